@@ -625,6 +625,12 @@ namespace Alchemy::Compilation {
                 TouchToken(p->operatorToken);
                 break;
             }
+            case SyntaxKind::BangExpression: {
+                PostfixUnaryExpressionSyntax* p = (PostfixUnaryExpressionSyntax*)syntaxBase;
+                TouchNode(p->expression);
+                TouchToken(p->operatorToken);
+                break;
+            }
 
             case SyntaxKind::ElementAccessExpression: {
                 ElementAccessExpressionSyntax* p = (ElementAccessExpressionSyntax*)syntaxBase;
@@ -1555,6 +1561,15 @@ namespace Alchemy::Compilation {
                 TouchToken(p->semiColon);
                 break;
             }
+            case SyntaxKind::UnknownAccessorDeclaration: {
+                AccessorDeclarationSyntax* p = (AccessorDeclarationSyntax*)syntaxBase;
+                TouchTokenList(p->modifiers);
+                TouchToken(p->keyword);
+                TouchNode(p->bodyBlock);
+                TouchNode(p->expressionBody);
+                TouchToken(p->semiColon);
+                break;
+            }
 
             case SyntaxKind::AccessorList: {
                 AccessorListSyntax* p = (AccessorListSyntax*)syntaxBase;
@@ -626,6 +626,12 @@ namespace Alchemy::Compilation {
                 if(p->operatorToken.IsValid()) return p->operatorToken;
                 return SyntaxToken();
             }
+            case SyntaxKind::BangExpression: {
+                PostfixUnaryExpressionSyntax* p = (PostfixUnaryExpressionSyntax*)syntaxBase;
+                if(p->expression != nullptr) return GetFirstToken((SyntaxBase*)p->expression);
+                if(p->operatorToken.IsValid()) return p->operatorToken;
+                return SyntaxToken();
+            }
 
             case SyntaxKind::ElementAccessExpression: {
                 ElementAccessExpressionSyntax* p = (ElementAccessExpressionSyntax*)syntaxBase;
@@ -1556,6 +1562,15 @@ namespace Alchemy::Compilation {
                 if(p->semiColon.IsValid()) return p->semiColon;
                 return SyntaxToken();
             }
+            case SyntaxKind::UnknownAccessorDeclaration: {
+                AccessorDeclarationSyntax* p = (AccessorDeclarationSyntax*)syntaxBase;
+                if(p->modifiers != nullptr && p->modifiers->size != 0) return p->modifiers->array[0];
+                if(p->keyword.IsValid()) return p->keyword;
+                if(p->bodyBlock != nullptr) return GetFirstToken((SyntaxBase*)p->bodyBlock);
+                if(p->expressionBody != nullptr) return GetFirstToken((SyntaxBase*)p->expressionBody);
+                if(p->semiColon.IsValid()) return p->semiColon;
+                return SyntaxToken();
+            }
 
             case SyntaxKind::AccessorList: {
                 AccessorListSyntax* p = (AccessorListSyntax*)syntaxBase;
@@ -2341,6 +2356,12 @@ namespace Alchemy::Compilation {
                 if(p->expression != nullptr) return GetLastToken((SyntaxBase*)p->expression);
                 return SyntaxToken();
             }
+            case SyntaxKind::BangExpression: {
+                PostfixUnaryExpressionSyntax* p = (PostfixUnaryExpressionSyntax*)syntaxBase;
+                if(p->operatorToken.IsValid()) return p->operatorToken;
+                if(p->expression != nullptr) return GetLastToken((SyntaxBase*)p->expression);
+                return SyntaxToken();
+            }
 
             case SyntaxKind::ElementAccessExpression: {
                 ElementAccessExpressionSyntax* p = (ElementAccessExpressionSyntax*)syntaxBase;
@@ -3319,6 +3340,15 @@ namespace Alchemy::Compilation {
                 if(p->modifiers != nullptr && p->modifiers->size != 0) return p->modifiers->array[p->modifiers->size - 1];
                 return SyntaxToken();
             }
+            case SyntaxKind::UnknownAccessorDeclaration: {
+                AccessorDeclarationSyntax* p = (AccessorDeclarationSyntax*)syntaxBase;
+                if(p->semiColon.IsValid()) return p->semiColon;
+                if(p->expressionBody != nullptr) return GetLastToken((SyntaxBase*)p->expressionBody);
+                if(p->bodyBlock != nullptr) return GetLastToken((SyntaxBase*)p->bodyBlock);
+                if(p->keyword.IsValid()) return p->keyword;
+                if(p->modifiers != nullptr && p->modifiers->size != 0) return p->modifiers->array[p->modifiers->size - 1];
+                return SyntaxToken();
+            }
 
             case SyntaxKind::AccessorList: {
                 AccessorListSyntax* p = (AccessorListSyntax*)syntaxBase;
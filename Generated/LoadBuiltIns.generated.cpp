@@ -2,7 +2,7 @@
 
 namespace Alchemy::Compilation {
 
-void LoadBuiltIns(PodList<SourceFileInfo*> * files, PoolAllocator<SourceFileInfo>* fileAllocator) {
+void LoadBuiltInSources(PodList<SourceFileInfo*> * files, PoolAllocator<SourceFileInfo>* fileAllocator) {
 files->Add(MakeBuiltInFile(fileAllocator, "builtin:array.wyx", R"xyz(
 namespace BuiltIn;
 
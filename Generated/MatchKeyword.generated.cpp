@@ -101,6 +101,7 @@ bool TryMatchKeyword_Generated(char * buffer, int32 length, TokenKind * keywordT
     char * truncatedBuffer = buffer + 2;
     switch(*(uint16*)buffer) {
         case 24930:
+                    if(length != 4) return false;
                     if(Matches2("se", truncatedBuffer)) { // BaseKeyword
                         *keywordType = TokenKind::BaseKeyword;
                         return true;
@@ -125,42 +126,49 @@ bool TryMatchKeyword_Generated(char * buffer, int32 length, TokenKind * keywordT
                 default: return false;
             }
         case 24934:
+                    if(length != 5) return false;
                     if(Matches3("lse", truncatedBuffer)) { // FalseKeyword
                         *keywordType = TokenKind::FalseKeyword;
                         return true;
                     }
                     return false;
         case 24942:
+                    if(length != 9) return false;
                     if(Matches7("mespace", truncatedBuffer)) { // NamespaceKeyword
                         *keywordType = TokenKind::NamespaceKeyword;
                         return true;
                     }
                     return false;
         case 24944:
+                    if(length != 6) return false;
                     if(Matches4("rams", truncatedBuffer)) { // ParamsKeyword
                         *keywordType = TokenKind::ParamsKeyword;
                         return true;
                     }
                     return false;
         case 24950:
+                    if(length != 3) return false;
                     if(truncatedBuffer[0] == 'r') { // VarKeyword
                         *keywordType = TokenKind::VarKeyword;
                         return true;
                     }
                     return false;
         case 25185:
+                    if(length != 8) return false;
                     if(Matches6("stract", truncatedBuffer)) { // AbstractKeyword
                         *keywordType = TokenKind::AbstractKeyword;
                         return true;
                     }
                     return false;
         case 25199:
+                    if(length != 6) return false;
                     if(Matches4("ject", truncatedBuffer)) { // ObjectKeyword
                         *keywordType = TokenKind::ObjectKeyword;
                         return true;
                     }
                     return false;
         case 25203:
+                    if(length != 5) return false;
                     if(Matches3("yte", truncatedBuffer)) { // SByteKeyword
                         *keywordType = TokenKind::SByteKeyword;
                         return true;
@@ -185,12 +193,14 @@ bool TryMatchKeyword_Generated(char * buffer, int32 length, TokenKind * keywordT
                 default: return false;
             }
         case 25959:
+                    if(length != 3) return false;
                     if(truncatedBuffer[0] == 't') { // GetKeyword
                         *keywordType = TokenKind::GetKeyword;
                         return true;
                     }
                     return false;
         case 25966:
+                    if(length != 3) return false;
                     if(truncatedBuffer[0] == 'w') { // NewKeyword
                         *keywordType = TokenKind::NewKeyword;
                         return true;
@@ -244,15 +254,18 @@ bool TryMatchKeyword_Generated(char * buffer, int32 length, TokenKind * keywordT
                 default: return false;
             }
         case 26217:
+                    if(length != 2) return false;
                     *keywordType = TokenKind::IfKeyword;
                     return true;                    return false;
         case 26723:
+                    if(length != 4) return false;
                     if(Matches2("ar", truncatedBuffer)) { // CharKeyword
                         *keywordType = TokenKind::CharKeyword;
                         return true;
                     }
                     return false;
         case 26739:
+                    if(length != 5) return false;
                     if(Matches3("ort", truncatedBuffer)) { // ShortKeyword
                         *keywordType = TokenKind::ShortKeyword;
                         return true;
@@ -299,6 +312,7 @@ bool TryMatchKeyword_Generated(char * buffer, int32 length, TokenKind * keywordT
                 default: return false;
             }
         case 26982:
+                    if(length != 7) return false;
                     if(Matches5("nally", truncatedBuffer)) { // FinallyKeyword
                         *keywordType = TokenKind::FinallyKeyword;
                         return true;
@@ -331,30 +345,35 @@ bool TryMatchKeyword_Generated(char * buffer, int32 length, TokenKind * keywordT
                 default: return false;
             }
         case 26998:
+                    if(length != 7) return false;
                     if(Matches5("rtual", truncatedBuffer)) { // VirtualKeyword
                         *keywordType = TokenKind::VirtualKeyword;
                         return true;
                     }
                     return false;
         case 26999:
+                    if(length != 4) return false;
                     if(Matches2("th", truncatedBuffer)) { // WithKeyword
                         *keywordType = TokenKind::WithKeyword;
                         return true;
                     }
                     return false;
         case 27001:
+                    if(length != 5) return false;
                     if(Matches3("eld", truncatedBuffer)) { // YieldKeyword
                         *keywordType = TokenKind::YieldKeyword;
                         return true;
                     }
                     return false;
         case 27747:
+                    if(length != 5) return false;
                     if(Matches3("ass", truncatedBuffer)) { // ClassKeyword
                         *keywordType = TokenKind::ClassKeyword;
                         return true;
                     }
                     return false;
         case 27749:
+                    if(length != 4) return false;
                     if(Matches2("se", truncatedBuffer)) { // ElseKeyword
                         *keywordType = TokenKind::ElseKeyword;
                         return true;
@@ -391,18 +410,21 @@ bool TryMatchKeyword_Generated(char * buffer, int32 length, TokenKind * keywordT
                 default: return false;
             }
         case 27765:
+                    if(length != 5) return false;
                     if(Matches3("ong", truncatedBuffer)) { // ULongKeyword
                         *keywordType = TokenKind::ULongKeyword;
                         return true;
                     }
                     return false;
         case 28009:
+                    if(length != 8) return false;
                     if(Matches6("plicit", truncatedBuffer)) { // ImplicitKeyword
                         *keywordType = TokenKind::ImplicitKeyword;
                         return true;
                     }
                     return false;
         case 28257:
+                    if(length != 3) return false;
                     if(truncatedBuffer[0] == 'd') { // AndKeyword
                         *keywordType = TokenKind::AndKeyword;
                         return true;
@@ -475,6 +497,7 @@ bool TryMatchKeyword_Generated(char * buffer, int32 length, TokenKind * keywordT
                 default: return false;
             }
         case 28514:
+                    if(length != 4) return false;
                     if(Matches2("ol", truncatedBuffer)) { // BoolKeyword
                         *keywordType = TokenKind::BoolKeyword;
                         return true;
@@ -557,12 +580,14 @@ bool TryMatchKeyword_Generated(char * buffer, int32 length, TokenKind * keywordT
                 default: return false;
             }
         case 28519:
+                    if(length != 4) return false;
                     if(Matches2("to", truncatedBuffer)) { // GotoKeyword
                         *keywordType = TokenKind::GotoKeyword;
                         return true;
                     }
                     return false;
         case 28524:
+                    if(length != 4) return false;
                     if(Matches2("ng", truncatedBuffer)) { // LongKeyword
                         *keywordType = TokenKind::LongKeyword;
                         return true;
@@ -573,36 +598,42 @@ bool TryMatchKeyword_Generated(char * buffer, int32 length, TokenKind * keywordT
                     }
                     return false;
         case 28526:
+                    if(length != 3) return false;
                     if(truncatedBuffer[0] == 't') { // NotKeyword
                         *keywordType = TokenKind::NotKeyword;
                         return true;
                     }
                     return false;
         case 28534:
+                    if(length != 4) return false;
                     if(Matches2("id", truncatedBuffer)) { // VoidKeyword
                         *keywordType = TokenKind::VoidKeyword;
                         return true;
                     }
                     return false;
         case 28783:
+                    if(length != 8) return false;
                     if(Matches6("erator", truncatedBuffer)) { // OperatorKeyword
                         *keywordType = TokenKind::OperatorKeyword;
                         return true;
                     }
                     return false;
         case 29282:
+                    if(length != 5) return false;
                     if(Matches3("eak", truncatedBuffer)) { // BreakKeyword
                         *keywordType = TokenKind::BreakKeyword;
                         return true;
                     }
                     return false;
         case 29286:
+                    if(length != 4) return false;
                     if(Matches2("om", truncatedBuffer)) { // FromKeyword
                         *keywordType = TokenKind::FromKeyword;
                         return true;
                     }
                     return false;
         case 29295:
+                    if(length != 2) return false;
                     *keywordType = TokenKind::OrKeyword;
                     return true;                    return false;
         case 29296:
@@ -642,9 +673,11 @@ bool TryMatchKeyword_Generated(char * buffer, int32 length, TokenKind * keywordT
                 default: return false;
             }
         case 29537:
+                    if(length != 2) return false;
                     *keywordType = TokenKind::AsKeyword;
                     return true;                    return false;
         case 29545:
+                    if(length != 2) return false;
                     *keywordType = TokenKind::IsKeyword;
                     return true;                    return false;
         case 29557:
@@ -666,6 +699,7 @@ bool TryMatchKeyword_Generated(char * buffer, int32 length, TokenKind * keywordT
                 default: return false;
             }
         case 29811:
+                    if(length != 6) return false;
                     if(Matches4("ring", truncatedBuffer)) { // StringKeyword
                         *keywordType = TokenKind::StringKeyword;
                         return true;
@@ -680,42 +714,49 @@ bool TryMatchKeyword_Generated(char * buffer, int32 length, TokenKind * keywordT
                     }
                     return false;
         case 30062:
+                    if(length != 4) return false;
                     if(Matches2("ll", truncatedBuffer)) { // NullKeyword
                         *keywordType = TokenKind::NullKeyword;
                         return true;
                     }
                     return false;
         case 30063:
+                    if(length != 3) return false;
                     if(truncatedBuffer[0] == 't') { // OutKeyword
                         *keywordType = TokenKind::OutKeyword;
                         return true;
                     }
                     return false;
         case 30064:
+                    if(length != 6) return false;
                     if(Matches4("blic", truncatedBuffer)) { // PublicKeyword
                         *keywordType = TokenKind::PublicKeyword;
                         return true;
                     }
                     return false;
         case 30068:
+                    if(length != 5) return false;
                     if(Matches3("ple", truncatedBuffer)) { // TupleKeyword
                         *keywordType = TokenKind::TupleKeyword;
                         return true;
                     }
                     return false;
         case 30319:
+                    if(length != 8) return false;
                     if(Matches6("erride", truncatedBuffer)) { // OverrideKeyword
                         *keywordType = TokenKind::OverrideKeyword;
                         return true;
                     }
                     return false;
         case 30579:
+                    if(length != 6) return false;
                     if(Matches4("itch", truncatedBuffer)) { // SwitchKeyword
                         *keywordType = TokenKind::SwitchKeyword;
                         return true;
                     }
                     return false;
         case 30821:
+                    if(length != 6) return false;
                     if(Matches4("port", truncatedBuffer)) { // ExportKeyword
                         *keywordType = TokenKind::ExportKeyword;
                         return true;
@@ -726,18 +767,21 @@ bool TryMatchKeyword_Generated(char * buffer, int32 length, TokenKind * keywordT
                     }
                     return false;
         case 31074:
+                    if(length != 4) return false;
                     if(Matches2("te", truncatedBuffer)) { // ByteKeyword
                         *keywordType = TokenKind::ByteKeyword;
                         return true;
                     }
                     return false;
         case 31076:
+                    if(length != 7) return false;
                     if(Matches5("namic", truncatedBuffer)) { // DynamicKeyword
                         *keywordType = TokenKind::DynamicKeyword;
                         return true;
                     }
                     return false;
         case 31092:
+                    if(length != 6) return false;
                     if(Matches4("peof", truncatedBuffer)) { // TypeofKeyword
                         *keywordType = TokenKind::TypeofKeyword;
                         return true;
@@ -1092,6 +1092,17 @@ namespace Alchemy::Compilation {
                 indent--;
                 break;
             }
+            case SyntaxKind::BangExpression: {
+                PostfixUnaryExpressionSyntax* p = (PostfixUnaryExpressionSyntax*)syntaxBase;
+                PrintNodeHeader("PostfixUnaryExpressionSyntax", syntaxBase);
+                indent++;
+                PrintFieldName("expression");
+                PrintNode(p->expression);
+                PrintFieldName("operatorToken");
+                PrintToken(p->operatorToken);
+                indent--;
+                break;
+            }
 
             case SyntaxKind::ElementAccessExpression: {
                 ElementAccessExpressionSyntax* p = (ElementAccessExpressionSyntax*)syntaxBase;
@@ -2765,6 +2776,23 @@ namespace Alchemy::Compilation {
                 indent--;
                 break;
             }
+            case SyntaxKind::UnknownAccessorDeclaration: {
+                AccessorDeclarationSyntax* p = (AccessorDeclarationSyntax*)syntaxBase;
+                PrintNodeHeader("AccessorDeclarationSyntax", syntaxBase);
+                indent++;
+                PrintFieldName("modifiers");
+                PrintTokenList(p->modifiers);
+                PrintFieldName("keyword");
+                PrintToken(p->keyword);
+                PrintFieldName("bodyBlock");
+                PrintNode(p->bodyBlock);
+                PrintFieldName("expressionBody");
+                PrintNode(p->expressionBody);
+                PrintFieldName("semiColon");
+                PrintToken(p->semiColon);
+                indent--;
+                break;
+            }
 
             case SyntaxKind::AccessorList: {
                 AccessorListSyntax* p = (AccessorListSyntax*)syntaxBase;
@@ -46,6 +46,7 @@ namespace Alchemy::Compilation {
             case SyntaxKind::GetAccessorDeclaration: return "GetAccessorDeclaration";
             case SyntaxKind::SetAccessorDeclaration: return "SetAccessorDeclaration";
             case SyntaxKind::InitAccessorDeclaration: return "InitAccessorDeclaration";
+            case SyntaxKind::UnknownAccessorDeclaration: return "UnknownAccessorDeclaration";
             case SyntaxKind::TypeArgumentList: return "TypeArgumentList";
             case SyntaxKind::VariableDeclarator: return "VariableDeclarator";
             case SyntaxKind::__PATTERN_START__: return "__PATTERN_START__";
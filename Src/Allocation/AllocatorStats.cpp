@@ -0,0 +1,142 @@
+#include "./AllocatorStats.h"
+#include "./LinearAllocator.h"
+#include <mutex>
+#include <cstdio>
+
+namespace Alchemy {
+
+#if ALCHEMY_ALLOCATOR_STATS != 0
+
+    static std::mutex s_RegistryMutex;
+    static AllocatorStats* s_Registry;
+
+    AllocatorStats::AllocatorStats(const char* name, void* owner, AllocatorStatsUpdateFn update)
+        : name(name)
+        , owner(owner)
+        , update(update)
+        , committedBytes(0)
+        , usedBytes(0)
+        , peakUsedBytes(0)
+        , allocationCount(0)
+        , sizeClassCounts()
+        , prev(nullptr)
+        , next(nullptr) {
+        std::unique_lock lock(s_RegistryMutex);
+        next = s_Registry;
+        if (s_Registry != nullptr) {
+            s_Registry->prev = this;
+        }
+        s_Registry = this;
+    }
+
+    AllocatorStats::~AllocatorStats() {
+        std::unique_lock lock(s_RegistryMutex);
+        if (prev != nullptr) {
+            prev->next = next;
+        }
+        else {
+            s_Registry = next;
+        }
+        if (next != nullptr) {
+            next->prev = prev;
+        }
+    }
+
+    void SnapshotAllocatorStats(PodList<AllocatorStatsSnapshot>* snapshots) {
+
+        snapshots->size = 0;
+
+        // counters aren't atomic, take snapshots between compiles when no jobs are running
+        std::unique_lock lock(s_RegistryMutex);
+
+        for (AllocatorStats* stats = s_Registry; stats != nullptr; stats = stats->next) {
+
+            if (stats->update != nullptr) {
+                stats->update(stats);
+            }
+
+            const char* name = stats->name != nullptr ? stats->name : "unnamed";
+
+            AllocatorStatsSnapshot* snapshot = nullptr;
+            for (int32 i = 0; i < snapshots->size; i++) {
+                if (strcmp(snapshots->array[i].name, name) == 0) {
+                    snapshot = &snapshots->array[i];
+                    break;
+                }
+            }
+
+            if (snapshot == nullptr) {
+                snapshot = snapshots->Reserve();
+                memset(snapshot, 0, sizeof(AllocatorStatsSnapshot));
+                snapshot->name = name;
+            }
+
+            snapshot->allocatorCount++;
+            snapshot->committedBytes += stats->committedBytes;
+            snapshot->usedBytes += stats->usedBytes;
+            snapshot->peakUsedBytes += stats->peakUsedBytes;
+            snapshot->allocationCount += stats->allocationCount;
+            for (int32 i = 0; i < kAllocatorSizeClassCount; i++) {
+                snapshot->sizeClassCounts[i] += stats->sizeClassCounts[i];
+            }
+
+        }
+
+    }
+
+#else
+
+    void SnapshotAllocatorStats(PodList<AllocatorStatsSnapshot>* snapshots) {
+        snapshots->size = 0;
+    }
+
+#endif
+
+    FixedCharSpan AllocatorStatsToJson(CheckedArray<AllocatorStatsSnapshot> snapshots, Allocator allocator) {
+
+        // names are short identifiers, 160 covers the numbers in one entry with plenty of room
+        size_t capacity = 32;
+        for (int32 i = 0; i < snapshots.size; i++) {
+            capacity += strlen(snapshots[i].name) + 160 + kAllocatorSizeClassCount * 21;
+        }
+
+        char* buffer = allocator.AllocateUncleared<char>(capacity);
+        char* p = buffer;
+        char* end = buffer + capacity;
+
+        p += snprintf(p, end - p, "[");
+
+        for (int32 i = 0; i < snapshots.size; i++) {
+            AllocatorStatsSnapshot* s = &snapshots.array[i];
+
+            p += snprintf(p, end - p,
+                "%s\n  {\"name\": \"%s\", \"allocators\": %d, \"committed\": %llu, \"used\": %llu, \"peak\": %llu, \"allocations\": %lld, \"sizeClasses\": [",
+                i == 0 ? "" : ",",
+                s->name,
+                s->allocatorCount,
+                (unsigned long long) s->committedBytes,
+                (unsigned long long) s->usedBytes,
+                (unsigned long long) s->peakUsedBytes,
+                (long long) s->allocationCount
+            );
+
+            for (int32 c = 0; c < kAllocatorSizeClassCount; c++) {
+                p += snprintf(p, end - p, c == 0 ? "%lld" : ", %lld", (long long) s->sizeClassCounts[c]);
+            }
+
+            p += snprintf(p, end - p, "]}");
+        }
+
+        p += snprintf(p, end - p, "\n]\n");
+
+        // hand back an exact size (plus terminator) so the caller can free it with the span's size
+        size_t length = p - buffer;
+        char* retn = allocator.AllocateUncleared<char>(length + 1);
+        memcpy(retn, buffer, length + 1);
+        allocator.Free(buffer, capacity);
+
+        return FixedCharSpan(retn, length);
+
+    }
+
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "../PrimitiveTypes.h"
+#include "../Collections/PodList.h"
+#include "../Util/FixedCharSpan.h"
+#include "../Util/MathUtil.h"
+
+// build with ALCHEMY_ALLOCATOR_STATS=1 to track how much every allocator commits and uses. when it is 0 the
+// members, registration and counting compile away entirely and SetStatsName is an empty inline
+#ifndef ALCHEMY_ALLOCATOR_STATS
+#define ALCHEMY_ALLOCATOR_STATS 0
+#endif
+
+#if ALCHEMY_ALLOCATOR_STATS != 0
+#define ALLOCATOR_STATS(x) x
+#else
+#define ALLOCATOR_STATS(x)
+#endif
+
+namespace Alchemy {
+
+    class Allocator;
+
+    // pow2 buckets, [0] is <= 16 bytes, [kAllocatorSizeClassCount - 1] is everything >= 1mb
+    constexpr int32 kAllocatorSizeClassCount = 18;
+
+    struct AllocatorStats;
+
+    // refreshes committed & used bytes from the owning allocator right before a snapshot
+    typedef void (* AllocatorStatsUpdateFn)(AllocatorStats* stats);
+
+    struct AllocatorStats {
+
+        const char* name;
+        void* owner;
+        AllocatorStatsUpdateFn update;
+
+        size_t committedBytes;
+        size_t usedBytes;
+        size_t peakUsedBytes;
+        int64 allocationCount;
+        int64 sizeClassCounts[kAllocatorSizeClassCount];
+
+        AllocatorStats* prev;
+        AllocatorStats* next;
+
+        AllocatorStats(const char* name, void* owner, AllocatorStatsUpdateFn update);
+
+        ~AllocatorStats();
+
+        AllocatorStats(const AllocatorStats&) = delete;
+        AllocatorStats& operator=(const AllocatorStats&) = delete;
+
+        inline void RecordAllocation(size_t bytes) {
+            allocationCount++;
+            int32 sizeClass = bytes <= 16 ? 0 : MathUtil::FloorLog2((uint64) bytes - 1) - 3;
+            sizeClassCounts[sizeClass < kAllocatorSizeClassCount ? sizeClass : kAllocatorSizeClassCount - 1]++;
+        }
+
+        inline void RecordUsed(size_t bytes) {
+            usedBytes = bytes;
+            peakUsedBytes = bytes > peakUsedBytes ? bytes : peakUsedBytes;
+        }
+
+    };
+
+    // allocators with the same name are summed, there is one entry per name
+    struct AllocatorStatsSnapshot {
+
+        const char* name;
+        int32 allocatorCount;
+        size_t committedBytes;
+        size_t usedBytes;
+        size_t peakUsedBytes; // sum of each allocator's own peak
+        int64 allocationCount;
+        int64 sizeClassCounts[kAllocatorSizeClassCount];
+
+    };
+
+    // no-op when stats are compiled out
+    void SnapshotAllocatorStats(PodList<AllocatorStatsSnapshot>* snapshots);
+
+    // the result is null terminated, free it with size + 1 bytes
+    FixedCharSpan AllocatorStatsToJson(CheckedArray<AllocatorStatsSnapshot> snapshots, Allocator allocator);
+
+}
@@ -0,0 +1,229 @@
+#include "./ArenaPool.h"
+#include "../Panic.h"
+
+#if defined(_WIN32)
+
+#define WIN32_LEAN_AND_MEAN
+
+#include <windows.h>
+
+#else
+
+#include <sys/mman.h>
+#include <cerrno>
+
+#endif
+
+namespace Alchemy {
+
+    // commits are rounded up to this, it only costs syscalls on windows where committing isn't free
+    static constexpr size_t kCommitGranularity = 64 * 1024;
+
+    ArenaPool::ArenaPool(size_t slabSize, int32 slabsPerReservation, size_t residentCap)
+        : slabSize((slabSize + kCommitGranularity - 1) & ~(kCommitGranularity - 1))
+        , slabsPerReservation(slabsPerReservation)
+        , residentCap(residentCap)
+        , freeResidentBytes(0)
+        , slabCount(0)
+        , freeSlabCount(0)
+        , warmList(nullptr)
+        , coldList(nullptr)
+        , reservations(4)
+        , slabBlocks(4)
+        , mutex() {}
+
+    ArenaPool::~ArenaPool() {
+        for (int32 i = 0; i < reservations.size; i++) {
+#if defined(_WIN32)
+            VirtualFree(reservations[i], 0, MEM_RELEASE);
+#else
+            munmap(reservations[i], slabSize * slabsPerReservation);
+#endif
+        }
+        for (int32 i = 0; i < slabBlocks.size; i++) {
+            MfreeTyped(slabBlocks[i], slabsPerReservation);
+        }
+    }
+
+    void ArenaPool::AddReservation() {
+
+        size_t size = slabSize * slabsPerReservation;
+
+#if defined(_WIN32)
+        uint8* base = (uint8*) VirtualAlloc(nullptr, size, MEM_RESERVE, PAGE_READWRITE);
+#else
+        // mapped read/write up front with no swap reservation, pages only cost something once touched. this keeps
+        // the whole reservation as one mapping instead of splitting it every time an allocator commits more memory
+        uint8* base = (uint8*) mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (base == (uint8*) MAP_FAILED) {
+            base = nullptr;
+        }
+#endif
+
+        if (base == nullptr) {
+            Panic(PanicType::NotSupported, nullptr);
+            return;
+        }
+
+        reservations.Add(base);
+
+        ArenaSlab* slabs = MallocateTyped(ArenaSlab, slabsPerReservation);
+        slabBlocks.Add(slabs);
+
+        // push in reverse so slabs are handed out front to back
+        for (int32 i = slabsPerReservation - 1; i >= 0; i--) {
+            slabs[i].base = base + slabSize * i;
+            slabs[i].committed = 0;
+            slabs[i].isCold = false;
+            slabs[i].next = coldList;
+            coldList = &slabs[i];
+        }
+
+        slabCount += slabsPerReservation;
+        freeSlabCount += slabsPerReservation;
+
+    }
+
+    ArenaSlab* ArenaPool::Borrow() {
+
+        std::unique_lock lock(mutex);
+
+        // prefer a slab whose pages are still resident
+        ArenaSlab* slab = warmList;
+
+        if (slab != nullptr) {
+            warmList = slab->next;
+            freeResidentBytes -= slab->committed;
+        }
+        else {
+            if (coldList == nullptr) {
+                AddReservation();
+            }
+            slab = coldList;
+            coldList = slab->next;
+        }
+
+        freeSlabCount--;
+        slab->next = nullptr;
+        slab->isCold = false;
+        return slab;
+
+    }
+
+    void ArenaPool::ReleasePages(ArenaSlab* slab) {
+
+        if (slab->committed == 0) {
+            return;
+        }
+
+#if defined(_WIN32)
+        VirtualFree(slab->base, slab->committed, MEM_DECOMMIT);
+        slab->committed = 0;
+#else
+
+#if defined(MADV_FREE)
+        // lazily reclaimed, pages we get back before the os needs them cost nothing
+        if (madvise(slab->base, slab->committed, MADV_FREE) != 0 && errno == EINVAL) {
+            madvise(slab->base, slab->committed, MADV_DONTNEED);
+        }
+#else
+        madvise(slab->base, slab->committed, MADV_DONTNEED);
+#endif
+
+#endif
+
+        slab->isCold = true;
+
+    }
+
+    void ArenaPool::Return(ArenaSlab* slab) {
+
+        std::unique_lock lock(mutex);
+
+        freeSlabCount++;
+
+        if (freeResidentBytes + slab->committed > residentCap) {
+            ReleasePages(slab);
+            slab->next = coldList;
+            coldList = slab;
+            return;
+        }
+
+        freeResidentBytes += slab->committed;
+        slab->next = warmList;
+        warmList = slab;
+
+    }
+
+    bool ArenaPool::Commit(ArenaSlab* slab, size_t size) {
+
+        if (size > slabSize) {
+            return false;
+        }
+
+        if (size <= slab->committed) {
+            return true;
+        }
+
+        size = (size + kCommitGranularity - 1) & ~(kCommitGranularity - 1);
+        size = size > slabSize ? slabSize : size;
+
+#if defined(_WIN32)
+        if (!VirtualAlloc(slab->base + slab->committed, size - slab->committed, MEM_COMMIT, PAGE_READWRITE)) {
+            return false;
+        }
+#endif
+
+        slab->committed = size;
+        return true;
+
+    }
+
+    void ArenaPool::SetResidentCap(size_t bytes) {
+
+        std::unique_lock lock(mutex);
+
+        residentCap = bytes;
+
+        while (freeResidentBytes > residentCap && warmList != nullptr) {
+            ArenaSlab* slab = warmList;
+            warmList = slab->next;
+            freeResidentBytes -= slab->committed;
+            ReleasePages(slab);
+            slab->next = coldList;
+            coldList = slab;
+        }
+
+    }
+
+    size_t ArenaPool::GetSlabSize() {
+        return slabSize;
+    }
+
+    int32 ArenaPool::GetSlabCount() {
+        std::unique_lock lock(mutex);
+        return slabCount;
+    }
+
+    int32 ArenaPool::GetFreeSlabCount() {
+        std::unique_lock lock(mutex);
+        return freeSlabCount;
+    }
+
+    int32 ArenaPool::GetReservationCount() {
+        std::unique_lock lock(mutex);
+        return reservations.size;
+    }
+
+    size_t ArenaPool::GetFreeResidentBytes() {
+        std::unique_lock lock(mutex);
+        return freeResidentBytes;
+    }
+
+    ArenaPool* GetSourceFileArenaPool() {
+        // 256mb of address space per file, 64 files per mapping. keep up to 256mb of warm pages around for re-parses
+        static ArenaPool pool(MEGABYTES(256), 64, MEGABYTES(256));
+        return &pool;
+    }
+
+}
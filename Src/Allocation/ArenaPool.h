@@ -0,0 +1,74 @@
+#pragma once
+
+#include "../PrimitiveTypes.h"
+#include "../Collections/PodList.h"
+#include <mutex>
+
+namespace Alchemy {
+
+    struct ArenaSlab {
+        uint8* base;
+        size_t committed; // high water mark, everything below this has been committed (and possibly touched)
+        ArenaSlab* next;
+        bool isCold; // pages were handed back to the os, they refault as zeroes
+    };
+
+    // Fixed size address ranges that linear allocators borrow instead of reserving their own. Slabs are carved out
+    // of a few large reservations so a project with tens of thousands of files doesn't need one mapping per file,
+    // and a returned slab keeps its committed pages so the next file to borrow it doesn't commit or fault them again.
+    // Once the free slabs hold more than residentCap bytes, further returns give their pages back with MADV_FREE.
+    class ArenaPool {
+
+    public:
+
+        ArenaPool(size_t slabSize, int32 slabsPerReservation, size_t residentCap);
+
+        ~ArenaPool();
+
+        ArenaPool(const ArenaPool&) = delete;
+        ArenaPool& operator=(const ArenaPool&) = delete;
+
+        ArenaSlab* Borrow();
+
+        void Return(ArenaSlab* slab);
+
+        // makes sure bytes [0, size) of the slab are usable, returns false if size doesn't fit in a slab
+        bool Commit(ArenaSlab* slab, size_t size);
+
+        void SetResidentCap(size_t bytes);
+
+        size_t GetSlabSize();
+
+        int32 GetSlabCount();
+
+        int32 GetFreeSlabCount();
+
+        int32 GetReservationCount();
+
+        // committed bytes sitting in free (warm) slabs
+        size_t GetFreeResidentBytes();
+
+    private:
+
+        size_t slabSize;
+        int32 slabsPerReservation;
+        size_t residentCap;
+        size_t freeResidentBytes;
+        int32 slabCount;
+        int32 freeSlabCount;
+        ArenaSlab* warmList;
+        ArenaSlab* coldList;
+        PodList<uint8*> reservations;
+        PodList<ArenaSlab*> slabBlocks;
+        std::mutex mutex;
+
+        void AddReservation();
+
+        void ReleasePages(ArenaSlab* slab);
+
+    };
+
+    // shared by every SourceFileInfo
+    ArenaPool* GetSourceFileArenaPool();
+
+}
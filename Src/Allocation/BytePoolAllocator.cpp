@@ -18,14 +18,14 @@ namespace Alchemy {
         *blk = b;
     }
 
-    void* AllocateBlock(BytePoolAllocator::Block** ptr, size_t allocSize, LinearAllocator* allocator) {
+    void* AllocateBlock(BytePoolAllocator::Block** ptr, size_t allocSize, BytePoolAllocator* pool) {
         if (*ptr == nullptr) {
-            return allocator->AllocateUncleared<uint8>(allocSize);
+            ALLOCATOR_STATS(pool->stats.committedBytes += allocSize;)
+            return pool->allocator->AllocateUncleared<uint8>(allocSize);
         }
+        // always pop, the last block used to stay at the head and get handed out twice
         BytePoolAllocator::Block* retnBlock = *ptr;
-        if (retnBlock->next != nullptr) {
-            *ptr = retnBlock->next;
-        }
+        *ptr = retnBlock->next;
         return retnBlock;
     }
 
@@ -53,24 +53,28 @@ namespace Alchemy {
             allocBytes = 32;
         }
 
+        ALLOCATOR_STATS(stats.RecordAllocation(bytes);)
+        ALLOCATOR_STATS(stats.RecordUsed(stats.usedBytes + (allocBytes > 4096 ? bytes : allocBytes));)
+
         switch (allocBytes) {
             case 32:
-                return AllocateBlock(&b32, allocBytes, allocator);
+                return AllocateBlock(&b32, allocBytes, this);
             case 64:
-                return AllocateBlock(&b64, allocBytes, allocator);
+                return AllocateBlock(&b64, allocBytes, this);
             case 128:
-                return AllocateBlock(&b128, allocBytes, allocator);
+                return AllocateBlock(&b128, allocBytes, this);
             case 256:
-                return AllocateBlock(&b256, allocBytes, allocator);
+                return AllocateBlock(&b256, allocBytes, this);
             case 512:
-                return AllocateBlock(&b512, allocBytes, allocator);
+                return AllocateBlock(&b512, allocBytes, this);
             case 1024:
-                return AllocateBlock(&b1024, allocBytes, allocator);
+                return AllocateBlock(&b1024, allocBytes, this);
             case 2048:
-                return AllocateBlock(&b2048, allocBytes, allocator);
+                return AllocateBlock(&b2048, allocBytes, this);
             case 4096:
-                return AllocateBlock(&b4096, allocBytes, allocator);
+                return AllocateBlock(&b4096, allocBytes, this);
             default:
+                ALLOCATOR_STATS(stats.committedBytes += bytes;)
                 return allocator->AllocateUncleared<uint8>(bytes);
         }
     }
@@ -82,6 +86,8 @@ namespace Alchemy {
             allocBytes = 32;
         }
 
+        ALLOCATOR_STATS(stats.usedBytes -= allocBytes > 4096 ? bytes : allocBytes;)
+
         switch (allocBytes) {
             case 32:
                 return FreeBlock(&b32, ptr);
@@ -19,6 +19,15 @@ namespace Alchemy {
         Block* b4096;
         LinearAllocator * allocator;
 
+#if ALCHEMY_ALLOCATOR_STATS != 0
+        // committed is what we carved out of the backing allocator, used is what is handed out right now
+        AllocatorStats stats { "BytePoolAllocator", this, nullptr };
+#endif
+
+        inline void SetStatsName(const char* name) {
+            ALLOCATOR_STATS(stats.name = name;)
+        }
+
         explicit BytePoolAllocator(LinearAllocator * allocator);
 
         void * Allocate(size_t bytes);
@@ -1,5 +1,8 @@
 #include "./LinearAllocator.h"
+#include "./ArenaPool.h"
+#include "../Panic.h"
 #include <cstdint>
+#include <cstdio>
 
 #if defined(_WIN32)
 
@@ -25,6 +28,7 @@ static size_t kPageSize = []() {
 #else
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
 #include <fcntl.h>
 #include <unistd.h>
 
@@ -37,6 +41,8 @@ static size_t kPageSize = []() {
 #endif
 
 static constexpr size_t kGigabyte = 1073741824;
+static constexpr size_t kHugePageSize = 2 * 1024 * 1024;
+static constexpr size_t kMaxGeometricCommitStep = 64 * 1024 * 1024;
 
 static size_t Ceilpow2(size_t x) {
     x -= 1;
@@ -65,29 +71,160 @@ size_t ComputeMinCommitSize(size_t declaredSize) {
 }
 
 namespace Alchemy {
-    LinearAllocator::LinearAllocator(size_t reserveSize, size_t commitSize)
+    LinearAllocator::LinearAllocator(size_t reserveSize, size_t commitSize, LinearAllocatorFlags flags)
         : reserved(reserveSize)
         , committed(0)
+        , peakOffset(0)
         , base()
         , offset(0)
-        , minCommitStep(ComputeMinCommitSize(commitSize)) {
+        , minCommitStep(ComputeMinCommitSize(commitSize))
+        , pool(nullptr)
+        , slab(nullptr)
+        , flags(flags) {
         // reserve at least 1 gb
         if (reserved < kGigabyte) {
             reserved = kGigabyte;
         }
 
 #if defined(_WIN32)
+        // large pages on windows need SeLockMemoryPrivilege and can't be committed incrementally, ignore the flag
+        this->flags &= ~LinearAllocatorFlags::HugePages;
         base = (uint8*) VirtualAlloc(nullptr, reserved, MEM_RESERVE, PAGE_READWRITE);
 #else
-        base = (uint8*)mmap(nullptr, reserved, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        uint8* unaligned = (uint8*) MAP_FAILED;
+
+        if ((flags & LinearAllocatorFlags::HugePages) != 0) {
+            // over-reserve by one huge page and trim both ends so the range starts on a 2mb boundary
+            size_t hugeReserved = (reserved + kHugePageSize - 1) & ~(kHugePageSize - 1);
+            unaligned = (uint8*) mmap(nullptr, hugeReserved + kHugePageSize, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (unaligned == (uint8*) MAP_FAILED) {
+                // no room for the extra huge page, take a plain reservation instead
+                this->flags &= ~LinearAllocatorFlags::HugePages;
+            }
+            else {
+                reserved = hugeReserved;
+            }
+        }
+
+        if (unaligned != (uint8*) MAP_FAILED) {
+            base = (uint8*) (((size_t) unaligned + kHugePageSize - 1) & ~(kHugePageSize - 1));
+            size_t head = base - unaligned;
+            if (head != 0) {
+                munmap(unaligned, head);
+            }
+            munmap(base + reserved, kHugePageSize - head);
+            minCommitStep = (minCommitStep + kHugePageSize - 1) & ~(kHugePageSize - 1);
+#if defined(MADV_HUGEPAGE)
+            madvise(base, reserved, MADV_HUGEPAGE);
+#endif
+        }
+        else {
+            base = (uint8*) mmap(nullptr, reserved, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (base == (uint8*) MAP_FAILED) {
+                base = nullptr;
+            }
+        }
 #endif
 
+        if (base == nullptr) {
+            static char message[128];
+            snprintf(message, sizeof(message), "failed to reserve %zu bytes of address space for a linear allocator", reserved);
+            fprintf(stderr, "%s\n", message);
+            Panic(PanicType::NotSupported, message);
+        }
+
+    }
+
+    LinearAllocator::LinearAllocator(ArenaPool* pool)
+        : reserved(pool->GetSlabSize())
+        , committed(0)
+        , peakOffset(0)
+        , base(nullptr)
+        , offset(0)
+        , minCommitStep(0)
+        , pool(pool)
+        , slab(nullptr)
+        , flags(LinearAllocatorFlags::None) {}
+
+    void LinearAllocator::BorrowSlab() {
+        slab = pool->Borrow();
+        base = slab->base;
+        committed = slab->committed;
+    }
+
+    void LinearAllocator::Release() {
+        offset = 0;
+
+        if (slab == nullptr) {
+            return;
+        }
+
+        pool->Return(slab);
+        slab = nullptr;
+        base = nullptr;
+        committed = 0;
     }
 
-    TempAllocator::TempAllocator(size_t reservation, size_t commitSize)
-        : LinearAllocator(reservation, commitSize) {}
+    TempAllocator::TempAllocator(size_t reservation, size_t commitSize, LinearAllocatorFlags flags)
+        : LinearAllocator(reservation, commitSize, flags)
+        , resetPolicy()
+        , runStats()
+        , lowUsageStreak(0)
+        , streakPeak(0) {
+        SetStatsName("TempAllocator");
+    }
+
+    void TempAllocator::EndRun() {
+
+        size_t peak = ResetPeak();
+
+        runStats.runCount++;
+        runStats.lastPeakBytes = peak;
+        runStats.maxPeakBytes = peak > runStats.maxPeakBytes ? peak : runStats.maxPeakBytes;
+
+        if (resetPolicy.lowUsageRuns <= 0) {
+            return;
+        }
+
+        if (committed <= resetPolicy.warmBytes || peak >= committed / 2) {
+            lowUsageStreak = 0;
+            streakPeak = 0;
+            return;
+        }
+
+        streakPeak = peak > streakPeak ? peak : streakPeak;
+
+        if (++lowUsageStreak < resetPolicy.lowUsageRuns) {
+            return;
+        }
+
+        // keep what the recent runs actually needed
+        size_t keep = streakPeak > resetPolicy.warmBytes ? streakPeak : resetPolicy.warmBytes;
+        size_t released = Decommit(keep);
+
+        if (released != 0) {
+            runStats.decommitCount++;
+            runStats.decommittedBytes += released;
+        }
+
+        lowUsageStreak = 0;
+        streakPeak = 0;
+
+    }
+
+#if ALCHEMY_ALLOCATOR_STATS != 0
+    void LinearAllocator::UpdateStats(AllocatorStats* stats) {
+        LinearAllocator* allocator = (LinearAllocator*) stats->owner;
+        stats->committedBytes = allocator->committed;
+        stats->usedBytes = allocator->offset;
+    }
+#endif
 
     LinearAllocator::~LinearAllocator() {
+        if (pool != nullptr) {
+            Release();
+            return;
+        }
         if (base == nullptr) {
             return;
         }
@@ -108,6 +245,11 @@ namespace Alchemy {
             alignment = Ceilpow2(alignment);
         }
 
+        // pooled allocators only hold a slab while they have something in it
+        if (base == nullptr && pool != nullptr) {
+            BorrowSlab();
+        }
+
         uint8* unalignedptr = base + offset;
         uint8* alignedptr = reinterpret_cast<uint8*>((reinterpret_cast<size_t>(unalignedptr) + alignment - 1) & ~(alignment - 1));
 
@@ -115,23 +257,135 @@ namespace Alchemy {
 
         offset += size + alignmentDiff;
 
-        if (offset > committed) {
-            size_t growBy = offset - committed;
-            growBy = growBy < minCommitStep ? minCommitStep : growBy;
-            growBy = (growBy + kPageSize - 1) & ~(kPageSize - 1); // round to page size
-#if defined(_WIN32)
-            if (!VirtualAlloc(base + committed, growBy, MEM_COMMIT, PAGE_READWRITE)) {
+        if (offset > peakOffset) {
+            peakOffset = offset;
+        }
+
+        ALLOCATOR_STATS(stats.RecordAllocation(size);)
+        ALLOCATOR_STATS(stats.RecordUsed(offset);)
+
+        if (offset > committed && pool != nullptr) {
+            // slabs are fixed size and what's in them can't move, there is nothing to fall back to
+            if (!pool->Commit(slab, offset)) {
+                static char message[256];
+                snprintf(message, sizeof(message), "a pooled arena needs %zu bytes but its slab only holds %zu, give the pool bigger slabs", offset, pool->GetSlabSize());
+                fprintf(stderr, "%s\n", message);
+                Panic(PanicType::NotSupported, message);
+            }
+            committed = slab->committed;
+        }
+        else if (offset > committed) {
+            if (!Commit(offset - committed)) {
                 return nullptr; // abort?
             }
+        }
+
+        return (uint8*) alignedptr;
+    }
+
+    bool LinearAllocator::Commit(size_t growBy) {
+
+        size_t required = growBy;
+
+        growBy = growBy < minCommitStep ? minCommitStep : growBy;
+
+        if ((flags & LinearAllocatorFlags::GeometricCommit) != 0) {
+            size_t geometric = committed < kMaxGeometricCommitStep ? committed : kMaxGeometricCommitStep;
+            growBy = growBy < geometric ? geometric : growBy;
+        }
+
+        size_t granularity = (flags & LinearAllocatorFlags::HugePages) != 0 ? kHugePageSize : kPageSize;
+        growBy = (growBy + granularity - 1) & ~(granularity - 1); // round to page size
+
+        if (committed + growBy > reserved) {
+            growBy = reserved - committed;
+            if (growBy < required) {
+                return false;
+            }
+        }
+
+#if defined(_WIN32)
+        if (!VirtualAlloc(base + committed, growBy, MEM_COMMIT, PAGE_READWRITE)) {
+            return false;
+        }
 #else
-            if(!mmap(base + committed, growBy, PROT_READ | PROT_WRITE, MAP_FIXED | MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)) {
-                return nullptr; // abort?
+        if ((flags & LinearAllocatorFlags::HugePages) != 0) {
+            // a fresh MAP_FIXED mapping would drop the MADV_HUGEPAGE hint, mprotect keeps it
+            if (mprotect(base + committed, growBy, PROT_READ | PROT_WRITE) != 0) {
+                return false;
+            }
+        }
+        else {
+            int32 mapFlags = MAP_FIXED | MAP_PRIVATE | MAP_ANONYMOUS;
+#if defined(MAP_POPULATE)
+            if ((flags & LinearAllocatorFlags::Prefault) != 0) {
+                mapFlags |= MAP_POPULATE;
             }
 #endif
-            committed += growBy;
+            if (mmap(base + committed, growBy, PROT_READ | PROT_WRITE, mapFlags, -1, 0) == MAP_FAILED) {
+                return false;
+            }
         }
+#endif
+
+#if !defined(MAP_POPULATE)
+        bool touchPages = (flags & LinearAllocatorFlags::Prefault) != 0;
+#else
+        bool touchPages = (flags & LinearAllocatorFlags::Prefault) != 0 && (flags & LinearAllocatorFlags::HugePages) != 0;
+#endif
+
+        if (touchPages) {
+            for (size_t i = 0; i < growBy; i += kPageSize) {
+                ((volatile uint8*) (base + committed))[i] = 0;
+            }
+        }
+
+        committed += growBy;
+        return true;
+
+    }
+
+    void LinearAllocator::Prefault(size_t bytes) {
+
+        if (pool != nullptr || bytes <= committed) {
+            return;
+        }
+
+        LinearAllocatorFlags prev = flags;
+        flags |= LinearAllocatorFlags::Prefault;
+        Commit(bytes - committed);
+        flags = prev;
+
+    }
+
+    size_t LinearAllocator::Decommit(size_t keepBytes) {
+
+        if (pool != nullptr || base == nullptr) {
+            return 0;
+        }
+
+        size_t granularity = (flags & LinearAllocatorFlags::HugePages) != 0 ? kHugePageSize : kPageSize;
+
+        keepBytes = keepBytes < offset ? offset : keepBytes;
+        keepBytes = (keepBytes + granularity - 1) & ~(granularity - 1);
+
+        if (keepBytes >= committed) {
+            return 0;
+        }
+
+        size_t released = committed - keepBytes;
+
+#if defined(_WIN32)
+        VirtualFree(base + keepBytes, released, MEM_DECOMMIT);
+#else
+        // drop the pages, then the write permission so the commit charge goes too. Commit maps them again on demand
+        madvise(base + keepBytes, released, MADV_DONTNEED);
+        mprotect(base + keepBytes, released, PROT_NONE);
+#endif
+
+        committed = keepBytes;
+        return released;
 
-        return (uint8*) alignedptr;
     }
 
     size_t LinearAllocator::GetOffset(void* ptr) {
@@ -2,11 +2,22 @@
 
 #include "../PrimitiveTypes.h"
 #include "../Collections/CheckedArray.h"
+#include "./AllocatorStats.h"
 #include <cstring>
 #include <memory>
 
 namespace Alchemy {
 
+    class ArenaPool;
+    struct ArenaSlab;
+
+    DEFINE_ENUM_FLAGS(LinearAllocatorFlags, uint8, {
+        None = 0,
+        HugePages = 1 << 0, // 2mb aligned reservation, commits in 2mb steps and asks for transparent huge pages
+        GeometricCommit = 1 << 1, // each commit at least doubles what is committed (capped), fewer commit calls for big arenas
+        Prefault = 1 << 2, // touch pages as they are committed so first use doesn't fault
+    })
+
     typedef uint8* (* AllocatorFn)(void* cookie, size_t size, size_t alignment);
     typedef void (* FreeFn)(void* cookie, void* ptr, size_t size);
 
@@ -52,6 +63,11 @@ namespace Alchemy {
             return (T*) allocFn(cookie, sizeof(T) * count, alignof(T));
         }
 
+        // false when memory only comes back with the whole arena, Free would be a no-op or has nothing to call
+        bool CanFree() {
+            return freeFn != nullptr && freeFn != LinearFree;
+        }
+
         template<typename T>
         void Free(T * ptr, size_t itemCount = 1) {
             freeFn(cookie, ptr, sizeof(T) * itemCount);
@@ -75,7 +91,21 @@ namespace Alchemy {
         uint8* base;
         size_t reserved;
         size_t committed;
+        size_t peakOffset; // highest offset since the last ResetPeak, rollbacks don't lower it
         size_t minCommitStep;
+        ArenaPool* pool;
+        ArenaSlab* slab;
+        LinearAllocatorFlags flags;
+
+        bool Commit(size_t growBy);
+
+#if ALCHEMY_ALLOCATOR_STATS != 0
+        AllocatorStats stats { "LinearAllocator", this, UpdateStats };
+
+        static void UpdateStats(AllocatorStats* stats);
+#endif
+
+        void BorrowSlab();
 
 
     public:
@@ -84,7 +114,10 @@ namespace Alchemy {
             return Allocator(this, LinearAlloc, LinearFree);
         }
 
-        explicit LinearAllocator(size_t reserveSize, size_t minCommitSize);
+        explicit LinearAllocator(size_t reserveSize, size_t minCommitSize, LinearAllocatorFlags flags = LinearAllocatorFlags::None);
+
+        // borrows a slab from the pool on first allocation instead of reserving its own address range
+        explicit LinearAllocator(ArenaPool* pool);
 
         virtual ~LinearAllocator();
 
@@ -92,6 +125,31 @@ namespace Alchemy {
             offset = 0;
         }
 
+        // clears and, for pooled allocators, hands the slab back until something is allocated again
+        void Release();
+
+        // commits and touches the first `bytes` up front, for allocators that are re-used by every job
+        void Prefault(size_t bytes);
+
+        // gives committed pages past max(keepBytes, offset) back to the os, returns how many bytes were released.
+        // no-op for pooled allocators, the pool decides what stays resident
+        size_t Decommit(size_t keepBytes);
+
+        inline size_t GetCommittedBytes() {
+            return committed;
+        }
+
+        inline size_t ResetPeak() {
+            size_t peak = peakOffset;
+            peakOffset = offset;
+            return peak;
+        }
+
+        // allocators with the same name are summed in stats snapshots. the string must outlive the allocator
+        inline void SetStatsName(const char* name) {
+            ALLOCATOR_STATS(stats.name = name;)
+        }
+
         uint8* AllocateBytesUncleared(size_t bytes, size_t alignment);
 
         template<typename T>
@@ -150,6 +208,20 @@ namespace Alchemy {
         return (uint8*)Mallocate(size);
     }
 
+    struct TempAllocatorResetPolicy {
+        size_t warmBytes; // never decommit below this
+        int32 lowUsageRuns; // decommit once this many runs in a row peaked under half of what is committed, 0 never decommits
+    };
+
+    struct TempAllocatorStats {
+        int64 runCount;
+        size_t lastPeakBytes;
+        size_t maxPeakBytes;
+        size_t committedBytes;
+        int64 decommitCount;
+        size_t decommittedBytes;
+    };
+
     struct TempAllocator : public LinearAllocator {
 
         class Marker {
@@ -186,7 +258,27 @@ namespace Alchemy {
 
         Marker MarkerFromOffset(void* p);
 
-        TempAllocator(size_t reservation, size_t commitSize);
+        TempAllocator(size_t reservation, size_t commitSize, LinearAllocatorFlags flags = LinearAllocatorFlags::None);
+
+        inline void SetResetPolicy(TempAllocatorResetPolicy policy) {
+            resetPolicy = policy;
+        }
+
+        // call at the end of a run (after Clear, or with whatever is still live). one big run leaves its pages committed
+        // so the next big run is cheap, but once enough small runs follow the excess goes back to the os
+        void EndRun();
+
+        inline TempAllocatorStats GetRunStats() {
+            runStats.committedBytes = committed;
+            return runStats;
+        }
+
+    private:
+
+        TempAllocatorResetPolicy resetPolicy;
+        TempAllocatorStats runStats;
+        int32 lowUsageStreak;
+        size_t streakPeak;
 
     };
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include "../PrimitiveTypes.h"
 #include "../Collections/PodList.h"
+#include "./AllocatorStats.h"
 
 namespace Alchemy {
 
@@ -16,6 +17,7 @@ namespace Alchemy {
             T* alloc = MallocateTyped(T, basePageSize);
             memset((void*) alloc, 0, sizeof(T) * basePageSize);
             pages.Add(Page(alloc, basePageSize, 0));
+            ALLOCATOR_STATS(stats.committedBytes = sizeof(T) * basePageSize;)
         }
 
         ~PagedAllocator() {
@@ -64,6 +66,22 @@ namespace Alchemy {
         }
 
     public:
+
+#if ALCHEMY_ALLOCATOR_STATS != 0
+        // used & committed are kept up to date as we go, no update function
+        AllocatorStats stats { "PagedAllocator", this, nullptr };
+
+        inline void RecordStats(int32 count, int32 newPageSize) {
+            stats.RecordAllocation(sizeof(T) * count);
+            stats.RecordUsed(stats.usedBytes + sizeof(T) * count);
+            stats.committedBytes += sizeof(T) * newPageSize;
+        }
+#endif
+
+        inline void SetStatsName(const char* name) {
+            ALLOCATOR_STATS(stats.name = name;)
+        }
+
         T* AllocateUncleared(int32 count) {
             // todo keep current page as a pointer so we don't dereference pages in the common case.
             // better yet, just keep capacity & size and update them on the page if we don't hit the common case
@@ -73,6 +91,7 @@ namespace Alchemy {
             if (remaining > count) {
                 T* retn = currentPage.buffer + currentPage.size;
                 currentPage.size += count;
+                ALLOCATOR_STATS(RecordStats(count, 0);)
                 return retn;
             }
 
@@ -80,15 +99,17 @@ namespace Alchemy {
 
             if (pageIndex == -1) {
                 int32 pageSize = baseItemsPerPage > count ? baseItemsPerPage : count;
-                T* alloc = MallocateTyped(T, 1);
+                T* alloc = MallocateTypedUncleared(T, pageSize);
                 pages.Add(Page(alloc, pageSize, count));
                 UpdateCurrentPage();
+                ALLOCATOR_STATS(RecordStats(count, pageSize);)
                 return alloc;
             }
 
             Page &page = pages.Get(pageIndex);
             T* retn = page.buffer + page.size;
             page.size += count;
+            ALLOCATOR_STATS(RecordStats(count, 0);)
             return retn;
 
         }
@@ -101,6 +122,7 @@ namespace Alchemy {
             if (remaining > count) {
                 T* retn = currentPage.buffer + currentPage.size;
                 currentPage.size += count;
+                ALLOCATOR_STATS(RecordStats(count, 0);)
                 return retn;
             }
 
@@ -112,12 +134,14 @@ namespace Alchemy {
                 memset((void*) alloc, 0, sizeof(T) * pageSize);
                 pages.Add(Page(alloc, pageSize, count));
                 UpdateCurrentPage();
+                ALLOCATOR_STATS(RecordStats(count, pageSize);)
                 return alloc;
             }
 
             Page &page = pages.Get(pageIndex);
             T* retn = page.buffer + page.size;
             page.size += count;
+            ALLOCATOR_STATS(RecordStats(count, 0);)
             return retn;
 
         }
@@ -129,6 +153,8 @@ namespace Alchemy {
                 pages[i].size = 0;
             }
 
+            ALLOCATOR_STATS(stats.usedBytes = 0;)
+
         }
 
     };
@@ -9,7 +9,13 @@ namespace Alchemy {
 
         explicit PoolAllocator(int32 pageSize = 128)
             : buffer(pageSize)
-            , allocator() {}
+            , allocator() {
+            buffer.SetStatsName("PoolAllocator");
+        }
+
+        inline void SetStatsName(const char* name) {
+            buffer.SetStatsName(name);
+        }
 
         T* Allocate() {
 
@@ -18,6 +24,7 @@ namespace Alchemy {
                 allocator.next = ptr->next;
                 T* retn = (T*) ptr;
                 memset((void*)retn, 0, sizeof(T));
+                ALLOCATOR_STATS(buffer.RecordStats(1, 0);)
                 return retn;
             }
             // buffer will always return zero'd memory
@@ -29,6 +36,7 @@ namespace Alchemy {
             BlockHeader* blockHeader = (BlockHeader*) allocation;
             blockHeader->next = allocator.next;
             allocator.next = blockHeader;
+            ALLOCATOR_STATS(buffer.stats.usedBytes -= sizeof(T);)
         }
 
     private:
@@ -0,0 +1,247 @@
+#include "./SlabAllocator.h"
+
+namespace Alchemy {
+
+    // cache slots are shared by every slab allocator. a thread takes one the first time it allocates and hands it
+    // back when it exits, whatever is left in that slot's magazines is picked up by the next thread to get it
+    static std::mutex s_SlotMutex;
+    static int32 s_FreeSlots[SlabAllocator::kMaxThreadCaches];
+    static int32 s_FreeSlotCount;
+    static int32 s_NextSlot;
+
+    struct ThreadSlot {
+
+        int32 index;
+
+        ThreadSlot() : index(-1) {
+            std::unique_lock lock(s_SlotMutex);
+            if (s_FreeSlotCount != 0) {
+                index = s_FreeSlots[--s_FreeSlotCount];
+            }
+            else if (s_NextSlot < SlabAllocator::kMaxThreadCaches) {
+                index = s_NextSlot++;
+            }
+        }
+
+        ~ThreadSlot() {
+            if (index != -1) {
+                std::unique_lock lock(s_SlotMutex);
+                s_FreeSlots[s_FreeSlotCount++] = index;
+            }
+        }
+
+    };
+
+    static thread_local ThreadSlot ts_ThreadSlot;
+
+    SlabAllocator::SlabAllocator(size_t reservation)
+        : backing(reservation, KILOBYTES(64))
+        , backingMutex()
+        , depots()
+        , caches() {
+        backing.SetStatsName("SlabAllocator");
+    }
+
+    SlabAllocator::~SlabAllocator() {
+        for (int32 i = 0; i < kMaxThreadCaches; i++) {
+            ThreadCache* cache = caches[i].load(std::memory_order_acquire);
+            if (cache != nullptr) {
+                cache->~ThreadCache();
+                MfreeTyped(cache, 1);
+            }
+        }
+    }
+
+    int32 SlabAllocator::GetSizeClass(size_t bytes) {
+        int32 sizeClass = kMinSizeClass;
+        while (((size_t) 1 << sizeClass) < bytes) {
+            sizeClass++;
+        }
+        assert(sizeClass < kSizeClassCount);
+        return sizeClass;
+    }
+
+    SlabAllocator::ThreadCache* SlabAllocator::GetThreadCache() {
+
+        int32 slot = ts_ThreadSlot.index;
+
+        if (slot == -1) {
+            return nullptr;
+        }
+
+        ThreadCache* cache = caches[slot].load(std::memory_order_acquire);
+
+        if (cache == nullptr) {
+            // only the thread holding the slot creates its cache, nobody else can race us here
+            cache = new(MallocateTyped(ThreadCache, 1)) ThreadCache();
+            caches[slot].store(cache, std::memory_order_release);
+        }
+
+        return cache;
+
+    }
+
+    bool SlabAllocator::PopMagazine(Depot* depot, Magazine* magazine) {
+
+        FreeBlock* head = depot->fullMagazines;
+
+        if (head == nullptr) {
+            return false;
+        }
+
+        depot->fullMagazines = head->nextMagazine;
+
+        int32 count = 0;
+        for (FreeBlock* block = head; block != nullptr; block = block->next) {
+            magazine->blocks[count++] = block;
+        }
+
+        magazine->count = count;
+        return true;
+
+    }
+
+    void SlabAllocator::PushMagazine(Depot* depot, Magazine* magazine) {
+
+        FreeBlock* head = magazine->blocks[0];
+
+        for (int32 i = 0; i < magazine->count - 1; i++) {
+            magazine->blocks[i]->next = magazine->blocks[i + 1];
+        }
+
+        magazine->blocks[magazine->count - 1]->next = nullptr;
+        head->nextMagazine = depot->fullMagazines;
+        depot->fullMagazines = head;
+        magazine->count = 0;
+
+    }
+
+    void SlabAllocator::Carve(Magazine* magazine, int32 sizeClass) {
+
+        size_t classSize = (size_t) 1 << sizeClass;
+
+        // a full magazine of small blocks, fewer once blocks get big so we don't commit memory nobody asked for
+        int32 count = classSize >= KILOBYTES(64) ? 1 : (int32) (KILOBYTES(64) / classSize);
+        count = count > kMagazineSize ? kMagazineSize : count;
+
+        uint8* bytes;
+        {
+            std::unique_lock lock(backingMutex);
+            bytes = backing.AllocateBytesUncleared(classSize * count, 16);
+        }
+
+        for (int32 i = 0; i < count; i++) {
+            magazine->blocks[i] = (FreeBlock*) (bytes + classSize * (count - 1 - i));
+        }
+
+        magazine->count = count;
+
+    }
+
+    void SlabAllocator::Refill(Magazine* magazine, int32 sizeClass, bool depotLocked) {
+
+        Depot* depot = &depots[sizeClass];
+
+        if (depotLocked) {
+            if (!PopMagazine(depot, magazine)) {
+                Carve(magazine, sizeClass);
+            }
+            return;
+        }
+
+        {
+            std::unique_lock lock(depot->mutex);
+            if (PopMagazine(depot, magazine)) {
+                return;
+            }
+        }
+
+        Carve(magazine, sizeClass);
+
+    }
+
+    void* SlabAllocator::Allocate(int32 sizeClass) {
+
+        assert(sizeClass >= kMinSizeClass && sizeClass < kSizeClassCount);
+
+        ThreadCache* cache = GetThreadCache();
+
+        if (cache == nullptr) {
+            Depot* depot = &depots[sizeClass];
+            std::unique_lock lock(depot->mutex);
+            if (depot->shared.count == 0) {
+                Refill(&depot->shared, sizeClass, true);
+            }
+            depot->sharedLiveBytes += (int64) 1 << sizeClass;
+            return depot->shared.blocks[--depot->shared.count];
+        }
+
+        Magazine* magazine = &cache->magazines[sizeClass];
+
+        if (magazine->count == 0) {
+            Refill(magazine, sizeClass, false);
+        }
+
+        cache->liveBytes.store(cache->liveBytes.load(std::memory_order_relaxed) + ((int64) 1 << sizeClass), std::memory_order_relaxed);
+
+        return magazine->blocks[--magazine->count];
+
+    }
+
+    void SlabAllocator::Free(void* block, int32 sizeClass) {
+
+        assert(sizeClass >= kMinSizeClass && sizeClass < kSizeClassCount);
+
+        Depot* depot = &depots[sizeClass];
+        ThreadCache* cache = GetThreadCache();
+
+        if (cache == nullptr) {
+            std::unique_lock lock(depot->mutex);
+            if (depot->shared.count == kMagazineSize) {
+                PushMagazine(depot, &depot->shared);
+            }
+            depot->sharedLiveBytes -= (int64) 1 << sizeClass;
+            depot->shared.blocks[depot->shared.count++] = (FreeBlock*) block;
+            return;
+        }
+
+        Magazine* magazine = &cache->magazines[sizeClass];
+
+        if (magazine->count == kMagazineSize) {
+            std::unique_lock lock(depot->mutex);
+            PushMagazine(depot, magazine);
+        }
+
+        // can go negative for a thread that frees what others allocated, the sum is what matters
+        cache->liveBytes.store(cache->liveBytes.load(std::memory_order_relaxed) - ((int64) 1 << sizeClass), std::memory_order_relaxed);
+
+        magazine->blocks[magazine->count++] = (FreeBlock*) block;
+
+    }
+
+    size_t SlabAllocator::GetLiveBytes() {
+
+        int64 total = 0;
+
+        for (int32 i = 0; i < kMaxThreadCaches; i++) {
+            ThreadCache* cache = caches[i].load(std::memory_order_acquire);
+            if (cache != nullptr) {
+                total += cache->liveBytes.load(std::memory_order_relaxed);
+            }
+        }
+
+        for (int32 i = 0; i < kSizeClassCount; i++) {
+            std::unique_lock lock(depots[i].mutex);
+            total += depots[i].sharedLiveBytes;
+        }
+
+        return (size_t) total;
+
+    }
+
+    size_t SlabAllocator::GetCommittedBytes() {
+        std::unique_lock lock(backingMutex);
+        return backing.offset;
+    }
+
+}
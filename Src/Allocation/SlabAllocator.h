@@ -0,0 +1,88 @@
+#pragma once
+
+#include "../PrimitiveTypes.h"
+#include "./LinearAllocator.h"
+#include <mutex>
+#include <atomic>
+
+namespace Alchemy {
+
+    // Power of two size classes that any thread can allocate from and free into. Each thread keeps a magazine of
+    // free blocks per size class and only goes to the shared depot (under that class's lock) when its magazine runs
+    // empty or fills up, so threads hammering the same class meet once every kMagazineSize calls instead of on
+    // every call. Blocks may be freed on a different thread than the one that allocated them. Nothing is given
+    // back to the os, freed blocks are re-used.
+    class SlabAllocator {
+
+    public:
+
+        static constexpr int32 kMinSizeClass = 4; // 16 bytes, a free block holds two pointers
+        static constexpr int32 kSizeClassCount = 32;
+        static constexpr int32 kMagazineSize = 32;
+        static constexpr int32 kMaxThreadCaches = 128;
+
+        explicit SlabAllocator(size_t reservation);
+
+        ~SlabAllocator();
+
+        SlabAllocator(const SlabAllocator&) = delete;
+        SlabAllocator& operator=(const SlabAllocator&) = delete;
+
+        static int32 GetSizeClass(size_t bytes);
+
+        // 16 byte aligned, 1 << sizeClass bytes, not cleared
+        void* Allocate(int32 sizeClass);
+
+        void Free(void* block, int32 sizeClass);
+
+        // bytes currently handed out, only exact when no other thread is allocating
+        size_t GetLiveBytes();
+
+        size_t GetCommittedBytes();
+
+        inline void SetStatsName(const char* name) {
+            backing.SetStatsName(name);
+        }
+
+    private:
+
+        struct FreeBlock {
+            FreeBlock* next; // next block of the same magazine
+            FreeBlock* nextMagazine; // only used on the first block of a magazine sitting in the depot
+        };
+
+        struct Magazine {
+            int32 count;
+            FreeBlock* blocks[kMagazineSize];
+        };
+
+        struct ThreadCache {
+            Magazine magazines[kSizeClassCount];
+            std::atomic<int64> liveBytes; // only written by the owning thread
+        };
+
+        struct Depot {
+            std::mutex mutex;
+            FreeBlock* fullMagazines;
+            Magazine shared; // for threads that didn't get a cache slot, only touched under the lock
+            int64 sharedLiveBytes;
+        };
+
+        LinearAllocator backing;
+        std::mutex backingMutex;
+        Depot depots[kSizeClassCount];
+        std::atomic<ThreadCache*> caches[kMaxThreadCaches];
+
+        ThreadCache* GetThreadCache();
+
+        void Refill(Magazine* magazine, int32 sizeClass, bool depotLocked);
+
+        void Carve(Magazine* magazine, int32 sizeClass);
+
+        static bool PopMagazine(Depot* depot, Magazine* magazine);
+
+        static void PushMagazine(Depot* depot, Magazine* magazine);
+
+    };
+
+}
@@ -4,19 +4,38 @@ namespace Alchemy {
 
     thread_local TempAllocator * ts_ThreadLocalAllocator;
 
+    static LinearAllocatorFlags s_ThreadLocalAllocatorFlags = LinearAllocatorFlags::None;
+    static size_t s_ThreadLocalPrefaultBytes = 0;
+
+    void ConfigureThreadLocalAllocators(LinearAllocatorFlags flags, size_t prefaultBytes) {
+        s_ThreadLocalAllocatorFlags = flags;
+        s_ThreadLocalPrefaultBytes = prefaultBytes;
+    }
+
     void DisposeThreadLocalAllocator() {
+        if (ts_ThreadLocalAllocator == nullptr) {
+            return;
+        }
+        // run the destructor so the reservation is released and stats unregister
+        ts_ThreadLocalAllocator->~TempAllocator();
         Mfree(ts_ThreadLocalAllocator, sizeof(TempAllocator));
+        ts_ThreadLocalAllocator = nullptr;
     }
 
     TempAllocator * GetThreadLocalAllocator() {
 
         if(ts_ThreadLocalAllocator == nullptr) {
             ts_ThreadLocalAllocator = (TempAllocator*)MallocateUncleared(sizeof(TempAllocator));
-            new (ts_ThreadLocalAllocator) TempAllocator(GIGABYTES(1), KILOBYTES(64));
+            new (ts_ThreadLocalAllocator) TempAllocator(GIGABYTES(1), KILOBYTES(64), s_ThreadLocalAllocatorFlags);
+            ts_ThreadLocalAllocator->SetStatsName("ThreadTemp");
+
+            if (s_ThreadLocalPrefaultBytes != 0) {
+                ts_ThreadLocalAllocator->Prefault(s_ThreadLocalPrefaultBytes);
+            }
         }
 
         return ts_ThreadLocalAllocator;
 
     }
 
-}
\ No newline at end of file
+}
@@ -7,6 +7,10 @@ namespace Alchemy {
 
     void DisposeThreadLocalAllocator();
 
+    // applies to thread local allocators created after the call. worker threads create theirs when they start so
+    // configure this before creating a JobSystem. prefaultBytes are committed & touched up front
+    void ConfigureThreadLocalAllocators(LinearAllocatorFlags flags, size_t prefaultBytes);
+
     #define TEMP_ALLOC_SCOPE_MARKER TempAllocator::ScopedMarker xxxxxxmarkerxxxxx(GetThreadLocalAllocator());
 
-}
\ No newline at end of file
+}
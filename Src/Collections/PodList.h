@@ -69,7 +69,8 @@ namespace Alchemy {
             if (size + cnt >= capacity) {
                 int32 a = size + (cnt * 2);
                 int32 b = (int32)(capacity * 2);
-                EnsureCapacity(capacity == 0 ? 8 : a  > b ? a : b);
+                // EnsureCapacity rounds tiny lists up to 8, a first Reserve may ask for more than that
+                EnsureCapacity(a > b ? a : b);
             }
             T* retn = &array[size];
             size += cnt;
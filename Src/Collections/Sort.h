@@ -98,7 +98,7 @@ namespace Alchemy {
     template<class T, class CompareTo>
     void InsertionSort(T* arr, int32 low, int32 high, const CompareTo &compareTo) {
         for (int32 i = low + 1; i <= high; i++) {
-            T &key = arr[i];
+            T key = arr[i]; // a reference would be overwritten by the first shift
             int32 j = i - 1;
             while (j >= low && compareTo(arr[j], key) > 0) {
                 arr[j + 1] = arr[j];
@@ -0,0 +1,808 @@
+#include "./CodeGen.h"
+#include "./TypeInfo.h"
+#include "./MemberInfo.h"
+#include "./TypeTable.h"
+#include "./ConstantFolding.h"
+#include "../Collections/Sort.h"
+#include "../Util/StringUtil.h"
+#include "../Util/File.h"
+#include "../Util/Hash.h"
+#include <cstdio>
+
+namespace Alchemy::Compilation {
+
+    const char* kCodeGenTypesHeader = "alchemy_types.h";
+
+    const char* kCodeGenManifest = "alchemy_manifest.json";
+
+    const char* kTranslationUnitPrelude = "// generated by the alchemy compiler, do not edit\n#include \"alchemy_types.h\"\n\n";
+
+    // what types are written as when the compiler can't say yet, and the built ins that aren't spelled in source
+    static const char* kTypesHeaderPrelude =
+        "// generated by the alchemy compiler, do not edit\n"
+        "#pragma once\n"
+        "\n"
+        "#include <stdint.h>\n"
+        "#include <stdbool.h>\n"
+        "\n"
+        "typedef void* alc_unresolved;\n"
+        "typedef struct alc_array { void* data; int32_t length; } alc_array;\n"
+        "typedef struct alc_string { const uint16_t* chars; int32_t length; } alc_string;\n"
+        "\n";
+
+    // offsets are int32 like the introspection arenas', nothing a worker emits comes close
+    static constexpr size_t kCodeGenArenaReservation = GIGABYTES(1);
+
+    void CodeBuffer::Reset(LinearAllocator* allocator) {
+        this->allocator = allocator;
+        tail = nullptr;
+        totalBytes = 0;
+    }
+
+    void CodeBuffer::AddChunk(int32 minSize) {
+
+        int32 capacity = minSize > kCodeChunkSize ? minSize : kCodeChunkSize;
+
+        CodeChunk* chunk = allocator->AllocateUncleared<CodeChunk>(1);
+        chunk->next = nullptr;
+        chunk->data = allocator->AllocateUncleared<char>(capacity);
+        chunk->size = 0;
+        chunk->capacity = capacity;
+
+        if (tail != nullptr) {
+            tail->next = chunk;
+        }
+
+        tail = chunk;
+
+    }
+
+    void CodeBuffer::Begin(EmittedMethod* method) {
+
+        if (tail == nullptr || tail->size == tail->capacity) {
+            AddChunk(1);
+        }
+
+        method->chunk = tail;
+        method->start = tail->size;
+        // the byte count so far, End turns it into the method's size
+        method->size = (int32) totalBytes;
+
+    }
+
+    void CodeBuffer::End(EmittedMethod* method) {
+        method->size = (int32) totalBytes - method->size;
+    }
+
+    char* CodeBuffer::Reserve(int32 size) {
+
+        if (tail == nullptr || tail->capacity - tail->size < size) {
+            AddChunk(size);
+        }
+
+        return tail->data + tail->size;
+
+    }
+
+    void CodeBuffer::Commit(int32 size) {
+        tail->size += size;
+        totalBytes += size;
+    }
+
+    void CodeBuffer::Write(const char* ptr, int32 size) {
+
+        totalBytes += size;
+
+        while (size != 0) {
+
+            if (tail == nullptr || tail->size == tail->capacity) {
+                AddChunk(1);
+            }
+
+            int32 space = tail->capacity - tail->size;
+            int32 count = size < space ? size : space;
+
+            memcpy(tail->data + tail->size, ptr, count);
+            tail->size += count;
+            ptr += count;
+            size -= count;
+
+        }
+
+    }
+
+    void CodeBuffer::WriteInt(int32 value) {
+        char* p = Reserve(12);
+        Commit(IntToAscii(value, p));
+    }
+
+    CodeGenOutput::CodeGenOutput()
+        : arenas()
+        , buffers()
+        , translationUnits()
+        , writtenHashes()
+        , typesHash(0)
+        , manifestHash(0) {}
+
+    CodeGenOutput::~CodeGenOutput() {
+        for (int32 i = 0; i < arenas.size; i++) {
+            arenas[i]->~LinearAllocator();
+            Mfree(arenas[i], sizeof(LinearAllocator));
+        }
+        arenas.Dispose();
+        buffers.Dispose();
+        translationUnits.Dispose();
+        writtenHashes.Dispose();
+    }
+
+    void CodeGenOutput::Reset(int32 workerCount) {
+
+        while (arenas.size < workerCount) {
+            LinearAllocator* arena = (LinearAllocator*) MallocateUncleared(sizeof(LinearAllocator));
+            new(arena) LinearAllocator(kCodeGenArenaReservation, KILOBYTES(64), LinearAllocatorFlags::GeometricCommit);
+            arena->SetStatsName("CodeGen");
+            arenas.Add(arena);
+        }
+
+        buffers.size = 0;
+
+        for (int32 i = 0; i < arenas.size; i++) {
+            arenas[i]->Clear();
+            buffers.Reserve()->Reset(arenas[i]);
+        }
+
+    }
+
+    void CodeGenOutput::Partition(CheckedArray<EmittedMethod> sortedMethods, int32 targetBytes) {
+
+        translationUnits.size = 0;
+
+        TranslationUnit* current = nullptr;
+
+        // a method is never split, one bigger than the target is a unit of its own
+        for (int32 i = 0; i < sortedMethods.size; i++) {
+
+            int32 size = sortedMethods[i].size;
+
+            if (current == nullptr || (current->methodCount != 0 && current->size + size > targetBytes)) {
+                current = translationUnits.Reserve();
+                *current = TranslationUnit { i, 0, 0, 0, CodeGenWrite::Unchanged };
+            }
+
+            current->methodCount++;
+            current->size += size;
+
+        }
+
+    }
+
+    void CodeGenOutput::PartitionByShard(CheckedArray<EmittedMethod> sortedMethods, int32 shardCount) {
+
+        translationUnits.size = 0;
+
+        int32 i = 0;
+
+        for (int32 shard = 0; shard < shardCount; shard++) {
+
+            TranslationUnit* current = translationUnits.Reserve();
+            *current = TranslationUnit { i, 0, 0, 0, CodeGenWrite::Unchanged };
+
+            while (i < sortedMethods.size && sortedMethods[i].shard == shard) {
+                current->methodCount++;
+                current->size += sortedMethods[i].size;
+                i++;
+            }
+
+        }
+
+        assert(i == sortedMethods.size);
+
+    }
+
+    size_t CodeGenOutput::GetUsedBytes() {
+        size_t used = 0;
+        for (int32 i = 0; i < arenas.size; i++) {
+            used += arenas[i]->offset;
+        }
+        return used;
+    }
+
+    size_t CodeGenOutput::GetCommittedBytes() {
+        size_t committed = 0;
+        for (int32 i = 0; i < arenas.size; i++) {
+            committed += arenas[i]->GetCommittedBytes();
+        }
+        return committed;
+    }
+
+    static char* EscapeName(FixedCharSpan name, char* p) {
+
+        static const char* kHex = "0123456789abcdef";
+
+        for (size_t i = 0; i < name.size; i++) {
+
+            char c = name.ptr[i];
+
+            if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9')) {
+                *p++ = c;
+                continue;
+            }
+
+            *p++ = '_';
+
+            switch (c) {
+                case '_': *p++ = '_'; break;
+                case '.': *p++ = 'D'; break;
+                case '$': *p++ = 'G'; break;
+                case '<': *p++ = 'L'; break;
+                case '>': *p++ = 'R'; break;
+                case ',': *p++ = 'C'; break;
+                case ':': {
+                    if (i + 1 < name.size && name.ptr[i + 1] == ':') {
+                        *p++ = 'N';
+                        i++;
+                        break;
+                    }
+                    [[fallthrough]];
+                }
+                default: {
+                    *p++ = 'X';
+                    *p++ = kHex[((uint8) c) >> 4];
+                    *p++ = kHex[((uint8) c) & 15];
+                    break;
+                }
+            }
+
+        }
+
+        return p;
+
+    }
+
+    static int32 GetOverloadOrdinal(MethodInfo* methodInfo) {
+
+        TypeInfo* declaringType = methodInfo->declaringType;
+        int32 ordinal = 0;
+
+        for (MethodInfo* m = declaringType->methods; m != methodInfo; m++) {
+            if (m->parameterCount == methodInfo->parameterCount && m->name == methodInfo->name) {
+                ordinal++;
+            }
+        }
+
+        return ordinal;
+
+    }
+
+    FixedCharSpan MangleTypeName(TypeInfo* typeInfo, LinearAllocator* allocator) {
+        FixedCharSpan name = typeInfo->GetFullyQualifiedTypeName();
+        char* buffer = allocator->AllocateUncleared<char>(6 + name.size * 4);
+        char* p = buffer;
+        memcpy(p, "alc_T_", 6);
+        p = EscapeName(name, p + 6);
+        return FixedCharSpan(buffer, p - buffer);
+    }
+
+    FixedCharSpan MangleMethodName(MethodInfo* methodInfo, LinearAllocator* allocator) {
+
+        FixedCharSpan typeName = methodInfo->declaringType->GetFullyQualifiedTypeName();
+        int32 ordinal = GetOverloadOrdinal(methodInfo);
+
+        char* buffer = allocator->AllocateUncleared<char>(6 + typeName.size * 4 + 2 + methodInfo->name.size * 4 + 2 * (2 + 12));
+        char* p = buffer;
+
+        memcpy(p, "alc_M_", 6);
+        p = EscapeName(typeName, p + 6);
+        *p++ = '_';
+        *p++ = 'M';
+        p = EscapeName(methodInfo->name, p);
+        *p++ = '_';
+        *p++ = 'P';
+        p += IntToAscii(methodInfo->parameterCount, p);
+
+        if (ordinal != 0) {
+            *p++ = '_';
+            *p++ = 'O';
+            p += IntToAscii(ordinal, p);
+        }
+
+        return FixedCharSpan(buffer, p - buffer);
+
+    }
+
+    int32 CompareMangledNames(FixedCharSpan a, FixedCharSpan b) {
+        size_t size = a.size < b.size ? a.size : b.size;
+        int32 cmp = memcmp(a.ptr, b.ptr, size);
+        if (cmp != 0) {
+            return cmp;
+        }
+        return a.size == b.size ? 0 : (a.size < b.size ? -1 : 1);
+    }
+
+    void WriteCName(CodeBuffer* out, const char* prefix, FixedCharSpan name) {
+        out->Write(prefix);
+        char* p = out->Reserve((int32) name.size * 4);
+        out->Commit((int32) (EscapeName(name, p) - p));
+    }
+
+    void WriteCTypeName(CodeBuffer* out, TypeInfo* typeInfo) {
+        WriteCName(out, "alc_T_", typeInfo->GetFullyQualifiedTypeName());
+    }
+
+    static const char* GetPrimitiveCType(BuiltInTypeName builtInTypeName) {
+        switch (builtInTypeName) {
+            case BuiltInTypeName::Bool: return "bool";
+            case BuiltInTypeName::Char: return "uint16_t";
+            case BuiltInTypeName::Int8: return "int8_t";
+            case BuiltInTypeName::Int16: return "int16_t";
+            case BuiltInTypeName::Int32: return "int32_t";
+            case BuiltInTypeName::Int64: return "int64_t";
+            case BuiltInTypeName::UInt8: return "uint8_t";
+            case BuiltInTypeName::UInt16: return "uint16_t";
+            case BuiltInTypeName::UInt32: return "uint32_t";
+            case BuiltInTypeName::UInt64: return "uint64_t";
+            case BuiltInTypeName::Float: return "float";
+            case BuiltInTypeName::Double: return "double";
+            case BuiltInTypeName::String: return "alc_string";
+            case BuiltInTypeName::Void: return "void";
+            default: return nullptr;
+        }
+    }
+
+    void WriteCType(CodeBuffer* out, ResolvedType type) {
+
+        if (type.IsVoid()) {
+            out->Write("void");
+            return;
+        }
+
+        TypeInfo* typeInfo = type.GetTypeInfo();
+
+        if (typeInfo == nullptr || type.IsUnresolved() || type.IsTuple()) {
+            out->Write("alc_unresolved");
+            return;
+        }
+
+        if ((type.resolvedTypeFlags & ResolvedTypeFlags::IsArray) != 0) {
+            out->Write("alc_array");
+        }
+        else if (const char* primitive = GetPrimitiveCType(typeInfo->builtInTypeName)) {
+            out->Write(primitive);
+            if (type.IsNullable()) {
+                out->WriteChar('*');
+            }
+        }
+        else {
+            switch (typeInfo->typeClass) {
+                case TypeClass::Void: {
+                    out->Write("void");
+                    break;
+                }
+                case TypeClass::Enum: {
+                    out->Write("int32_t");
+                    break;
+                }
+                case TypeClass::Struct: {
+                    out->Write("struct ");
+                    WriteCTypeName(out, typeInfo);
+                    if (type.IsNullable()) {
+                        out->WriteChar('*');
+                    }
+                    break;
+                }
+                case TypeClass::Class:
+                case TypeClass::Widget: {
+                    out->Write("struct ");
+                    WriteCTypeName(out, typeInfo);
+                    out->WriteChar('*');
+                    break;
+                }
+                default: {
+                    // interfaces & delegates don't have a layout yet
+                    out->Write("alc_unresolved");
+                    break;
+                }
+            }
+        }
+
+        if (type.IsRef()) {
+            out->WriteChar('*');
+        }
+
+    }
+
+    static void WriteHex(CodeBuffer* out, uint32 value, int32 digits) {
+        char* p = out->Reserve(digits);
+        for (int32 i = digits - 1; i >= 0; i--) {
+            p[i] = "0123456789ABCDEF"[value & 0xF];
+            value >>= 4;
+        }
+        out->Commit(digits);
+    }
+
+    // the literal's text is still escaped C# and utf-8, C wants utf-16 units it can't misread. C doesn't take \u
+    // below 0xA0 or for a surrogate, those are octal or combined into one \U
+    static void WriteCString(CodeBuffer* out, ConstantString value) {
+
+        const char* ptr = value.ptr;
+        const char* end = value.ptr + value.size;
+        int32 length = 0;
+
+        out->Write("(alc_string){ u\"");
+
+        while (ptr < end) {
+
+            uint32 c;
+            int32 consumed = DecodeCharacter(ptr, end, &c);
+
+            if (consumed == 0) {
+                c = 0xFFFD;
+                consumed = 1;
+            }
+
+            ptr += consumed;
+
+            if (c >= 0xD800 && c <= 0xDBFF) {
+                uint32 low;
+                int32 lowConsumed = DecodeCharacter(ptr, end, &low);
+                if (lowConsumed != 0 && low >= 0xDC00 && low <= 0xDFFF) {
+                    c = 0x10000 + ((c - 0xD800) << 10) + (low - 0xDC00);
+                    ptr += lowConsumed;
+                }
+                else {
+                    c = 0xFFFD;
+                }
+            }
+            else if (c >= 0xDC00 && c <= 0xDFFF) {
+                c = 0xFFFD;
+            }
+
+            length += c > 0xFFFF ? 2 : 1;
+
+            if (c == '"' || c == '\\' || c == '?') {
+                out->WriteChar('\\');
+                out->WriteChar((char) c);
+            }
+            else if (c >= 0x20 && c < 0x7F) {
+                out->WriteChar((char) c);
+            }
+            else if (c < 0xA0) {
+                out->WriteChar('\\');
+                out->WriteChar((char) ('0' + ((c >> 6) & 7)));
+                out->WriteChar((char) ('0' + ((c >> 3) & 7)));
+                out->WriteChar((char) ('0' + (c & 7)));
+            }
+            else if (c <= 0xFFFF) {
+                out->Write("\\u");
+                WriteHex(out, c, 4);
+            }
+            else {
+                out->Write("\\U");
+                WriteHex(out, c, 8);
+            }
+
+        }
+
+        out->Write("\", ");
+        out->WriteInt(length);
+        out->Write(" }");
+
+    }
+
+    // %g drops the point from whole numbers, C would read them back as ints
+    static void WriteCFloatingPoint(CodeBuffer* out, double value, bool isFloat) {
+
+        if (value != value) {
+            out->Write(isFloat ? "(0.0f / 0.0f)" : "(0.0 / 0.0)");
+            return;
+        }
+
+        if (value == 1.0 / 0.0 || value == -1.0 / 0.0) {
+            out->Write(value < 0 ? "(-1.0" : "(1.0");
+            out->Write(isFloat ? "f / 0.0f)" : " / 0.0)");
+            return;
+        }
+
+        char* p = out->Reserve(32);
+        int32 size = snprintf(p, 32, isFloat ? "%.9g" : "%.17g", value);
+
+        bool hasPoint = false;
+        for (int32 i = 0; i < size; i++) {
+            if (p[i] == '.' || p[i] == 'e' || p[i] == 'E') {
+                hasPoint = true;
+                break;
+            }
+        }
+
+        if (!hasPoint) {
+            p[size++] = '.';
+            p[size++] = '0';
+        }
+
+        if (isFloat) {
+            p[size++] = 'f';
+        }
+
+        out->Commit(size);
+
+    }
+
+    void WriteCConstant(CodeBuffer* out, ConstantValue value) {
+
+        assert(value.type != ConstantType::None);
+
+        char* p;
+
+        switch (value.type) {
+            case ConstantType::Bool: {
+                out->Write(value.boolValue ? "true" : "false");
+                break;
+            }
+            case ConstantType::Char:
+            case ConstantType::UInt8:
+            case ConstantType::UInt16:
+            case ConstantType::Int8:
+            case ConstantType::Int16: {
+                out->WriteInt((int32) value.intValue);
+                break;
+            }
+            case ConstantType::Int32: {
+                // -2147483648 is a negated long in C
+                if (value.intValue == INT32_MIN) {
+                    out->Write("(-2147483647 - 1)");
+                }
+                else {
+                    out->WriteInt((int32) value.intValue);
+                }
+                break;
+            }
+            case ConstantType::UInt32: {
+                p = out->Reserve(16);
+                out->Commit(snprintf(p, 16, "%uu", (uint32) value.uintValue));
+                break;
+            }
+            case ConstantType::Int64: {
+                p = out->Reserve(48);
+                out->Commit(value.intValue == INT64_MIN
+                    ? snprintf(p, 48, "(INT64_C(-9223372036854775807) - 1)")
+                    : snprintf(p, 48, "INT64_C(%lld)", (long long) value.intValue));
+                break;
+            }
+            case ConstantType::UInt64: {
+                p = out->Reserve(32);
+                out->Commit(snprintf(p, 32, "UINT64_C(%llu)", (unsigned long long) value.uintValue));
+                break;
+            }
+            case ConstantType::Float: {
+                WriteCFloatingPoint(out, value.floatValue, true);
+                break;
+            }
+            case ConstantType::Double: {
+                WriteCFloatingPoint(out, value.doubleValue, false);
+                break;
+            }
+            case ConstantType::String: {
+                WriteCString(out, value.stringValue);
+                break;
+            }
+            default: {
+                out->WriteChar('0');
+                break;
+            }
+        }
+
+    }
+
+    static bool HasDefinition(TypeInfo* typeInfo) {
+        // built ins are either spelled out in the prelude or are only ever pointed at
+        if (typeInfo->builtInTypeName != BuiltInTypeName::Invalid) {
+            return false;
+        }
+        return typeInfo->typeClass == TypeClass::Class || typeInfo->typeClass == TypeClass::Struct || typeInfo->typeClass == TypeClass::Widget;
+    }
+
+    enum class DefinitionState : uint8 {
+        None,
+        Wanted,
+        Visiting,
+        Written
+    };
+
+    static void WriteDefinition(CodeBuffer* out, TypeInfo* typeInfo, DefinitionState* states) {
+
+        DefinitionState* state = &states[typeInfo->typeId];
+
+        // a struct that holds itself by value can't be laid out, it is left for the C compiler to complain about
+        if (*state != DefinitionState::Wanted) {
+            return;
+        }
+
+        *state = DefinitionState::Visiting;
+
+        TypeInfo* baseClass = typeInfo->typeClass == TypeClass::Struct ? nullptr : typeInfo->GetBaseClass();
+
+        if (baseClass != nullptr && HasDefinition(baseClass)) {
+            WriteDefinition(out, baseClass, states);
+        }
+        else {
+            baseClass = nullptr;
+        }
+
+        for (int32 i = 0; i < typeInfo->fieldCount; i++) {
+            FieldInfo* fieldInfo = &typeInfo->fields[i];
+            TypeInfo* fieldType = fieldInfo->type.GetTypeInfo();
+            if (fieldType != nullptr && fieldType->typeClass == TypeClass::Struct && !fieldInfo->type.IsNullable() && HasDefinition(fieldType)) {
+                WriteDefinition(out, fieldType, states);
+            }
+        }
+
+        out->Write("struct ");
+        WriteCTypeName(out, typeInfo);
+        out->Write(" {\n");
+
+        int32 memberCount = 0;
+
+        if (baseClass != nullptr) {
+            out->Write("    struct ");
+            WriteCTypeName(out, baseClass);
+            out->Write(" base;\n");
+            memberCount++;
+        }
+
+        for (int32 i = 0; i < typeInfo->fieldCount; i++) {
+            FieldInfo* fieldInfo = &typeInfo->fields[i];
+            if ((fieldInfo->modifiers & (FieldModifiers::Static | FieldModifiers::Const)) != 0) {
+                continue;
+            }
+            out->Write("    ");
+            WriteCType(out, fieldInfo->type);
+            out->WriteChar(' ');
+            WriteCName(out, "f_", fieldInfo->identifier);
+            out->Write(";\n");
+            memberCount++;
+        }
+
+        // an empty struct isn't valid C
+        if (memberCount == 0) {
+            out->Write("    char alc_empty;\n");
+        }
+
+        out->Write("};\n\n");
+
+        *state = DefinitionState::Written;
+
+    }
+
+    struct NamedType {
+        TypeInfo* typeInfo;
+        FixedCharSpan mangledName;
+    };
+
+    void WriteTypesHeader(CheckedArray<TypeInfo*> concreteTypes, CodeBuffer* out, LinearAllocator* allocator) {
+
+        NamedType* types = allocator->AllocateUncleared<NamedType>(concreteTypes.size);
+        int32 typeCount = 0;
+
+        DefinitionState* states = allocator->Allocate<DefinitionState>(GetTypeTable()->GetIdLimit());
+
+        for (int32 i = 0; i < concreteTypes.size; i++) {
+            TypeInfo* typeInfo = concreteTypes[i];
+            if (HasDefinition(typeInfo)) {
+                types[typeCount++] = NamedType { typeInfo, MangleTypeName(typeInfo, allocator) };
+                states[typeInfo->typeId] = DefinitionState::Wanted;
+            }
+        }
+
+        // the table hands out ids in whatever order types were registered, names are the same every run
+        IntrospectionSort(types, typeCount, [](const NamedType& a, const NamedType& b) {
+            return CompareMangledNames(a.mangledName, b.mangledName);
+        });
+
+        out->Write(kTypesHeaderPrelude);
+
+        for (int32 i = 0; i < typeCount; i++) {
+            out->Write("struct ");
+            out->Write(types[i].mangledName);
+            out->Write(";\n");
+        }
+
+        out->WriteChar('\n');
+
+        for (int32 i = 0; i < typeCount; i++) {
+            WriteDefinition(out, types[i].typeInfo, states);
+        }
+
+    }
+
+    int32 WriteTranslationUnitName(int32 index, char* buffer) {
+        return snprintf(buffer, 32, "alchemy_%04d.c", index);
+    }
+
+    int32 GetShardIndex(TypeInfo* typeInfo, int32 shardCount) {
+        FixedCharSpan name = typeInfo->GetFullyQualifiedTypeName();
+        uint64 hash = MsiHash::FNV1a64(MsiHash::kFNV1a64OffsetBasis, name.ptr, name.size);
+        // fnv's low bits barely mix, names that only differ in their last character would walk through the shards
+        return (int32) ((hash ^ (hash >> 32)) % (uint64) shardCount);
+    }
+
+    static void WriteManifestEntry(CodeBuffer* out, const char* fileName, uint64 hash, int64 bytes) {
+        char* p = out->Reserve(128);
+        out->Commit(snprintf(p, 128, "{\"file\": \"%s\", \"hash\": \"%016llx\", \"bytes\": %lld", fileName, (unsigned long long) hash, (long long) bytes));
+    }
+
+    void WriteManifest(CodeBuffer* out, CheckedArray<TranslationUnit> units, uint64 typesHash, int64 typesBytes, int32 shardCount) {
+
+        int64 preludeSize = (int64) strlen(kTranslationUnitPrelude);
+
+        out->Write("{\n  \"shards\": ");
+        out->WriteInt(shardCount);
+        out->Write(",\n  \"types\": ");
+        WriteManifestEntry(out, kCodeGenTypesHeader, typesHash, typesBytes);
+        out->Write("},\n  \"units\": [");
+
+        for (int32 i = 0; i < units.size; i++) {
+            char name[32];
+            WriteTranslationUnitName(i, name);
+            out->Write(i == 0 ? "\n    " : ",\n    ");
+            WriteManifestEntry(out, name, units[i].contentHash, preludeSize + units[i].size);
+            out->Write(", \"methods\": ");
+            out->WriteInt(units[i].methodCount);
+            out->WriteChar('}');
+        }
+
+        out->Write("\n  ]\n}\n");
+
+    }
+
+    char* MakeCodeGenPath(FixedCharSpan directory, const char* fileName, LinearAllocator* allocator) {
+        size_t nameLength = strlen(fileName);
+        char* path = allocator->AllocateUncleared<char>(directory.size + nameLength + 2);
+        memcpy(path, directory.ptr, directory.size);
+        path[directory.size] = '/';
+        memcpy(path + directory.size + 1, fileName, nameLength + 1);
+        return path;
+    }
+
+    CodeGenWrite WriteIfChanged(const char* path, CheckedArray<FixedCharSpan> segments, uint64* diskHash, uint64* contentHash, LinearAllocator* tempAllocator) {
+
+        uint64 hash = MsiHash::kFNV1a64OffsetBasis;
+        int64 size = 0;
+
+        for (int32 i = 0; i < segments.size; i++) {
+            hash = MsiHash::FNV1a64(hash, segments[i].ptr, segments[i].size);
+            size += (int64) segments[i].size;
+        }
+
+        *contentHash = hash;
+
+        int64 diskSize = GetFileSize(path);
+
+        // the cached hash only holds while the file is what we wrote, it may have been deleted or edited since
+        if (diskSize != size) {
+            *diskHash = 0;
+        }
+
+        // a fresh compiler doesn't know what an earlier one left behind, reading it back is still far cheaper than
+        // the rebuild a new timestamp would cause
+        if (*diskHash == 0 && diskSize == size) {
+            FixedCharSpan existing = ReadFile(FixedCharSpan(path), tempAllocator->MakeAllocator());
+            if (existing.ptr != nullptr) {
+                *diskHash = MsiHash::FNV1a64(MsiHash::kFNV1a64OffsetBasis, existing.ptr, existing.size);
+            }
+        }
+
+        if (*diskHash == hash) {
+            return CodeGenWrite::Unchanged;
+        }
+
+        if (!WriteFileSegments(path, segments)) {
+            *diskHash = 0;
+            return CodeGenWrite::Failed;
+        }
+
+        *diskHash = hash;
+        return CodeGenWrite::Written;
+
+    }
+
+}
@@ -0,0 +1,199 @@
+#pragma once
+
+#include "../PrimitiveTypes.h"
+#include "../Collections/PodList.h"
+#include "../Collections/CheckedArray.h"
+#include "../Allocation/LinearAllocator.h"
+#include "../Util/FixedCharSpan.h"
+#include "./ResolvedType.h"
+#include "./ConstantValue.h"
+
+namespace Alchemy::Compilation {
+
+    struct TypeInfo;
+    struct MethodInfo;
+
+    constexpr int32 kCodeChunkSize = (int32) KILOBYTES(16);
+
+    constexpr int32 kDefaultTranslationUnitBytes = (int32) KILOBYTES(256);
+
+    struct CodeChunk {
+        CodeChunk* next;
+        char* data;
+        int32 size;
+        int32 capacity;
+    };
+
+    // one method's text. it starts at `start` in `chunk` and carries on into the chunks after it, a chunk can end
+    // before its capacity when a Reserve didn't fit
+    struct EmittedMethod {
+        MethodInfo* methodInfo;
+        FixedCharSpan mangledName;
+        CodeChunk* chunk;
+        int32 start;
+        int32 size;
+        int32 shard; // 0 unless sharding, see GetShardIndex
+    };
+
+    template<typename Fn>
+    inline void ForEachSegment(EmittedMethod* method, Fn fn) {
+        CodeChunk* chunk = method->chunk;
+        int32 offset = method->start;
+        int32 remaining = method->size;
+        while (remaining != 0) {
+            int32 size = chunk->size - offset < remaining ? chunk->size - offset : remaining;
+            if (size != 0) {
+                fn(FixedCharSpan(chunk->data + offset, size));
+            }
+            remaining -= size;
+            chunk = chunk->next;
+            offset = 0;
+        }
+    }
+
+    // Append only text for one worker. Chunks come from the worker's arena and never move once written, so a
+    // method is only ever remembered as where it started and how long it is, merging is handing those pieces to
+    // writev in the right order.
+    struct CodeBuffer {
+
+        LinearAllocator* allocator;
+        CodeChunk* tail;
+        int64 totalBytes;
+
+        void Reset(LinearAllocator* allocator);
+
+        void Begin(EmittedMethod* method);
+
+        void End(EmittedMethod* method);
+
+        // size bytes in one piece, for numbers. only what is written counts, see Commit
+        char* Reserve(int32 size);
+
+        void Commit(int32 size);
+
+        void Write(const char* ptr, int32 size);
+
+        inline void Write(FixedCharSpan span) {
+            Write(span.ptr, (int32) span.size);
+        }
+
+        inline void Write(const char* str) {
+            Write(str, (int32) strlen(str));
+        }
+
+        inline void WriteChar(char c) {
+            if (tail == nullptr || tail->size == tail->capacity) {
+                AddChunk(1);
+            }
+            tail->data[tail->size++] = c;
+            totalBytes++;
+        }
+
+        void WriteInt(int32 value);
+
+    private:
+
+        void AddChunk(int32 minSize);
+
+    };
+
+    enum class CodeGenWrite : uint8 {
+        Unchanged,
+        Written,
+        Failed
+    };
+
+    // methods [firstMethod, firstMethod + methodCount) of the sorted list
+    struct TranslationUnit {
+        int32 firstMethod;
+        int32 methodCount;
+        int64 size;
+        uint64 contentHash;
+        CodeGenWrite result;
+    };
+
+    // Everything the codegen stage keeps between runs: the worker arenas the text lives in until the next run and
+    // the hash of every file it left on disk, which is what lets an unchanged translation unit keep its timestamp.
+    struct CodeGenOutput {
+
+        PodList<LinearAllocator*> arenas;
+        PodList<CodeBuffer> buffers;
+        PodList<TranslationUnit> translationUnits;
+
+        // by translation unit index, 0 when we don't know what is on disk
+        PodList<uint64> writtenHashes;
+        uint64 typesHash;
+        uint64 manifestHash;
+
+        CodeGenOutput();
+
+        ~CodeGenOutput();
+
+        CodeGenOutput(const CodeGenOutput&) = delete;
+        CodeGenOutput& operator=(const CodeGenOutput&) = delete;
+
+        // one empty buffer per worker
+        void Reset(int32 workerCount);
+
+        // the file names only depend on the index, whatever was in a slot last run is what we compare against
+        void Partition(CheckedArray<EmittedMethod> sortedMethods, int32 targetBytes);
+
+        // exactly shardCount units, empty ones included, so a shard keeps its file no matter what the others hold.
+        // the methods have to be sorted by shard first
+        void PartitionByShard(CheckedArray<EmittedMethod> sortedMethods, int32 shardCount);
+
+        size_t GetUsedBytes();
+
+        size_t GetCommittedBytes();
+
+    };
+
+    // alnum stays as is, everything else is escaped behind a '_' so no two names mangle the same
+    FixedCharSpan MangleTypeName(TypeInfo* typeInfo, LinearAllocator* allocator);
+
+    // the declaring type's name, the method's and its parameter count. overloads with the same count are told
+    // apart by their order in the declaration
+    FixedCharSpan MangleMethodName(MethodInfo* methodInfo, LinearAllocator* allocator);
+
+    int32 CompareMangledNames(FixedCharSpan a, FixedCharSpan b);
+
+    // from the fully qualified name alone, so a type stays in its shard across runs, machines and whatever else
+    // gets added or removed around it
+    int32 GetShardIndex(TypeInfo* typeInfo, int32 shardCount);
+
+    // prefix + the escaped name, for locals, fields and anything else that could clash with a C keyword
+    void WriteCName(CodeBuffer* out, const char* prefix, FixedCharSpan name);
+
+    void WriteCTypeName(CodeBuffer* out, TypeInfo* typeInfo);
+
+    // classes are pointers, structs are values, anything without a layout yet is alc_unresolved
+    void WriteCType(CodeBuffer* out, ResolvedType type);
+
+    // a C expression of exactly the constant's type, strings are compound literals
+    void WriteCConstant(CodeBuffer* out, ConstantValue value);
+
+    // every struct & class the emitted code can name, value types are defined before whoever embeds them
+    void WriteTypesHeader(CheckedArray<TypeInfo*> concreteTypes, CodeBuffer* out, LinearAllocator* allocator);
+
+    // directory + '/' + fileName, null terminated
+    char* MakeCodeGenPath(FixedCharSpan directory, const char* fileName, LinearAllocator* allocator);
+
+    // only touches the file when it doesn't already hold exactly the segments, so whatever builds from it doesn't
+    // rebuild for nothing. diskHash is what we wrote there last time, 0 when we don't know and the file is read to
+    // find out. it is updated to whatever is on disk afterwards
+    CodeGenWrite WriteIfChanged(const char* path, CheckedArray<FixedCharSpan> segments, uint64* diskHash, uint64* contentHash, LinearAllocator* tempAllocator);
+
+    // "alchemy_0000.c" and so on, the header every one of them includes is kCodeGenTypesHeader
+    int32 WriteTranslationUnitName(int32 index, char* buffer);
+
+    // what a build system needs to know about the directory: every file with its content hash, size and method
+    // count. nothing in it changes unless a file does, so it's only rewritten alongside one
+    void WriteManifest(CodeBuffer* out, CheckedArray<TranslationUnit> units, uint64 typesHash, int64 typesBytes, int32 shardCount);
+
+    extern const char* kCodeGenTypesHeader;
+
+    extern const char* kCodeGenManifest;
+
+    extern const char* kTranslationUnitPrelude;
+
+}
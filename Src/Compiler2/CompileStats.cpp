@@ -0,0 +1,393 @@
+#include "./CompileStats.h"
+#include "../Util/Stopwatch.h"
+#include <cstdio>
+
+namespace Alchemy::Compilation {
+
+    const char* CompilePhaseToString(CompilePhase phase) {
+        switch (phase) {
+            case CompilePhase::Setup: return "Setup";
+            case CompilePhase::Parse: return "Parse";
+            case CompilePhase::Gather: return "Gather";
+            case CompilePhase::ResolveMembers: return "ResolveMembers";
+            case CompilePhase::ResolveBases: return "ResolveBases";
+            case CompilePhase::FillGenericInstances: return "FillGenericInstances";
+            case CompilePhase::SignatureHashes: return "SignatureHashes";
+            case CompilePhase::TypeDependencies: return "TypeDependencies";
+            case CompilePhase::MemberTables: return "MemberTables";
+            case CompilePhase::Constants: return "Constants";
+            case CompilePhase::Introspect: return "Introspect";
+            case CompilePhase::CodeGen: return "CodeGen";
+            default: return "Invalid";
+        }
+    }
+
+    const char* FilePhaseToString(FilePhase phase) {
+        switch (phase) {
+            case FilePhase::Parse: return "Parse";
+            case FilePhase::Gather: return "Gather";
+            case FilePhase::ResolveMembers: return "ResolveMembers";
+            case FilePhase::ResolveBases: return "ResolveBases";
+            default: return "Invalid";
+        }
+    }
+
+    CompileStats::CompileStats()
+        : phases()
+        , workers()
+        , arenas()
+        , slowestFiles()
+        , slowFileCounts()
+        , fileCount(0)
+        , changedFileCount(0)
+        , relinkedFileCount(0)
+        , signatureChangedFileCount(0)
+        , sourceBytes(0)
+        , tokenCount(0)
+        , nodeCount(0)
+        , typeCount(0)
+        , declaredTypeCount(0)
+        , instantiationCount(0)
+        , liveInstanceCount(0)
+        , sweptInstanceCount(0)
+        , diagnosticCount(0)
+        , introspectedMethodCount(0)
+        , keptMethodCount(0)
+        , constantCount(0)
+        , emittedBytes(0)
+        , emittedMethodCount(0)
+        , translationUnitCount(0)
+        , writtenTranslationUnitCount(0)
+        , residentBytes(0)
+        , mappingCount(0)
+        , arenaReservationCount(0)
+        , perfCounterMask(0)
+        , phaseStartCpu(0)
+        , workerScratch()
+        , phaseStartBusy()
+        , runStartJobs()
+        , phaseStartCounters() {}
+
+    CompileStats::~CompileStats() {
+        workers.Dispose();
+        arenas.Dispose();
+        workerScratch.Dispose();
+        phaseStartBusy.Dispose();
+        runStartJobs.Dispose();
+        phaseStartCounters.Dispose();
+    }
+
+    void CompileStats::BeginRun(Jobs::JobSystem* jobSystem) {
+
+        memset(phases, 0, sizeof(phases));
+        memset(slowFileCounts, 0, sizeof(slowFileCounts));
+
+        fileCount = 0;
+        changedFileCount = 0;
+        relinkedFileCount = 0;
+        signatureChangedFileCount = 0;
+        sourceBytes = 0;
+        tokenCount = 0;
+        nodeCount = 0;
+        typeCount = 0;
+        declaredTypeCount = 0;
+        instantiationCount = 0;
+        liveInstanceCount = 0;
+        sweptInstanceCount = 0;
+        diagnosticCount = 0;
+        introspectedMethodCount = 0;
+        keptMethodCount = 0;
+        constantCount = 0;
+        emittedBytes = 0;
+        emittedMethodCount = 0;
+        translationUnitCount = 0;
+        writtenTranslationUnitCount = 0;
+        residentBytes = 0;
+        mappingCount = 0;
+        arenaReservationCount = 0;
+        arenas.size = 0;
+
+        jobSystem->GetWorkerStats(&workerScratch);
+
+        workers.size = 0;
+        phaseStartBusy.size = 0;
+        runStartJobs.size = 0;
+        phaseStartCounters.size = 0;
+        perfCounterMask = workerScratch.size == 0 ? 0 : ~0u;
+
+        for (int32 i = 0; i < workerScratch.size; i++) {
+            CompileWorkerStats* worker = workers.Reserve();
+            memset(worker, 0, sizeof(CompileWorkerStats));
+            worker->workerId = workerScratch[i].workerId;
+            phaseStartBusy.Add(workerScratch[i].busyNanoseconds);
+            runStartJobs.Add(workerScratch[i].jobsExecuted);
+            phaseStartCounters.Add(workerScratch[i].perfCounters);
+            perfCounterMask &= workerScratch[i].perfCounterMask;
+        }
+
+        phaseStartCpu = GetProcessCpuNanoseconds();
+
+    }
+
+    void CompileStats::EndPhase(CompilePhase phase, uint64 wallNanoseconds, Jobs::JobSystem* jobSystem) {
+
+        uint64 cpu = GetProcessCpuNanoseconds();
+
+        phases[(int32) phase].wallNanoseconds = wallNanoseconds;
+        phases[(int32) phase].cpuNanoseconds = cpu - phaseStartCpu;
+        phaseStartCpu = cpu;
+
+        // no jobs run between executes, the counters are stable here
+        jobSystem->GetWorkerStats(&workerScratch);
+
+        for (int32 i = 0; i < workerScratch.size && i < workers.size; i++) {
+            Jobs::WorkerStats* current = &workerScratch[i];
+            CompileWorkerStats* worker = &workers[i];
+            worker->busyNanoseconds[(int32) phase] = current->busyNanoseconds - phaseStartBusy[i];
+            worker->jobsExecuted = current->jobsExecuted - runStartJobs[i];
+            // the last execute of each phase, phases that execute more than once only report their last
+            worker->jobTempPeakBytes = current->jobTemp.lastPeakBytes > worker->jobTempPeakBytes ? current->jobTemp.lastPeakBytes : worker->jobTempPeakBytes;
+            worker->threadTempPeakBytes = current->threadTemp.lastPeakBytes > worker->threadTempPeakBytes ? current->threadTemp.lastPeakBytes : worker->threadTempPeakBytes;
+            phaseStartBusy[i] = current->busyNanoseconds;
+            phases[(int32) phase].perfCounters.Add(phaseStartCounters[i], current->perfCounters);
+            phaseStartCounters[i] = current->perfCounters;
+        }
+
+    }
+
+    void CompileStats::RecordSlowFiles(FilePhase phase, CheckedArray<SourceFileInfo*> files) {
+
+        SlowFileStats* slowest = slowestFiles[(int32) phase];
+        int32 count = 0;
+
+        // insertion into a handful of slots, a full sort would cost more than the timing itself
+        for (int32 i = 0; i < files.size; i++) {
+
+            uint64 nanoseconds = files[i]->phaseNanoseconds[(int32) phase];
+
+            if (count == kCompileStatsSlowFileCount && nanoseconds <= slowest[count - 1].nanoseconds) {
+                continue;
+            }
+
+            int32 slot = count < kCompileStatsSlowFileCount ? count++ : count - 1;
+
+            while (slot > 0 && slowest[slot - 1].nanoseconds < nanoseconds) {
+                slowest[slot] = slowest[slot - 1];
+                slot--;
+            }
+
+            slowest[slot] = SlowFileStats { files[i]->path, nanoseconds };
+
+        }
+
+        slowFileCounts[(int32) phase] = count;
+
+    }
+
+    void CompileStats::AddArena(const char* name, int32 count, size_t usedBytes, size_t committedBytes) {
+        arenas.Add(CompileArenaStats { name, count, usedBytes, committedBytes });
+    }
+
+    uint64 CompileStats::GetWallNanoseconds() {
+        uint64 total = 0;
+        for (int32 i = 0; i < (int32) CompilePhase::Count; i++) {
+            total += phases[i].wallNanoseconds;
+        }
+        return total;
+    }
+
+    uint64 CompileStats::GetCpuNanoseconds() {
+        uint64 total = 0;
+        for (int32 i = 0; i < (int32) CompilePhase::Count; i++) {
+            total += phases[i].cpuNanoseconds;
+        }
+        return total;
+    }
+
+    double CompileStats::GetEmittedMegabytesPerSecond() {
+        uint64 wall = phases[(int32) CompilePhase::CodeGen].wallNanoseconds;
+        return wall == 0 ? 0 : (emittedBytes / (1024.0 * 1024.0)) / (wall / 1e9);
+    }
+
+    // paths are the only strings that don't come from us, they might hold backslashes or quotes
+    static char* WriteJsonString(char* p, char* end, FixedCharSpan text) {
+        p += snprintf(p, end - p, "\"");
+        for (size_t i = 0; i < text.size; i++) {
+            char c = text.ptr[i];
+            if (c == '"' || c == '\\') {
+                p += snprintf(p, end - p, "\\%c", c);
+            }
+            else if ((uint8) c < 0x20) {
+                p += snprintf(p, end - p, "\\u%04x", (uint32) (uint8) c);
+            }
+            else {
+                p += snprintf(p, end - p, "%c", c);
+            }
+        }
+        p += snprintf(p, end - p, "\"");
+        return p;
+    }
+
+    FixedCharSpan CompileStats::ToJson(Allocator allocator, FixedCharSpan allocatorsJson) {
+
+        constexpr int32 kPhaseCount = (int32) CompilePhase::Count;
+        constexpr int32 kFilePhaseCount = (int32) FilePhase::Count;
+
+        // every number fits in 21 characters, 64 more per entry covers the keys around them
+        size_t capacity = 1024 + allocatorsJson.size;
+        capacity += kPhaseCount * (64 + 2 * 21 + kPerfCounterCount * (32 + 21));
+        capacity += workers.size * (128 + 2 * kPhaseCount * 22);
+        for (int32 i = 0; i < arenas.size; i++) {
+            capacity += strlen(arenas[i].name) + 128;
+        }
+        for (int32 phase = 0; phase < kFilePhaseCount; phase++) {
+            capacity += 64;
+            for (int32 i = 0; i < slowFileCounts[phase]; i++) {
+                capacity += slowestFiles[phase][i].path.size * 6 + 64;
+            }
+        }
+
+        char* buffer = allocator.AllocateUncleared<char>(capacity);
+        char* p = buffer;
+        char* end = buffer + capacity;
+
+        p += snprintf(p, end - p, "{\n  \"wallNanoseconds\": %llu,\n  \"cpuNanoseconds\": %llu,\n",
+            (unsigned long long) GetWallNanoseconds(),
+            (unsigned long long) GetCpuNanoseconds()
+        );
+
+        p += snprintf(p, end - p, "  \"files\": {\"total\": %d, \"changed\": %d, \"relinked\": %d, \"signatureChanged\": %d},\n",
+            fileCount,
+            changedFileCount,
+            relinkedFileCount,
+            signatureChangedFileCount
+        );
+
+        p += snprintf(p, end - p,
+            "  \"counts\": {\"sourceBytes\": %lld, \"tokens\": %lld, \"nodes\": %lld, \"types\": %d, \"declaredTypes\": %d, "
+            "\"instantiations\": %d, \"liveInstances\": %d, \"sweptInstances\": %d, \"diagnostics\": %d, \"introspectedMethods\": %d, \"keptMethods\": %d, \"constants\": %d},\n",
+            (long long) sourceBytes,
+            (long long) tokenCount,
+            (long long) nodeCount,
+            typeCount,
+            declaredTypeCount,
+            instantiationCount,
+            liveInstanceCount,
+            sweptInstanceCount,
+            diagnosticCount,
+            introspectedMethodCount,
+            keptMethodCount,
+            constantCount
+        );
+
+        p += snprintf(p, end - p, "  \"codeGen\": {\"bytes\": %lld, \"methods\": %d, \"translationUnits\": %d, \"written\": %d, \"mbPerSecond\": %.2f},\n",
+            (long long) emittedBytes,
+            emittedMethodCount,
+            translationUnitCount,
+            writtenTranslationUnitCount,
+            GetEmittedMegabytesPerSecond()
+        );
+
+        p += snprintf(p, end - p, "  \"memory\": {\"residentBytes\": %llu, \"mappings\": %d, \"arenaReservations\": %d},\n",
+            (unsigned long long) residentBytes,
+            mappingCount,
+            arenaReservationCount
+        );
+
+        p += snprintf(p, end - p, "  \"phases\": [");
+        for (int32 i = 0; i < kPhaseCount; i++) {
+            p += snprintf(p, end - p, "%s\n    {\"name\": \"%s\", \"wall\": %llu, \"cpu\": %llu",
+                i == 0 ? "" : ",",
+                CompilePhaseToString((CompilePhase) i),
+                (unsigned long long) phases[i].wallNanoseconds,
+                (unsigned long long) phases[i].cpuNanoseconds
+            );
+            // only the counters that could be opened, a missing key means unknown rather than 0
+            if (perfCounterMask != 0) {
+                p += snprintf(p, end - p, ", \"counters\": {");
+                bool first = true;
+                for (int32 c = 0; c < kPerfCounterCount; c++) {
+                    if ((perfCounterMask & (1u << (uint32) c)) != 0) {
+                        p += snprintf(p, end - p, "%s\"%s\": %llu", first ? "" : ", ", PerfCounterToString((PerfCounter) c), (unsigned long long) phases[i].perfCounters.values[c]);
+                        first = false;
+                    }
+                }
+                p += snprintf(p, end - p, "}");
+            }
+            p += snprintf(p, end - p, "}");
+        }
+        p += snprintf(p, end - p, "\n  ],\n");
+
+        p += snprintf(p, end - p, "  \"workers\": [");
+        for (int32 w = 0; w < workers.size; w++) {
+            CompileWorkerStats* worker = &workers[w];
+
+            p += snprintf(p, end - p, "%s\n    {\"id\": %d, \"jobs\": %lld, \"jobTempPeak\": %llu, \"threadTempPeak\": %llu, \"busy\": [",
+                w == 0 ? "" : ",",
+                worker->workerId,
+                (long long) worker->jobsExecuted,
+                (unsigned long long) worker->jobTempPeakBytes,
+                (unsigned long long) worker->threadTempPeakBytes
+            );
+            for (int32 i = 0; i < kPhaseCount; i++) {
+                p += snprintf(p, end - p, i == 0 ? "%llu" : ", %llu", (unsigned long long) worker->busyNanoseconds[i]);
+            }
+
+            p += snprintf(p, end - p, "], \"idle\": [");
+            for (int32 i = 0; i < kPhaseCount; i++) {
+                // busy can overshoot a phase by the few ns between the last job and the phase's lap
+                uint64 wall = phases[i].wallNanoseconds;
+                uint64 busy = worker->busyNanoseconds[i];
+                p += snprintf(p, end - p, i == 0 ? "%llu" : ", %llu", (unsigned long long) (busy < wall ? wall - busy : 0));
+            }
+            p += snprintf(p, end - p, "]}");
+        }
+        p += snprintf(p, end - p, "\n  ],\n");
+
+        p += snprintf(p, end - p, "  \"arenas\": [");
+        for (int32 i = 0; i < arenas.size; i++) {
+            p += snprintf(p, end - p, "%s\n    {\"name\": \"%s\", \"count\": %d, \"used\": %llu, \"committed\": %llu}",
+                i == 0 ? "" : ",",
+                arenas[i].name,
+                arenas[i].count,
+                (unsigned long long) arenas[i].usedBytes,
+                (unsigned long long) arenas[i].committedBytes
+            );
+        }
+        p += snprintf(p, end - p, "\n  ],\n");
+
+        p += snprintf(p, end - p, "  \"slowestFiles\": {");
+        for (int32 phase = 0; phase < kFilePhaseCount; phase++) {
+            p += snprintf(p, end - p, "%s\n    \"%s\": [", phase == 0 ? "" : ",", FilePhaseToString((FilePhase) phase));
+            for (int32 i = 0; i < slowFileCounts[phase]; i++) {
+                p += snprintf(p, end - p, "%s{\"path\": ", i == 0 ? "" : ", ");
+                p = WriteJsonString(p, end, slowestFiles[phase][i].path);
+                p += snprintf(p, end - p, ", \"nanoseconds\": %llu}", (unsigned long long) slowestFiles[phase][i].nanoseconds);
+            }
+            p += snprintf(p, end - p, "]");
+        }
+        p += snprintf(p, end - p, "\n  },\n");
+
+        if (allocatorsJson.size != 0) {
+            // already a json array with a trailing newline
+            p += snprintf(p, end - p, "  \"allocators\": %.*s", (int32) allocatorsJson.size, allocatorsJson.ptr);
+            while (p > buffer && p[-1] == '\n') {
+                p--;
+            }
+            p += snprintf(p, end - p, "\n}\n");
+        }
+        else {
+            p += snprintf(p, end - p, "  \"allocators\": []\n}\n");
+        }
+
+        // hand back an exact size (plus terminator) so the caller can free it with the span's size
+        size_t length = p - buffer;
+        char* retn = allocator.AllocateUncleared<char>(length + 1);
+        memcpy(retn, buffer, length + 1);
+        allocator.Free(buffer, capacity);
+
+        return FixedCharSpan(retn, length);
+
+    }
+
+}
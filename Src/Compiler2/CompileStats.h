@@ -0,0 +1,148 @@
+#pragma once
+
+#include "../PrimitiveTypes.h"
+#include "../Collections/PodList.h"
+#include "../Collections/CheckedArray.h"
+#include "../Util/FixedCharSpan.h"
+#include "../JobSystem/JobSystem.h"
+#include "../Util/PerfCounters.h"
+#include "./SourceFileInfo.h"
+
+namespace Alchemy::Compilation {
+
+    // the stages of Compile in the order they run
+    enum class CompilePhase : uint8 {
+        Setup, // built ins, finding files and figuring out what changed
+        Parse, // tokenizing included, it happens in the same job
+        Gather,
+        ResolveMembers,
+        ResolveBases,
+        FillGenericInstances,
+        SignatureHashes,
+        TypeDependencies,
+        MemberTables,
+        Constants,
+        Introspect,
+        CodeGen, // 0 unless there is a codegen directory
+
+        Count
+    };
+
+    const char* CompilePhaseToString(CompilePhase phase);
+
+    const char* FilePhaseToString(FilePhase phase);
+
+    constexpr int32 kCompileStatsSlowFileCount = 8;
+
+    struct CompilePhaseStats {
+        uint64 wallNanoseconds;
+        uint64 cpuNanoseconds; // every thread of the process, parallel phases go past their wall time
+        PerfCounterValues perfCounters; // summed over the jobs of every worker, serial work between jobs isn't in here
+    };
+
+    struct CompileWorkerStats {
+        int32 workerId;
+        int64 jobsExecuted;
+        uint64 busyNanoseconds[(int32) CompilePhase::Count]; // running jobs, idle is the rest of the phase's wall time
+        size_t jobTempPeakBytes;
+        size_t threadTempPeakBytes;
+    };
+
+    struct CompileArenaStats {
+        const char* name;
+        int32 count;
+        size_t usedBytes;
+        size_t committedBytes;
+    };
+
+    struct SlowFileStats {
+        FixedCharSpan path;
+        uint64 nanoseconds;
+    };
+
+    // What the last Compile did and where its time went. Everything is either a counter the compiler keeps anyway
+    // or two timestamps per file & phase, cheap enough that it is never turned off. Paths point at the compiler's
+    // files, so they are only good until the next Compile.
+    struct CompileStats {
+
+        CompilePhaseStats phases[(int32) CompilePhase::Count];
+
+        PodList<CompileWorkerStats> workers;
+        PodList<CompileArenaStats> arenas;
+
+        // slowest first
+        SlowFileStats slowestFiles[(int32) FilePhase::Count][kCompileStatsSlowFileCount];
+        int32 slowFileCounts[(int32) FilePhase::Count];
+
+        int32 fileCount;
+        int32 changedFileCount;
+        int32 relinkedFileCount;
+        int32 signatureChangedFileCount;
+
+        // of the files parsed in this run
+        int64 sourceBytes;
+        int64 tokenCount;
+        int64 nodeCount;
+
+        int32 typeCount; // live rows in the type table, built ins included
+        int32 declaredTypeCount; // by the files parsed in this run
+        int32 instantiationCount; // generic instances filled in this run
+        int32 liveInstanceCount;
+        int32 sweptInstanceCount;
+        int32 diagnosticCount;
+        int32 introspectedMethodCount;
+        int32 keptMethodCount; // reached, but only scanned for what they reach, see IsKeptBody
+        int32 constantCount; // const fields, enum members and default values that folded
+
+        // everything codegen produced, unchanged files included. over the CodeGen phase's wall time it's the MB/s
+        int64 emittedBytes;
+        int32 emittedMethodCount;
+        int32 translationUnitCount;
+        int32 writtenTranslationUnitCount;
+
+        // the whole process at the end of the run, watch these across incremental runs to see what they keep around
+        size_t residentBytes; // 0 where the os won't say
+        int32 mappingCount; // 0 anywhere but linux
+        int32 arenaReservationCount; // by the source file arena pool, one covers many files
+
+        // the counters every worker could open, 0 unless built with ALCHEMY_PERF_COUNTERS on a machine that lets us
+        uint32 perfCounterMask;
+
+        CompileStats();
+
+        ~CompileStats();
+
+        CompileStats(const CompileStats&) = delete;
+        CompileStats& operator=(const CompileStats&) = delete;
+
+        // clears the last run and takes the cpu & worker baselines the first phase is measured against
+        void BeginRun(Jobs::JobSystem* jobSystem);
+
+        void EndPhase(CompilePhase phase, uint64 wallNanoseconds, Jobs::JobSystem* jobSystem);
+
+        // keeps the slowest files of a per file phase
+        void RecordSlowFiles(FilePhase phase, CheckedArray<SourceFileInfo*> files);
+
+        void AddArena(const char* name, int32 count, size_t usedBytes, size_t committedBytes);
+
+        uint64 GetWallNanoseconds();
+
+        uint64 GetCpuNanoseconds();
+
+        double GetEmittedMegabytesPerSecond();
+
+        // allocatorsJson is the compiler's allocatorStatsJson, it is embedded as is when it isn't empty. the
+        // result is null terminated, free it with size + 1 bytes
+        FixedCharSpan ToJson(Allocator allocator, FixedCharSpan allocatorsJson = FixedCharSpan());
+
+    private:
+
+        uint64 phaseStartCpu;
+        PodList<Jobs::WorkerStats> workerScratch;
+        PodList<uint64> phaseStartBusy;
+        PodList<int64> runStartJobs;
+        PodList<PerfCounterValues> phaseStartCounters;
+
+    };
+
+}
@@ -5,27 +5,90 @@
 #include "./Jobs/GatherTypeInfoJob.h"
 #include "./Jobs/ResolveBaseTypesJob.h"
 #include "./Jobs/ResolveMemberTypes.h"
+#include "./Jobs/ComputeSignatureHashesJob.h"
+#include "./Jobs/UpdateTypeDependenciesJob.h"
+#include "./Jobs/BuildMemberTablesJob.h"
+#include "./Jobs/FillGenericInstancesJob.h"
 #include "./Jobs/IntrospectScopesJob.h"
 #include "./Jobs/ScheduleIntrospectJobs.h"
+#include "./Jobs/MergeDiagnosticsJob.h"
+#include "./Jobs/EmitMethodsJob.h"
+#include "./ConstantEvaluator.h"
 #include "./LoadBuiltIns.h"
+#include "./Snapshot.h"
+#include "../Collections/Sort.h"
+#include "../Util/Stopwatch.h"
+#include "../Util/ProcessMemory.h"
 
 namespace Alchemy::Compilation {
 
-    void RecurseChangedDependants(SourceFileInfo* fileInfo) {
+    static bool DeclaresGenericTypes(SourceFileInfo* fileInfo) {
+        for (int32 i = 0; i < fileInfo->declaredTypes.size; i++) {
+            if (fileInfo->declaredTypes[i]->IsGenericTypeDefinition()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void MarkDependantsForRelink(SourceFileInfo* fileInfo) {
 
         if (fileInfo->dependantsVisited) {
             return;
         }
 
         fileInfo->dependantsVisited = true;
-        fileInfo->wasChanged = true;
 
         for (int32 i = 0; i < fileInfo->dependants.size; i++) {
-            RecurseChangedDependants(fileInfo->dependants[i]);
+            SourceFileInfo* dependant = fileInfo->dependants[i];
+
+            if (dependant->wasChanged || !dependant->wasTouched) {
+                continue;
+            }
+
+            // files restored from a snapshot have no syntax to resolve again, they get parsed instead
+            if (dependant->syntaxTree == nullptr) {
+                dependant->wasChanged = true;
+                MarkDependantsForRelink(dependant);
+                continue;
+            }
+
+            dependant->needsRelink = true;
+
+            // instances of a relinked file's generic types get swept, so whoever used them has to resolve again too
+            if (DeclaresGenericTypes(dependant)) {
+                MarkDependantsForRelink(dependant);
+            }
+
         }
 
     }
 
+    // a changed file can hand its ids to the types it declares again and its generic instances are built again under
+    // theirs, so its dependants wait until the new signatures are known. the ones without syntax can't wait, they
+    // have to be re-parsed before anything else happens
+    static bool CanDeferDependants(SourceFileInfo* fileInfo) {
+
+        if (!fileInfo->wasTouched || fileInfo->isBuiltIn) {
+            return false;
+        }
+
+        for (int32 i = 0; i < fileInfo->dependants.size; i++) {
+            SourceFileInfo* dependant = fileInfo->dependants[i];
+
+            if (dependant->wasChanged || !dependant->wasTouched) {
+                continue;
+            }
+
+            if (dependant->syntaxTree == nullptr) {
+                return false;
+            }
+        }
+
+        return true;
+
+    }
+
     void Compiler::AssignBuiltInType(const char* name, BuiltInTypeName builtInTypeName) {
         TypeInfo* pTypeInfo = nullptr;
         assert(resolveMap.TryResolve(FixedCharSpan(name), &pTypeInfo));
@@ -33,24 +96,96 @@ namespace Alchemy::Compilation {
         pTypeInfo->builtInTypeName = builtInTypeName;
         if(IsPrimitiveTypeName(builtInTypeName)) {
             pTypeInfo->flags |= TypeInfoFlags::IsPrimitive;
+            resolveMap.table->Refresh(pTypeInfo->typeId);
         }
 
     }
 
-    Compiler::Compiler(int32 workerCount, FileSystemType fileSystemType)
+    Compiler::Compiler(int32 workerCount, FileSystemType fileSystemType, LinearAllocatorFlags tempFlags, size_t tempPrefaultBytes)
         : diagnostics(Allocator::MakeMallocator())
-        , jobSystem(workerCount)
+        , jobSystem(workerCount, tempFlags, tempPrefaultBytes)
         , resolveMap(Allocator::MakeMallocator())
         , vfs(fileSystemType)
         , fileInfos()
         , sourceFileBuffer()
         , fileAllocator()
-        , typeBuffer() {}
+        , typeBuffer()
+        , snapshot(nullptr)
+        , builtInImage()
+        , changedFileCount(0)
+        , relinkedFileCount(0)
+        , signatureChangedFileCount(0)
+        , stats()
+        , memberTableRunId(0)
+        , constantRunId(0)
+        , retiredTypeIds()
+        , introspectionArenas()
+        , entryPoints()
+        , introspectedEntryPointCount(0)
+        , codeGenDirectory()
+        , translationUnitTargetBytes(kDefaultTranslationUnitBytes)
+        , translationUnitShards(0)
+        , codeGen()
+        , allocatorStats()
+        , allocatorStatsJson() {
+        fileAllocator.SetStatsName("SourceFileInfos");
+    }
+
+    Compiler::~Compiler() {
+        jobSystem.Shutdown();
+        for (int32 i = 0; i < retiredTypeIds.size; i++) {
+            GetTypeTable()->Release(retiredTypeIds[i]);
+        }
+    }
 
     void Compiler::LoadDependencies() {}
 
+    void Compiler::LoadSnapshot(Snapshot* snapshot) {
+
+        assert(fileInfos.size == 0 && this->snapshot == nullptr);
+
+        this->snapshot = snapshot;
+
+        CheckedArray<SnapshotFile> files = snapshot->GetSection<SnapshotFile>(SnapshotSectionName::Files);
+        CheckedArray<uint32> dependencies = snapshot->GetSection<uint32>(SnapshotSectionName::Dependencies);
+        CheckedArray<SnapshotDiagnostic> fileDiagnostics = snapshot->GetSection<SnapshotDiagnostic>(SnapshotSectionName::Diagnostics);
+
+        // types are only built once Compile knows which of these files are still unchanged
+        for (int32 i = 0; i < files.size; i++) {
+            SourceFileInfo* fileInfo = new(fileAllocator.Allocate()) SourceFileInfo();
+            fileInfo->path = snapshot->GetString(files[i].path);
+            fileInfo->assemblyName = snapshot->GetString(files[i].assemblyName);
+            fileInfo->lastEditTime = files[i].lastEditTime;
+            fileInfo->snapshotIndex = i;
+            fileInfos.Add(fileInfo);
+        }
+
+        for (int32 i = 0; i < files.size; i++) {
+
+            SourceFileInfo* fileInfo = fileInfos[i];
+            SnapshotFile* record = files.GetPointer(i);
+
+            for (uint32 d = 0; d < record->dependencyCount; d++) {
+                fileInfo->dependencies.Add(fileInfos[(int32) dependencies[record->dependencyStart + d]]);
+            }
+
+            for (uint32 d = 0; d < record->diagnosticCount; d++) {
+                SnapshotDiagnostic* diagnostic = fileDiagnostics.GetPointer(record->diagnosticStart + d);
+                FixedCharSpan message = snapshot->GetString(diagnostic->message);
+                fileInfo->diagnostics.AddEntry(DiagnosticEntry { diagnostic->start, diagnostic->end, diagnostic->errorCode, (uint32) message.size, message.ptr });
+            }
+
+        }
+
+    }
+
     void Compiler::Compile(CheckedArray<PackageInfo> compiledPackages) {
 
+        stats.BeginRun(&jobSystem);
+
+        // each lap ends the phase before it
+        Stopwatch stopwatch;
+
         if (resolveMap.unresolvedType == nullptr) {
 
             // todo -- delete these eventually
@@ -70,7 +205,28 @@ namespace Alchemy::Compilation {
             resolveMap.voidType->typeNameLength = resolveMap.voidType->fullyQualifiedNameLength;
             resolveMap.voidType->typeClass = TypeClass::Void;
 
-            LoadBuiltIns(&fileInfos, &fileAllocator);
+            // never resolvable by name but still referenced from resolved types
+            GetTypeTable()->Add(resolveMap.unresolvedType);
+            GetTypeTable()->Add(resolveMap.voidType);
+
+            // a loaded snapshot might have added files already
+            int32 firstBuiltIn = fileInfos.size;
+
+            if (LoadBuiltIns(&fileInfos, &fileAllocator, &builtInImage)) {
+
+                CheckedArray<SourceFileInfo*> builtIns(fileInfos.array + firstBuiltIn, fileInfos.size - firstBuiltIn);
+
+                resolveMap.deferGenericInstances = true;
+                MaterializeSnapshotFiles(&builtInImage, builtIns, &resolveMap, &diagnostics);
+                resolveMap.deferGenericInstances = false;
+
+                FillGenericInstances();
+
+                for (int32 i = 0; i < builtIns.size; i++) {
+                    builtIns[i]->snapshotIndex = -1;
+                }
+
+            }
 
         }
 
@@ -93,33 +249,69 @@ namespace Alchemy::Compilation {
         SetupCompilationRun(GetThreadLocalAllocator(), sourceFileBuffer.ToCheckedArray());
 
         int32 changeCount = 0;
+        int32 relinkCount = 0;
 
         for (int32 i = 0; i < fileInfos.size; i++) {
             if (fileInfos[i]->wasChanged) {
                 changeCount++;
             }
+            else if (fileInfos[i]->needsRelink) {
+                relinkCount++;
+            }
         }
 
-        CheckedArray<SourceFileInfo*> changedFiles(GetThreadLocalAllocator()->Allocate<SourceFileInfo*>(changeCount), changeCount);
+        // changed files come first, resolve jobs run over changed + relinked files. dependants relinked once the
+        // new signatures are known are appended later
+        CheckedArray<SourceFileInfo*> resolveFiles(GetThreadLocalAllocator()->Allocate<SourceFileInfo*>(fileInfos.size), changeCount + relinkCount);
+        CheckedArray<SourceFileInfo*> changedFiles(resolveFiles.array, changeCount);
 
+        changedFileCount = changeCount;
+        relinkedFileCount = relinkCount;
+        int32 relinkWrite = changeCount;
         changeCount = 0;
 
         for (int32 i = 0; i < fileInfos.size; i++) {
             if (fileInfos[i]->wasChanged) {
                 changedFiles[changeCount++] = fileInfos[i];
             }
+            else if (fileInfos[i]->needsRelink) {
+                resolveFiles[relinkWrite++] = fileInfos[i];
+                fileInfos[i]->RestoreResolveCheckpoint();
+            }
         }
 
+        stats.EndPhase(CompilePhase::Setup, stopwatch.Lap(), &jobSystem);
+
         jobSystem.Execute(ParseFilesJobRoot(&vfs, changedFiles));
 
+        stats.EndPhase(CompilePhase::Parse, stopwatch.Lap(), &jobSystem);
+
         jobSystem.Execute(Jobs::Parallel::Foreach(changedFiles.size), GatherTypeInfoJob(changedFiles));
 
+        int32 retiredCount = retiredTypeIds.size;
+        for (int32 i = 0; i < changedFiles.size; i++) {
+            if (changedFiles[i]->keepsTypeIds) {
+                changedFiles[i]->ReuseTypeIds(&retiredTypeIds);
+            }
+        }
+
+        int32 lostInstanceCount = resolveMap.RebuildKeptInstances();
+
+        // instances over a type that went away would still be found by name, whoever used them relinks below
+        if (retiredTypeIds.size != retiredCount || lostInstanceCount != 0) {
+            stats.sweptInstanceCount += resolveMap.RemoveDeadTypes();
+        }
+
         for (int32 i = 0; i < changedFiles.size; i++) {
             SourceFileInfo* file = changedFiles[i];
+
+            // anything allocated past here is thrown away when the file is relinked
+            file->SaveResolveCheckpoint();
+
             for (int32 d = 0; d < file->declaredTypes.size; d++) {
 
                 if (!resolveMap.AddUnlocked(file->declaredTypes[d])) {
-                    diagnostics.AddError(Diagnostic(ErrorCode::ERR_DuplicateDeclaration, file->declaredTypes[d]->GetFullyQualifiedTypeName()));
+                    diagnostics.AddError(Diagnostic(ErrorCode::ERR_DuplicateDeclaration, FixedCharSpan(), file->declaredTypes[d]->GetFullyQualifiedTypeName()));
                 }
 
             }
@@ -154,8 +346,89 @@ namespace Alchemy::Compilation {
         // we can go ahead and try to resolve base types now
         // we should only need to do this for changed files
 
-        jobSystem.Execute(Jobs::Parallel::Foreach(changedFiles.size), ResolveMemberTypesJob(changedFiles, &resolveMap));
-        jobSystem.Execute(Jobs::Parallel::Foreach(changedFiles.size), ResolveBaseTypesJob(changedFiles, &resolveMap));
+        // files that only need relinking already have syntax & type infos, they just point at stale types
+
+        // generic instances made while resolving can't copy from their open type yet, it might be half done on another thread
+        resolveMap.deferGenericInstances = true;
+
+        if (snapshot != nullptr) {
+
+            // whatever is still waiting on its snapshot record wasn't changed, removed files are gone by now
+            int32 restoreCount = 0;
+            SourceFileInfo** restoreFiles = GetThreadLocalAllocator()->AllocateUncleared<SourceFileInfo*>(fileInfos.size);
+            for (int32 i = 0; i < fileInfos.size; i++) {
+                if (fileInfos[i]->snapshotIndex != -1) {
+                    restoreFiles[restoreCount++] = fileInfos[i];
+                }
+            }
+
+            if (restoreCount != 0) {
+                MaterializeSnapshotFiles(snapshot, CheckedArray<SourceFileInfo*>(restoreFiles, restoreCount), &resolveMap, &diagnostics);
+                for (int32 i = 0; i < restoreCount; i++) {
+                    restoreFiles[i]->snapshotIndex = -1;
+                }
+            }
+
+        }
+
+        stats.EndPhase(CompilePhase::Gather, stopwatch.Lap(), &jobSystem);
+
+        jobSystem.Execute(Jobs::Parallel::Foreach(resolveFiles.size), ResolveMemberTypesJob(resolveFiles, &resolveMap));
+
+        stats.EndPhase(CompilePhase::ResolveMembers, stopwatch.Lap(), &jobSystem);
+
+        jobSystem.Execute(Jobs::Parallel::Foreach(resolveFiles.size), ResolveBaseTypesJob(resolveFiles, &resolveMap));
+
+        jobSystem.Execute(Jobs::Parallel::Foreach(changedFiles.size), ComputeSignatureHashesJob(changedFiles));
+
+        int32 lateRelinkCount = RelinkDependants(changedFiles, resolveFiles.array + resolveFiles.size);
+
+        if (lateRelinkCount != 0) {
+            resolveMap.RefillInstancesOfRelinkedFiles();
+            CheckedArray<SourceFileInfo*> lateFiles(resolveFiles.array + resolveFiles.size, lateRelinkCount);
+            jobSystem.Execute(Jobs::Parallel::Foreach(lateFiles.size), ResolveMemberTypesJob(lateFiles, &resolveMap));
+            jobSystem.Execute(Jobs::Parallel::Foreach(lateFiles.size), ResolveBaseTypesJob(lateFiles, &resolveMap));
+            resolveFiles.size += lateRelinkCount;
+            relinkedFileCount += lateRelinkCount;
+        }
+
+        stats.EndPhase(CompilePhase::ResolveBases, stopwatch.Lap(), &jobSystem);
+
+        resolveMap.deferGenericInstances = false;
+
+        FillGenericInstances();
+
+        stats.EndPhase(CompilePhase::FillGenericInstances, stopwatch.Lap(), &jobSystem);
+
+        // the changed files were hashed before their dependants were looked at
+        CheckedArray<SourceFileInfo*> relinkedFiles(resolveFiles.array + changedFiles.size, resolveFiles.size - changedFiles.size);
+        jobSystem.Execute(Jobs::Parallel::Foreach(relinkedFiles.size), ComputeSignatureHashesJob(relinkedFiles));
+
+        stats.EndPhase(CompilePhase::SignatureHashes, stopwatch.Lap(), &jobSystem);
+
+        jobSystem.Execute(Jobs::Parallel::Foreach(resolveFiles.size), UpdateTypeDependenciesJob(resolveFiles, &resolveMap));
+
+        signatureChangedFileCount = 0;
+        for (int32 i = changedFiles.size; i < resolveFiles.size; i++) {
+            if (resolveFiles[i]->dependencySignatureChanged) {
+                signatureChangedFileCount++;
+            }
+        }
+
+        stats.EndPhase(CompilePhase::TypeDependencies, stopwatch.Lap(), &jobSystem);
+
+        {
+            TempAllocator::ScopedMarker m(GetThreadLocalAllocator());
+            TypeHierarchy hierarchy;
+            BuildTypeHierarchy(&hierarchy, GetThreadLocalAllocator());
+            BuildMemberTables(&hierarchy);
+        }
+
+        stats.EndPhase(CompilePhase::MemberTables, stopwatch.Lap(), &jobSystem);
+
+        EvaluateConstants();
+
+        stats.EndPhase(CompilePhase::Constants, stopwatch.Lap(), &jobSystem);
 
         // here we start branching I think
         // if we are serving as an lsp we want to introspect files in a given priority w/o codegen
@@ -165,31 +438,969 @@ namespace Alchemy::Compilation {
         // during compilation we're very likely to create additional types for state/closures/etc
         // where do we keep those? do we keep them around or assume we create fresh ones per-pass?
         // if ephemeral we can have each thread handle its own data and we'll just diff them before emitting for selection
-//        jobSystem.Execute(Jobs::Parallel::Foreach(changedFiles.size), IntrospectScopesJob(changedFiles, &resolveMap));
 
+        // without entry points unchanged files keep their body diagnostics and only the resolved files are visited
+        // again, with them it's whatever the entry points reach. unchanged files reached like last time keep theirs too
+        IntrospectMethods(resolveFiles);
+
+        stats.EndPhase(CompilePhase::Introspect, stopwatch.Lap(), &jobSystem);
+
+        if (codeGenDirectory.size != 0) {
+            EmitCode();
+        }
+
+        stats.EndPhase(CompilePhase::CodeGen, stopwatch.Lap(), &jobSystem);
+
+        SnapshotAllocators();
+
+        GatherStats(changedFiles, resolveFiles);
+
+    }
+
+    void Compiler::CollectDiagnostics(PodList<MergedDiagnostic>* output, PodList<SourceFileInfo*>* files) {
+
+        TempAllocator* tempAllocator = GetThreadLocalAllocator();
+        TempAllocator::ScopedMarker marker(tempAllocator);
+
+        output->size = 0;
+        files->size = 0;
+
+        // path order keeps the output stable no matter which order files were discovered in
+        files->EnsureCapacity(fileInfos.size);
+        for (int32 i = 0; i < fileInfos.size; i++) {
+            if (fileInfos[i]->diagnostics.size != 0) {
+                files->Add(fileInfos[i]);
+            }
+        }
+
+        IntrospectionSort(files->array, files->size, [](SourceFileInfo* a, SourceFileInfo* b) {
+            size_t length = a->path.size < b->path.size ? a->path.size : b->path.size;
+            int32 cmp = memcmp(a->path.ptr, b->path.ptr, length);
+            if (cmp != 0) {
+                return cmp;
+            }
+            return a->path.size == b->path.size ? 0 : (a->path.size < b->path.size ? -1 : 1);
+        });
+
+        int32* starts = tempAllocator->AllocateUncleared<int32>(files->size + 1);
+        int32* counts = tempAllocator->AllocateUncleared<int32>(files->size);
+
+        starts[0] = diagnostics.size;
+        for (int32 i = 0; i < files->size; i++) {
+            starts[i + 1] = starts[i] + files->Get(i)->diagnostics.size;
+        }
+
+        DiagnosticEntry* scratch = tempAllocator->AllocateUncleared<DiagnosticEntry>(starts[files->size]);
+
+        diagnostics.CopyTo(scratch);
+        int32 compilerCount = SortAndDeduplicate(scratch, diagnostics.size);
+
+        jobSystem.Execute(Jobs::Parallel::Foreach(files->size), MergeDiagnosticsJob(files->ToCheckedArray(), starts, counts, scratch));
+
+        int32 total = compilerCount;
+        for (int32 i = 0; i < files->size; i++) {
+            total += counts[i];
+        }
+
+        output->EnsureCapacity(total);
+
+        for (int32 i = 0; i < compilerCount; i++) {
+            output->array[output->size++] = MergedDiagnostic { -1, scratch[i] };
+        }
+
+        for (int32 f = 0; f < files->size; f++) {
+            DiagnosticEntry* entries = scratch + starts[f];
+            for (int32 i = 0; i < counts[f]; i++) {
+                output->array[output->size++] = MergedDiagnostic { f, entries[i] };
+            }
+        }
+
+    }
+
+    void Compiler::SnapshotAllocators() {
+#if ALCHEMY_ALLOCATOR_STATS != 0
+        // no jobs are running here so the counters are stable
+        Allocator mallocator = Allocator::MakeMallocator();
+        if (allocatorStatsJson.ptr != nullptr) {
+            mallocator.Free(allocatorStatsJson.ptr, allocatorStatsJson.size + 1);
+        }
+        SnapshotAllocatorStats(&allocatorStats);
+        allocatorStatsJson = AllocatorStatsToJson(allocatorStats.ToCheckedArray(), mallocator);
+#endif
+    }
+
+    void Compiler::GatherStats(CheckedArray<SourceFileInfo*> changedFiles, CheckedArray<SourceFileInfo*> resolveFiles) {
+
+        stats.fileCount = fileInfos.size;
+        stats.changedFileCount = changedFileCount;
+        stats.relinkedFileCount = relinkedFileCount;
+        stats.signatureChangedFileCount = signatureChangedFileCount;
+
+        for (int32 i = 0; i < changedFiles.size; i++) {
+            SourceFileInfo* file = changedFiles[i];
+            stats.sourceBytes += (int64) file->contents.size;
+            stats.tokenCount += file->tokenizerResult.tokens.size;
+            stats.nodeCount += file->nodeCount;
+            stats.declaredTypeCount += file->declaredTypes.size;
+        }
+
+        stats.RecordSlowFiles(FilePhase::Parse, changedFiles);
+        stats.RecordSlowFiles(FilePhase::Gather, changedFiles);
+        stats.RecordSlowFiles(FilePhase::ResolveMembers, resolveFiles);
+        stats.RecordSlowFiles(FilePhase::ResolveBases, resolveFiles);
+
+        stats.typeCount = GetTypeTable()->GetCount();
+        stats.liveInstanceCount = resolveMap.genericInstances.GetInstanceCount();
+
+        size_t fileUsed = 0;
+        size_t fileCommitted = 0;
+        stats.diagnosticCount = diagnostics.size;
+
+        for (int32 i = 0; i < fileInfos.size; i++) {
+            fileUsed += fileInfos[i]->allocator.offset;
+            fileCommitted += fileInfos[i]->allocator.GetCommittedBytes();
+            stats.diagnosticCount += fileInfos[i]->diagnostics.size;
+        }
+
+        stats.AddArena("SourceFile", fileInfos.size, fileUsed, fileCommitted);
+        stats.AddArena("GenericInstances", stats.liveInstanceCount, resolveMap.genericInstances.GetLiveBytes(), resolveMap.genericInstances.GetCommittedBytes());
+        stats.AddArena("Introspection", introspectionArenas.arenas.size, introspectionArenas.GetUsedBytes(), introspectionArenas.GetCommittedBytes());
+        stats.AddArena("CodeGen", codeGen.arenas.size, codeGen.GetUsedBytes(), codeGen.GetCommittedBytes());
+
+        stats.residentBytes = GetProcessResidentBytes();
+        stats.mappingCount = GetProcessMappingCount();
+        stats.arenaReservationCount = GetSourceFileArenaPool()->GetReservationCount();
+
+    }
+
+    FixedCharSpan Compiler::GetStatsJson(Allocator allocator) {
+        return stats.ToJson(allocator, allocatorStatsJson);
+    }
+
+    void Compiler::FillGenericInstances() {
+
+        TempAllocator::ScopedMarker m(GetThreadLocalAllocator());
+
+        CheckedArray<TypeInfo*> pending = resolveMap.TakePendingInstances(GetThreadLocalAllocator()->MakeAllocator());
+
+        // every open type is resolved by now and instances always copy from a declaration, never from
+        // another instance, so these can all be filled at once
+        if (pending.size != 0) {
+            jobSystem.Execute(Jobs::Parallel::Foreach(pending.size), FillGenericInstancesJob(pending, &resolveMap));
+        }
+
+        stats.instantiationCount += pending.size;
+
+    }
+
+    void Compiler::AddEntryPoint(FixedCharSpan pattern) {
+        entryPoints.Add(pattern);
+    }
+
+    // the type part of an entry point & the method after the last '.' of the name, namespaces can have dots too.
+    // shortName is the type part without its namespace, what TypeInfo::GetTypeName would give
+    static void SplitEntryPoint(FixedCharSpan pattern, FixedCharSpan* typeName, FixedCharSpan* shortName, FixedCharSpan* methodName) {
+
+        // signed so the backwards scan below ends at -1 on an empty pattern
+        int32 size = (int32) pattern.size;
+
+        int32 nameStart = 0;
+        for (int32 i = 0; i + 1 < size; i++) {
+            if (pattern.ptr[i] == ':' && pattern.ptr[i + 1] == ':') {
+                nameStart = i + 2;
+            }
+        }
+
+        *typeName = pattern;
+        *methodName = FixedCharSpan();
+
+        for (int32 i = size - 1; i >= nameStart; i--) {
+            if (pattern.ptr[i] == '.') {
+                *typeName = FixedCharSpan(pattern.ptr, i);
+                *methodName = FixedCharSpan(pattern.ptr + i + 1, size - i - 1);
+                break;
+            }
+        }
+
+        *shortName = FixedCharSpan(pattern.ptr + nameStart, (int32) typeName->size - nameStart);
+
+    }
+
+    struct TypeNameEntry {
+        int32 nameHash;
+        int32 order;
+        TypeInfo* typeInfo;
+    };
+
+    CheckedArray<MethodInfo*> Compiler::FindEntryPoints(TempAllocator* tempAllocator) {
+
+        int32 typeCount = 0;
+        int32 methodCount = 0;
+        for (int32 f = 0; f < fileInfos.size; f++) {
+            typeCount += fileInfos[f]->declaredTypes.size;
+            for (int32 t = 0; t < fileInfos[f]->declaredTypes.size; t++) {
+                methodCount += fileInfos[f]->declaredTypes[t]->methodCount;
+            }
+        }
+
+        // every declared type sorted by the hash of its name, a pattern only looks at the ones its name hashes to.
+        // ties stay in declaration order so the diagnostics come out the same every run
+        TypeNameEntry* types = tempAllocator->AllocateUncleared<TypeNameEntry>(typeCount);
+        int32 write = 0;
+        for (int32 f = 0; f < fileInfos.size; f++) {
+            for (int32 t = 0; t < fileInfos[f]->declaredTypes.size; t++) {
+                TypeInfo* typeInfo = fileInfos[f]->declaredTypes[t];
+                types[write] = TypeNameEntry { MsiHash::FNV1a(typeInfo->GetTypeName()), write, typeInfo };
+                write++;
+            }
+        }
+
+        IntrospectionSort(types, typeCount, [](const TypeNameEntry& a, const TypeNameEntry& b) {
+            if (a.nameHash != b.nameHash) {
+                return a.nameHash < b.nameHash ? -1 : 1;
+            }
+            return a.order < b.order ? -1 : (a.order > b.order ? 1 : 0);
+        });
+
+        // a method is claimed once no matter how many patterns match it
+        MethodInfo** seeds = tempAllocator->AllocateUncleared<MethodInfo*>(methodCount);
+        int32 seedCount = 0;
+
+        for (int32 p = 0; p < entryPoints.size; p++) {
+
+            FixedCharSpan pattern = entryPoints[p];
+            FixedCharSpan typeName;
+            FixedCharSpan shortName;
+            FixedCharSpan methodName;
+            SplitEntryPoint(pattern, &typeName, &shortName, &methodName);
+
+            int32 nameHash = MsiHash::FNV1a(shortName);
+
+            int32 low = 0;
+            int32 high = typeCount;
+            while (low < high) {
+                int32 mid = low + ((high - low) >> 1);
+                if (types[mid].nameHash < nameHash) {
+                    low = mid + 1;
+                }
+                else {
+                    high = mid;
+                }
+            }
+
+            bool matched = false;
+
+            for (int32 e = low; e < typeCount && types[e].nameHash == nameHash; e++) {
+
+                TypeInfo* typeInfo = types[e].typeInfo;
+
+                if (!(typeName == typeInfo->GetFullyQualifiedTypeName() || typeName == typeInfo->GetTypeName())) {
+                    continue;
+                }
+
+                // messages point at the pattern, compiler level diagnostics outlive the files
+                if (!typeInfo->IsExported()) {
+                    diagnostics.AddError(Diagnostic(ErrorCode::ERR_EntryPointMustBeExported, FixedCharSpan(), pattern));
+                    matched = true;
+                    continue;
+                }
+
+                for (int32 m = 0; m < typeInfo->methodCount; m++) {
+
+                    MethodInfo* methodInfo = &typeInfo->methods[m];
+
+                    if (methodName.size != 0 && !(methodInfo->name == methodName)) {
+                        continue;
+                    }
+
+                    if (methodInfo->visibility != MemberVisibility::Export) {
+                        if (methodName.size != 0) {
+                            diagnostics.AddError(Diagnostic(ErrorCode::ERR_EntryPointMustBeExported, FixedCharSpan(), pattern));
+                            matched = true;
+                        }
+                        continue;
+                    }
+
+                    matched = true;
+
+                    bool expected = false;
+                    if (methodInfo->isEnqueued.compare_exchange_strong(expected, true)) {
+                        seeds[seedCount++] = methodInfo;
+                    }
+
+                }
+
+            }
+
+            if (!matched) {
+                diagnostics.AddError(Diagnostic(ErrorCode::ERR_EntryPointNotFound, FixedCharSpan(), pattern));
+            }
+
+        }
+
+        return CheckedArray<MethodInfo*>(seeds, seedCount);
+
+    }
+
+    void Compiler::IntrospectTargets(CheckedArray<IntrospectionTarget> targets, MethodNameIndex* methodNames) {
+
+        TempAllocator* tempAllocator = GetThreadLocalAllocator();
+        TempAllocator::ScopedMarker m(tempAllocator);
+
+        int32* batchStarts = tempAllocator->AllocateUncleared<int32>(targets.size + 1);
+        int32 batchCount = BatchIntrospectionTargets(targets, jobSystem.GetWorkerCount(), batchStarts);
+
+        jobSystem.Execute(Jobs::Parallel::Foreach(batchCount), IntrospectScopesJob(targets, batchStarts, &introspectionArenas, &resolveMap, methodNames));
+
+    }
+
+    int32 Compiler::IntrospectReachableMethods(CheckedArray<TypeInfo*> concreteTypes) {
+
+        TempAllocator* tempAllocator = GetThreadLocalAllocator();
+        TempAllocator::ScopedMarker m(tempAllocator);
+
+        MethodNameIndex methodNames = BuildMethodNameIndex(concreteTypes, tempAllocator);
+
+        CheckedArray<IntrospectionTarget> targets = MakeIntrospectionTargets(FindEntryPoints(tempAllocator), tempAllocator);
+
+        int32 introspectedCount = 0;
+
+        // each wave visits what the one before it claimed, a method is claimed at most once so this ends when
+        // nothing new turned up. instance methods are only claimed for the instances that exist, which are the
+        // ones some resolved code spelled out
+        while (targets.size != 0) {
+
+            IntrospectTargets(targets, &methodNames);
+            introspectedCount += targets.size;
+
+            int32 claimedCount = 0;
+            for (int32 i = 0; i < targets.size; i++) {
+                claimedCount += targets[i].methodInfo->introspection->claimedMethodCount;
+            }
+
+            MethodInfo** claimed = tempAllocator->AllocateUncleared<MethodInfo*>(claimedCount);
+            int32 write = 0;
+
+            for (int32 i = 0; i < targets.size; i++) {
+                MethodIntrospection* introspection = targets[i].methodInfo->introspection;
+                memcpy(claimed + write, introspection->claimedMethods, sizeof(MethodInfo*) * introspection->claimedMethodCount);
+                write += introspection->claimedMethodCount;
+            }
+
+            targets = MakeIntrospectionTargets(CheckedArray<MethodInfo*>(claimed, claimedCount), tempAllocator);
+
+        }
+
+        return introspectedCount;
+
+    }
+
+    static void AddBodyDiagnostics(MethodInfo* methodInfo) {
+
+        MethodIntrospection* introspection = methodInfo->introspection;
+
+        if (introspection == nullptr || introspection->diagnosticCount == 0) {
+            return;
+        }
+
+        ts_LocalExpressionBase = introspection->base;
+        Diagnostics* diagnostics = &methodInfo->declaringType->declaringFile->diagnostics;
+
+        for (IntrospectionDiagnostic* d = introspection->firstDiagnostic; d != nullptr; d = d->GetNext()) {
+            diagnostics->AddError(d->diagnostic);
+        }
+
+    }
+
+    CheckedArray<SourceFileInfo*> Compiler::SettleReachedFiles(CheckedArray<TypeInfo*> concreteTypes, TempAllocator* tempAllocator) {
+
+        for (int32 t = 0; t < concreteTypes.size; t++) {
+            if (concreteTypes[t]->IsGenericInstance()) {
+                for (int32 i = 0; i < concreteTypes[t]->methodCount; i++) {
+                    if (concreteTypes[t]->methods[i].introspection != nullptr) {
+                        concreteTypes[t]->declaringFile->keepsBodyDiagnostics = false;
+                        concreteTypes[t]->declaringFile->reachedInstanceBodies = true;
+                        break;
+                    }
+                }
+            }
+        }
+
+        // a file keeps its diagnostics when exactly the bodies reached last time are reached again
+        for (int32 f = 0; f < fileInfos.size; f++) {
+            SourceFileInfo* file = fileInfos[f];
+            for (int32 t = 0; t < file->declaredTypes.size && file->keepsBodyDiagnostics; t++) {
+                TypeInfo* typeInfo = file->declaredTypes[t];
+                for (int32 i = 0; i < typeInfo->methodCount; i++) {
+                    if (typeInfo->methods[i].wasReached != (typeInfo->methods[i].introspection != nullptr)) {
+                        file->keepsBodyDiagnostics = false;
+                        break;
+                    }
+                }
+            }
+        }
+
+        CheckedArray<SourceFileInfo*> files(tempAllocator->AllocateUncleared<SourceFileInfo*>(fileInfos.size), 0);
+        CheckedArray<MethodInfo*> scanned(tempAllocator->AllocateUncleared<MethodInfo*>(stats.introspectedMethodCount), 0);
+
+        for (int32 f = 0; f < fileInfos.size; f++) {
+
+            SourceFileInfo* file = fileInfos[f];
+
+            for (int32 t = 0; t < file->declaredTypes.size; t++) {
+                TypeInfo* typeInfo = file->declaredTypes[t];
+                for (int32 i = 0; i < typeInfo->methodCount; i++) {
+                    MethodInfo* methodInfo = &typeInfo->methods[i];
+                    methodInfo->wasReached = methodInfo->introspection != nullptr;
+                    if (methodInfo->introspection != nullptr && methodInfo->introspection->rootScope == nullptr) {
+                        stats.keptMethodCount++;
+                        if (!file->keepsBodyDiagnostics) {
+                            scanned.array[scanned.size++] = methodInfo;
+                        }
+                    }
+                }
+            }
+
+            // files restored from a snapshot have no bodies, their diagnostics stay as they were saved
+            if (file->syntaxTree != nullptr && !file->keepsBodyDiagnostics) {
+                file->diagnostics.Truncate(file->bodyDiagnostics);
+                files.array[files.size++] = file;
+            }
+
+        }
+
+        // what they reach was claimed during the walk, this only builds what the diagnostics come from
+        CheckedArray<IntrospectionTarget> targets = MakeIntrospectionTargets(scanned, tempAllocator);
+        IntrospectTargets(targets, nullptr);
+
+        stats.keptMethodCount -= targets.size;
+        stats.introspectedMethodCount -= stats.keptMethodCount;
+
+        // kept bodies lose their results like the unchanged files of a run without entry points
+        for (int32 f = 0; f < fileInfos.size; f++) {
+            SourceFileInfo* file = fileInfos[f];
+            for (int32 t = 0; t < file->declaredTypes.size && file->keepsBodyDiagnostics; t++) {
+                TypeInfo* typeInfo = file->declaredTypes[t];
+                for (int32 i = 0; i < typeInfo->methodCount; i++) {
+                    typeInfo->methods[i].introspection = nullptr;
+                }
+            }
+        }
+
+        return files;
+
+    }
+
+    void Compiler::IntrospectMethods(CheckedArray<SourceFileInfo*> resolveFiles) {
+
+        TempAllocator* tempAllocator = GetThreadLocalAllocator();
+        TempAllocator::ScopedMarker m(tempAllocator);
+
+        bool reachableOnly = entryPoints.size != 0;
+
+        // an edit anywhere can change what is reachable, so body diagnostics kept from an earlier run can't be
+        // trusted in a run from entry points, nor in the first full run after one. codegen needs every body's
+        // results, not just the ones of the files that changed
+        bool revisitAll = reachableOnly || introspectedEntryPointCount != 0 || codeGenDirectory.size != 0;
+
+        // unless the entry points are the same as last time, then a file that reaches the same bodies does keep them
+        bool keepUnchanged = reachableOnly && introspectedEntryPointCount == entryPoints.size && codeGenDirectory.size == 0;
+        introspectedEntryPointCount = entryPoints.size;
+
+        CheckedArray<TypeInfo*> concreteTypes = revisitAll
+            ? resolveMap.GetConcreteTypes(tempAllocator->MakeAllocator())
+            : CheckedArray<TypeInfo*>();
+
+        // the arenas are about to be re-used, methods that aren't visited again lose their results. nothing is
+        // claimed until the entry points are
+        for (int32 f = 0; f < fileInfos.size; f++) {
+            for (int32 t = 0; t < fileInfos[f]->declaredTypes.size; t++) {
+                TypeInfo* typeInfo = fileInfos[f]->declaredTypes[t];
+                for (int32 i = 0; i < typeInfo->methodCount; i++) {
+                    typeInfo->methods[i].introspection = nullptr;
+                    typeInfo->methods[i].isEnqueued.store(false, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        for (int32 t = 0; t < concreteTypes.size; t++) {
+            if (concreteTypes[t]->IsGenericInstance()) {
+                for (int32 i = 0; i < concreteTypes[t]->methodCount; i++) {
+                    concreteTypes[t]->methods[i].introspection = nullptr;
+                    concreteTypes[t]->methods[i].isEnqueued.store(false, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        // instance bodies report into the declaration's file, a file they reported into last time is built again
+        for (int32 f = 0; f < fileInfos.size; f++) {
+            SourceFileInfo* file = fileInfos[f];
+            file->keepsBodyDiagnostics = keepUnchanged && file->syntaxTree != nullptr && !file->reachedInstanceBodies;
+            file->reachedInstanceBodies = false;
+        }
+
+        for (int32 f = 0; f < resolveFiles.size; f++) {
+            resolveFiles[f]->bodyDiagnostics = resolveFiles[f]->diagnostics.Checkpoint();
+            resolveFiles[f]->keepsBodyDiagnostics = false;
+        }
+
+        CheckedArray<SourceFileInfo*> files = resolveFiles;
+
+        introspectionArenas.Reset(jobSystem.GetWorkerCount());
+
+        if (reachableOnly) {
+            stats.introspectedMethodCount = IntrospectReachableMethods(concreteTypes);
+            files = SettleReachedFiles(concreteTypes, tempAllocator);
+        }
+        else {
+
+            if (revisitAll) {
+                // files restored from a snapshot have no bodies, their diagnostics stay as they were saved
+                files = CheckedArray<SourceFileInfo*>(tempAllocator->AllocateUncleared<SourceFileInfo*>(fileInfos.size), 0);
+                for (int32 f = 0; f < fileInfos.size; f++) {
+                    if (fileInfos[f]->syntaxTree != nullptr) {
+                        fileInfos[f]->diagnostics.Truncate(fileInfos[f]->bodyDiagnostics);
+                        files.array[files.size++] = fileInfos[f];
+                    }
+                }
+            }
+
+            CheckedArray<IntrospectionTarget> targets = GatherIntrospectionTargets(files, tempAllocator);
+            IntrospectTargets(targets, nullptr);
+            stats.introspectedMethodCount = targets.size;
+
+        }
+
+        // every method kept its own diagnostics, copying them over in declaration order keeps the files' lists stable
+        for (int32 f = 0; f < files.size; f++) {
+            for (int32 t = 0; t < files[f]->declaredTypes.size; t++) {
+                TypeInfo* typeInfo = files[f]->declaredTypes[t];
+                for (int32 i = 0; i < typeInfo->methodCount; i++) {
+                    AddBodyDiagnostics(&typeInfo->methods[i]);
+                }
+            }
+        }
+
+        // an instance reports whatever its body reports against the declaration's file, the copies are dropped
+        // when diagnostics are collected
+        for (int32 t = 0; t < concreteTypes.size; t++) {
+            if (concreteTypes[t]->IsGenericInstance()) {
+                for (int32 i = 0; i < concreteTypes[t]->methodCount; i++) {
+                    AddBodyDiagnostics(&concreteTypes[t]->methods[i]);
+                }
+            }
+        }
+
+    }
+
+    void Compiler::EvaluateConstants() {
+
+        TempAllocator* tempAllocator = GetThreadLocalAllocator();
+        TempAllocator::ScopedMarker m(tempAllocator);
+
+        // everything is evaluated again, a constant can depend on one in any other file
+        constantRunId++;
+        ConstantEvaluator evaluator(&resolveMap, constantRunId);
+
+        for (int32 f = 0; f < fileInfos.size; f++) {
+
+            if (fileInfos[f]->syntaxTree == nullptr) {
+                continue;
+            }
+
+            for (int32 t = 0; t < fileInfos[f]->declaredTypes.size; t++) {
+
+                TypeInfo* typeInfo = fileInfos[f]->declaredTypes[t];
+
+                for (int32 i = 0; i < typeInfo->fieldCount; i++) {
+                    if ((typeInfo->fields[i].modifiers & FieldModifiers::Const) != 0) {
+                        evaluator.EvaluateField(&typeInfo->fields[i]);
+                    }
+                }
+
+                for (int32 i = 0; i < typeInfo->methodCount; i++) {
+                    if (!typeInfo->methods[i].isDefaultParameterOverload) {
+                        evaluator.EvaluateDefaultValues(&typeInfo->methods[i]);
+                    }
+                }
+
+            }
+
+        }
+
+        // instances copied their fields & parameters before there was anything to copy, they share the definition's
+        // syntax so the values are the same
+        CheckedArray<TypeInfo*> concreteTypes = resolveMap.GetConcreteTypes(tempAllocator->MakeAllocator());
 
-        // foreach file
-            // get a list of it's instantiated generics
-            // pump into a master list (file*, typeInfo*)
-            // go through the list
-            // remove any type infos that were in a file marked as changed or not touched
-            // get all remaining type infos
-            // remove duplicates
-            // foreach typeinfo in generic cache
-            // if not in final de-dup list, remove it / delete it
+        for (int32 t = 0; t < concreteTypes.size; t++) {
 
-        // assuming we're just compiling right now and only care about what is reachable from the list of entry points
+            TypeInfo* instance = concreteTypes[t];
 
-        // if we compile for full reflection, where we start doesn't matter
-        // CheckedArray<TypeInfo*> typeInfos = resolveMap.GetExportedTypes(GetThreadLocalAllocator()->MakeAllocator());
+            if (!instance->IsGenericInstance()) {
+                continue;
+            }
 
-        CheckedArray<TypeInfo*> typeInfos = resolveMap.GetConcreteTypes(GetThreadLocalAllocator()->MakeAllocator());
+            TypeInfo* openType = instance->genericDefinition;
 
-        // foreach type
-            // foreach method
-                // introspect & codegen  & write to output somewhere
+            for (int32 i = 0; i < instance->fieldCount; i++) {
+                instance->fields[i].constantState = openType->fields[i].constantState;
+                instance->fields[i].constantRunId = openType->fields[i].constantRunId;
+                instance->fields[i].constantValue = openType->fields[i].constantValue;
+            }
 
-        jobSystem.Execute(Jobs::Parallel::Batch(typeInfos.size, 3), ScheduleIntrospectScopesJob(typeInfos, &resolveMap));
+            for (int32 i = 0; i < instance->methodCount; i++) {
+                for (int32 p = 0; p < instance->methods[i].parameterCount; p++) {
+                    instance->methods[i].parameters[p].defaultValue = openType->methods[i].parameters[p].defaultValue;
+                }
+            }
+
+        }
+
+        stats.constantCount = evaluator.constantCount;
+
+    }
+
+    void Compiler::SetCodeGenOutput(FixedCharSpan directory, int32 targetBytes) {
+        codeGenDirectory = directory;
+        translationUnitTargetBytes = targetBytes;
+        translationUnitShards = 0;
+    }
+
+    void Compiler::SetCodeGenShards(FixedCharSpan directory, int32 shardCount) {
+        assert(shardCount > 0);
+        codeGenDirectory = directory;
+        translationUnitShards = shardCount;
+    }
+
+    // default parameter overloads are never introspected, they go out as forwarders next to their full method
+    static bool IsEmitted(MethodInfo* methodInfo) {
+        return MethodEmitter::GetFullMethod(methodInfo)->introspection != nullptr;
+    }
+
+    void Compiler::EmitCode() {
+
+        TempAllocator* tempAllocator = GetThreadLocalAllocator();
+        TempAllocator::ScopedMarker m(tempAllocator);
+
+        // generic definitions aren't in here, only their instances can be written down
+        CheckedArray<TypeInfo*> concreteTypes = resolveMap.GetConcreteTypes(tempAllocator->MakeAllocator());
+
+        int32 methodCount = 0;
+        for (int32 t = 0; t < concreteTypes.size; t++) {
+            for (int32 i = 0; i < concreteTypes[t]->methodCount; i++) {
+                if (IsEmitted(&concreteTypes[t]->methods[i])) {
+                    methodCount++;
+                }
+            }
+        }
+
+        CheckedArray<EmittedMethod> methods(tempAllocator->Allocate<EmittedMethod>(methodCount), 0);
+
+        for (int32 t = 0; t < concreteTypes.size; t++) {
+            int32 shard = translationUnitShards == 0 ? 0 : GetShardIndex(concreteTypes[t], translationUnitShards);
+            for (int32 i = 0; i < concreteTypes[t]->methodCount; i++) {
+                if (IsEmitted(&concreteTypes[t]->methods[i])) {
+                    EmittedMethod* emitted = &methods.array[methods.size++];
+                    emitted->methodInfo = &concreteTypes[t]->methods[i];
+                    emitted->shard = shard;
+                }
+            }
+        }
+
+        int32 workerCount = jobSystem.GetWorkerCount();
+        codeGen.Reset(workerCount);
+
+        // a few batches per worker so the last ones can be stolen, bodies cost about the same to write out
+        int32 batchSize = methods.size / (workerCount * 8);
+        batchSize = batchSize < 16 ? 16 : batchSize;
+        int32 batchCount = (methods.size + batchSize - 1) / batchSize;
+
+        if (batchCount != 0) {
+            jobSystem.Execute(Jobs::Parallel::Foreach(batchCount), EmitMethodsJob(methods, batchSize, &codeGen));
+        }
+
+        IntrospectionSort(methods.array, methods.size, [](const EmittedMethod& a, const EmittedMethod& b) {
+            if (a.shard != b.shard) {
+                return a.shard < b.shard ? -1 : 1;
+            }
+            return CompareMangledNames(a.mangledName, b.mangledName);
+        });
+
+        if (translationUnitShards != 0) {
+            codeGen.PartitionByShard(methods, translationUnitShards);
+        }
+        else {
+            codeGen.Partition(methods, translationUnitTargetBytes);
+        }
+
+        std::error_code error;
+        std::filesystem::create_directories(std::filesystem::path(std::string(codeGenDirectory.ptr, codeGenDirectory.size)), error);
+
+        CodeBuffer header;
+        header.Reset(tempAllocator);
+        EmittedMethod headerText {};
+        header.Begin(&headerText);
+        WriteTypesHeader(concreteTypes, &header, tempAllocator);
+        header.End(&headerText);
+
+        PodList<FixedCharSpan> segments;
+        ForEachSegment(&headerText, [&segments](FixedCharSpan segment) {
+            segments.Add(segment);
+        });
+
+        uint64 headerHash;
+        CodeGenWrite headerResult = WriteIfChanged(
+            MakeCodeGenPath(codeGenDirectory, kCodeGenTypesHeader, tempAllocator),
+            segments.ToCheckedArray(),
+            &codeGen.typesHash,
+            &headerHash,
+            tempAllocator
+        );
+
+        segments.size = 0;
+
+        CheckedArray<TranslationUnit> units = codeGen.translationUnits.ToCheckedArray();
+
+        int32 previousCount = codeGen.writtenHashes.size;
+        while (codeGen.writtenHashes.size < units.size) {
+            codeGen.writtenHashes.Add(0);
+        }
+
+        jobSystem.Execute(Jobs::Parallel::Foreach(units.size), WriteTranslationUnitsJob(units, methods, codeGenDirectory, codeGen.writtenHashes.array));
+
+        // fewer units than last time, whatever is left past the end would still get compiled. an earlier compiler
+        // might have left more than we know about, so keep going until there's nothing to remove
+        for (int32 i = units.size; ; i++) {
+            char name[32];
+            WriteTranslationUnitName(i, name);
+            if (remove(MakeCodeGenPath(codeGenDirectory, name, tempAllocator)) != 0 && i >= previousCount) {
+                break;
+            }
+        }
+
+        codeGen.writtenHashes.size = units.size;
+
+        // after the units, it holds their hashes
+        CodeBuffer manifest;
+        manifest.Reset(tempAllocator);
+        EmittedMethod manifestText {};
+        manifest.Begin(&manifestText);
+        WriteManifest(&manifest, units, headerHash, headerText.size, translationUnitShards);
+        manifest.End(&manifestText);
+
+        ForEachSegment(&manifestText, [&segments](FixedCharSpan segment) {
+            segments.Add(segment);
+        });
+
+        uint64 manifestHash;
+        CodeGenWrite manifestResult = WriteIfChanged(
+            MakeCodeGenPath(codeGenDirectory, kCodeGenManifest, tempAllocator),
+            segments.ToCheckedArray(),
+            &codeGen.manifestHash,
+            &manifestHash,
+            tempAllocator
+        );
+
+        segments.Dispose();
+
+        bool failed = headerResult == CodeGenWrite::Failed || manifestResult == CodeGenWrite::Failed;
+
+        stats.emittedMethodCount = methods.size;
+        stats.translationUnitCount = units.size;
+        stats.emittedBytes = headerText.size;
+
+        for (int32 i = 0; i < units.size; i++) {
+            stats.emittedBytes += (int64) strlen(kTranslationUnitPrelude) + units[i].size;
+            stats.writtenTranslationUnitCount += units[i].result == CodeGenWrite::Written ? 1 : 0;
+            failed |= units[i].result == CodeGenWrite::Failed;
+        }
+
+        if (failed) {
+            diagnostics.AddError(Diagnostic(ErrorCode::ERR_FailedToWriteOutput, FixedCharSpan(), codeGenDirectory));
+        }
+
+    }
+
+    static FixedCharSpan MakeCycleError(CheckedArray<FixedCharSpan> path, Allocator allocator) {
+        size_t s = 0;
+        for (int32 x = 0; x < path.size; x++) {
+            s += path[x].size;
+            if (x != path.size - 1) {
+                s += 4;
+            }
+
+        }
+        s++;
+        char* c = allocator.AllocateUncleared<char>(s);
+        char* b = c;
+        for (int32 x = 0; x < path.size; x++) {
+            memcpy(b, path[x].ptr, path[x].size);
+            b += path[x].size;
+            if (x != path.size - 1) {
+                b[0] = ' ';
+                b[1] = '-';
+                b[2] = '>';
+                b[3] = ' ';
+                b += 4;
+            }
+
+        }
+        b[0] = '\0';
+        return FixedCharSpan(c, b - c);
+    }
+
+    void Compiler::BuildTypeHierarchy(TypeHierarchy* hierarchy, TempAllocator* tempAllocator) {
+
+        CheckedArray<TypeInfo*> values = resolveMap.GetValues(tempAllocator->MakeAllocator());
+
+        int32 count = 0;
+        for (int32 i = 0; i < values.size; i++) {
+            if (!values[i]->IsGenericArgumentDefinition()) {
+                values[count++] = values[i];
+            }
+        }
+
+        hierarchy->Build(CheckedArray<TypeInfo*>(values.array, count), tempAllocator);
+
+        CheckedArray<int32> cycleStarts;
+        CheckedArray<TypeInfo*> cycles = hierarchy->GetCycles(&cycleStarts);
+
+        // a path visits each type of its cycle once plus the start again at the end
+        FixedPodList<FixedCharSpan> path(tempAllocator->AllocateUncleared<FixedCharSpan>(cycles.size + 1), cycles.size + 1);
+
+        // every type in a cycle gets an error, files that weren't resolved this run still have theirs from last time
+        for (int32 i = 0; i < cycles.size; i++) {
+
+            TypeInfo* typeInfo = cycles[i];
+            SourceFileInfo* file = typeInfo->declaringFile;
+
+            if (typeInfo->IsGenericInstance() || file == nullptr || (!file->wasChanged && !file->needsRelink)) {
+                continue;
+            }
+
+            if (typeInfo->typeClass != TypeClass::Class && typeInfo->typeClass != TypeClass::Struct) {
+                continue;
+            }
+
+            BaseListSyntax* baseList = typeInfo->typeClass == TypeClass::Struct
+                ? ((StructDeclarationSyntax*) typeInfo->syntaxNode)->baseList
+                : ((ClassDeclarationSyntax*) typeInfo->syntaxNode)->baseList;
+
+            path.size = 0;
+            hierarchy->GetCyclePath(typeInfo, &path);
+
+            FixedCharSpan error = MakeCycleError(path.ToCheckedArray(), file->allocator.MakeAllocator());
+            FixedCharSpan sourceRange = baseList->types->items[0]->GetText(file->tokenizerResult);
+            file->diagnostics.AddError(Diagnostic(ErrorCode::ERR_CycleDetectedInClassHierarchy, sourceRange, error));
+
+        }
+
+    }
+
+    // a parallel run costs more than a handful of tables, and a deep single inheritance chain is one type per level
+    static void RunBuildMemberTables(Jobs::JobSystem* jobSystem, TypeResolutionMap* resolveMap, CheckedArray<TypeInfo*> types, bool ignoreBaseClass) {
+
+        constexpr int32 kMinParallelTypes = 64;
+
+        BuildMemberTablesJob job(types, resolveMap, ignoreBaseClass);
+
+        if (types.size >= kMinParallelTypes) {
+            jobSystem->Execute(Jobs::Parallel::Foreach(types.size), job);
+            return;
+        }
+
+        for (int32 i = 0; i < types.size; i++) {
+            job.Execute(i);
+        }
+
+    }
+
+    void Compiler::BuildMemberTables(TypeHierarchy* hierarchy) {
+
+        TempAllocator* tempAllocator = GetThreadLocalAllocator();
+        TempAllocator::ScopedMarker m(tempAllocator);
+
+        memberTableRunId++;
+
+        TypeInfo** stale = tempAllocator->AllocateUncleared<TypeInfo*>(hierarchy->typeCount);
+
+        // a table is stale if it is missing, its type was relinked (the base it copied from may be gone) or anything
+        // up the chain was rebuilt, since it copied those entries. the hierarchy hands out bases before derived types
+        // so stamping the run id as we go is enough to propagate that down. cyclic types were already reported, they
+        // only get their declared members
+        for (int32 level = 0; level < hierarchy->levelCount; level++) {
+
+            CheckedArray<TypeInfo*> types = hierarchy->GetLevel(level);
+
+            int32 write = 0;
+            int32 cyclicWrite = types.size;
+
+            for (int32 i = 0; i < types.size; i++) {
+                TypeInfo* typeInfo = types[i];
+                bool isCyclic = hierarchy->IsCyclic(typeInfo);
+                TypeInfo* baseClass = isCyclic ? nullptr : typeInfo->GetBaseClass();
+
+                bool wasRelinked = typeInfo->declaringFile != nullptr && typeInfo->declaringFile->needsRelink;
+
+                if (typeInfo->memberTable != nullptr && !wasRelinked && (baseClass == nullptr || baseClass->memberTableRunId != memberTableRunId)) {
+                    continue;
+                }
+
+                typeInfo->memberTableRunId = memberTableRunId;
+
+                if (isCyclic) {
+                    stale[--cyclicWrite] = typeInfo;
+                }
+                else {
+                    stale[write++] = typeInfo;
+                }
+            }
+
+            if (write != 0) {
+                RunBuildMemberTables(&jobSystem, &resolveMap, CheckedArray<TypeInfo*>(stale, write), false);
+            }
+
+            if (cyclicWrite != types.size) {
+                CheckedArray<TypeInfo*> cyclic(stale + cyclicWrite, types.size - cyclicWrite);
+                RunBuildMemberTables(&jobSystem, &resolveMap, cyclic, true);
+            }
+
+        }
+
+    }
+
+    int32 Compiler::RelinkDependants(CheckedArray<SourceFileInfo*> changedFiles, SourceFileInfo** output) {
+
+        int32 count = 0;
+
+        for (int32 i = 0; i < changedFiles.size; i++) {
+
+            SourceFileInfo* fileInfo = changedFiles[i];
+
+            if (!fileInfo->keepsTypeIds) {
+                continue;
+            }
+
+            for (int32 d = 0; d < fileInfo->dependants.size; d++) {
+                SourceFileInfo* dependant = fileInfo->dependants[d];
+
+                if (dependant->wasChanged || !dependant->wasTouched || dependant->needsRelink) {
+                    continue;
+                }
+
+                // same shape under the same id, nothing it resolved or folded can come out differently
+                if (!dependant->RecordedSignaturesChanged(&resolveMap)) {
+                    continue;
+                }
+
+                dependant->needsRelink = true;
+                dependant->RestoreResolveCheckpoint();
+                output[count++] = dependant;
+            }
+
+        }
+
+        return count;
 
     }
 
@@ -201,9 +1412,19 @@ namespace Alchemy::Compilation {
         for (int32 i = 0; i < fileInfos.size; i++) {
             SourceFileInfo* fileInfo = fileInfos.Get(i);
             fileInfo->dependants.size = 0;
+            fileInfo->dependantsVisited = false;
+            fileInfo->needsRelink = false;
+            fileInfo->dependencySignatureChanged = false;
+            fileInfo->keepsTypeIds = false;
+            if (fileInfo->isBuiltIn) {
+                // built ins aren't part of any package, they are always alive and only need parsing the first time through.
+                // the ones from the image have no source, they never get parsed
+                fileInfo->wasTouched = true;
+                fileInfo->wasChanged = fileInfo->syntaxTree == nullptr && fileInfo->contents.ptr != nullptr;
+                continue;
+            }
             fileInfo->wasTouched = false;
             fileInfo->wasChanged = false;
-            fileInfo->dependantsVisited = false;
         }
 
         // compute file dependants (could be done at the end of compilation instead)
@@ -292,29 +1513,29 @@ namespace Alchemy::Compilation {
 
             SourceFileInfo* fileInfo = fileInfos.Get(i);
 
-            // if we changed a file or didn't touch a file (ie removed it) then we need to tell dependants it's gone
-            if ((fileInfo->wasChanged || !fileInfo->wasTouched) && !fileInfo->dependantsVisited) {
-                RecurseChangedDependants(fileInfo);
+            // if we changed a file or didn't touch a file (ie removed it) its dependants are left pointing at
+            // types that are about to be freed. they don't need re-parsing, just resolving against the new types,
+            // and only if those look different to them when the file keeps its ids
+            if (fileInfo->wasChanged && CanDeferDependants(fileInfo)) {
+                fileInfo->keepsTypeIds = true;
+            }
+            else if (fileInfo->wasChanged || !fileInfo->wasTouched) {
+                MarkDependantsForRelink(fileInfo);
             }
 
         }
 
         // We know what files are dead / invalidated, update our type resolution map to remove those types
         // that originate from a dead / invalidated file. We need to do this before the files are invalidated
-        // because the type infos are owned by their declaring file.
-        CheckedArray<TypeInfo*> typeInfos = resolveMap.GetValues(GetThreadLocalAllocator()->MakeAllocator());
-        FixedPodList list(typeInfos.array, typeInfos.size);
-        for (int32 i = 0; i < list.size; i++) {
-            SourceFileInfo* fileInfo = list[i]->declaringFile;
-
-            if (fileInfo->wasChanged || !fileInfo->wasTouched) {
-                list.SwapRemoveAt(i);
-                i--;
-            }
+        // because the type infos are owned by their declaring file. Generic instances that nothing live
+        // refers to anymore are swept back into the instance arena here as well.
+        stats.sweptInstanceCount = resolveMap.RemoveDeadTypes();
 
+        // whatever was built over these was just swept, whoever held one was relinked when they were retired
+        for (int32 i = 0; i < retiredTypeIds.size; i++) {
+            GetTypeTable()->Release(retiredTypeIds[i]);
         }
-
-        resolveMap.ReplaceValues(list.ToCheckedArray());
+        retiredTypeIds.size = 0;
 
         // we need to remove dead files and invalidate changed ones now
         for (int32 i = 0; i < fileInfos.size; i++) {
@@ -326,8 +1547,10 @@ namespace Alchemy::Compilation {
             }
 
             if (!fileInfo->wasTouched) {
-                fileAllocator.Free(fileInfo);
+                // destruct first, Free re-uses the memory as a free list link. this also returns the file's arena slab
+                fileInfo->ReleaseTypeIds();
                 fileInfo->~SourceFileInfo();
+                fileAllocator.Free(fileInfo);
                 fileInfos.SwapRemoveAt(i);
                 i--;
             }
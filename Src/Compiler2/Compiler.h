@@ -3,14 +3,23 @@
 #include "../Parsing3/Diagnostics.h"
 #include "../Collections/PagedList.h"
 #include "../Allocation/PoolAllocator.h"
+#include "../Allocation/AllocatorStats.h"
 #include "../FileSystem/VirtualFileSystem.h"
 #include "../JobSystem/JobSystem.h"
 #include "./TypeInfo.h"
 #include "./SourceFileInfo.h"
 #include "./TypeResolutionMap.h"
+#include "./TypeHierarchy.h"
+#include "./Snapshot.h"
+#include "./CompileStats.h"
+#include "./IntrospectionArenas.h"
+#include "./CodeGen.h"
 
 namespace Alchemy::Compilation {
 
+    struct IntrospectionTarget;
+    struct MethodNameIndex;
+
     struct PackageInfo {
 
         FixedCharSpan packageName;
@@ -32,15 +41,117 @@ namespace Alchemy::Compilation {
 
         TypeInfo* typeBuffer[kBuiltInTypeCount];
 
-        Compiler(int32 workerCount, FileSystemType fileSystemType);
+        // names of restored types point into it, has to outlive the compiler
+        Snapshot* snapshot;
+
+        // the precompiled built ins, empty when they were parsed from source
+        Snapshot builtInImage;
+
+        // last run only. changed files were re-parsed, relinked files only had their types resolved again
+        int32 changedFileCount;
+        int32 relinkedFileCount;
+        int32 signatureChangedFileCount;
+
+        // timings & counters of the last run, see CompileStats::ToJson
+        CompileStats stats;
+
+        uint32 memberTableRunId;
+        uint32 constantRunId;
+
+        // ids of types that went away when their file was re-parsed, given back after the next sweep
+        PodList<uint32> retiredTypeIds;
+
+        // scopes & expressions of the method bodies introspected in the last run, see MethodInfo::introspection
+        IntrospectionArenas introspectionArenas;
+
+        // see AddEntryPoint, the spans have to outlive the compiler
+        PodList<FixedCharSpan> entryPoints;
+
+        // the entry points the last run started from, 0 when it visited the resolved files instead
+        int32 introspectedEntryPointCount;
+
+        // see SetCodeGenOutput, nothing is emitted while the directory is empty
+        FixedCharSpan codeGenDirectory;
+        int32 translationUnitTargetBytes;
+        int32 translationUnitShards; // 0 packs by size
+        CodeGenOutput codeGen;
+
+        // refreshed after every Compile, empty unless built with ALCHEMY_ALLOCATOR_STATS
+        PodList<AllocatorStatsSnapshot> allocatorStats;
+        FixedCharSpan allocatorStatsJson;
+
+        // tempFlags & tempPrefaultBytes are handed to the job system for the workers' temp allocators
+        Compiler(int32 workerCount, FileSystemType fileSystemType, LinearAllocatorFlags tempFlags = LinearAllocatorFlags::None, size_t tempPrefaultBytes = 0);
+
+        ~Compiler();
 
         void SetupCompilationRun(TempAllocator * tempAllocator, CheckedArray<VirtualFileInfo> includedSourceFiles);
 
         void LoadDependencies();
 
+        // only before the first Compile. files in it that are unchanged by then skip parsing & resolving
+        void LoadSnapshot(Snapshot* snapshot);
+
         void Compile(CheckedArray<PackageInfo> compiledPackages);
 
         void AssignBuiltInType(const char* name, BuiltInTypeName builtInTypeName);
+
+        void FillGenericInstances();
+
+        void BuildTypeHierarchy(TypeHierarchy* hierarchy, TempAllocator* tempAllocator);
+
+        void BuildMemberTables(TypeHierarchy* hierarchy);
+
+        // the dependants of changed files that kept their type ids and saw one of them change shape, rewound to
+        // be resolved again. returns how many were written to output
+        int32 RelinkDependants(CheckedArray<SourceFileInfo*> changedFiles, SourceFileInfo** output);
+
+        // `Type`, `Type.Method` or `namespace::Type.Method`, a type alone means all of its `export` methods. once there
+        // is an entry point Compile only introspects the method bodies reachable from them
+        void AddEntryPoint(FixedCharSpan pattern);
+
+        // every Compile after this writes what it introspected to `directory` as C, the span has to outlive the compiler.
+        // methods are packed into translation units of about targetBytes each, see EmitCode
+        void SetCodeGenOutput(FixedCharSpan directory, int32 targetBytes = kDefaultTranslationUnitBytes);
+
+        // like SetCodeGenOutput, but always shardCount translation units and a type's methods always go to the same
+        // one. editing a method rewrites its shard only, where packing by size can shift everything sorted after it
+        void SetCodeGenShards(FixedCharSpan directory, int32 shardCount);
+
+        // const fields, enum members & default parameter values of every file with a syntax tree, before any body
+        // is introspected. only the resolved files report errors, the others kept theirs
+        void EvaluateConstants();
+
+        // the bodies of the files resolved this run, or the ones reachable from the entry points when there are any
+        void IntrospectMethods(CheckedArray<SourceFileInfo*> resolveFiles);
+
+        // one job per batch of similar sized bodies
+        void IntrospectTargets(CheckedArray<IntrospectionTarget> targets, MethodNameIndex* methodNames);
+
+        // returns the number of bodies visited
+        int32 IntrospectReachableMethods(CheckedArray<TypeInfo*> concreteTypes);
+
+        // after a run from entry points, decides which files keep the body diagnostics of the last one. the scanned
+        // bodies of the others are introspected for real, returns those files
+        CheckedArray<SourceFileInfo*> SettleReachedFiles(CheckedArray<TypeInfo*> concreteTypes, TempAllocator* tempAllocator);
+
+        // claims the methods the entry points name, unknown or non `export` ones are reported
+        CheckedArray<MethodInfo*> FindEntryPoints(TempAllocator* tempAllocator);
+
+        // every introspected body into the workers' buffers, then sorted by mangled name into translation units or
+        // shards, with a manifest of them all. files that would come out the same aren't written again
+        void EmitCode();
+
+        void SnapshotAllocators();
+
+        void GatherStats(CheckedArray<SourceFileInfo*> changedFiles, CheckedArray<SourceFileInfo*> resolveFiles);
+
+        // the stats of the last run with the allocator stats folded in, free it with size + 1 bytes
+        FixedCharSpan GetStatsJson(Allocator allocator);
+
+        // every diagnostic of the last run ordered by (file path, offset) with duplicates removed. fileIndex points
+        // into `files`, compiler level diagnostics that don't belong to a file come first with a fileIndex of -1
+        void CollectDiagnostics(PodList<MergedDiagnostic>* output, PodList<SourceFileInfo*>* files);
     };
 
 
@@ -0,0 +1,501 @@
+#include "./ConstantEvaluator.h"
+#include "./SourceFileInfo.h"
+#include "./TypeResolver.h"
+#include "./MemberLookupTable.h"
+#include "../Parsing3/SyntaxNodes.h"
+
+namespace Alchemy::Compilation {
+
+    EnumMemberDeclarationSyntax* GetEnumMemberSyntax(FieldInfo* fieldInfo) {
+        TypeInfo* enumType = fieldInfo->declaringType;
+        assert(enumType->typeClass == TypeClass::Enum);
+        return ((EnumDeclarationSyntax*) enumType->syntaxNode)->members->items[fieldInfo - enumType->fields];
+    }
+
+    ConstantType GetEnumUnderlyingType(TypeInfo* enumType) {
+
+        EnumDeclarationSyntax* syntax = (EnumDeclarationSyntax*) enumType->syntaxNode;
+
+        if (syntax == nullptr || syntax->baseList == nullptr || syntax->baseList->types == nullptr || syntax->baseList->types->itemCount == 0) {
+            return ConstantType::Int32;
+        }
+
+        TypeSyntax* typeSyntax = syntax->baseList->types->items[0]->type;
+
+        if (typeSyntax == nullptr || typeSyntax->GetKind() != SyntaxKind::PredefinedType) {
+            return ConstantType::Int32;
+        }
+
+        ConstantType type = ConstantTypeFromBuiltIn(BuiltInTypeNameFromKeyword(((PredefinedTypeSyntax*) typeSyntax)->typeToken.kind));
+
+        return IsIntegralConstantType(type) && type != ConstantType::Char ? type : ConstantType::Int32;
+
+    }
+
+    ConstantType GetConstantType(ResolvedType type) {
+
+        TypeInfo* typeInfo = type.GetTypeInfo();
+
+        if (typeInfo == nullptr || type.IsUnresolved()) {
+            return ConstantType::None;
+        }
+
+        if (typeInfo->typeClass == TypeClass::Enum) {
+            return GetEnumUnderlyingType(typeInfo);
+        }
+
+        ConstantType constantType = ConstantTypeFromBuiltIn(typeInfo->builtInTypeName);
+
+        if (constantType != ConstantType::None) {
+            return constantType;
+        }
+
+        if (typeInfo->builtInTypeName == BuiltInTypeName::Object || typeInfo->typeClass == TypeClass::Class || typeInfo->typeClass == TypeClass::Interface) {
+            return ConstantType::Null;
+        }
+
+        return ConstantType::None;
+
+    }
+
+    FieldInfo* FindConstantField(TypeInfo* typeInfo, FixedCharSpan name) {
+
+        if (typeInfo == nullptr || typeInfo->memberTable == nullptr) {
+            return nullptr;
+        }
+
+        MemberLookupEntry* member = typeInfo->memberTable->Find(name);
+
+        if (member == nullptr || member->kind != MemberKind::Field) {
+            return nullptr;
+        }
+
+        FieldInfo* fieldInfo = member->GetField();
+
+        return (fieldInfo->modifiers & FieldModifiers::Const) != 0 ? fieldInfo : nullptr;
+
+    }
+
+    TypeInfo* ResolveConstantScope(SourceFileInfo* file, TypeResolutionMap* resolutionMap, FixedCharSpan name) {
+
+        TypeResolver typeResolver(file, resolutionMap);
+        typeResolver.supressDiagnostics = true;
+
+        ResolvedType resolvedType;
+        if (!typeResolver.TryResolveIdentifierName(name, &resolvedType)) {
+            return nullptr;
+        }
+
+        TypeInfo* typeInfo = resolvedType.GetTypeInfo();
+        file->AddBodyTypeDependency(typeInfo);
+        return typeInfo;
+
+    }
+
+    ConstantType ResolveCastType(SourceFileInfo* file, TypeResolutionMap* resolutionMap, SyntaxBase* typeSyntax) {
+
+        if (typeSyntax == nullptr) {
+            return ConstantType::None;
+        }
+
+        if (typeSyntax->GetKind() == SyntaxKind::PredefinedType) {
+            return ConstantTypeFromBuiltIn(BuiltInTypeNameFromKeyword(((PredefinedTypeSyntax*) typeSyntax)->typeToken.kind));
+        }
+
+        if (typeSyntax->GetKind() == SyntaxKind::IdentifierName) {
+            TypeInfo* typeInfo = ResolveConstantScope(file, resolutionMap, file->GetText(((IdentifierNameSyntax*) typeSyntax)->identifier));
+            if (typeInfo != nullptr && typeInfo->typeClass == TypeClass::Enum) {
+                return GetEnumUnderlyingType(typeInfo);
+            }
+        }
+
+        return ConstantType::None;
+
+    }
+
+    bool TryFoldLiteral(SourceFileInfo* file, ExpressionSyntax* syntax, ConstantValue* value) {
+
+        switch (syntax->GetKind()) {
+
+            case SyntaxKind::TrueLiteralExpression: {
+                *value = ConstantValue::Bool(true);
+                return true;
+            }
+
+            case SyntaxKind::FalseLiteralExpression: {
+                *value = ConstantValue::Bool(false);
+                return true;
+            }
+
+            case SyntaxKind::NullLiteralExpression: {
+                *value = ConstantValue::Null();
+                return true;
+            }
+
+            case SyntaxKind::EmptyStringLiteralExpression: {
+                *value = ConstantValue::String(nullptr, 0);
+                return true;
+            }
+
+            case SyntaxKind::NumericLiteralExpression: {
+                SyntaxToken literal = ((LiteralExpressionSyntax*) syntax)->literal;
+                return TryParseNumericLiteral(file->GetText(literal), literal.contextualKind, value);
+            }
+
+            case SyntaxKind::CharacterLiteralExpression: {
+                return TryParseCharLiteral(file->GetText(((CharacterLiteralExpressionSyntax*) syntax)->contents), value);
+            }
+
+            case SyntaxKind::StringLiteralExpression: {
+                // the text stays escaped, it is only decoded when written out. a string long enough to be split
+                // into several parts isn't folded
+                SyntaxList<StringPartSyntax>* parts = ((StringLiteralExpression*) syntax)->parts;
+                if (parts == nullptr || parts->size != 1 || parts->array[0]->GetKind() != SyntaxKind::StringLiteralPart) {
+                    return false;
+                }
+                FixedCharSpan text = file->GetText(((StringLiteralPartSyntax*) parts->array[0])->part);
+                *value = ConstantValue::String(text.ptr, (int32) text.size);
+                return true;
+            }
+
+            default: {
+                return false;
+            }
+
+        }
+
+    }
+
+    ConstantEvaluator::ConstantEvaluator(TypeResolutionMap* resolutionMap, uint32 runId)
+        : resolutionMap(resolutionMap)
+        , runId(runId)
+        , constantCount(0) {}
+
+    void ConstantEvaluator::AddError(SourceFileInfo* file, ErrorCode errorCode, FixedCharSpan span) {
+        // files that weren't resolved again already have whatever they reported last time
+        if (file->wasChanged || file->needsRelink) {
+            file->diagnostics.AddError(Diagnostic(errorCode, span));
+        }
+    }
+
+    ConstantFold ConstantEvaluator::Convert(SourceFileInfo* file, SyntaxBase* syntax, ConstantValue value, ConstantType type, bool isExplicit, ConstantValue* result) {
+
+        if (ConvertConstant(value, type, isExplicit, result) != ConstantFold::Folded) {
+            AddError(file, ErrorCode::ERR_ConstantValueCannotBeConverted, file->GetText(syntax));
+            return ConstantFold::Failed;
+        }
+
+        return ConstantFold::Folded;
+
+    }
+
+    ConstantFold ConstantEvaluator::GetFieldValue(FieldInfo* fieldInfo, ConstantValue* result) {
+
+        if (EvaluateField(fieldInfo) != ConstantState::Evaluated) {
+            return ConstantFold::Failed;
+        }
+
+        *result = fieldInfo->constantValue;
+        return ConstantFold::Folded;
+
+    }
+
+    ConstantState ConstantEvaluator::EvaluateField(FieldInfo* fieldInfo) {
+
+        if (fieldInfo->constantRunId == runId) {
+            if (fieldInfo->constantState == ConstantState::Evaluating) {
+                // its own initializer led back to it, whoever is still evaluating it finishes as Failed
+                AddError(fieldInfo->declaringType->declaringFile, ErrorCode::ERR_CircularConstantDefinition, fieldInfo->identifier);
+                return ConstantState::Failed;
+            }
+            return fieldInfo->constantState;
+        }
+
+        TypeInfo* declaringType = fieldInfo->declaringType;
+        SourceFileInfo* file = declaringType->declaringFile;
+
+        fieldInfo->constantRunId = runId;
+
+        // snapshot restored types have no syntax to evaluate until their file changes
+        if ((fieldInfo->modifiers & FieldModifiers::Const) == 0 || file == nullptr || file->syntaxTree == nullptr) {
+            fieldInfo->constantState = ConstantState::Failed;
+            return ConstantState::Failed;
+        }
+
+        fieldInfo->constantState = ConstantState::Evaluating;
+
+        ConstantValue value;
+        ConstantFold fold;
+
+        if (declaringType->typeClass == TypeClass::Enum) {
+            fold = EvaluateEnumMember(fieldInfo, &value);
+        }
+        else if (fieldInfo->syntaxNode->initializer == nullptr) {
+            AddError(file, ErrorCode::ERR_ConstantExpected, fieldInfo->identifier);
+            fold = ConstantFold::Failed;
+        }
+        else {
+            fold = EvaluateInitializer(file, declaringType, fieldInfo->syntaxNode->initializer->value, fieldInfo->type, &value);
+        }
+
+        if (fold == ConstantFold::Folded) {
+            fieldInfo->constantValue = value;
+            fieldInfo->constantState = ConstantState::Evaluated;
+            constantCount++;
+        }
+        else {
+            fieldInfo->constantState = ConstantState::Failed;
+        }
+
+        return fieldInfo->constantState;
+
+    }
+
+    ConstantFold ConstantEvaluator::EvaluateEnumMember(FieldInfo* fieldInfo, ConstantValue* result) {
+
+        TypeInfo* enumType = fieldInfo->declaringType;
+        SourceFileInfo* file = enumType->declaringFile;
+        EnumMemberDeclarationSyntax* member = GetEnumMemberSyntax(fieldInfo);
+        ConstantType underlyingType = GetEnumUnderlyingType(enumType);
+
+        ConstantValue value;
+
+        if (member->equalsValue != nullptr) {
+
+            ConstantFold fold = Evaluate(file, enumType, member->equalsValue->value, &value);
+
+            if (fold == ConstantFold::NotConstant) {
+                AddError(file, ErrorCode::ERR_ConstantExpected, file->GetText(member->equalsValue->value));
+                return ConstantFold::Failed;
+            }
+
+            if (fold != ConstantFold::Folded) {
+                return fold;
+            }
+
+            return Convert(file, member->equalsValue->value, value, underlyingType, false, result);
+
+        }
+
+        // without a value it's one more than the member before it, the first one is 0
+        if (fieldInfo == enumType->fields) {
+            return ConvertConstant(ConstantValue::Signed(ConstantType::Int32, 0), underlyingType, false, result);
+        }
+
+        ConstantValue one;
+        if (GetFieldValue(fieldInfo - 1, &value) != ConstantFold::Folded || ConvertConstant(ConstantValue::Signed(ConstantType::Int32, 1), underlyingType, false, &one) != ConstantFold::Folded) {
+            return ConstantFold::Failed;
+        }
+
+        if (FoldBinary(BinaryExpressionOp::Add, value, one, &value) != ConstantFold::Folded) {
+            return ConstantFold::Failed;
+        }
+
+        return Convert(file, member, value, underlyingType, false, result);
+
+    }
+
+    ConstantFold ConstantEvaluator::EvaluateInitializer(SourceFileInfo* file, TypeInfo* scope, ExpressionSyntax* syntax, ResolvedType type, ConstantValue* result) {
+
+        // an unresolved type was reported when it was resolved
+        if (type.IsUnresolved()) {
+            return ConstantFold::Failed;
+        }
+
+        ConstantType constantType = GetConstantType(type);
+        ConstantValue value;
+        ConstantFold fold;
+
+        if (syntax != nullptr && syntax->GetKind() == SyntaxKind::DefaultLiteralExpression) {
+            // default is zero of whatever it is assigned to
+            if (constantType == ConstantType::Bool) {
+                value = ConstantValue::Bool(false);
+            }
+            else if (IsNumericConstantType(constantType)) {
+                ConvertConstant(ConstantValue::Signed(ConstantType::Int32, 0), constantType, true, &value);
+            }
+            else {
+                value = ConstantValue::Null();
+            }
+            fold = ConstantFold::Folded;
+        }
+        else {
+            fold = Evaluate(file, scope, syntax, &value);
+        }
+
+        if (fold == ConstantFold::NotConstant) {
+            AddError(file, ErrorCode::ERR_ConstantExpected, file->GetText(syntax));
+            return ConstantFold::Failed;
+        }
+
+        if (fold != ConstantFold::Folded) {
+            return fold;
+        }
+
+        return Convert(file, syntax, value, constantType, false, result);
+
+    }
+
+    void ConstantEvaluator::EvaluateDefaultValues(MethodInfo* methodInfo) {
+
+        assert(!methodInfo->isDefaultParameterOverload);
+
+        TypeInfo* declaringType = methodInfo->declaringType;
+
+        for (int32 p = 0; p < methodInfo->parameterCount; p++) {
+
+            ParameterInfo* parameterInfo = &methodInfo->parameters[p];
+            parameterInfo->defaultValue = ConstantValue();
+
+            if (parameterInfo->syntaxNode == nullptr || parameterInfo->syntaxNode->defaultValue == nullptr) {
+                continue;
+            }
+
+            ExpressionSyntax* syntax = parameterInfo->syntaxNode->defaultValue->value;
+
+            // a struct can't be a constant but it can be defaulted, codegen zeroes whatever didn't fold
+            if (syntax != nullptr && syntax->GetKind() == SyntaxKind::DefaultLiteralExpression && GetConstantType(parameterInfo->type) == ConstantType::None) {
+                continue;
+            }
+
+            ConstantValue value;
+            if (EvaluateInitializer(declaringType->declaringFile, declaringType, syntax, parameterInfo->type, &value) == ConstantFold::Folded) {
+                parameterInfo->defaultValue = value;
+                constantCount++;
+            }
+
+        }
+
+    }
+
+    ConstantFold ConstantEvaluator::Evaluate(SourceFileInfo* file, TypeInfo* scope, ExpressionSyntax* syntax, ConstantValue* result) {
+
+        // whatever is missing was reported by the parser
+        if (syntax == nullptr) {
+            return ConstantFold::Failed;
+        }
+
+        switch (syntax->GetKind()) {
+
+            case SyntaxKind::ParenthesizedExpression: {
+                return Evaluate(file, scope, ((ParenthesizedExpressionSyntax*) syntax)->expression, result);
+            }
+
+            case SyntaxKind::TrueLiteralExpression:
+            case SyntaxKind::FalseLiteralExpression:
+            case SyntaxKind::NullLiteralExpression:
+            case SyntaxKind::NumericLiteralExpression:
+            case SyntaxKind::EmptyStringLiteralExpression:
+            case SyntaxKind::CharacterLiteralExpression:
+            case SyntaxKind::StringLiteralExpression: {
+                return TryFoldLiteral(file, syntax, result) ? ConstantFold::Folded : ConstantFold::NotConstant;
+            }
+
+            case SyntaxKind::UnaryPlusExpression:
+            case SyntaxKind::UnaryMinusExpression:
+            case SyntaxKind::BitwiseNotExpression:
+            case SyntaxKind::LogicalNotExpression: {
+                ConstantValue operand;
+                ConstantFold fold = Evaluate(file, scope, ((PrefixUnaryExpressionSyntax*) syntax)->operand, &operand);
+                if (fold != ConstantFold::Folded) {
+                    return fold;
+                }
+                return FoldUnary(GetUnaryOp(syntax->GetKind()), operand, result);
+            }
+
+            case SyntaxKind::AddExpression:
+            case SyntaxKind::SubtractExpression:
+            case SyntaxKind::MultiplyExpression:
+            case SyntaxKind::DivideExpression:
+            case SyntaxKind::ModuloExpression:
+            case SyntaxKind::LeftShiftExpression:
+            case SyntaxKind::RightShiftExpression:
+            case SyntaxKind::BitwiseAndExpression:
+            case SyntaxKind::BitwiseOrExpression:
+            case SyntaxKind::ExclusiveOrExpression:
+            case SyntaxKind::LogicalAndExpression:
+            case SyntaxKind::LogicalOrExpression:
+            case SyntaxKind::EqualsExpression:
+            case SyntaxKind::NotEqualsExpression:
+            case SyntaxKind::LessThanExpression:
+            case SyntaxKind::LessThanOrEqualExpression:
+            case SyntaxKind::GreaterThanExpression:
+            case SyntaxKind::GreaterThanOrEqualExpression: {
+
+                BinaryExpressionSyntax* binaryExpressionSyntax = (BinaryExpressionSyntax*) syntax;
+
+                ConstantValue left;
+                ConstantValue right;
+                ConstantFold fold = Evaluate(file, scope, binaryExpressionSyntax->left, &left);
+
+                if (fold == ConstantFold::Folded) {
+                    fold = Evaluate(file, scope, binaryExpressionSyntax->right, &right);
+                }
+
+                if (fold != ConstantFold::Folded) {
+                    return fold;
+                }
+
+                fold = FoldBinary(GetBinaryOp(syntax->GetKind()), left, right, result);
+
+                if (fold == ConstantFold::DivideByZero) {
+                    AddError(file, ErrorCode::ERR_ConstantDivideByZero, file->GetText(syntax));
+                    return ConstantFold::Failed;
+                }
+
+                return fold;
+
+            }
+
+            case SyntaxKind::CastExpression: {
+
+                CastExpressionSyntax* castExpressionSyntax = (CastExpressionSyntax*) syntax;
+                ConstantType type = ResolveCastType(file, resolutionMap, castExpressionSyntax->type);
+
+                if (type == ConstantType::None) {
+                    return ConstantFold::NotConstant;
+                }
+
+                ConstantValue value;
+                ConstantFold fold = Evaluate(file, scope, castExpressionSyntax->expression, &value);
+
+                if (fold != ConstantFold::Folded) {
+                    return fold;
+                }
+
+                return Convert(file, syntax, value, type, true, result);
+
+            }
+
+            case SyntaxKind::IdentifierName: {
+                FieldInfo* fieldInfo = FindConstantField(scope, file->GetText(((IdentifierNameSyntax*) syntax)->identifier));
+                return fieldInfo == nullptr ? ConstantFold::NotConstant : GetFieldValue(fieldInfo, result);
+            }
+
+            case SyntaxKind::SimpleMemberAccessExpression: {
+
+                // only Type.Member, a const is never reached through an instance
+                MemberAccessExpressionSyntax* memberAccessSyntax = (MemberAccessExpressionSyntax*) syntax;
+
+                if (memberAccessSyntax->expression == nullptr || memberAccessSyntax->expression->GetKind() != SyntaxKind::IdentifierName || memberAccessSyntax->name == nullptr || memberAccessSyntax->name->GetKind() != SyntaxKind::IdentifierName) {
+                    return ConstantFold::NotConstant;
+                }
+
+                FixedCharSpan typeName = file->GetText(((IdentifierNameSyntax*) memberAccessSyntax->expression)->identifier);
+                FixedCharSpan memberName = file->GetText(((IdentifierNameSyntax*) memberAccessSyntax->name)->identifier);
+
+                FieldInfo* fieldInfo = FindConstantField(ResolveConstantScope(file, resolutionMap, typeName), memberName);
+
+                return fieldInfo == nullptr ? ConstantFold::NotConstant : GetFieldValue(fieldInfo, result);
+
+            }
+
+            default: {
+                return ConstantFold::NotConstant;
+            }
+
+        }
+
+    }
+
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "../PrimitiveTypes.h"
+#include "../Util/FixedCharSpan.h"
+#include "../Parsing3/ErrorCode.h"
+#include "./ResolvedType.h"
+#include "./ConstantValue.h"
+#include "./ConstantFolding.h"
+#include "./MemberInfo.h"
+
+namespace Alchemy::Compilation {
+
+    struct SourceFileInfo;
+    struct TypeResolutionMap;
+    struct SyntaxBase;
+    struct ExpressionSyntax;
+    struct EnumMemberDeclarationSyntax;
+
+    // enum members are fields without a declarator, this is the syntax they came from
+    EnumMemberDeclarationSyntax* GetEnumMemberSyntax(FieldInfo* fieldInfo);
+
+    // int unless the enum's base list names another integral type
+    ConstantType GetEnumUnderlyingType(TypeInfo* enumType);
+
+    // what a value of `type` has to be folded to. classes only take null, None for anything that can't be a constant
+    ConstantType GetConstantType(ResolvedType type);
+
+    // a const field or enum member `name` finds from inside `typeInfo`, inherited ones included
+    FieldInfo* FindConstantField(TypeInfo* typeInfo, FixedCharSpan name);
+
+    // the type a bare name means in `file`, for `Type.Member`. null when it isn't one, nothing is reported. a type
+    // found here becomes a dependency of `file`, its bodies relink when it changes shape
+    TypeInfo* ResolveConstantScope(SourceFileInfo* file, TypeResolutionMap* resolutionMap, FixedCharSpan name);
+
+    // the cast's target when it is a built in or an enum, None otherwise
+    ConstantType ResolveCastType(SourceFileInfo* file, TypeResolutionMap* resolutionMap, SyntaxBase* typeSyntax);
+
+    // true, false, null, numbers, chars and strings without interpolations. raw strings and default aren't folded
+    bool TryFoldLiteral(SourceFileInfo* file, ExpressionSyntax* syntax, ConstantValue* value);
+
+    // Folds everything declared as a constant before any method body is looked at: const fields, enum members and
+    // default parameter values. A field is evaluated the first time something needs it, so declaration order doesn't
+    // matter and reaching a field that is still being evaluated is a cycle. Runs on one thread, nothing else touches
+    // the fields' constant state while it does.
+    struct ConstantEvaluator {
+
+        TypeResolutionMap* resolutionMap;
+        uint32 runId;
+        int32 constantCount;
+
+        ConstantEvaluator(TypeResolutionMap* resolutionMap, uint32 runId);
+
+        ConstantState EvaluateField(FieldInfo* fieldInfo);
+
+        // call it on the full method only, its overloads share the parameters
+        void EvaluateDefaultValues(MethodInfo* methodInfo);
+
+        // errors are reported where they happen and come back as Failed, NotConstant is left to the caller. `scope`
+        // is the type whose constants are in scope by name
+        ConstantFold Evaluate(SourceFileInfo* file, TypeInfo* scope, ExpressionSyntax* syntax, ConstantValue* result);
+
+    private:
+
+        ConstantFold EvaluateInitializer(SourceFileInfo* file, TypeInfo* scope, ExpressionSyntax* syntax, ResolvedType type, ConstantValue* result);
+
+        ConstantFold EvaluateEnumMember(FieldInfo* fieldInfo, ConstantValue* result);
+
+        ConstantFold GetFieldValue(FieldInfo* fieldInfo, ConstantValue* result);
+
+        ConstantFold Convert(SourceFileInfo* file, SyntaxBase* syntax, ConstantValue value, ConstantType type, bool isExplicit, ConstantValue* result);
+
+        void AddError(SourceFileInfo* file, ErrorCode errorCode, FixedCharSpan span);
+
+    };
+
+}
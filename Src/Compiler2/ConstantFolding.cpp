@@ -0,0 +1,803 @@
+#include "./ConstantFolding.h"
+#include <type_traits>
+#include <cmath>
+#include <cstdlib>
+
+namespace Alchemy::Compilation {
+
+    typedef ConstantFold (* BinaryFoldFn)(ConstantValue left, ConstantValue right, ConstantValue* result);
+    typedef ConstantFold (* UnaryFoldFn)(ConstantValue operand, ConstantValue* result);
+
+    template<typename T>
+    struct IntegerConstantType;
+
+    template<>
+    struct IntegerConstantType<int32> {
+        static constexpr ConstantType value = ConstantType::Int32;
+    };
+
+    template<>
+    struct IntegerConstantType<uint32> {
+        static constexpr ConstantType value = ConstantType::UInt32;
+    };
+
+    template<>
+    struct IntegerConstantType<int64> {
+        static constexpr ConstantType value = ConstantType::Int64;
+    };
+
+    template<>
+    struct IntegerConstantType<uint64> {
+        static constexpr ConstantType value = ConstantType::UInt64;
+    };
+
+    template<typename T>
+    static T GetInteger(ConstantValue value) {
+        if constexpr (std::is_signed<T>::value) {
+            return (T) value.intValue;
+        }
+        else {
+            return (T) value.uintValue;
+        }
+    }
+
+    template<typename T>
+    static ConstantValue MakeInteger(T value) {
+        if constexpr (std::is_signed<T>::value) {
+            return ConstantValue::Signed(IntegerConstantType<T>::value, (int64) value);
+        }
+        else {
+            return ConstantValue::Unsigned(IntegerConstantType<T>::value, (uint64) value);
+        }
+    }
+
+    template<typename T>
+    static T GetReal(ConstantValue value) {
+        if constexpr (std::is_same<T, float>::value) {
+            return value.floatValue;
+        }
+        else {
+            return value.doubleValue;
+        }
+    }
+
+    template<typename T>
+    static ConstantValue MakeReal(T value) {
+        if constexpr (std::is_same<T, float>::value) {
+            return ConstantValue::Float(value);
+        }
+        else {
+            return ConstantValue::Double(value);
+        }
+    }
+
+    template<BinaryExpressionOp kOp, typename T>
+    static bool Compare(T x, T y) {
+        if constexpr (kOp == BinaryExpressionOp::Equal) {
+            return x == y;
+        }
+        else if constexpr (kOp == BinaryExpressionOp::NotEqual) {
+            return x != y;
+        }
+        else if constexpr (kOp == BinaryExpressionOp::LessThan) {
+            return x < y;
+        }
+        else if constexpr (kOp == BinaryExpressionOp::LessThanOrEqual) {
+            return x <= y;
+        }
+        else if constexpr (kOp == BinaryExpressionOp::GreaterThan) {
+            return x > y;
+        }
+        else {
+            return x >= y;
+        }
+    }
+
+    template<BinaryExpressionOp kOp>
+    static constexpr bool IsComparison() {
+        return kOp >= BinaryExpressionOp::Equal && kOp <= BinaryExpressionOp::GreaterThanOrEqual;
+    }
+
+    // wraps the way the emitted code would, the arithmetic is done unsigned so overflowing is defined here too
+    template<typename T, BinaryExpressionOp kOp>
+    static ConstantFold FoldInteger(ConstantValue left, ConstantValue right, ConstantValue* result) {
+
+        typedef typename std::make_unsigned<T>::type U;
+
+        T x = GetInteger<T>(left);
+
+        if constexpr (kOp == BinaryExpressionOp::ShiftLeft || kOp == BinaryExpressionOp::ShiftRight) {
+            // the count is always an int, only as many of its low bits as the left side is wide are used
+            int32 count = (int32) right.intValue & (int32) (sizeof(T) * 8 - 1);
+            *result = MakeInteger<T>(kOp == BinaryExpressionOp::ShiftLeft ? (T) ((U) x << count) : (T) (x >> count));
+            return ConstantFold::Folded;
+        }
+        else {
+
+            T y = GetInteger<T>(right);
+
+            if constexpr (kOp == BinaryExpressionOp::Add) {
+                *result = MakeInteger<T>((T) ((U) x + (U) y));
+            }
+            else if constexpr (kOp == BinaryExpressionOp::Subtract) {
+                *result = MakeInteger<T>((T) ((U) x - (U) y));
+            }
+            else if constexpr (kOp == BinaryExpressionOp::Multiply) {
+                *result = MakeInteger<T>((T) ((U) x * (U) y));
+            }
+            else if constexpr (kOp == BinaryExpressionOp::Divide || kOp == BinaryExpressionOp::Modulo) {
+
+                if (y == 0) {
+                    return ConstantFold::DivideByZero;
+                }
+
+                if constexpr (std::is_signed<T>::value) {
+                    // min / -1 doesn't fit, it wraps back to min
+                    if (y == -1) {
+                        *result = MakeInteger<T>(kOp == BinaryExpressionOp::Divide ? (T) ((U) 0 - (U) x) : (T) 0);
+                        return ConstantFold::Folded;
+                    }
+                }
+
+                *result = MakeInteger<T>(kOp == BinaryExpressionOp::Divide ? (T) (x / y) : (T) (x % y));
+            }
+            else if constexpr (kOp == BinaryExpressionOp::BitwiseAnd) {
+                *result = MakeInteger<T>((T) (x & y));
+            }
+            else if constexpr (kOp == BinaryExpressionOp::BitwiseOr) {
+                *result = MakeInteger<T>((T) (x | y));
+            }
+            else if constexpr (kOp == BinaryExpressionOp::ExclusiveOr) {
+                *result = MakeInteger<T>((T) (x ^ y));
+            }
+            else if constexpr (IsComparison<kOp>()) {
+                *result = ConstantValue::Bool(Compare<kOp>(x, y));
+            }
+            else {
+                return ConstantFold::NotConstant;
+            }
+
+            return ConstantFold::Folded;
+
+        }
+
+    }
+
+    // dividing by zero is an infinity like it is at runtime, not an error
+    template<typename T, BinaryExpressionOp kOp>
+    static ConstantFold FoldReal(ConstantValue left, ConstantValue right, ConstantValue* result) {
+
+        T x = GetReal<T>(left);
+        T y = GetReal<T>(right);
+
+        if constexpr (kOp == BinaryExpressionOp::Add) {
+            *result = MakeReal<T>(x + y);
+        }
+        else if constexpr (kOp == BinaryExpressionOp::Subtract) {
+            *result = MakeReal<T>(x - y);
+        }
+        else if constexpr (kOp == BinaryExpressionOp::Multiply) {
+            *result = MakeReal<T>(x * y);
+        }
+        else if constexpr (kOp == BinaryExpressionOp::Divide) {
+            *result = MakeReal<T>(x / y);
+        }
+        else if constexpr (kOp == BinaryExpressionOp::Modulo) {
+            *result = MakeReal<T>((T) std::fmod(x, y));
+        }
+        else if constexpr (IsComparison<kOp>()) {
+            *result = ConstantValue::Bool(Compare<kOp>(x, y));
+        }
+        else {
+            return ConstantFold::NotConstant;
+        }
+
+        return ConstantFold::Folded;
+
+    }
+
+    template<BinaryExpressionOp kOp>
+    static ConstantFold FoldBool(ConstantValue left, ConstantValue right, ConstantValue* result) {
+
+        bool x = left.boolValue;
+        bool y = right.boolValue;
+
+        if constexpr (kOp == BinaryExpressionOp::BitwiseAnd || kOp == BinaryExpressionOp::LogicalAnd) {
+            *result = ConstantValue::Bool(x && y);
+        }
+        else if constexpr (kOp == BinaryExpressionOp::BitwiseOr || kOp == BinaryExpressionOp::LogicalOr) {
+            *result = ConstantValue::Bool(x || y);
+        }
+        else if constexpr (kOp == BinaryExpressionOp::ExclusiveOr || kOp == BinaryExpressionOp::NotEqual) {
+            *result = ConstantValue::Bool(x != y);
+        }
+        else if constexpr (kOp == BinaryExpressionOp::Equal) {
+            *result = ConstantValue::Bool(x == y);
+        }
+        else {
+            return ConstantFold::NotConstant;
+        }
+
+        return ConstantFold::Folded;
+
+    }
+
+    template<typename T, UnaryExpressionOp kOp>
+    static ConstantFold FoldUnaryInteger(ConstantValue operand, ConstantValue* result) {
+
+        typedef typename std::make_unsigned<T>::type U;
+
+        T x = GetInteger<T>(operand);
+
+        if constexpr (kOp == UnaryExpressionOp::Plus) {
+            *result = MakeInteger<T>(x);
+        }
+        else if constexpr (kOp == UnaryExpressionOp::Minus) {
+            *result = MakeInteger<T>((T) ((U) 0 - (U) x));
+        }
+        else if constexpr (kOp == UnaryExpressionOp::BitwiseNot) {
+            *result = MakeInteger<T>((T) ~(U) x);
+        }
+        else {
+            return ConstantFold::NotConstant;
+        }
+
+        return ConstantFold::Folded;
+
+    }
+
+    template<typename T, UnaryExpressionOp kOp>
+    static ConstantFold FoldUnaryReal(ConstantValue operand, ConstantValue* result) {
+
+        T x = GetReal<T>(operand);
+
+        if constexpr (kOp == UnaryExpressionOp::Plus) {
+            *result = MakeReal<T>(x);
+        }
+        else if constexpr (kOp == UnaryExpressionOp::Minus) {
+            *result = MakeReal<T>(-x);
+        }
+        else {
+            return ConstantFold::NotConstant;
+        }
+
+        return ConstantFold::Folded;
+
+    }
+
+    template<UnaryExpressionOp kOp>
+    static ConstantFold FoldUnaryBool(ConstantValue operand, ConstantValue* result) {
+        if constexpr (kOp == UnaryExpressionOp::LogicalNot) {
+            *result = ConstantValue::Bool(!operand.boolValue);
+            return ConstantFold::Folded;
+        }
+        else {
+            return ConstantFold::NotConstant;
+        }
+    }
+
+    // one entry per ConstantType. operands are promoted before the lookup, so the columns of anything narrower than
+    // an int, char, strings and null stay empty
+#define BINARY_FOLD_ROW(op) {                                                                               \
+        nullptr, FoldBool<op>, nullptr, nullptr, nullptr, nullptr, nullptr,                                 \
+        FoldInteger<int32, op>, FoldInteger<uint32, op>, FoldInteger<int64, op>, FoldInteger<uint64, op>,   \
+        FoldReal<float, op>, FoldReal<double, op>, nullptr, nullptr                                         \
+    }
+
+#define UNARY_FOLD_ROW(op) {                                                                                                \
+        nullptr, FoldUnaryBool<op>, nullptr, nullptr, nullptr, nullptr, nullptr,                                            \
+        FoldUnaryInteger<int32, op>, FoldUnaryInteger<uint32, op>, FoldUnaryInteger<int64, op>, FoldUnaryInteger<uint64, op>, \
+        FoldUnaryReal<float, op>, FoldUnaryReal<double, op>, nullptr, nullptr                                               \
+    }
+
+    static const BinaryFoldFn kBinaryFolds[(int32) BinaryExpressionOp::Count][kConstantTypeCount] = {
+        {}, // Invalid
+        BINARY_FOLD_ROW(BinaryExpressionOp::Add),
+        BINARY_FOLD_ROW(BinaryExpressionOp::Subtract),
+        BINARY_FOLD_ROW(BinaryExpressionOp::Multiply),
+        BINARY_FOLD_ROW(BinaryExpressionOp::Divide),
+        BINARY_FOLD_ROW(BinaryExpressionOp::Modulo),
+        BINARY_FOLD_ROW(BinaryExpressionOp::ShiftRight),
+        BINARY_FOLD_ROW(BinaryExpressionOp::ShiftLeft),
+        BINARY_FOLD_ROW(BinaryExpressionOp::BitwiseAnd),
+        BINARY_FOLD_ROW(BinaryExpressionOp::BitwiseOr),
+        BINARY_FOLD_ROW(BinaryExpressionOp::ExclusiveOr),
+        BINARY_FOLD_ROW(BinaryExpressionOp::LogicalAnd),
+        BINARY_FOLD_ROW(BinaryExpressionOp::LogicalOr),
+        BINARY_FOLD_ROW(BinaryExpressionOp::Equal),
+        BINARY_FOLD_ROW(BinaryExpressionOp::NotEqual),
+        BINARY_FOLD_ROW(BinaryExpressionOp::LessThan),
+        BINARY_FOLD_ROW(BinaryExpressionOp::LessThanOrEqual),
+        BINARY_FOLD_ROW(BinaryExpressionOp::GreaterThan),
+        BINARY_FOLD_ROW(BinaryExpressionOp::GreaterThanOrEqual),
+    };
+
+    static const UnaryFoldFn kUnaryFolds[(int32) UnaryExpressionOp::Count][kConstantTypeCount] = {
+        {}, // Invalid
+        UNARY_FOLD_ROW(UnaryExpressionOp::Plus),
+        UNARY_FOLD_ROW(UnaryExpressionOp::Minus),
+        UNARY_FOLD_ROW(UnaryExpressionOp::BitwiseNot),
+        UNARY_FOLD_ROW(UnaryExpressionOp::LogicalNot),
+    };
+
+#undef BINARY_FOLD_ROW
+#undef UNARY_FOLD_ROW
+
+    // C#'s numeric promotion. a signed operand against a ulong has no common type, against a uint it meets in long
+    static constexpr ConstantType PromoteBinary(ConstantType a, ConstantType b) {
+
+        if (a == ConstantType::Bool && b == ConstantType::Bool) {
+            return ConstantType::Bool;
+        }
+
+        if (!IsNumericConstantType(a) || !IsNumericConstantType(b)) {
+            return ConstantType::None;
+        }
+
+        if (a == ConstantType::Double || b == ConstantType::Double) {
+            return ConstantType::Double;
+        }
+
+        if (a == ConstantType::Float || b == ConstantType::Float) {
+            return ConstantType::Float;
+        }
+
+        if (a == ConstantType::UInt64 || b == ConstantType::UInt64) {
+            return IsSignedConstantType(a) || IsSignedConstantType(b) ? ConstantType::None : ConstantType::UInt64;
+        }
+
+        if (a == ConstantType::Int64 || b == ConstantType::Int64) {
+            return ConstantType::Int64;
+        }
+
+        if (a == ConstantType::UInt32 || b == ConstantType::UInt32) {
+            return IsSignedConstantType(a) || IsSignedConstantType(b) ? ConstantType::Int64 : ConstantType::UInt32;
+        }
+
+        return ConstantType::Int32;
+
+    }
+
+    static constexpr ConstantType PromoteUnary(ConstantType a) {
+        if (a >= ConstantType::Char && a <= ConstantType::UInt16) {
+            return ConstantType::Int32;
+        }
+        return a;
+    }
+
+    struct PromotionTable {
+
+        ConstantType binary[kConstantTypeCount][kConstantTypeCount];
+        ConstantType unary[kConstantTypeCount];
+
+        constexpr PromotionTable()
+            : binary()
+            , unary() {
+            for (int32 a = 0; a < kConstantTypeCount; a++) {
+                unary[a] = PromoteUnary((ConstantType) a);
+                for (int32 b = 0; b < kConstantTypeCount; b++) {
+                    binary[a][b] = PromoteBinary((ConstantType) a, (ConstantType) b);
+                }
+            }
+        }
+
+    };
+
+    static constexpr PromotionTable kPromotion;
+
+#define TYPE_BIT(x) (1u << (uint32) ConstantType::x)
+
+    // what each type converts to without a cast, besides itself
+    static const uint32 kImplicitConversions[kConstantTypeCount] = {
+        0, // None
+        0, // Bool
+        TYPE_BIT(UInt16) | TYPE_BIT(Int32) | TYPE_BIT(UInt32) | TYPE_BIT(Int64) | TYPE_BIT(UInt64) | TYPE_BIT(Float) | TYPE_BIT(Double), // Char
+        TYPE_BIT(Int16) | TYPE_BIT(Int32) | TYPE_BIT(Int64) | TYPE_BIT(Float) | TYPE_BIT(Double), // Int8
+        TYPE_BIT(Int16) | TYPE_BIT(UInt16) | TYPE_BIT(Int32) | TYPE_BIT(UInt32) | TYPE_BIT(Int64) | TYPE_BIT(UInt64) | TYPE_BIT(Float) | TYPE_BIT(Double), // UInt8
+        TYPE_BIT(Int32) | TYPE_BIT(Int64) | TYPE_BIT(Float) | TYPE_BIT(Double), // Int16
+        TYPE_BIT(Int32) | TYPE_BIT(UInt32) | TYPE_BIT(Int64) | TYPE_BIT(UInt64) | TYPE_BIT(Float) | TYPE_BIT(Double), // UInt16
+        TYPE_BIT(Int64) | TYPE_BIT(Float) | TYPE_BIT(Double), // Int32
+        TYPE_BIT(Int64) | TYPE_BIT(UInt64) | TYPE_BIT(Float) | TYPE_BIT(Double), // UInt32
+        TYPE_BIT(Float) | TYPE_BIT(Double), // Int64
+        TYPE_BIT(Float) | TYPE_BIT(Double), // UInt64
+        TYPE_BIT(Double), // Float
+        0, // Double
+        0, // String
+        TYPE_BIT(String), // Null
+    };
+
+#undef TYPE_BIT
+
+    // only the integral rows are read
+    static const int64 kIntegerMin[kConstantTypeCount] = {
+        0, 0, 0, INT8_MIN, 0, INT16_MIN, 0, INT32_MIN, 0, INT64_MIN, 0, 0, 0, 0, 0
+    };
+
+    static const uint64 kIntegerMax[kConstantTypeCount] = {
+        0, 0, UINT16_MAX, INT8_MAX, UINT8_MAX, INT16_MAX, UINT16_MAX, INT32_MAX, UINT32_MAX, INT64_MAX, UINT64_MAX, 0, 0, 0, 0
+    };
+
+    // every conversion of a constant is checked, a value that doesn't fit is an error rather than truncated
+    static ConstantFold ConvertNumeric(ConstantValue value, ConstantType type, ConstantValue* result) {
+
+        bool isReal = value.type == ConstantType::Float || value.type == ConstantType::Double;
+
+        if (type == ConstantType::Float || type == ConstantType::Double) {
+
+            double d = value.type == ConstantType::Float ? value.floatValue : value.doubleValue;
+
+            if (type == ConstantType::Float) {
+                *result = ConstantValue::Float(isReal ? (float) d : IsSignedConstantType(value.type) ? (float) value.intValue : (float) value.uintValue);
+            }
+            else {
+                *result = ConstantValue::Double(isReal ? d : IsSignedConstantType(value.type) ? (double) value.intValue : (double) value.uintValue);
+            }
+
+            return ConstantFold::Folded;
+
+        }
+
+        bool negative;
+        uint64 bits;
+
+        if (isReal) {
+
+            double d = value.type == ConstantType::Float ? value.floatValue : value.doubleValue;
+
+            if (std::isnan(d)) {
+                return ConstantFold::OutOfRange;
+            }
+
+            d = std::trunc(d);
+
+            if (d < -9223372036854775808.0 || d >= 18446744073709551616.0) {
+                return ConstantFold::OutOfRange;
+            }
+
+            negative = d < 0;
+            bits = negative ? (uint64) (int64) d : (uint64) d;
+
+        }
+        else if (IsSignedConstantType(value.type)) {
+            negative = value.intValue < 0;
+            bits = (uint64) value.intValue;
+        }
+        else {
+            negative = false;
+            bits = value.uintValue;
+        }
+
+        if (negative ? (int64) bits < kIntegerMin[(int32) type] : bits > kIntegerMax[(int32) type]) {
+            return ConstantFold::OutOfRange;
+        }
+
+        *result = IsSignedConstantType(type)
+            ? ConstantValue::Signed(type, (int64) bits)
+            : ConstantValue::Unsigned(type, bits);
+
+        return ConstantFold::Folded;
+
+    }
+
+    ConstantFold ConvertConstant(ConstantValue value, ConstantType type, bool isExplicit, ConstantValue* result) {
+
+        if (value.type == type) {
+            *result = value;
+            return ConstantFold::Folded;
+        }
+
+        if (value.type == ConstantType::None || type == ConstantType::None) {
+            return ConstantFold::NotConstant;
+        }
+
+        bool isImplicit = (kImplicitConversions[(int32) value.type] & (1u << (uint32) type)) != 0;
+
+        if (!IsNumericConstantType(value.type) || !IsNumericConstantType(type)) {
+            if (!isImplicit) {
+                return ConstantFold::OutOfRange;
+            }
+            *result = value;
+            result->type = type;
+            return ConstantFold::Folded;
+        }
+
+        if (!isExplicit && !isImplicit) {
+            // int and long constants narrow to whatever they fit, nothing else does without a cast
+            bool narrows = (value.type == ConstantType::Int32 && IsIntegralConstantType(type) && type != ConstantType::Char)
+                || (value.type == ConstantType::Int64 && type == ConstantType::UInt64);
+            if (!narrows) {
+                return ConstantFold::OutOfRange;
+            }
+        }
+
+        return ConvertNumeric(value, type, result);
+
+    }
+
+    ConstantFold FoldBinary(BinaryExpressionOp op, ConstantValue left, ConstantValue right, ConstantValue* result) {
+
+        ConstantType type;
+        ConstantValue a;
+        ConstantValue b;
+
+        if (op == BinaryExpressionOp::ShiftLeft || op == BinaryExpressionOp::ShiftRight) {
+            // the sides aren't promoted together, the count is an int no matter what is shifted
+            type = kPromotion.unary[(int32) left.type];
+            if (!IsIntegralConstantType(type) || ConvertConstant(right, ConstantType::Int32, false, &b) != ConstantFold::Folded) {
+                return ConstantFold::NotConstant;
+            }
+        }
+        else {
+            type = kPromotion.binary[(int32) left.type][(int32) right.type];
+            if (type == ConstantType::None || ConvertConstant(right, type, false, &b) != ConstantFold::Folded) {
+                return ConstantFold::NotConstant;
+            }
+        }
+
+        BinaryFoldFn fn = kBinaryFolds[(int32) op][(int32) type];
+
+        if (fn == nullptr || ConvertConstant(left, type, false, &a) != ConstantFold::Folded) {
+            return ConstantFold::NotConstant;
+        }
+
+        return fn(a, b, result);
+
+    }
+
+    ConstantFold FoldUnary(UnaryExpressionOp op, ConstantValue operand, ConstantValue* result) {
+
+        ConstantType type = kPromotion.unary[(int32) operand.type];
+
+        if (op == UnaryExpressionOp::Minus) {
+            // -uint is a long, -ulong only exists for the literal that is long's minimum
+            if (type == ConstantType::UInt32) {
+                type = ConstantType::Int64;
+            }
+            else if (type == ConstantType::UInt64) {
+                if (operand.uintValue != 0x8000000000000000ull) {
+                    return ConstantFold::NotConstant;
+                }
+                *result = ConstantValue::Signed(ConstantType::Int64, INT64_MIN);
+                return ConstantFold::Folded;
+            }
+        }
+
+        UnaryFoldFn fn = kUnaryFolds[(int32) op][(int32) type];
+        ConstantValue value;
+
+        if (fn == nullptr || ConvertConstant(operand, type, false, &value) != ConstantFold::Folded) {
+            return ConstantFold::NotConstant;
+        }
+
+        return fn(value, result);
+
+    }
+
+    ConstantType ConstantTypeFromBuiltIn(BuiltInTypeName typeName) {
+        switch (typeName) {
+            case BuiltInTypeName::Bool: return ConstantType::Bool;
+            case BuiltInTypeName::Char: return ConstantType::Char;
+            case BuiltInTypeName::Int8: return ConstantType::Int8;
+            case BuiltInTypeName::UInt8: return ConstantType::UInt8;
+            case BuiltInTypeName::Int16: return ConstantType::Int16;
+            case BuiltInTypeName::UInt16: return ConstantType::UInt16;
+            case BuiltInTypeName::Int32: return ConstantType::Int32;
+            case BuiltInTypeName::UInt32: return ConstantType::UInt32;
+            case BuiltInTypeName::Int64: return ConstantType::Int64;
+            case BuiltInTypeName::UInt64: return ConstantType::UInt64;
+            case BuiltInTypeName::Float: return ConstantType::Float;
+            case BuiltInTypeName::Double: return ConstantType::Double;
+            case BuiltInTypeName::String: return ConstantType::String;
+            default: return ConstantType::None;
+        }
+    }
+
+    BinaryExpressionOp GetBinaryOp(SyntaxKind kind) {
+        switch (kind) {
+            case SyntaxKind::AddExpression: return BinaryExpressionOp::Add;
+            case SyntaxKind::SubtractExpression: return BinaryExpressionOp::Subtract;
+            case SyntaxKind::MultiplyExpression: return BinaryExpressionOp::Multiply;
+            case SyntaxKind::DivideExpression: return BinaryExpressionOp::Divide;
+            case SyntaxKind::ModuloExpression: return BinaryExpressionOp::Modulo;
+            case SyntaxKind::LeftShiftExpression: return BinaryExpressionOp::ShiftLeft;
+            case SyntaxKind::RightShiftExpression: return BinaryExpressionOp::ShiftRight;
+            case SyntaxKind::BitwiseAndExpression: return BinaryExpressionOp::BitwiseAnd;
+            case SyntaxKind::BitwiseOrExpression: return BinaryExpressionOp::BitwiseOr;
+            case SyntaxKind::ExclusiveOrExpression: return BinaryExpressionOp::ExclusiveOr;
+            case SyntaxKind::LogicalAndExpression: return BinaryExpressionOp::LogicalAnd;
+            case SyntaxKind::LogicalOrExpression: return BinaryExpressionOp::LogicalOr;
+            case SyntaxKind::EqualsExpression: return BinaryExpressionOp::Equal;
+            case SyntaxKind::NotEqualsExpression: return BinaryExpressionOp::NotEqual;
+            case SyntaxKind::LessThanExpression: return BinaryExpressionOp::LessThan;
+            case SyntaxKind::LessThanOrEqualExpression: return BinaryExpressionOp::LessThanOrEqual;
+            case SyntaxKind::GreaterThanExpression: return BinaryExpressionOp::GreaterThan;
+            case SyntaxKind::GreaterThanOrEqualExpression: return BinaryExpressionOp::GreaterThanOrEqual;
+            default: return BinaryExpressionOp::Invalid;
+        }
+    }
+
+    UnaryExpressionOp GetUnaryOp(SyntaxKind kind) {
+        switch (kind) {
+            case SyntaxKind::UnaryPlusExpression: return UnaryExpressionOp::Plus;
+            case SyntaxKind::UnaryMinusExpression: return UnaryExpressionOp::Minus;
+            case SyntaxKind::BitwiseNotExpression: return UnaryExpressionOp::BitwiseNot;
+            case SyntaxKind::LogicalNotExpression: return UnaryExpressionOp::LogicalNot;
+            default: return UnaryExpressionOp::Invalid;
+        }
+    }
+
+    bool TryParseNumericLiteral(FixedCharSpan text, TokenKind contextualKind, ConstantValue* value) {
+
+        char buffer[128];
+        int32 size = 0;
+
+        for (size_t i = 0; i < text.size; i++) {
+            if (text.ptr[i] == '_') {
+                continue;
+            }
+            if (size == (int32) sizeof(buffer) - 1) {
+                return false;
+            }
+            buffer[size++] = text.ptr[i];
+        }
+
+        buffer[size] = '\0';
+
+        switch (contextualKind) {
+
+            case TokenKind::FloatLiteral:
+            case TokenKind::DoubleLiteral: {
+                // the suffix is where parsing stops
+                char* end;
+                if (contextualKind == TokenKind::FloatLiteral) {
+                    *value = ConstantValue::Float(strtof(buffer, &end));
+                }
+                else {
+                    *value = ConstantValue::Double(strtod(buffer, &end));
+                }
+                return end != buffer;
+            }
+
+            case TokenKind::Int32Literal:
+            case TokenKind::UInt32Literal:
+            case TokenKind::Int64Literal:
+            case TokenKind::UInt64Literal: {
+
+                while (size > 0 && (buffer[size - 1] == 'u' || buffer[size - 1] == 'U' || buffer[size - 1] == 'l' || buffer[size - 1] == 'L')) {
+                    buffer[--size] = '\0';
+                }
+
+                uint64 bits = 0;
+
+                if (size > 2 && buffer[0] == '0' && (buffer[1] == 'x' || buffer[1] == 'X')) {
+                    bits = strtoull(buffer + 2, nullptr, 16);
+                }
+                else if (size > 2 && buffer[0] == '0' && (buffer[1] == 'b' || buffer[1] == 'B')) {
+                    for (int32 i = 2; i < size; i++) {
+                        bits = (bits << 1) | (buffer[i] == '1' ? 1 : 0);
+                    }
+                }
+                else {
+                    bits = strtoull(buffer, nullptr, 10);
+                }
+
+                // the scanner already picked the smallest kind the value fits
+                switch (contextualKind) {
+                    case TokenKind::Int32Literal: *value = ConstantValue::Signed(ConstantType::Int32, (int64) bits); break;
+                    case TokenKind::UInt32Literal: *value = ConstantValue::Unsigned(ConstantType::UInt32, bits); break;
+                    case TokenKind::Int64Literal: *value = ConstantValue::Signed(ConstantType::Int64, (int64) bits); break;
+                    default: *value = ConstantValue::Unsigned(ConstantType::UInt64, bits); break;
+                }
+
+                return true;
+
+            }
+
+            default: {
+                return false;
+            }
+
+        }
+
+    }
+
+    static int32 HexDigitValue(char c) {
+        if (c >= '0' && c <= '9') {
+            return c - '0';
+        }
+        if (c >= 'a' && c <= 'f') {
+            return c - 'a' + 10;
+        }
+        if (c >= 'A' && c <= 'F') {
+            return c - 'A' + 10;
+        }
+        return -1;
+    }
+
+    int32 DecodeCharacter(const char* ptr, const char* end, uint32* codepoint) {
+
+        if (ptr >= end) {
+            return 0;
+        }
+
+        if (ptr[0] != '\\') {
+
+            uint8 lead = (uint8) ptr[0];
+            int32 width = lead < 0x80 ? 1 : (lead >> 5) == 0x6 ? 2 : (lead >> 4) == 0xE ? 3 : 4;
+
+            if (end - ptr < width) {
+                return 0;
+            }
+
+            uint32 c = width == 1 ? lead : width == 2 ? lead & 0x1F : width == 3 ? lead & 0x0F : lead & 0x07;
+
+            for (int32 i = 1; i < width; i++) {
+                c = (c << 6) | ((uint8) ptr[i] & 0x3F);
+            }
+
+            *codepoint = c;
+            return width;
+
+        }
+
+        if (end - ptr < 2) {
+            return 0;
+        }
+
+        switch (ptr[1]) {
+            case '\'': *codepoint = '\''; return 2;
+            case '"': *codepoint = '"'; return 2;
+            case '\\': *codepoint = '\\'; return 2;
+            case '$': *codepoint = '$'; return 2;
+            case '0': *codepoint = 0; return 2;
+            case 'a': *codepoint = 7; return 2;
+            case 'b': *codepoint = 8; return 2;
+            case 'f': *codepoint = 12; return 2;
+            case 'n': *codepoint = 10; return 2;
+            case 'r': *codepoint = 13; return 2;
+            case 't': *codepoint = 9; return 2;
+            case 'v': *codepoint = 11; return 2;
+            case 'x':
+            case 'u':
+            case 'U': {
+
+                // \u is exactly 4 digits, \U 8 and \x anything from 1 to 4
+                int32 minDigits = ptr[1] == 'x' ? 1 : ptr[1] == 'u' ? 4 : 8;
+                int32 maxDigits = ptr[1] == 'x' ? 4 : minDigits;
+                int32 digits = 0;
+                uint32 c = 0;
+
+                while (digits < maxDigits && ptr + 2 + digits < end && HexDigitValue(ptr[2 + digits]) >= 0) {
+                    c = (c << 4) | (uint32) HexDigitValue(ptr[2 + digits]);
+                    digits++;
+                }
+
+                if (digits < minDigits) {
+                    return 0;
+                }
+
+                *codepoint = c;
+                return 2 + digits;
+
+            }
+            default: {
+                return 0;
+            }
+        }
+
+    }
+
+    bool TryParseCharLiteral(FixedCharSpan text, ConstantValue* value) {
+
+        uint32 c;
+
+        if (DecodeCharacter(text.ptr, text.ptr + text.size, &c) != (int32) text.size || c > 0xFFFF) {
+            return false;
+        }
+
+        *value = ConstantValue::Unsigned(ConstantType::Char, c);
+        return true;
+
+    }
+
+}
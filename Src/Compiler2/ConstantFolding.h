@@ -0,0 +1,48 @@
+#pragma once
+
+#include "../PrimitiveTypes.h"
+#include "../Util/FixedCharSpan.h"
+#include "../Parsing3/TokenKind.h"
+#include "../Parsing3/SyntaxKind.h"
+#include "./BuiltInTypeName.h"
+#include "./ConstantValue.h"
+#include "./Expression.h"
+
+namespace Alchemy::Compilation {
+
+    enum class ConstantFold : uint8 {
+        Folded,
+        NotConstant,
+        DivideByZero,
+        OutOfRange, // the value doesn't fit the type it has to become
+        Failed // something it depends on already reported an error
+    };
+
+    // both sides are promoted first (promotion is a table too), then the fold is a single lookup in op x type.
+    // nothing allocates, strings aren't concatenated for that reason
+    ConstantFold FoldBinary(BinaryExpressionOp op, ConstantValue left, ConstantValue right, ConstantValue* result);
+
+    ConstantFold FoldUnary(UnaryExpressionOp op, ConstantValue operand, ConstantValue* result);
+
+    // without isExplicit only what C# lets a constant convert to without a cast: widening, and int or long constants
+    // narrowed to whatever type they fit. with it, numbers convert to any numeric type they fit
+    ConstantFold ConvertConstant(ConstantValue value, ConstantType type, bool isExplicit, ConstantValue* result);
+
+    // None for anything that can't be a constant
+    ConstantType ConstantTypeFromBuiltIn(BuiltInTypeName typeName);
+
+    BinaryExpressionOp GetBinaryOp(SyntaxKind kind);
+
+    UnaryExpressionOp GetUnaryOp(SyntaxKind kind);
+
+    // the token's text and the kind the scanner picked from its suffix & size, underscores are skipped
+    bool TryParseNumericLiteral(FixedCharSpan text, TokenKind contextualKind, ConstantValue* value);
+
+    // one utf-8 encoded character or one escape off the front of a char or string literal's text, how many bytes it
+    // took or 0 when it isn't valid. \U can decode past 0xFFFF
+    int32 DecodeCharacter(const char* ptr, const char* end, uint32* codepoint);
+
+    // a single utf-16 unit, either one character or one escape
+    bool TryParseCharLiteral(FixedCharSpan text, ConstantValue* value);
+
+}
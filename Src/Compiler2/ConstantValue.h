@@ -0,0 +1,120 @@
+#pragma once
+
+#include "../PrimitiveTypes.h"
+
+namespace Alchemy::Compilation {
+
+    // the order matters, the fold & conversion tables are indexed by it
+    enum class ConstantType : uint8 {
+        None,
+        Bool,
+        Char,
+        Int8,
+        UInt8,
+        Int16,
+        UInt16,
+        Int32,
+        UInt32,
+        Int64,
+        UInt64,
+        Float,
+        Double,
+        String,
+        Null,
+
+        Count
+    };
+
+    constexpr int32 kConstantTypeCount = (int32) ConstantType::Count;
+
+    constexpr bool IsIntegralConstantType(ConstantType type) {
+        return type >= ConstantType::Char && type <= ConstantType::UInt64;
+    }
+
+    constexpr bool IsSignedConstantType(ConstantType type) {
+        return type == ConstantType::Int8 || type == ConstantType::Int16 || type == ConstantType::Int32 || type == ConstantType::Int64;
+    }
+
+    constexpr bool IsNumericConstantType(ConstantType type) {
+        return type >= ConstantType::Char && type <= ConstantType::Double;
+    }
+
+    // the text between the quotes, escapes and all. it points into the declaring file's source
+    struct ConstantString {
+        const char* ptr;
+        int32 size;
+    };
+
+    // A folded value, 16 bytes + its type and nothing to free. Integers narrower than 64 bits are stored sign or
+    // zero extended so comparing and converting them never has to look at the width, folding wraps them back.
+    struct ConstantValue {
+
+        union {
+            bool boolValue;
+            int64 intValue; // Int8 .. Int64
+            uint64 uintValue; // Char, UInt8 .. UInt64
+            float floatValue;
+            double doubleValue;
+            ConstantString stringValue;
+        };
+
+        ConstantType type;
+
+        ConstantValue()
+            : stringValue({nullptr, 0})
+            , type(ConstantType::None) {}
+
+        static ConstantValue Bool(bool value) {
+            ConstantValue retn;
+            retn.type = ConstantType::Bool;
+            retn.boolValue = value;
+            return retn;
+        }
+
+        static ConstantValue Signed(ConstantType type, int64 value) {
+            ConstantValue retn;
+            retn.type = type;
+            retn.intValue = value;
+            return retn;
+        }
+
+        static ConstantValue Unsigned(ConstantType type, uint64 value) {
+            ConstantValue retn;
+            retn.type = type;
+            retn.uintValue = value;
+            return retn;
+        }
+
+        static ConstantValue Float(float value) {
+            ConstantValue retn;
+            retn.type = ConstantType::Float;
+            retn.floatValue = value;
+            return retn;
+        }
+
+        static ConstantValue Double(double value) {
+            ConstantValue retn;
+            retn.type = ConstantType::Double;
+            retn.doubleValue = value;
+            return retn;
+        }
+
+        static ConstantValue String(const char* ptr, int32 size) {
+            ConstantValue retn;
+            retn.type = ConstantType::String;
+            retn.stringValue.ptr = ptr;
+            retn.stringValue.size = size;
+            return retn;
+        }
+
+        static ConstantValue Null() {
+            ConstantValue retn;
+            retn.type = ConstantType::Null;
+            return retn;
+        }
+
+    };
+
+    static_assert(sizeof(ConstantValue) == 24);
+
+}
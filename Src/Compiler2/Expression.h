@@ -1,9 +1,13 @@
 #pragma once
 
 #include "../PrimitiveTypes.h"
+#include "../Parsing3/LineColumn.h"
+#include "./ConstantValue.h"
 
+// offset 0 is null, the arenas these point into never hand out their first bytes
 #define BlitPointerField(x, y) int32 y##_offset {};                         \
         inline x * Get##y() {                                               \
+            if(y##_offset == 0) return nullptr;                             \
             return (x*)(ts_LocalExpressionBase + y##_offset);               \
         }                                                                   \
         inline void Set##y(x * value) {                                     \
@@ -14,7 +18,14 @@
 
 namespace Alchemy::Compilation {
 
-    thread_local uint8* ts_LocalExpressionBase;
+    // base of the arena the expressions being read or built live in, see IntrospectionArenas
+    inline thread_local uint8* ts_LocalExpressionBase;
+
+    struct TypeInfo;
+    struct FieldInfo;
+    struct PropertyInfo;
+    struct MethodInfo;
+    struct LocalValue;
 
 
     enum class ExpressionKind : uint8 {
@@ -23,10 +34,16 @@ namespace Alchemy::Compilation {
         Binary,
         FieldAccess,
         PropertyAccess,
+        This,
+        Local,
+        Constant,
+        Unary,
+        MethodGroup,
 
     };
 
-    enum class BinaryExpressionOp {
+    // rows of the fold table, see FoldBinary
+    enum class BinaryExpressionOp : uint8 {
         Invalid,
         Add,
         Subtract,
@@ -34,7 +51,30 @@ namespace Alchemy::Compilation {
         Divide,
         Modulo,
         ShiftRight,
-        ShiftLeft
+        ShiftLeft,
+        BitwiseAnd,
+        BitwiseOr,
+        ExclusiveOr,
+        LogicalAnd,
+        LogicalOr,
+        Equal,
+        NotEqual,
+        LessThan,
+        LessThanOrEqual,
+        GreaterThan,
+        GreaterThanOrEqual,
+
+        Count
+    };
+
+    enum class UnaryExpressionOp : uint8 {
+        Invalid,
+        Plus,
+        Minus,
+        BitwiseNot,
+        LogicalNot,
+
+        Count
     };
 
     struct Expression {
@@ -64,6 +104,30 @@ namespace Alchemy::Compilation {
 
     };
 
+    struct UnaryExpression : Expression {
+
+        BlitPointerField(Expression, Operand);
+        UnaryExpressionOp op;
+
+        UnaryExpression(UnaryExpressionOp op, Expression* operand, LineColumn location)
+            : Expression(ExpressionKind::Unary, location)
+            , op(op) {
+            SetOperand(operand);
+        }
+
+    };
+
+    // literals, const fields & enum members, and anything made only of them, already folded
+    struct ConstantExpression : Expression {
+
+        ConstantValue value;
+
+        ConstantExpression(ConstantValue value, LineColumn location)
+            : Expression(ExpressionKind::Constant, location)
+            , value(value) {}
+
+    };
+
     struct PropertyAccessExpression : Expression {
 
         BlitPointerField(Expression, Instance);
@@ -78,6 +142,22 @@ namespace Alchemy::Compilation {
 
     };
 
+    // a method named without being picked yet, methodInfo is only the first overload with that name. the instance
+    // is null in a static context, overload resolution decides whether that's an error
+    struct MethodGroupExpression : Expression {
+
+        BlitPointerField(Expression, Instance);
+        MethodInfo* methodInfo;
+
+        MethodGroupExpression(Expression* instance, MethodInfo* methodInfo, LineColumn location)
+            : Expression(ExpressionKind::MethodGroup, location)
+            , Instance_offset(0)
+            , methodInfo(methodInfo) {
+            SetInstance(instance);
+        }
+
+    };
+
     struct FieldAccessExpression : Expression {
 
         BlitPointerField(Expression, Instance);
@@ -92,4 +172,26 @@ namespace Alchemy::Compilation {
 
     };
 
-}
\ No newline at end of file
+    struct ThisExpression : Expression {
+
+        TypeInfo* typeInfo;
+
+        ThisExpression(TypeInfo* typeInfo, LineColumn location)
+            : Expression(ExpressionKind::This, location)
+            , typeInfo(typeInfo) {}
+
+    };
+
+    struct LocalExpression : Expression {
+
+        BlitPointerField(LocalValue, Local);
+
+        LocalExpression(LocalValue* local, LineColumn location)
+            : Expression(ExpressionKind::Local, location)
+            , Local_offset(0) {
+            SetLocal(local);
+        }
+
+    };
+
+}
@@ -0,0 +1,117 @@
+#include "./GenericInstanceArena.h"
+#include "./TypeInfo.h"
+#include "./MemberLookupTable.h"
+#include "./TypeTable.h"
+
+namespace Alchemy::Compilation {
+
+    GenericInstanceArena::GenericInstanceArena(size_t reservation)
+        : slab(reservation)
+        , instances(64)
+        , markId(0) {
+        slab.SetStatsName("GenericInstances");
+    }
+
+    GenericInstanceArena::BlockHeader* GenericInstanceArena::GetHeader(void* block) {
+        return ((BlockHeader*) block) - 1;
+    }
+
+    static uint8* ArenaAlloc(void* cookie, size_t size, size_t alignment) {
+        // blocks are 16 byte aligned
+        assert(alignment <= 16);
+        return ((GenericInstanceArena*) cookie)->Allocate(size);
+    }
+
+    static void ArenaFree(void* cookie, void* ptr, size_t size) {
+        ((GenericInstanceArena*) cookie)->Free(ptr);
+    }
+
+    Allocator GenericInstanceArena::MakeAllocator() {
+        return Allocator(this, ArenaAlloc, ArenaFree);
+    }
+
+    uint8* GenericInstanceArena::Allocate(size_t bytes) {
+
+        int32 sizeClass = SlabAllocator::GetSizeClass(bytes + sizeof(BlockHeader));
+        size_t classSize = (size_t) 1 << sizeClass;
+
+        BlockHeader* header = (BlockHeader*) slab.Allocate(sizeClass);
+
+        memset(header, 0, classSize);
+        header->sizeClass = sizeClass;
+        // a new instance counts as reachable in the run that created it
+        header->markId = markId;
+
+        return (uint8*) (header + 1);
+
+    }
+
+    void GenericInstanceArena::Free(void* block) {
+        BlockHeader* header = GetHeader(block);
+        slab.Free(header, (int32) header->sizeClass);
+    }
+
+    void GenericInstanceArena::TrackUnlocked(TypeInfo* instance) {
+        instances.Add(instance);
+    }
+
+    void GenericInstanceArena::BeginMark() {
+        markId++;
+    }
+
+    bool GenericInstanceArena::Mark(TypeInfo* instance) {
+        BlockHeader* header = GetHeader(instance);
+        if (header->markId == markId) {
+            return false;
+        }
+        header->markId = markId;
+        return true;
+    }
+
+    bool GenericInstanceArena::IsMarked(TypeInfo* instance) {
+        return GetHeader(instance)->markId == markId;
+    }
+
+    int32 GenericInstanceArena::Sweep() {
+
+        int32 swept = 0;
+
+        for (int32 i = 0; i < instances.size; i++) {
+
+            if (IsMarked(instances[i])) {
+                continue;
+            }
+
+            if (instances[i]->memberTable != nullptr) {
+                Free(instances[i]->memberTable);
+            }
+
+            GetTypeTable()->Remove(instances[i]->typeId);
+            Free(instances[i]);
+            instances.SwapRemoveAt(i);
+            i--;
+            swept++;
+
+        }
+
+        return swept;
+
+    }
+
+    CheckedArray<TypeInfo*> GenericInstanceArena::GetInstancesUnlocked() {
+        return instances.ToCheckedArray();
+    }
+
+    int32 GenericInstanceArena::GetInstanceCount() {
+        return instances.size;
+    }
+
+    size_t GenericInstanceArena::GetLiveBytes() {
+        return slab.GetLiveBytes();
+    }
+
+    size_t GenericInstanceArena::GetCommittedBytes() {
+        return slab.GetCommittedBytes();
+    }
+
+}
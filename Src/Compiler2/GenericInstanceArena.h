@@ -0,0 +1,66 @@
+#pragma once
+
+#include "../PrimitiveTypes.h"
+#include "../Allocation/SlabAllocator.h"
+#include "../Collections/PodList.h"
+#include "../Collections/CheckedArray.h"
+
+namespace Alchemy::Compilation {
+
+    struct TypeInfo;
+
+    // Closed generic types (List<int>, Dictionary<string, Foo> etc) are shared by every file that mentions them
+    // so they can't be owned by any single file's allocator. They live here instead. Each compilation run marks
+    // the instances that are still reachable from a live type and sweeps the rest back onto size class free lists,
+    // so a long running session re-uses instance memory instead of growing with every edit. Blocks come from a
+    // slab allocator with per-thread magazines, so threads instantiating types of the same file don't take a lock.
+    struct GenericInstanceArena {
+
+        struct BlockHeader {
+            uint32 sizeClass;
+            uint32 markId;
+            uint64 padding; // keeps blocks 16 byte aligned
+        };
+
+        explicit GenericInstanceArena(size_t reservation);
+
+        // returns a zeroed block, safe to call from any thread. for instances the TypeInfo must be placed at the start of it
+        uint8* Allocate(size_t bytes);
+
+        void Free(void* block);
+
+        // for data hanging off an instance (member tables), freed along with the instance when it is swept
+        Allocator MakeAllocator();
+
+        void TrackUnlocked(TypeInfo* instance);
+
+        // every tracked instance, a slot can be pointed at a block that replaces the instance
+        CheckedArray<TypeInfo*> GetInstancesUnlocked();
+
+        void BeginMark();
+
+        // returns true if the instance was not yet marked in this run
+        bool Mark(TypeInfo* instance);
+
+        bool IsMarked(TypeInfo* instance);
+
+        // frees every tracked instance that was not marked since the last BeginMark, returns the number of swept instances
+        int32 Sweep();
+
+        int32 GetInstanceCount();
+
+        size_t GetLiveBytes();
+
+        size_t GetCommittedBytes();
+
+    private:
+
+        SlabAllocator slab;
+        PodList<TypeInfo*> instances;
+        uint32 markId;
+
+        static BlockHeader* GetHeader(void* block);
+
+    };
+
+}
@@ -0,0 +1,50 @@
+#include "./IntrospectionArenas.h"
+
+namespace Alchemy::Compilation {
+
+    // offsets are int32, an arena can't grow past what they reach
+    static constexpr size_t kIntrospectionArenaReservation = GIGABYTES(1);
+
+    IntrospectionArenas::IntrospectionArenas()
+        : arenas() {}
+
+    IntrospectionArenas::~IntrospectionArenas() {
+        for (int32 i = 0; i < arenas.size; i++) {
+            arenas[i]->~LinearAllocator();
+            Mfree(arenas[i], sizeof(LinearAllocator));
+        }
+    }
+
+    void IntrospectionArenas::Reset(int32 workerCount) {
+
+        while (arenas.size < workerCount) {
+            LinearAllocator* arena = (LinearAllocator*) MallocateUncleared(sizeof(LinearAllocator));
+            new(arena) LinearAllocator(kIntrospectionArenaReservation, KILOBYTES(64), LinearAllocatorFlags::GeometricCommit);
+            arena->SetStatsName("Introspection");
+            arenas.Add(arena);
+        }
+
+        for (int32 i = 0; i < arenas.size; i++) {
+            arenas[i]->Clear();
+            arenas[i]->AllocateUncleared<uint64>(1); // nothing lives at offset 0
+        }
+
+    }
+
+    size_t IntrospectionArenas::GetUsedBytes() {
+        size_t used = 0;
+        for (int32 i = 0; i < arenas.size; i++) {
+            used += arenas[i]->offset;
+        }
+        return used;
+    }
+
+    size_t IntrospectionArenas::GetCommittedBytes() {
+        size_t committed = 0;
+        for (int32 i = 0; i < arenas.size; i++) {
+            committed += arenas[i]->GetCommittedBytes();
+        }
+        return committed;
+    }
+
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "../PrimitiveTypes.h"
+#include "../Collections/PodList.h"
+#include "../Allocation/LinearAllocator.h"
+
+namespace Alchemy::Compilation {
+
+    // Scopes, locals, expressions and diagnostics of introspected method bodies. There is one arena per worker and a
+    // job only ever writes to its own, so building them takes no locks. BlitPointerFields inside them are 32 bit
+    // offsets from the arena's base, which never moves, and offset 0 is null so the first bytes of every arena are
+    // never handed out. Everything is thrown away at the start of the next introspection pass.
+    struct IntrospectionArenas {
+
+        PodList<LinearAllocator*> arenas;
+
+        IntrospectionArenas();
+
+        ~IntrospectionArenas();
+
+        IntrospectionArenas(const IntrospectionArenas&) = delete;
+        IntrospectionArenas& operator=(const IntrospectionArenas&) = delete;
+
+        // one arena per worker, all of them empty
+        void Reset(int32 workerCount);
+
+        inline LinearAllocator* Get(int32 workerId) {
+            return arenas[workerId];
+        }
+
+        size_t GetUsedBytes();
+
+        size_t GetCommittedBytes();
+
+    };
+
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "../../JobSystem/Job.h"
+#include "../TypeInfo.h"
+#include "../SourceFileInfo.h"
+#include "../TypeResolutionMap.h"
+#include "../MemberLookupTable.h"
+
+namespace Alchemy::Compilation {
+
+    // all the types handed to one execution have the same inheritance depth, their base tables are already built
+    struct BuildMemberTablesJob : Jobs::IJob {
+
+        CheckedArray<TypeInfo*> typeInfos;
+        TypeResolutionMap* resolutionMap;
+        bool ignoreBaseClass; // the hierarchy is cyclic, we already reported it so just use the declared members
+
+        BuildMemberTablesJob(CheckedArray<TypeInfo*> typeInfos, TypeResolutionMap* resolutionMap, bool ignoreBaseClass)
+            : typeInfos(typeInfos)
+            , resolutionMap(resolutionMap)
+            , ignoreBaseClass(ignoreBaseClass) {}
+
+        void Execute(int32 idx) override {
+
+            TypeInfo* typeInfo = typeInfos[idx];
+
+            // types in the same file can be built on different threads
+            Allocator allocator = typeInfo->IsGenericInstance()
+                ? resolutionMap->genericInstances.MakeAllocator()
+                : typeInfo->declaringFile->GetLockedAllocator();
+
+            TypeInfo* baseClass = ignoreBaseClass ? nullptr : typeInfo->GetBaseClass();
+
+            typeInfo->memberTable = MemberLookupTable::Build(typeInfo, baseClass, typeInfo->memberTable, allocator);
+
+        }
+
+    };
+
+}
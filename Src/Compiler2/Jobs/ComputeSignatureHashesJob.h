@@ -0,0 +1,28 @@
+#pragma once
+
+#include "../../JobSystem/Job.h"
+#include "../SourceFileInfo.h"
+#include "../TypeInfo.h"
+
+namespace Alchemy::Compilation {
+
+    // runs once member & base types are resolved. every signature needs to be done before
+    // UpdateTypeDependenciesJob reads them since dependencies cross file boundaries
+    struct ComputeSignatureHashesJob : Jobs::IJob {
+
+        CheckedArray<SourceFileInfo*> files;
+
+        explicit ComputeSignatureHashesJob(CheckedArray<SourceFileInfo*> files)
+            : files(files) {}
+
+        void Execute(int32 idx) override {
+            SourceFileInfo* file = files[idx];
+            for (int32 i = 0; i < file->declaredTypes.size; i++) {
+                TypeInfo* typeInfo = file->declaredTypes[i];
+                typeInfo->signatureHash = typeInfo->ComputeSignatureHash();
+            }
+        }
+
+    };
+
+}
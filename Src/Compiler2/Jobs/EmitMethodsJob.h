@@ -0,0 +1,305 @@
+#pragma once
+
+#include "../../JobSystem/Job.h"
+#include "../../PrimitiveTypes.h"
+#include "../../Allocation/ThreadLocalTemp.h"
+#include "../CodeGen.h"
+#include "../MemberInfo.h"
+#include "../Expression.h"
+#include "./IntrospectScopesJob.h"
+
+namespace Alchemy::Compilation {
+
+    // Writes one introspected method as a C function: the signature, a block per scope holding its locals and a
+    // zeroed return value. Statements aren't lowered yet, the body is the frame they'll go into, so a method that has
+    // any gets an #error and the unit won't compile instead of quietly doing nothing. A default parameter overload
+    // becomes a call to its full method with the folded defaults filled in.
+    struct MethodEmitter {
+
+        CodeBuffer* out;
+
+        explicit MethodEmitter(CodeBuffer* out)
+            : out(out) {}
+
+        void WriteIndent(int32 depth) {
+            for (int32 i = 0; i < depth; i++) {
+                out->Write("    ", 4);
+            }
+        }
+
+        static bool IsVoid(ResolvedType type) {
+            if (type.IsVoid()) {
+                return true;
+            }
+            TypeInfo* typeInfo = type.GetTypeInfo();
+            return typeInfo != nullptr && (typeInfo->typeClass == TypeClass::Void || typeInfo->builtInTypeName == BuiltInTypeName::Void);
+        }
+
+        void WriteScope(Scope* scope, int32 depth, int32 skipLocals) {
+
+            int32 index = 0;
+
+            for (LocalValue* local = scope->GetFirstLocal(); local != nullptr; local = local->GetNextLocal()) {
+                if (index++ < skipLocals) {
+                    continue;
+                }
+                WriteIndent(depth);
+                WriteCType(out, local->resolvedType);
+                out->WriteChar(' ');
+                WriteCName(out, "l_", local->name);
+                out->Write(";\n");
+            }
+
+            for (Scope* child = scope->GetFirstChild(); child != nullptr; child = child->GetNextSibling()) {
+
+                if (child->localCount == 0 && child->GetFirstChild() == nullptr) {
+                    continue;
+                }
+
+                WriteIndent(depth);
+                out->Write("{\n");
+                WriteScope(child, depth + 1, 0);
+                WriteIndent(depth);
+                out->Write("}\n");
+
+            }
+
+        }
+
+        static bool HasStatements(MethodInfo* methodInfo) {
+            MethodDeclarationSyntax* syntax = methodInfo->syntaxNode;
+            if (syntax == nullptr) {
+                return false;
+            }
+            return syntax->expressionBody != nullptr || (syntax->body != nullptr && syntax->body->statements != nullptr && syntax->body->statements->size != 0);
+        }
+
+        static MethodInfo* GetFullMethod(MethodInfo* methodInfo) {
+            while (methodInfo->isDefaultParameterOverload) {
+                methodInfo--;
+            }
+            return methodInfo;
+        }
+
+        void WriteParameterName(ParameterInfo* parameterInfo, int32 index) {
+            if (parameterInfo->name.size != 0) {
+                WriteCName(out, "l_", parameterInfo->name);
+            }
+            else {
+                out->Write("alc_arg");
+                out->WriteInt(index);
+            }
+        }
+
+        void WriteForwardingCall(MethodInfo* methodInfo, bool isStatic) {
+
+            MethodInfo* fullMethod = GetFullMethod(methodInfo);
+
+            out->Write("    ");
+            if (!IsVoid(methodInfo->returnType)) {
+                out->Write("return ");
+            }
+            out->Write(MangleMethodName(fullMethod, out->allocator));
+            out->WriteChar('(');
+
+            if (!isStatic) {
+                out->Write("self");
+            }
+
+            for (int32 i = 0; i < fullMethod->parameterCount; i++) {
+
+                ParameterInfo* parameterInfo = &fullMethod->parameters[i];
+
+                if (i != 0 || !isStatic) {
+                    out->Write(", ");
+                }
+
+                if (i < methodInfo->parameterCount) {
+                    WriteParameterName(parameterInfo, i);
+                }
+                else if (parameterInfo->defaultValue.type != ConstantType::None) {
+                    WriteCConstant(out, parameterInfo->defaultValue);
+                }
+                else {
+                    // `default` of a struct
+                    out->WriteChar('(');
+                    WriteCType(out, parameterInfo->type);
+                    out->Write("){0}");
+                }
+
+            }
+
+            out->Write(");\n");
+
+        }
+
+        void EmitMethod(EmittedMethod* emitted) {
+
+            MethodInfo* methodInfo = emitted->methodInfo;
+            TypeInfo* declaringType = methodInfo->declaringType;
+            MethodIntrospection* introspection = methodInfo->introspection;
+
+            emitted->mangledName = MangleMethodName(methodInfo, out->allocator);
+
+            out->Begin(emitted);
+
+            out->Write("// ");
+            out->Write(declaringType->GetFullyQualifiedTypeName());
+            out->WriteChar('.');
+            out->Write(methodInfo->name);
+            out->WriteChar('\n');
+
+            WriteCType(out, methodInfo->returnType);
+            out->WriteChar(' ');
+            out->Write(emitted->mangledName);
+            out->WriteChar('(');
+
+            bool isStatic = (methodInfo->modifiers & MethodModifiers::Static) != 0;
+            int32 namedParameterCount = 0;
+
+            if (!isStatic) {
+                out->Write("struct ");
+                WriteCTypeName(out, declaringType);
+                out->Write("* self");
+            }
+
+            for (int32 i = 0; i < methodInfo->parameterCount; i++) {
+
+                ParameterInfo* parameterInfo = &methodInfo->parameters[i];
+
+                if (i != 0 || !isStatic) {
+                    out->Write(", ");
+                }
+
+                WriteCType(out, parameterInfo->type);
+                out->WriteChar(' ');
+                WriteParameterName(parameterInfo, i);
+
+                // the introspector only declared the named ones, they lead the root scope's locals
+                if (parameterInfo->name.size != 0) {
+                    namedParameterCount++;
+                }
+
+            }
+
+            if (isStatic && methodInfo->parameterCount == 0) {
+                out->Write("void");
+            }
+
+            out->Write(") {\n");
+
+            if (methodInfo->isDefaultParameterOverload) {
+                WriteForwardingCall(methodInfo, isStatic);
+                out->Write("}\n\n");
+                out->End(emitted);
+                return;
+            }
+
+            if (HasStatements(methodInfo)) {
+                out->Write("#error \"");
+                out->Write(declaringType->GetFullyQualifiedTypeName());
+                out->WriteChar('.');
+                out->Write(methodInfo->name);
+                out->Write(": statements aren't lowered to C yet\"\n");
+            }
+
+            ts_LocalExpressionBase = introspection->base;
+            WriteScope(introspection->rootScope, 1, namedParameterCount);
+
+            if (!IsVoid(methodInfo->returnType)) {
+                out->Write("    ");
+                WriteCType(out, methodInfo->returnType);
+                out->Write(" alc_return = {0};\n    return alc_return;\n");
+            }
+
+            out->Write("}\n\n");
+
+            out->End(emitted);
+
+        }
+
+    };
+
+    // Methods are handed out in fixed size batches, each one goes into the buffer of whichever worker runs it. The
+    // text doesn't depend on the worker or the order, that only decides which chunks it lands in, so sorting the
+    // results by name afterwards gives the same files no matter how many workers there were.
+    struct EmitMethodsJob : Jobs::IJob {
+
+        CheckedArray<EmittedMethod> methods;
+        int32 batchSize;
+        CodeGenOutput* output;
+
+        EmitMethodsJob(CheckedArray<EmittedMethod> methods, int32 batchSize, CodeGenOutput* output)
+            : methods(methods)
+            , batchSize(batchSize)
+            , output(output) {}
+
+        void Execute(int32 batchIndex) override {
+
+            MethodEmitter emitter(&output->buffers[GetWorkerId()]);
+
+            int32 start = batchIndex * batchSize;
+            int32 end = start + batchSize < methods.size ? start + batchSize : methods.size;
+
+            for (int32 i = start; i < end; i++) {
+                emitter.EmitMethod(&methods[i]);
+            }
+
+        }
+
+    };
+
+    // One translation unit per call. The prelude and every method's pieces go out in a single writev, unless the file
+    // already holds exactly that.
+    struct WriteTranslationUnitsJob : Jobs::IJob {
+
+        CheckedArray<TranslationUnit> units;
+        CheckedArray<EmittedMethod> methods;
+        FixedCharSpan directory;
+        uint64* writtenHashes;
+
+        WriteTranslationUnitsJob(CheckedArray<TranslationUnit> units, CheckedArray<EmittedMethod> methods, FixedCharSpan directory, uint64* writtenHashes)
+            : units(units)
+            , methods(methods)
+            , directory(directory)
+            , writtenHashes(writtenHashes) {}
+
+        void Execute(int32 index) override {
+
+            TranslationUnit* unit = &units[index];
+            TempAllocator* tempAllocator = GetAllocator();
+
+            int32 segmentCount = 1;
+            for (int32 i = unit->firstMethod; i < unit->firstMethod + unit->methodCount; i++) {
+                ForEachSegment(&methods[i], [&segmentCount](FixedCharSpan segment) {
+                    segmentCount++;
+                });
+            }
+
+            FixedCharSpan* segments = tempAllocator->AllocateUncleared<FixedCharSpan>(segmentCount);
+            int32 write = 0;
+
+            segments[write++] = FixedCharSpan(kTranslationUnitPrelude);
+
+            for (int32 i = unit->firstMethod; i < unit->firstMethod + unit->methodCount; i++) {
+                ForEachSegment(&methods[i], [segments, &write](FixedCharSpan segment) {
+                    segments[write++] = segment;
+                });
+            }
+
+            char name[32];
+            WriteTranslationUnitName(index, name);
+
+            unit->result = WriteIfChanged(
+                MakeCodeGenPath(directory, name, tempAllocator),
+                CheckedArray<FixedCharSpan>(segments, segmentCount),
+                &writtenHashes[index],
+                &unit->contentHash,
+                tempAllocator
+            );
+
+        }
+
+    };
+
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "../../JobSystem/Job.h"
+#include "../TypeInfo.h"
+#include "../TypeResolutionMap.h"
+
+namespace Alchemy::Compilation {
+
+    // instances created while types were being resolved are only shells, fill them now that every open type is done
+    struct FillGenericInstancesJob : Jobs::IJob {
+
+        CheckedArray<TypeInfo*> instances;
+        TypeResolutionMap* resolutionMap;
+
+        FillGenericInstancesJob(CheckedArray<TypeInfo*> instances, TypeResolutionMap* resolutionMap)
+            : instances(instances)
+            , resolutionMap(resolutionMap) {}
+
+        void Execute(int32 idx) override {
+            resolutionMap->FillGenericInstance(instances[idx]);
+        }
+
+    };
+
+}
@@ -2,6 +2,7 @@
 #include "../TypeInfo.h"
 #include "../FullyQualifiedName.h"
 #include "../MemberInfo.h"
+#include "../../Util/Stopwatch.h"
 
 namespace Alchemy::Compilation {
 
@@ -45,6 +46,8 @@ namespace Alchemy::Compilation {
     void GatherTypeInfoJob::Execute(int32 idx) {
         fileInfo = files[idx];
 
+        Stopwatch stopwatch;
+
         CompilationUnitSyntax* syntaxTree = fileInfo->syntaxTree;
 
         SyntaxList<MemberDeclarationSyntax>* members = syntaxTree->members;
@@ -178,6 +181,7 @@ namespace Alchemy::Compilation {
 
         fileInfo->usingDirectives = usingDeclarations;
         fileInfo->declaredTypes = typeDeclarations;
+        fileInfo->phaseNanoseconds[(int32) FilePhase::Gather] = stopwatch.ElapsedNanoseconds();
     }
 
     void GatherTypeInfoJob::CreateTypeInfo(CheckedArray<TypeInfo*> typeInfos, int32* typeInfoIndex, MemberDeclarationSyntax* pSyntax) {
@@ -191,6 +195,7 @@ namespace Alchemy::Compilation {
                 break;
             }
             case SyntaxKind::EnumDeclaration: {
+                CreateEnumDeclaration(typeInfos, typeInfoIndex, (EnumDeclarationSyntax*) pSyntax);
                 break;
             }
             case SyntaxKind::DelegateDeclaration: {
@@ -333,7 +338,8 @@ namespace Alchemy::Compilation {
                             firstDefault = p;
                         }
 
-                        if (firstDefault != -1 && parameter->defaultValue != nullptr) {
+                        // a required parameter can't follow an optional one
+                        if (firstDefault != -1 && parameter->defaultValue == nullptr) {
                             FixedCharSpan text = parameter->identifier.GetText(fileInfo->tokenizerResult.texts);
                             fileInfo->diagnostics.AddError(Diagnostic(ErrorCode::ERR_OptionalParameterOrder, text));
                         }
@@ -464,6 +470,40 @@ namespace Alchemy::Compilation {
 
     }
 
+    void GatherTypeInfoJob::CreateEnumDeclaration(CheckedArray<TypeInfo*> typeInfos, int32* typeInfoIndex, EnumDeclarationSyntax* pSyntax) {
+
+        FixedCharSpan typeName = pSyntax->identifier.GetText(fileInfo->tokenizerResult.texts);
+
+        TypeInfo* pInfo = fileInfo->allocator.Allocate<TypeInfo>(1);
+        typeInfos[*typeInfoIndex] = pInfo;
+        *typeInfoIndex = *typeInfoIndex + 1;
+
+        FixedCharSpan namespaceName = fileInfo->namespaceName;
+        if(namespaceName.size == 0) {
+            namespaceName = FixedCharSpan("global");
+        }
+
+        FixedCharSpan fqn = MakeFullyQualifiedName(namespaceName, typeName, 0, fileInfo->allocator.MakeAllocator());
+        pInfo->fullyQualifiedName = fqn.ptr;
+        pInfo->fullyQualifiedNameLength = fqn.size;
+        pInfo->typeName = pInfo->fullyQualifiedName + namespaceName.size + 2;
+        pInfo->typeNameLength = pInfo->fullyQualifiedNameLength - namespaceName.size - 2;
+        pInfo->typeClass = TypeClass::Enum;
+        pInfo->syntaxNode = pSyntax;
+        pInfo->declaringFile = fileInfo;
+        HandleModifiers(pInfo, pSyntax->modifiers);
+
+        // the base list is the underlying type, not something to inherit from. it's read when the members are evaluated
+        pInfo->baseTypeCount = 0;
+        pInfo->baseTypes = nullptr;
+
+        // one const field per member, their values are folded with the other constants
+        int32 memberCount = pSyntax->members == nullptr ? 0 : pSyntax->members->itemCount;
+        pInfo->fields = fileInfo->allocator.Allocate<FieldInfo>(memberCount);
+        pInfo->fieldCount = memberCount;
+
+    }
+
     void GatherTypeInfoJob::HandleBaseTypes(TypeInfo* pInfo, BaseListSyntax* pSyntax) {
         if (pSyntax == nullptr || pSyntax->types == nullptr || pSyntax->types->itemCount == 0) {
             pInfo->baseTypeCount = 0;
@@ -507,6 +547,8 @@ namespace Alchemy::Compilation {
             genericArg->typeClass = TypeClass::GenericArgument;
             genericArg->visibility = pInfo->visibility;
 
+            // members of the open type refer to T before the file's types are added to the resolution map
+            GetTypeTable()->Add(genericArg);
             pInfo->genericArguments[i] = ResolvedType(genericArg);
 
         }
@@ -23,6 +23,7 @@ namespace Alchemy::Compilation {
 
         void CreateClassDeclaration(CheckedArray<TypeInfo*> typeInfos, int32 * typeInfoIndex, ClassDeclarationSyntax* pSyntax);
         void CreateStructDeclaration(CheckedArray<TypeInfo*> typeInfos, int32 * typeInfoIndex, StructDeclarationSyntax* pSyntax);
+        void CreateEnumDeclaration(CheckedArray<TypeInfo*> typeInfos, int32 * typeInfoIndex, EnumDeclarationSyntax* pSyntax);
 
         void HandleModifiers(TypeInfo* pTypeInfo, TokenList* modifiers);
 
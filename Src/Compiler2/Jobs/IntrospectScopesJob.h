@@ -9,6 +9,13 @@
 #include "../../PrimitiveTypes.h"
 #include "../../Allocation/ThreadLocalTemp.h"
 #include "../Expression.h"
+#include "../MemberLookupTable.h"
+#include "../LocalSymbolTable.h"
+#include "../IntrospectionArenas.h"
+#include "../SourceFileInfo.h"
+#include "../ConstantEvaluator.h"
+#include "../../Parsing3/SyntaxNodes.h"
+#include "./ScheduleIntrospectJobs.h"
 
 namespace Alchemy::Compilation {
 
@@ -34,6 +41,7 @@ namespace Alchemy::Compilation {
         ResolvedType resolvedType;
         BlitPointerField(Scope, DeclaringScope);
         BlitPointerField(Expression, Expression);
+        BlitPointerField(LocalValue, NextLocal);
 
     };
 
@@ -45,8 +53,10 @@ namespace Alchemy::Compilation {
         BlitPointerField(Scope, NextSibling);
         BlitPointerField(Scope, PrevSibling);
         BlitPointerField(Scope, LastChild);
+        BlitPointerField(LocalValue, FirstLocal);
+        BlitPointerField(LocalValue, LastLocal);
         int32 depth {};
-        CheckedArray<LocalValue> valueDeclarations;
+        int32 localCount {};
 
         void AddChild(Scope* scope) {
 
@@ -72,11 +82,22 @@ namespace Alchemy::Compilation {
             scope->SetParent(this);
         }
 
+        void AddLocal(LocalValue* value) {
+            if (GetLastLocal() == nullptr) {
+                SetFirstLocal(value);
+            }
+            else {
+                GetLastLocal()->SetNextLocal(value);
+            }
+            SetLastLocal(value);
+            localCount++;
+        }
+
     };
 
     struct IntrospectionDiagnostic {
         Diagnostic diagnostic;
-        BlitPointerField(Diagnostic, next);
+        BlitPointerField(IntrospectionDiagnostic, Next);
     };
 
     // scope is clearly a { }
@@ -101,313 +122,968 @@ namespace Alchemy::Compilation {
 
     };
 
+    // Builds the scope tree, locals and expressions of one method body at a time. Everything that outlives the method
+    // goes into `allocator`, the worker's introspection arena, only the locals table is temp memory. Diagnostics are
+    // kept with the method and copied to the file once every job is done, a file's methods run on many workers.
     struct Introspector {
 
         LinearAllocator* allocator;
-
-        // temp allocated w/o fixed sizes
-        FixedPodList<Scope*>* scopeStack;
-        FixedPodList<Scope*>* scopeList;
-        FixedPodList<Range32> declarationsByScopeDepth;
-        FixedPodList<LocalValue*> valueBuffer;
+        TypeResolutionMap* resolutionMap;
+        LocalSymbolTable locals;
+        Scope* currentScope;
+        MethodIntrospection* result;
+        IntrospectionDiagnostic* lastDiagnostic;
         int32 internalVarId;
-        Diagnostics * diagnostics;
         SourceFileInfo * file;
         TypeInfo * typeInfo;
         MethodInfo * methodInfo;
         Expression * thisInstance;
+        MethodNameIndex * methodNames; // only when compiling from entry points
+        PodList<MethodInfo*> claimed;
+
+        Introspector(LinearAllocator* allocator, TypeResolutionMap* resolutionMap, MethodNameIndex* methodNames)
+            : allocator(allocator)
+            , resolutionMap(resolutionMap)
+            , locals()
+            , currentScope(nullptr)
+            , result(nullptr)
+            , lastDiagnostic(nullptr)
+            , internalVarId(0)
+            , file(nullptr)
+            , typeInfo(nullptr)
+            , methodInfo(nullptr)
+            , thisInstance(nullptr)
+            , methodNames(methodNames)
+            , claimed() {}
 
         template<class T, typename... Args>
         T* CreateExpression(Args &&... args) {
             T* retn = (T*) allocator->AllocateUncleared<T>(1);
             new(retn) T(std::forward<Args>(args)...);
             assert(retn->kind != ExpressionKind::Invalid);
+            result->expressionCount++;
             return retn;
         }
 
-        void PushScope() {
+        // files don't keep line starts yet, locations stay empty until they do
+        LineColumn GetLocation(SyntaxBase* syntaxNode) {
+            return LineColumn();
+        }
+
+        void PushScope(SyntaxBase* syntaxNode) {
             Scope* scope = allocator->New<Scope>();
-            scope->SetParent(scopeStack->Peek());
-            scope->GetParent()->AddChild(scope);
-            scopeStack->Push(scope);
-            scopeList->Add(scope);
-            declarationsByScopeDepth[scopeStack->size - 1] = Range32(valueBuffer.size, 0);
+            scope->pSyntaxNode = syntaxNode;
+            if (currentScope != nullptr) {
+                currentScope->AddChild(scope);
+            }
+            currentScope = scope;
+            result->scopeCount++;
+            locals.PushScope();
         }
 
         void PopScope() {
-            declarationsByScopeDepth[scopeStack->size - 1] = Range32(0, 0);
-            scopeStack->Pop();
+            locals.PopScope();
+            currentScope = currentScope->GetParent();
         }
 
         void AddError(ErrorCode errorCode, FixedCharSpan sourceSpan, FixedCharSpan message) {
-            // todo
+
+            // spans & messages point into the file's source, the arena is gone by the next run
+            IntrospectionDiagnostic* diagnostic = allocator->New<IntrospectionDiagnostic>();
+            diagnostic->diagnostic = message.size == 0
+                ? Diagnostic(errorCode, sourceSpan)
+                : Diagnostic(errorCode, sourceSpan, message);
+
+            if (lastDiagnostic == nullptr) {
+                result->firstDiagnostic = diagnostic;
+            }
+            else {
+                lastDiagnostic->SetNext(diagnostic);
+            }
+
+            lastDiagnostic = diagnostic;
+            result->diagnosticCount++;
+
+        }
+
+        LocalValue* NewLocal(FixedCharSpan name, SyntaxBase* syntaxBase) {
+            LocalValue* value = allocator->New<LocalValue>();
+            value->name = name;
+            value->SetDeclaringScope(currentScope);
+            value->SetExpression(CreateExpression<LocalExpression>(value, GetLocation(syntaxBase)));
+            currentScope->AddLocal(value);
+            result->localCount++;
+            return value;
         }
 
         LocalValue* AddLocal(FixedCharSpan name, SyntaxBase * syntaxBase) {
 
-            for (int32 i = valueBuffer.size - 1; i >= 0; i--) {
-                if (name == valueBuffer[i]->name) {
-                    AddError(ErrorCode::ERR_DuplicateIdentifierInScope, file->GetText(syntaxBase), name);
-                    break;
-                }
+            LocalValue* value = NewLocal(name, syntaxBase);
+
+            // locals can't hide a local from this or any enclosing scope
+            if (locals.Declare(name, value) != nullptr) {
+                AddError(ErrorCode::ERR_DuplicateIdentifierInScope, file->GetText(syntaxBase), name);
             }
 
-            LocalValue* value = allocator->New<LocalValue>();
-            declarationsByScopeDepth[scopeStack->size - 1].count++;
-            valueBuffer.Add(value);
             return value;
 
         }
 
         LocalValue* AddInternalLocal(FixedCharSpan name) {
-            LocalValue* value = allocator->New<LocalValue>();
-            declarationsByScopeDepth[scopeStack->size - 1].count++;
-            valueBuffer.Add(value);
-            char* nameBuffer = allocator->AllocateUncleared<char>(name.size + 4);
+            char* nameBuffer = allocator->AllocateUncleared<char>(name.size + 16);
             char* ptr = nameBuffer;
             ptr[0] = '_';
             ptr++;
             memcpy(ptr, name.ptr, name.size);
             ptr += name.size;
             ptr[0] = '_';
-            ptr += IntToAscii(internalVarId, ptr);
-            value->name = FixedCharSpan(nameBuffer, ptr - nameBuffer);
+            ptr++;
+            ptr += IntToAscii(internalVarId++, ptr);
+            LocalValue* value = NewLocal(FixedCharSpan(nameBuffer, ptr - nameBuffer), nullptr);
+            locals.Declare(value->name, value);
             return value;
         }
 
-        Expression* ResolveIdentifier(FixedCharSpan identifier) {
-            Scope* currentScope = scopeStack->Peek();
-
-            Range32 values = declarationsByScopeDepth[currentScope->depth];
-
-            int32 end = values.End();
-            for (int32 i = values.start; i < end; i++) {
-                LocalValue * value = valueBuffer.Get(i);
-                // got it, it's local
-                if (value->name == identifier) {
-                    return value->GetExpression();
-                }
-            }
+        Expression* ResolveIdentifier(FixedCharSpan identifier, LineColumn location) {
 
             // we may need to mark locals with a variable type: loop iterator, yield, etc
             // reserve a slot per scope for closure instance creation, skip if not used
 
-            // wasn't in local scope, try parent scopes and watch for closure boundaries
-            // if we pass a closure boundary we need to promote the local to a closure
-
+            // if the local's declaring scope is outside a closure boundary we need to promote the local to a closure
             // we probably need to know when we hit a loop scope
             // we need to know when we hit a yield scope
             // we need to know when we hit a lambda
 
-            Scope* scope = currentScope->GetParent();
-            while (scope != nullptr) {
-                values = declarationsByScopeDepth[scope->depth];
-                end = values.End();
-                for (int32 i = values.start; i < end; i++) {
-                    LocalValue* value = valueBuffer.Get(i);
-                    if (value->name == identifier) {
-                        return value->GetExpression();
-                    }
-                }
-                scope = scope->GetParent();
+            LocalValue* local = locals.Find(identifier);
+
+            if (local != nullptr) {
+                return local->GetExpression();
             }
 
-            // todo -- profile here, this is likely kind of a hot code section & does a lot of searching / pointer tracking
+            if (typeInfo->memberTable == nullptr) {
+                return nullptr;
+            }
+
+            MemberLookupEntry* member = typeInfo->memberTable->Find(identifier);
 
-            TypeInfo * ptr = typeInfo;
+            if (member == nullptr) {
+                return nullptr;
+            }
 
             bool isStatic = thisInstance == nullptr;
 
-            while (ptr != nullptr) {
+            switch (member->kind) {
 
-                for (int32 i = 0; i < ptr->fieldCount; i++) {
+                case MemberKind::Field: {
+                    FieldInfo* fieldInfo = member->GetField();
 
-                    FieldInfo * fieldInfo = &ptr->fields[i];
+                    // one that failed was reported where it was declared
+                    if ((fieldInfo->modifiers & FieldModifiers::Const) != 0) {
+                        return fieldInfo->constantState == ConstantState::Evaluated
+                            ? CreateExpression<ConstantExpression>(fieldInfo->constantValue, location)
+                            : nullptr;
+                    }
 
-                    if (fieldInfo->identifier != identifier) {
-                        continue;
+                    if ((fieldInfo->modifiers & FieldModifiers::Static) != 0) {
+                        return CreateExpression<FieldAccessExpression>(nullptr, fieldInfo, location);
                     }
 
-                    // todo -- const
-                    if((fieldInfo->modifiers & FieldModifiers::Static) == 0) {
-                        if(isStatic) {
-                            AddError(ErrorCode::ERR_InstanceFieldAccessInStaticContext, identifier, FixedCharSpan());
-                        }
-                        return CreateExpression<FieldAccessExpression>(thisInstance, fieldInfo);
+                    if (isStatic) {
+                        AddError(ErrorCode::ERR_InstanceFieldAccessInStaticContext, identifier, FixedCharSpan());
+                        return nullptr;
+                    }
+
+                    return CreateExpression<FieldAccessExpression>(thisInstance, fieldInfo, location);
+                }
+
+                case MemberKind::Property: {
+                    PropertyInfo* propertyInfo = member->GetProperty();
+
+                    if ((propertyInfo->modifiers & MethodModifiers::Static) != 0) {
+                        return CreateExpression<PropertyAccessExpression>(nullptr, propertyInfo, location);
                     }
-                    else {
-                        return CreateExpression<FieldAccessExpression>(nullptr, fieldInfo);
+
+                    if (isStatic) {
+                        AddError(ErrorCode::ERR_InstanceFieldAccessInStaticContext, identifier, FixedCharSpan());
+                        return nullptr;
                     }
+
+                    return CreateExpression<PropertyAccessExpression>(thisInstance, propertyInfo, location);
+                }
+
+                case MemberKind::Method: {
+                    // the overloads can mix static & instance methods, so a static context isn't an error yet
+                    return CreateExpression<MethodGroupExpression>(thisInstance, member->GetMethod(), location);
                 }
 
-                if(!isStatic) {
-                    ptr = ptr->GetBaseClass();
+                default: {
+                    return nullptr;
                 }
 
             }
 
-            ptr = typeInfo;
-            while(ptr != nullptr) {
+        }
 
-                for(int32 i = 0; i < ptr->propertyCount; i++) {
-                    PropertyInfo * propertyInfo = &ptr->properties[i];
-                    if(propertyInfo->name != identifier) {
-                        continue;
-                    }
+        bool ReturnsVoid() {
+            ResolvedType returnType = methodInfo->returnType;
+            if (returnType.IsVoid()) {
+                return true;
+            }
+            TypeInfo* returnTypeInfo = returnType.GetTypeInfo();
+            return returnTypeInfo != nullptr && (returnTypeInfo == resolutionMap->voidType || returnTypeInfo->builtInTypeName == BuiltInTypeName::Void);
+        }
 
-                    if((propertyInfo->modifiers & PropertyModifiers::Static) == 0) {
-                        if(isStatic) {
-                            AddError(ErrorCode::ERR_InstanceFieldAccessInStaticContext, identifier, FixedCharSpan());
-                        }
-                        return CreateExpression<FieldAccessExpression>(thisInstance, propertyInfo);
-                    }
-                    else {
-                        return CreateExpression<FieldAccessExpression>(nullptr, propertyInfo);
-                    }
+        // a const local stands for its value wherever it is used
+        void DeclareVariables(VariableDeclarationSyntax* declaration, bool isConst = false) {
+
+            if (declaration == nullptr || declaration->variables == nullptr) {
+                return;
+            }
 
+            for (int32 i = 0; i < declaration->variables->itemCount; i++) {
+                VariableDeclaratorSyntax* declarator = declaration->variables->items[i];
+
+                Expression* initializer = nullptr;
+
+                if (declarator->initializer != nullptr) {
+                    initializer = VisitExpression(declarator->initializer->value);
                 }
 
+                FixedCharSpan name = file->GetText(declarator->identifier);
 
-                if(!isStatic) {
-                    ptr = ptr->GetBaseClass();
+                if (name.size == 0) {
+                    continue;
                 }
 
-            }
-            // search properties
-            // search methods
+                LocalValue* local = AddLocal(name, declarator);
+
+                if (!isConst || initializer == nullptr) {
+                    continue;
+                }
 
-            return nullptr;
+                if (initializer->kind == ExpressionKind::Constant) {
+                    local->SetExpression(initializer);
+                }
+                else {
+                    AddError(ErrorCode::ERR_ConstantExpected, file->GetText(declarator->initializer->value), FixedCharSpan());
+                }
+            }
 
         }
 
-        void IntrospectMethod(SourceFileInfo* fileInfo, MethodInfo* methodInfo) {
-            ts_LocalExpressionBase = allocator->GetBase();
-            MethodDeclarationSyntax* methodDeclarationSyntax = methodInfo->syntaxNode;
-            scopeStack->size = 0;
-            PushScope();
+        static bool IsConstant(Expression* expression) {
+            return expression != nullptr && expression->kind == ExpressionKind::Constant;
+        }
 
-            if (methodInfo->isDefaultParameterOverload) {
+        static ConstantValue GetConstant(Expression* expression) {
+            return ((ConstantExpression*) expression)->value;
+        }
 
+        static bool IsConstModifier(TokenList* modifiers) {
+            if (modifiers == nullptr) {
+                return false;
             }
-            else {
-                for (int32 i = 0; i < methodInfo->parameterCount; i++) {
-                    ParameterInfo* parameterInfo = &methodInfo->parameters[i];
+            for (int32 i = 0; i < modifiers->size; i++) {
+                if (modifiers->array[i].kind == TokenKind::ConstKeyword) {
+                    return true;
                 }
             }
-            PopScope();
+            return false;
         }
 
-    };
+        // constant operands are folded on the spot, what can't be folded (string concatenation, mismatched types)
+        // is left to whatever reports operator errors
+        Expression* VisitBinaryExpression(BinaryExpressionSyntax* binaryExpressionSyntax) {
 
-    struct IntrospectScopesJob : Jobs::IJob {
+            Expression* left = VisitExpression(binaryExpressionSyntax->left);
+            Expression* right = VisitExpression(binaryExpressionSyntax->right);
 
-        TypeResolutionMap* resolutionMap;
-        CheckedArray<SourceFileInfo*> files;
+            if (left == nullptr || right == nullptr) {
+                return nullptr;
+            }
+
+            BinaryExpressionOp op = GetBinaryOp(binaryExpressionSyntax->GetKind());
 
-        IntrospectScopesJob(CheckedArray<SourceFileInfo*> files, TypeResolutionMap* resolutionMap)
-            : files(files)
-            , resolutionMap(resolutionMap) {}
+            if (IsConstant(left) && IsConstant(right)) {
+                ConstantValue value;
+                switch (FoldBinary(op, GetConstant(left), GetConstant(right), &value)) {
+                    case ConstantFold::Folded: {
+                        return CreateExpression<ConstantExpression>(value, GetLocation(binaryExpressionSyntax));
+                    }
+                    case ConstantFold::DivideByZero: {
+                        AddError(ErrorCode::ERR_ConstantDivideByZero, file->GetText(binaryExpressionSyntax), FixedCharSpan());
+                        return nullptr;
+                    }
+                    default: {
+                        break;
+                    }
+                }
+            }
 
-        ResolvedType returnType;
-        Diagnostics* diagnostics;
-        SourceFileInfo* file;
+            return CreateExpression<BinaryExpression>(left, op, right, GetLocation(binaryExpressionSyntax));
 
-        // PodList<Scope> scopeStack;
-        // PodList<BlockExpression> blockStack;
+        }
 
+        void VisitArguments(SeparatedSyntaxList<ArgumentSyntax>* arguments) {
+            if (arguments == nullptr) {
+                return;
+            }
+            for (int32 i = 0; i < arguments->itemCount; i++) {
+                VisitExpression(arguments->items[i]->expression);
+            }
+        }
 
+        void VisitExpressions(SeparatedSyntaxList<ExpressionSyntax>* expressions) {
+            if (expressions == nullptr) {
+                return;
+            }
+            for (int32 i = 0; i < expressions->itemCount; i++) {
+                VisitExpression(expressions->items[i]);
+            }
+        }
 
-        struct IntrospectionInfo {
-            uint8* buffer;
-            size_t bufferSize;
-            // diagnostics
-            // referenced type infos // needed for typeof() etc
-            // referenced member infos // probably needed for indexing, won't store when compiling just when doing lsp?
-        };
+        // this pass does all desugaring, definite assignment analysis etc, anything it doesn't know yet comes back
+        // as nullptr without looking inside. names in there could belong to something other than this method
+        // (object initializers, lambdas) so guessing would only report errors that aren't there
+        Expression* VisitExpression(ExpressionSyntax* expressionSyntax) {
 
-        // this pass does all desugaring, definite assignment analys
-        Expression* Visit(ExpressionSyntax* expressionSyntax) {
+            if (expressionSyntax == nullptr) {
+                return nullptr;
+            }
 
             switch (expressionSyntax->GetKind()) {
-                case SyntaxKind::LocalDeclarationStatement: {
-                    break;
+
+                case SyntaxKind::ParenthesizedExpression: {
+                    return VisitExpression(((ParenthesizedExpressionSyntax*) expressionSyntax)->expression);
                 }
-                case SyntaxKind::InvocationExpression: {
-                    InvocationExpressionSyntax* invocationExpressionSyntax = (InvocationExpressionSyntax*) expressionSyntax;
-                    Expression* target = Visit(invocationExpressionSyntax->expression);
 
-                    for (int32 i = 0; i < invocationExpressionSyntax->argumentList->arguments->itemCount; i++) {
-                        ArgumentSyntax* argument = invocationExpressionSyntax->argumentList->arguments->items[i];
-//                        ArgumentExpression arg = Visit(argument);
+                case SyntaxKind::IdentifierName: {
+                    IdentifierNameSyntax* identifierNameSyntax = (IdentifierNameSyntax*) expressionSyntax;
+                    FixedCharSpan name = file->GetText(identifierNameSyntax->identifier);
+                    if (name.size == 0) {
+                        return nullptr;
                     }
+                    return ResolveIdentifier(name, GetLocation(identifierNameSyntax));
+                }
 
-                    MethodInfo * methodInfo = nullptr;
+                case SyntaxKind::ThisExpression: {
+                    return thisInstance;
+                }
 
-                    bool expected = false;
-                    if (methodInfo->isEnqueued.compare_exchange_strong(expected, true)) {
-                        std::unique_lock<std::mutex> scheduleLock();
-                        // probably one point of allocation here
-                        // Schedule();
+                case SyntaxKind::TrueLiteralExpression:
+                case SyntaxKind::FalseLiteralExpression:
+                case SyntaxKind::NullLiteralExpression:
+                case SyntaxKind::NumericLiteralExpression:
+                case SyntaxKind::EmptyStringLiteralExpression:
+                case SyntaxKind::CharacterLiteralExpression:
+                case SyntaxKind::StringLiteralExpression: {
+                    ConstantValue value;
+                    if (!TryFoldLiteral(file, expressionSyntax, &value)) {
+                        return nullptr;
                     }
+                    return CreateExpression<ConstantExpression>(value, GetLocation(expressionSyntax));
+                }
+
+                case SyntaxKind::AddExpression:
+                case SyntaxKind::SubtractExpression:
+                case SyntaxKind::MultiplyExpression:
+                case SyntaxKind::DivideExpression:
+                case SyntaxKind::ModuloExpression:
+                case SyntaxKind::LeftShiftExpression:
+                case SyntaxKind::RightShiftExpression:
+                case SyntaxKind::LogicalOrExpression:
+                case SyntaxKind::LogicalAndExpression:
+                case SyntaxKind::BitwiseOrExpression:
+                case SyntaxKind::BitwiseAndExpression:
+                case SyntaxKind::ExclusiveOrExpression:
+                case SyntaxKind::EqualsExpression:
+                case SyntaxKind::NotEqualsExpression:
+                case SyntaxKind::LessThanExpression:
+                case SyntaxKind::LessThanOrEqualExpression:
+                case SyntaxKind::GreaterThanExpression:
+                case SyntaxKind::GreaterThanOrEqualExpression: {
+                    return VisitBinaryExpression((BinaryExpressionSyntax*) expressionSyntax);
+                }
+
+                case SyntaxKind::UnsignedRightShiftExpression:
+                case SyntaxKind::CoalesceExpression: {
+                    BinaryExpressionSyntax* binaryExpressionSyntax = (BinaryExpressionSyntax*) expressionSyntax;
+                    VisitExpression(binaryExpressionSyntax->left);
+                    VisitExpression(binaryExpressionSyntax->right);
+                    return nullptr;
+                }
+
+                case SyntaxKind::IsExpression:
+                case SyntaxKind::AsExpression: {
+                    // the right hand side is a type
+                    VisitExpression(((BinaryExpressionSyntax*) expressionSyntax)->left);
+                    return nullptr;
+                }
+
+                case SyntaxKind::SimpleAssignmentExpression:
+                case SyntaxKind::AddAssignmentExpression:
+                case SyntaxKind::SubtractAssignmentExpression:
+                case SyntaxKind::MultiplyAssignmentExpression:
+                case SyntaxKind::DivideAssignmentExpression:
+                case SyntaxKind::ModuloAssignmentExpression:
+                case SyntaxKind::AndAssignmentExpression:
+                case SyntaxKind::ExclusiveOrAssignmentExpression:
+                case SyntaxKind::OrAssignmentExpression:
+                case SyntaxKind::LeftShiftAssignmentExpression:
+                case SyntaxKind::RightShiftAssignmentExpression:
+                case SyntaxKind::UnsignedRightShiftAssignmentExpression:
+                case SyntaxKind::CoalesceAssignmentExpression: {
+                    AssignmentExpressionSyntax* assignmentExpressionSyntax = (AssignmentExpressionSyntax*) expressionSyntax;
+                    VisitExpression(assignmentExpressionSyntax->left);
+                    VisitExpression(assignmentExpressionSyntax->right);
+                    return nullptr;
+                }
+
+                case SyntaxKind::UnaryPlusExpression:
+                case SyntaxKind::UnaryMinusExpression:
+                case SyntaxKind::BitwiseNotExpression:
+                case SyntaxKind::LogicalNotExpression: {
+                    PrefixUnaryExpressionSyntax* prefixUnaryExpressionSyntax = (PrefixUnaryExpressionSyntax*) expressionSyntax;
+                    Expression* operand = VisitExpression(prefixUnaryExpressionSyntax->operand);
+                    if (operand == nullptr) {
+                        return nullptr;
+                    }
+                    UnaryExpressionOp op = GetUnaryOp(expressionSyntax->GetKind());
+                    ConstantValue value;
+                    if (IsConstant(operand) && FoldUnary(op, GetConstant(operand), &value) == ConstantFold::Folded) {
+                        return CreateExpression<ConstantExpression>(value, GetLocation(prefixUnaryExpressionSyntax));
+                    }
+                    return CreateExpression<UnaryExpression>(op, operand, GetLocation(prefixUnaryExpressionSyntax));
+                }
+
+                case SyntaxKind::PreIncrementExpression:
+                case SyntaxKind::PreDecrementExpression:
+                case SyntaxKind::IndexExpression: {
+                    VisitExpression(((PrefixUnaryExpressionSyntax*) expressionSyntax)->operand);
+                    return nullptr;
+                }
+
+                case SyntaxKind::PostIncrementExpression:
+                case SyntaxKind::PostDecrementExpression:
+                case SyntaxKind::BangExpression: {
+                    VisitExpression(((PostfixUnaryExpressionSyntax*) expressionSyntax)->expression);
+                    return nullptr;
+                }
 
+                case SyntaxKind::SimpleMemberAccessExpression: {
+                    MemberAccessExpressionSyntax* memberAccessSyntax = (MemberAccessExpressionSyntax*) expressionSyntax;
+                    Expression* constant = TryResolveTypeConstant(memberAccessSyntax);
+                    if (constant != nullptr) {
+                        return constant;
+                    }
+                    // the name is looked up on whatever the expression turns out to be
+                    VisitExpression(memberAccessSyntax->expression);
+                    return nullptr;
+                }
+
+                case SyntaxKind::PointerMemberAccessExpression: {
+                    VisitExpression(((MemberAccessExpressionSyntax*) expressionSyntax)->expression);
+                    return nullptr;
+                }
+
+                case SyntaxKind::InvocationExpression: {
+                    InvocationExpressionSyntax* invocationExpressionSyntax = (InvocationExpressionSyntax*) expressionSyntax;
+                    VisitExpression(invocationExpressionSyntax->expression);
+                    if (invocationExpressionSyntax->argumentList != nullptr) {
+                        VisitArguments(invocationExpressionSyntax->argumentList->arguments);
+                    }
                     // ResolveMethodToCall()
                     // enqueue method call creation if it is generic or if it's instance type is generic (and doesn't already exist)
-                    // we could lock the resolver before doing this so it becomes reads only
-                    // and hold a separate resolver for dynamic types w/ locks
-                    // so we don't contend there
-                    // also offers a solution for nuking ephemeral types, we literally don't store them
+                    return nullptr;
+                }
 
-                    // expression system works on baseptr + offet w/ methods for accessing
+                case SyntaxKind::ElementAccessExpression: {
+                    ElementAccessExpressionSyntax* elementAccessExpressionSyntax = (ElementAccessExpressionSyntax*) expressionSyntax;
+                    VisitExpression(elementAccessExpressionSyntax->expression);
+                    if (elementAccessExpressionSyntax->argumentList != nullptr) {
+                        VisitArguments(elementAccessExpressionSyntax->argumentList->arguments);
+                    }
+                    return nullptr;
+                }
 
-                    break;
+                case SyntaxKind::ConditionalExpression: {
+                    ConditionalExpressionSyntax* conditionalExpressionSyntax = (ConditionalExpressionSyntax*) expressionSyntax;
+                    VisitExpression(conditionalExpressionSyntax->condition);
+                    VisitExpression(conditionalExpressionSyntax->whenTrue);
+                    VisitExpression(conditionalExpressionSyntax->whenFalse);
+                    return nullptr;
+                }
+
+                case SyntaxKind::CastExpression: {
+                    CastExpressionSyntax* castExpressionSyntax = (CastExpressionSyntax*) expressionSyntax;
+                    Expression* operand = VisitExpression(castExpressionSyntax->expression);
+                    if (!IsConstant(operand)) {
+                        return nullptr;
+                    }
+                    ConstantType type = ResolveCastType(file, resolutionMap, castExpressionSyntax->type);
+                    if (type == ConstantType::None) {
+                        return nullptr;
+                    }
+                    ConstantValue value;
+                    if (ConvertConstant(GetConstant(operand), type, true, &value) != ConstantFold::Folded) {
+                        AddError(ErrorCode::ERR_ConstantValueCannotBeConverted, file->GetText(castExpressionSyntax), FixedCharSpan());
+                        return nullptr;
+                    }
+                    return CreateExpression<ConstantExpression>(value, GetLocation(castExpressionSyntax));
+                }
+
+                case SyntaxKind::RefExpression: {
+                    return VisitExpression(((RefExpressionSyntax*) expressionSyntax)->expression);
                 }
+
+                default: {
+                    return nullptr;
+                }
+
+            }
+
+        }
+
+        // labels are compared at compile time, anything we could see through has to have folded
+        void VisitCaseValue(ExpressionSyntax* syntax) {
+            Expression* value = VisitExpression(syntax);
+            if (value != nullptr && value->kind != ExpressionKind::Constant) {
+                AddError(ErrorCode::ERR_ConstantExpected, file->GetText(syntax), FixedCharSpan());
             }
+        }
 
-//            return Expression();
+        bool IsValueName(TypeSyntax* typeSyntax) {
+            if (typeSyntax == nullptr || typeSyntax->GetKind() != SyntaxKind::IdentifierName) {
+                return false;
+            }
+            FixedCharSpan name = file->GetText(((IdentifierNameSyntax*) typeSyntax)->identifier);
+            return locals.Find(name) != nullptr || (typeInfo->memberTable != nullptr && typeInfo->memberTable->Find(name) != nullptr);
         }
 
-        void Visit(BlockSyntax* pSyntax) {
+        // Type.Member naming a const or an enum member. only when the left side isn't a local or a member of
+        // ours, those hide the type's name
+        Expression* TryResolveTypeConstant(MemberAccessExpressionSyntax* memberAccessSyntax) {
 
-            for (int32 i = 0; i < pSyntax->statements->size; i++) {
-                StatementSyntax* statementSyntax = pSyntax->statements->array[i];
-                switch (statementSyntax->GetKind()) {
-                    case SyntaxKind::EmptyStatement: {
-                        break;
+            if (memberAccessSyntax->expression == nullptr || memberAccessSyntax->expression->GetKind() != SyntaxKind::IdentifierName) {
+                return nullptr;
+            }
+
+            if (memberAccessSyntax->name == nullptr || memberAccessSyntax->name->GetKind() != SyntaxKind::IdentifierName) {
+                return nullptr;
+            }
+
+            FixedCharSpan typeName = file->GetText(((IdentifierNameSyntax*) memberAccessSyntax->expression)->identifier);
+
+            if (typeName.size == 0 || locals.Find(typeName) != nullptr || (typeInfo->memberTable != nullptr && typeInfo->memberTable->Find(typeName) != nullptr)) {
+                return nullptr;
+            }
+
+            FixedCharSpan memberName = file->GetText(((IdentifierNameSyntax*) memberAccessSyntax->name)->identifier);
+            FieldInfo* fieldInfo = FindConstantField(ResolveConstantScope(file, resolutionMap, typeName), memberName);
+
+            if (fieldInfo == nullptr || fieldInfo->constantState != ConstantState::Evaluated) {
+                return nullptr;
+            }
+
+            return CreateExpression<ConstantExpression>(fieldInfo->constantValue, GetLocation(memberAccessSyntax));
+
+        }
+
+        // the statement of an if, loop etc gets a scope of its own even when it isn't a block
+        void VisitEmbeddedStatement(StatementSyntax* statementSyntax) {
+            if (statementSyntax == nullptr || statementSyntax->GetKind() == SyntaxKind::Block) {
+                VisitStatement(statementSyntax);
+                return;
+            }
+            PushScope(statementSyntax);
+            VisitStatement(statementSyntax);
+            PopScope();
+        }
+
+        void VisitStatements(SyntaxList<StatementSyntax>* statements) {
+            if (statements == nullptr) {
+                return;
+            }
+            for (int32 i = 0; i < statements->size; i++) {
+                VisitStatement(statements->array[i]);
+            }
+        }
+
+        void VisitStatement(StatementSyntax* statementSyntax) {
+
+            if (statementSyntax == nullptr) {
+                return;
+            }
+
+            switch (statementSyntax->GetKind()) {
+
+                case SyntaxKind::Block: {
+                    PushScope(statementSyntax);
+                    VisitStatements(((BlockSyntax*) statementSyntax)->statements);
+                    PopScope();
+                    break;
+                }
+
+                case SyntaxKind::LocalDeclarationStatement: {
+                    LocalDeclarationStatementSyntax* localDeclarationSyntax = (LocalDeclarationStatementSyntax*) statementSyntax;
+                    DeclareVariables(localDeclarationSyntax->declaration, IsConstModifier(localDeclarationSyntax->modifiers));
+                    break;
+                }
+
+                case SyntaxKind::ExpressionStatement: {
+                    VisitExpression(((ExpressionStatementSyntax*) statementSyntax)->expression);
+                    break;
+                }
+
+                case SyntaxKind::ReturnStatement: {
+                    ReturnStatementSyntax* returnStatementSyntax = (ReturnStatementSyntax*) statementSyntax;
+
+                    if (returnStatementSyntax->expressionSyntax != nullptr) {
+                        VisitExpression(returnStatementSyntax->expressionSyntax);
+                    }
+                    else if (!ReturnsVoid() && !methodInfo->returnType.IsUnresolved()) {
+                        AddError(ErrorCode::ERR_ExpectedReturnType, file->GetText(returnStatementSyntax), FixedCharSpan());
                     }
-                    case SyntaxKind::ReturnStatement: {
-                        ReturnStatementSyntax* returnStatementSyntax = (ReturnStatementSyntax*) statementSyntax;
 
-                        if (returnStatementSyntax->expressionSyntax == nullptr && returnType.typeInfo != resolutionMap->voidType) {
-                            diagnostics->AddError(ErrorCode::ERR_ExpectedReturnType, file->GetText(returnStatementSyntax));
-                            break;
-                        }
-                        else if (returnStatementSyntax->expressionSyntax == nullptr) {
-                            // handle return void
-                        }
-                        else {
-                            // handle typed return
-                            // Expression retnExpression = VisitExpression(returnStatementSyntax->expressionSyntax);
-                            // tree->CreateNode<ReturnStatementExpression>(retnExpression);
+                    break;
+                }
+
+                case SyntaxKind::IfStatement: {
+                    IfStatementSyntax* ifStatementSyntax = (IfStatementSyntax*) statementSyntax;
+                    VisitExpression(ifStatementSyntax->condition);
+                    VisitEmbeddedStatement(ifStatementSyntax->statement);
+                    if (ifStatementSyntax->elseClause != nullptr) {
+                        VisitEmbeddedStatement(ifStatementSyntax->elseClause->statement);
+                    }
+                    break;
+                }
+
+                case SyntaxKind::WhileStatement: {
+                    WhileStatementSyntax* whileStatementSyntax = (WhileStatementSyntax*) statementSyntax;
+                    VisitExpression(whileStatementSyntax->condition);
+                    VisitEmbeddedStatement(whileStatementSyntax->statement);
+                    break;
+                }
+
+                case SyntaxKind::DoStatement: {
+                    DoStatementSyntax* doStatementSyntax = (DoStatementSyntax*) statementSyntax;
+                    VisitEmbeddedStatement(doStatementSyntax->statement);
+                    VisitExpression(doStatementSyntax->condition);
+                    break;
+                }
+
+                case SyntaxKind::ForStatement: {
+                    ForStatementSyntax* forStatementSyntax = (ForStatementSyntax*) statementSyntax;
+                    PushScope(forStatementSyntax);
+                    DeclareVariables(forStatementSyntax->declaration);
+                    VisitExpressions(forStatementSyntax->initializers);
+                    VisitExpression(forStatementSyntax->condition);
+                    VisitExpressions(forStatementSyntax->incrementors);
+                    VisitEmbeddedStatement(forStatementSyntax->statement);
+                    PopScope();
+                    break;
+                }
+
+                case SyntaxKind::ForEachStatement: {
+                    ForEachStatementSyntax* forEachStatementSyntax = (ForEachStatementSyntax*) statementSyntax;
+                    VisitExpression(forEachStatementSyntax->expression);
+                    PushScope(forEachStatementSyntax);
+                    FixedCharSpan name = file->GetText(forEachStatementSyntax->identifier);
+                    if (name.size != 0) {
+                        AddLocal(name, forEachStatementSyntax);
+                    }
+                    VisitEmbeddedStatement(forEachStatementSyntax->statement);
+                    PopScope();
+                    break;
+                }
+
+                case SyntaxKind::UsingStatement: {
+                    UsingStatementSyntax* usingStatementSyntax = (UsingStatementSyntax*) statementSyntax;
+                    PushScope(usingStatementSyntax);
+                    DeclareVariables(usingStatementSyntax->declaration);
+                    VisitExpression(usingStatementSyntax->expression);
+                    VisitEmbeddedStatement(usingStatementSyntax->statement);
+                    PopScope();
+                    break;
+                }
+
+                case SyntaxKind::SwitchStatement: {
+                    SwitchStatementSyntax* switchStatementSyntax = (SwitchStatementSyntax*) statementSyntax;
+                    VisitExpression(switchStatementSyntax->expression);
+
+                    // every section shares the switch block's scope
+                    PushScope(switchStatementSyntax);
+                    if (switchStatementSyntax->sections != nullptr) {
+                        for (int32 i = 0; i < switchStatementSyntax->sections->size; i++) {
+                            SwitchSectionSyntax* section = switchStatementSyntax->sections->array[i];
+                            for (int32 l = 0; l < section->labels->size; l++) {
+                                SwitchLabelSyntax* label = section->labels->array[l];
+                                if (label->GetKind() == SyntaxKind::CaseSwitchLabel) {
+                                    VisitCaseValue(((CaseSwitchLabelSyntax*) label)->value);
+                                }
+                                else if (label->GetKind() == SyntaxKind::CasePatternSwitchLabel) {
+                                    PatternSyntax* pattern = ((CasePatternSwitchLabelSyntax*) label)->pattern;
+                                    if (pattern->GetKind() == SyntaxKind::ConstantPattern) {
+                                        VisitCaseValue(((ConstantPatternSyntax*) pattern)->expression);
+                                    }
+                                    else if (pattern->GetKind() == SyntaxKind::TypePattern && IsValueName(((TypePatternSyntax*) pattern)->type)) {
+                                        // `case name:` parses as a type until we know it isn't one
+                                        VisitCaseValue(((TypePatternSyntax*) pattern)->type);
+                                    }
+                                }
+                            }
+                            VisitStatements(section->statements);
                         }
+                    }
+                    PopScope();
+                    break;
+                }
 
-                        break;
+                case SyntaxKind::TryStatement: {
+                    TryStatementSyntax* tryStatementSyntax = (TryStatementSyntax*) statementSyntax;
+                    VisitStatement(tryStatementSyntax->tryBlock);
+
+                    if (tryStatementSyntax->catchClauses != nullptr) {
+                        for (int32 i = 0; i < tryStatementSyntax->catchClauses->size; i++) {
+                            CatchClauseSyntax* catchClause = tryStatementSyntax->catchClauses->array[i];
+                            PushScope(catchClause);
+                            if (catchClause->declaration != nullptr) {
+                                FixedCharSpan name = file->GetText(catchClause->declaration->identifier);
+                                if (name.size != 0) {
+                                    AddLocal(name, catchClause->declaration);
+                                }
+                            }
+                            if (catchClause->filter != nullptr) {
+                                VisitExpression(catchClause->filter->filterExpression);
+                            }
+                            VisitStatement(catchClause->block);
+                            PopScope();
+                        }
                     }
-                    case SyntaxKind::ExpressionStatement: {
-                        ExpressionStatementSyntax* expressionStatementSyntax = (ExpressionStatementSyntax*) statementSyntax;
-                        Visit(expressionStatementSyntax->expression);
-                        break;
+
+                    if (tryStatementSyntax->finallyClaus != nullptr) {
+                        VisitStatement(tryStatementSyntax->finallyClaus->block);
                     }
-                    default: {
-                        NOT_IMPLEMENTED(SyntaxKindToString(statementSyntax->GetKind()));
-                        break;
+                    break;
+                }
+
+                case SyntaxKind::ThrowStatement: {
+                    VisitExpression(((ThrowStatementSyntax*) statementSyntax)->expression);
+                    break;
+                }
+
+                case SyntaxKind::LabeledStatement: {
+                    VisitStatement(((LabeledStatementSyntax*) statementSyntax)->statement);
+                    break;
+                }
+
+                default: {
+                    // break, continue, goto & empty have nothing in them, local functions etc aren't handled yet
+                    break;
+                }
+
+            }
+
+        }
+
+        void Claim(MethodInfo* calledMethod) {
+            bool expected = false;
+            if (calledMethod->isEnqueued.compare_exchange_strong(expected, true)) {
+                claimed.Add(calledMethod);
+            }
+        }
+
+        void ClaimByName(FixedCharSpan name) {
+            int32 nameHash = MsiHash::FNV1a(name);
+            for (int32 i = methodNames->FindFirst(nameHash); i < methodNames->entries.size; i++) {
+                MethodNameEntry entry = methodNames->entries.array[i];
+                if (entry.nameHash != nameHash) {
+                    break;
+                }
+                if (entry.methodInfo->name == name) {
+                    Claim(entry.methodInfo);
+                }
+            }
+        }
+
+        void ClaimReference(FixedCharSpan name, bool isMemberAccess) {
+
+            // we don't know what the left side is, so whatever could answer to the name is reachable
+            if (isMemberAccess || typeInfo->memberTable == nullptr) {
+                ClaimByName(name);
+                return;
+            }
+
+            MemberLookupEntry* member = typeInfo->memberTable->Find(name);
+
+            // a local, a type name, or a field holding a delegate whose targets were claimed where they were taken
+            if (member == nullptr || member->kind != MemberKind::Method) {
+                return;
+            }
+
+            MethodInfo* found = member->GetMethod();
+
+            // a virtual call can land in any override, the overrides share the name
+            if (found->declaringType->typeClass == TypeClass::Interface || (found->modifiers & (MethodModifiers::Virtual | MethodModifiers::Abstract | MethodModifiers::Override)) != 0) {
+                ClaimByName(name);
+                return;
+            }
+
+            // without overload resolution every overload is a candidate, a base class can add more of them
+            for (TypeInfo* declaringType = found->declaringType; declaringType != nullptr; declaringType = declaringType->GetBaseClass()) {
+                for (int32 i = 0; i < declaringType->methodCount; i++) {
+                    if (declaringType->methods[i].name == name) {
+                        Claim(&declaringType->methods[i]);
                     }
                 }
             }
 
         }
 
+        // The expression visitor doesn't look inside lambdas and initializers yet, so what a body can call is read off
+        // its tokens instead. Every identifier that could name a method counts, called or taken as a method group.
+        // Claiming too much only costs time, missing a method would leave it out of the program.
+        void ClaimReferencedMethods(SyntaxBase* body) {
+
+            CheckedArray<SyntaxToken> tokens = file->tokenizerResult.tokens;
+            int32 end = body->GetEndTokenId();
+            TokenKind previous = TokenKind::None;
+
+            for (int32 i = body->GetStartTokenId(); i <= end; i++) {
+
+                SyntaxToken token = tokens.array[i];
+
+                if (token.kind == TokenKind::Trivia) {
+                    continue;
+                }
+
+                // constructors aren't methods yet
+                if (token.kind == TokenKind::IdentifierToken && previous != TokenKind::NewKeyword) {
+                    bool isMemberAccess = previous == TokenKind::DotToken || previous == TokenKind::MinusGreaterThanToken;
+                    ClaimReference(token.GetText(file->tokenizerResult.texts), isMemberAccess);
+                }
+
+                previous = token.kind;
+
+            }
+
+        }
+
+        void IntrospectMethod(TypeInfo* typeInfo, MethodInfo* methodInfo, TempAllocator* tempAllocator) {
+
+            ts_LocalExpressionBase = allocator->GetBase();
+
+            this->typeInfo = typeInfo;
+            this->methodInfo = methodInfo;
+            this->file = typeInfo->declaringFile;
+
+            result = allocator->Allocate<MethodIntrospection>(1);
+            result->base = allocator->GetBase();
+            lastDiagnostic = nullptr;
+            currentScope = nullptr;
+            internalVarId = 0;
+
+            MethodDeclarationSyntax* methodDeclarationSyntax = methodInfo->syntaxNode;
+
+            locals.Initialize(tempAllocator, 32);
 
+            // parameters and the body's top level share a scope, a local can't reuse a parameter's name
+            PushScope(methodDeclarationSyntax);
+            result->rootScope = currentScope;
+
+            thisInstance = (methodInfo->modifiers & MethodModifiers::Static) != 0
+                ? nullptr
+                : CreateExpression<ThisExpression>(typeInfo, GetLocation(methodDeclarationSyntax));
+
+            // duplicate parameter names were reported when the signature was resolved
+            for (int32 i = 0; i < methodInfo->parameterCount; i++) {
+                ParameterInfo* parameterInfo = &methodInfo->parameters[i];
+                if (parameterInfo->name.size == 0) {
+                    continue;
+                }
+                LocalValue* value = NewLocal(parameterInfo->name, parameterInfo->syntaxNode);
+                value->resolvedType = parameterInfo->type;
+                locals.Declare(parameterInfo->name, value);
+            }
+
+            if (methodDeclarationSyntax->body != nullptr) {
+                VisitStatements(methodDeclarationSyntax->body->statements);
+            }
+            else if (methodDeclarationSyntax->expressionBody != nullptr) {
+                VisitExpression(methodDeclarationSyntax->expressionBody->expression);
+            }
+
+            PopScope();
+
+            if (methodNames != nullptr) {
+                ClaimBodyReferences(methodDeclarationSyntax);
+            }
+
+            methodInfo->introspection = result;
+
+        }
+
+        // only claims what the body reaches, see IsKeptBody. the result has no scopes
+        void ScanMethod(TypeInfo* typeInfo, MethodInfo* methodInfo) {
+
+            this->typeInfo = typeInfo;
+            this->methodInfo = methodInfo;
+            this->file = typeInfo->declaringFile;
+
+            result = allocator->Allocate<MethodIntrospection>(1);
+            result->base = allocator->GetBase();
+
+            ClaimBodyReferences(methodInfo->syntaxNode);
+
+            methodInfo->introspection = result;
+
+        }
+
+        void ClaimBodyReferences(MethodDeclarationSyntax* methodDeclarationSyntax) {
+            claimed.size = 0;
+            ClaimReferencedMethods(methodDeclarationSyntax->body != nullptr ? (SyntaxBase*) methodDeclarationSyntax->body : (SyntaxBase*) methodDeclarationSyntax->expressionBody);
+            result->claimedMethods = allocator->AllocateUncleared<MethodInfo*>(claimed.size);
+            result->claimedMethodCount = claimed.size;
+            memcpy(result->claimedMethods, claimed.array, sizeof(MethodInfo*) * claimed.size);
+        }
+
+    };
+
+    // One batch of methods per call. Each method writes only to its own MethodIntrospection and the worker's own arena,
+    // the type information they read was finished before the phase started, so nothing here takes a lock. Claiming a
+    // method is a compare & swap on its isEnqueued, whoever wins has it in their claimedMethods.
+    struct IntrospectScopesJob : Jobs::IJob {
+
+        CheckedArray<IntrospectionTarget> targets;
+        int32* batchStarts;
+        IntrospectionArenas* arenas;
+        TypeResolutionMap* resolutionMap;
+        MethodNameIndex* methodNames;
+
+        IntrospectScopesJob(CheckedArray<IntrospectionTarget> targets, int32* batchStarts, IntrospectionArenas* arenas, TypeResolutionMap* resolutionMap, MethodNameIndex* methodNames)
+            : targets(targets)
+            , batchStarts(batchStarts)
+            , arenas(arenas)
+            , resolutionMap(resolutionMap)
+            , methodNames(methodNames) {}
+
+        void Execute(int32 batchIndex) override {
+
+            Introspector introspector(arenas->Get(GetWorkerId()), resolutionMap, methodNames);
+            TempAllocator* tempAllocator = GetAllocator();
+
+            for (int32 i = batchStarts[batchIndex]; i < batchStarts[batchIndex + 1]; i++) {
+                TempAllocator::ScopedMarker marker(tempAllocator);
+                if (methodNames != nullptr && IsKeptBody(targets[i].methodInfo)) {
+                    introspector.ScanMethod(targets[i].typeInfo, targets[i].methodInfo);
+                }
+                else {
+                    introspector.IntrospectMethod(targets[i].typeInfo, targets[i].methodInfo, tempAllocator);
+                }
+            }
+
+        }
 
     };
 
-}
\ No newline at end of file
+}
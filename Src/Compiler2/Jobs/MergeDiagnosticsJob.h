@@ -0,0 +1,32 @@
+#pragma once
+
+#include "../../JobSystem/Job.h"
+#include "../SourceFileInfo.h"
+
+namespace Alchemy::Compilation {
+
+    // one file per job. each file owns a disjoint slice of `scratch` starting at starts[idx], the file's entries
+    // are copied there, sorted & de-duplicated in place and the surviving count written to counts[idx]
+    struct MergeDiagnosticsJob : Jobs::IJob {
+
+        CheckedArray<SourceFileInfo*> files;
+        int32* starts;
+        int32* counts;
+        DiagnosticEntry* scratch;
+
+        MergeDiagnosticsJob(CheckedArray<SourceFileInfo*> files, int32* starts, int32* counts, DiagnosticEntry* scratch)
+            : files(files)
+            , starts(starts)
+            , counts(counts)
+            , scratch(scratch) {}
+
+        void Execute(int32 idx) override {
+            Diagnostics* diagnostics = &files[idx]->diagnostics;
+            DiagnosticEntry* entries = scratch + starts[idx];
+            diagnostics->CopyTo(entries);
+            counts[idx] = SortAndDeduplicate(entries, diagnostics->size);
+        }
+
+    };
+
+}
@@ -3,6 +3,7 @@
 #include "../../Parsing3/Parsing.h"
 #include "../../Parsing3/TextWindow.h"
 #include "../../Parsing3/Parser.h"
+#include "../../Util/Stopwatch.h"
 
 namespace Alchemy::Compilation {
 
@@ -16,6 +17,8 @@ namespace Alchemy::Compilation {
 
         SourceFileInfo * fileInfo = files[idx];
 
+        Stopwatch stopwatch;
+
         fileInfo->contents = fileInfo->isBuiltIn ? fileInfo->contents : vfs->ReadFileText(fileInfo->path, fileInfo->allocator.MakeAllocator());
 
         TextWindow window(fileInfo->contents.ptr, fileInfo->contents.size);
@@ -26,6 +29,8 @@ namespace Alchemy::Compilation {
 
         fileInfo->tokenizerResult = result;
         fileInfo->syntaxTree = ParseCompilationUnit(&parser);
+        fileInfo->nodeCount = parser.nodeCount;
+        fileInfo->phaseNanoseconds[(int32) FilePhase::Parse] = stopwatch.ElapsedNanoseconds();
 
     }
 
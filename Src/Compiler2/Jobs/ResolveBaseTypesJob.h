@@ -5,6 +5,7 @@
 #include "../ResolvedType.h"
 #include "../TypeResolver.h"
 #include "../MemberInfo.h"
+#include "../../Util/Stopwatch.h"
 
 namespace Alchemy::Compilation {
 
@@ -28,7 +29,7 @@ namespace Alchemy::Compilation {
                 TypeInfo** generics = GetThreadLocalAllocator()->Allocate<TypeInfo*>(pInfo->genericArgumentCount);
 
                 for (int32 i = 0; i < pInfo->genericArgumentCount; i++) {
-                    generics[i] = pInfo->genericArguments[i].typeInfo;
+                    generics[i] = pInfo->genericArguments[i].GetTypeInfo();
                 }
 
                 typeResolver->inputGenericArguments = CheckedArray<TypeInfo*>(generics, pInfo->genericArgumentCount);
@@ -74,35 +75,8 @@ namespace Alchemy::Compilation {
             }
         }
 
-        FixedCharSpan MakeCycleError(CheckedArray<FixedCharSpan> path, Allocator allocator) {
-            size_t s = 0;
-            for (int32 x = 0; x < path.size; x++) {
-                s += path[x].size;
-                if (x != path.size - 1) {
-                    s += 4;
-                }
-
-            }
-            s++;
-            char* c = allocator.AllocateUncleared<char>(s);
-            char* b = c;
-            for (int32 x = 0; x < path.size; x++) {
-                memcpy(b, path[x].ptr, path[x].size);
-                b += path[x].size;
-                if (x != path.size - 1) {
-                    b[0] = ' ';
-                    b[1] = '-';
-                    b[2] = '>';
-                    b[3] = ' ';
-                    b += 4;
-                }
-
-            }
-            b[0] = '\0';
-            return FixedCharSpan(c, b - c);
-        }
-
-        void ValidateBaseList(TypeInfo* typeInfo, CheckedArray<TypeInfo*> visitList, FixedPodList<FixedCharSpan> path, BaseListSyntax* baseListSyntax) {
+        // cycles are found later by Compiler::BuildTypeHierarchy, once every file's base types are known
+        void ValidateBaseList(TypeInfo* typeInfo, BaseListSyntax* baseListSyntax) {
 
             if (typeInfo->baseTypeCount == 0) {
                 return;
@@ -112,13 +86,6 @@ namespace Alchemy::Compilation {
 
             bool isStruct = typeInfo->typeClass == TypeClass::Struct;
 
-            if (!isStruct && typeInfo->baseTypes[0].IsClass() && typeInfo->DetectClassCycle(visitList, &path)) {
-                FixedCharSpan error = MakeCycleError(path.ToCheckedArray(), typeInfo->declaringFile->allocator.MakeAllocator());
-                FixedCharSpan sourceRange = baseListSyntax->types->items[0]->GetText(typeInfo->declaringFile->tokenizerResult);
-                Diagnostic diagnostic(ErrorCode::ERR_CycleDetectedInClassHierarchy, sourceRange, error);
-                typeInfo->declaringFile->diagnostics.AddError(diagnostic);
-            }
-
 
             // check for duplicates
             for (int32 b = 0; b < typeInfo->baseTypeCount; b++) {
@@ -131,7 +98,7 @@ namespace Alchemy::Compilation {
 
                 for (int32 c = b + 1; c < typeInfo->baseTypeCount; c++) {
                     ResolvedType a = typeInfo->baseTypes[c];
-                    if (a.typeInfo == t.typeInfo) {
+                    if (a.typeId == t.typeId) {
                         FixedCharSpan sourceRange = baseListSyntax->types->items[b]->GetText(typeInfo->declaringFile->tokenizerResult);
                         Diagnostic diagnostic(ErrorCode::ERR_BaseTypeAppearsMultipleTimes, sourceRange);
                         typeInfo->declaringFile->diagnostics.AddError(diagnostic);
@@ -146,10 +113,9 @@ namespace Alchemy::Compilation {
                     continue;
                 }
 
-                visitList.size = 0;
                 FixedCharSpan span = baseList[b]->GetText(typeInfo->declaringFile->tokenizerResult);
 
-                if (resolvedType.typeInfo == typeInfo) {
+                if (resolvedType.typeId == typeInfo->typeId) {
                     typeInfo->declaringFile->diagnostics.AddError(Diagnostic(ErrorCode::ERR_CannotInheritRecursively, span));
                     continue;
                 }
@@ -196,11 +162,10 @@ namespace Alchemy::Compilation {
         void Execute(int32 idx) override {
 
             SourceFileInfo* file = files.Get(idx);
+            Stopwatch stopwatch;
 
             TypeResolver typeResolver(file, resolutionMap);
-
-            CheckedArray<TypeInfo*> inheritStack(GetThreadLocalAllocator()->Allocate<TypeInfo*>(64), 64);
-            FixedPodList<FixedCharSpan> cyclePath(GetThreadLocalAllocator()->Allocate<FixedCharSpan>(64), 64);
+            typeResolver.recordDependencies = true;
 
             for (int32 i = 0; i < file->declaredTypes.size; i++) {
 
@@ -216,7 +181,7 @@ namespace Alchemy::Compilation {
                         ValidateGenericArgs(typeParameterList, file, &typeResolver);
                         HandleBaseList(typeInfo, classDeclarationSyntax->baseList, &typeResolver);
 
-                        ValidateBaseList(typeInfo, inheritStack, cyclePath, classDeclarationSyntax->baseList);
+                        ValidateBaseList(typeInfo, classDeclarationSyntax->baseList);
 
                         break;
                     }
@@ -226,7 +191,7 @@ namespace Alchemy::Compilation {
                         ValidateGenericArgs(typeParameterList, file, &typeResolver);
                         HandleBaseList(typeInfo, structDeclarationSyntax->baseList, &typeResolver);
 
-                        ValidateBaseList(typeInfo, inheritStack, cyclePath, structDeclarationSyntax->baseList);
+                        ValidateBaseList(typeInfo, structDeclarationSyntax->baseList);
 
                         break;
                     }
@@ -240,7 +205,7 @@ namespace Alchemy::Compilation {
                         break;
                     }
                     case TypeClass::Enum: {
-                        NOT_IMPLEMENTED("Enum");
+                        // the base list only names the underlying type, see EvaluateEnumMember
                         break;
                     }
                     case TypeClass::Delegate: {
@@ -258,6 +223,8 @@ namespace Alchemy::Compilation {
                 }
             }
 
+            file->phaseNanoseconds[(int32) FilePhase::ResolveBases] = stopwatch.ElapsedNanoseconds();
+
         }
 
     };
@@ -8,6 +8,7 @@
 #include "../MemberInfo.h"
 #include "../../PrimitiveTypes.h"
 #include "../../Allocation/ThreadLocalTemp.h"
+#include "../../Util/Stopwatch.h"
 
 namespace Alchemy::Compilation {
 
@@ -67,6 +68,7 @@ namespace Alchemy::Compilation {
                             fileInfo->diagnostics.AddError(Diagnostic(ErrorCode::ERR_MultipleModifiers, fileInfo->GetText(token)));
                         }
                         readonlyCount++;
+                        break;
                     }
                     case TokenKind::StaticKeyword: {
                         if (staticCount == 0) {
@@ -81,6 +83,7 @@ namespace Alchemy::Compilation {
                             fileInfo->diagnostics.AddError(Diagnostic(ErrorCode::ERR_MultipleModifiers, fileInfo->GetText(token)));
                         }
                         staticCount++;
+                        break;
                     }
                     case TokenKind::ConstKeyword: {
                         if (constCount == 0) {
@@ -96,6 +99,7 @@ namespace Alchemy::Compilation {
                             fileInfo->diagnostics.AddError(Diagnostic(ErrorCode::ERR_MultipleModifiers, fileInfo->GetText(token)));
                         }
                         constCount++;
+                        break;
                     }
                     default: {
                         fileInfo->diagnostics.AddError(Diagnostic(ErrorCode::ERR_InvalidModifierForFieldDeclaration, fileInfo->GetText(token)));
@@ -121,7 +125,8 @@ namespace Alchemy::Compilation {
                     case TokenKind::PublicKeyword:
                     case TokenKind::ProtectedKeyword:
                     case TokenKind::InternalKeyword:
-                    case TokenKind::PrivateKeyword: {
+                    case TokenKind::PrivateKeyword:
+                    case TokenKind::ExportKeyword: {
                         if (visCount == 0) {
                             if (token.kind == TokenKind::PublicKeyword) {
                                 *pVisibility = MemberVisibility::Public;
@@ -135,6 +140,10 @@ namespace Alchemy::Compilation {
                             else if (token.kind == TokenKind::PrivateKeyword) {
                                 *pVisibility = MemberVisibility::Private;
                             }
+                            else if (token.kind == TokenKind::ExportKeyword) {
+                                // public, and something the host can call into, see Compiler::AddEntryPoint
+                                *pVisibility = MemberVisibility::Export;
+                            }
                         }
                         else if (visCount == 1) {
                             fileInfo->diagnostics.AddError(Diagnostic(ErrorCode::ERR_MultipleVisibilityModifiers, fileInfo->GetText(token)));
@@ -320,7 +329,9 @@ namespace Alchemy::Compilation {
         void Execute(int32 index) override {
 
             SourceFileInfo* file = files.Get(index);
+            Stopwatch stopwatch;
             TypeResolver typeResolver(file, resolutionMap);
+            typeResolver.recordDependencies = true;
 
             TypeInfo** tempTypeInfos = GetThreadLocalAllocator()->AllocateUncleared<TypeInfo*>(64);
             FixedPodList<TypeInfo*> genericArgumentStack(tempTypeInfos, 64);
@@ -352,12 +363,13 @@ namespace Alchemy::Compilation {
 
                         int32 genStackSize = genericArgumentStack.size;
                         for (int32 a = 0; a < typeInfo->genericArgumentCount; a++) {
-                            genericArgumentStack.Add(typeInfo->genericArguments[a].typeInfo);
+                            genericArgumentStack.Add(typeInfo->genericArguments[a].GetTypeInfo());
                         }
 
                         typeResolver.inputGenericArguments = genericArgumentStack.ToCheckedArray();
 
                         int32 fieldIndex = 0;
+                        int32 propertyIndex = 0;
                         int32 methodIndex = 0;
 
                         for (int32 m = 0; m < members->size; m++) {
@@ -393,6 +405,20 @@ namespace Alchemy::Compilation {
                                     break;
                                 }
                                 case SyntaxKind::PropertyDeclaration: {
+
+                                    PropertyDeclarationSyntax* propertyDeclarationSyntax = (PropertyDeclarationSyntax*) member;
+
+                                    // accessor bodies aren't looked at yet, only the signature
+                                    PropertyInfo* propertyInfo = &typeInfo->properties[propertyIndex++];
+                                    HandleMethodModifiers(typeInfo->declaringFile, propertyDeclarationSyntax->modifiers, &propertyInfo->visibility, &propertyInfo->modifiers);
+
+                                    if (!typeResolver.TryResolveType(propertyDeclarationSyntax->type, &propertyInfo->type)) {
+                                        propertyInfo->type = typeResolver.Unresolved();
+                                        file->diagnostics.AddError(Diagnostic(ErrorCode::ERR_UnresolvedType, file->GetText(propertyDeclarationSyntax->type)));
+                                    }
+
+                                    propertyInfo->declaringType = typeInfo;
+                                    propertyInfo->name = file->GetText(propertyDeclarationSyntax->identifier);
                                     break;
                                 }
                                 case SyntaxKind::MethodDeclaration: {
@@ -414,7 +440,7 @@ namespace Alchemy::Compilation {
                                         for (int32 t = 0; t < methodDeclarationSyntax->typeParameterList->parameters->itemCount; t++) {
                                             TypeParameterSyntax* genericArg = methodDeclarationSyntax->typeParameterList->parameters->items[t];
                                             FixedCharSpan argName = file->GetText(genericArg->identifier);
-                                            // genericArgumentStack.Add(typeInfo->genericArguments[a].typeInfo);
+                                            // genericArgumentStack.Add(typeInfo->genericArguments[a].GetTypeInfo());
                                         }
                                     }
 
@@ -467,6 +493,7 @@ namespace Alchemy::Compilation {
                                         parameterInfos[p].name = file->GetText(parameter->identifier);
                                         parameterInfos[p].modifiers = parameterModifiers;
                                         parameterInfos[p].syntaxNode = parameter;
+                                        parameterInfos[p].defaultValue = ConstantValue(); // folded once every constant can be looked up
 
                                         for(int32 p1 = p - 1; p1 >= 0; p1--) {
                                             if(parameterInfos[p1].name == parameterInfos[p].name) {
@@ -517,8 +544,22 @@ namespace Alchemy::Compilation {
                     }
                     case TypeClass::Interface:
                         break;
-                    case TypeClass::Enum:
+                    case TypeClass::Enum: {
+                        // members are const fields of the enum's own type, they can't have modifiers of their own
+                        EnumDeclarationSyntax* enumDeclarationSyntax = (EnumDeclarationSyntax*) typeInfo->syntaxNode;
+
+                        for (int32 f = 0; f < typeInfo->fieldCount; f++) {
+                            FieldInfo* fieldInfo = &typeInfo->fields[f];
+                            fieldInfo->type = ResolvedType(typeInfo);
+                            fieldInfo->declaringType = typeInfo;
+                            fieldInfo->identifier = file->GetText(enumDeclarationSyntax->members->items[f]->identifier);
+                            fieldInfo->syntaxNode = nullptr;
+                            fieldInfo->modifiers = FieldModifiers::Const;
+                            fieldInfo->visibility = MemberVisibility::Public;
+                        }
+
                         break;
+                    }
                     case TypeClass::Delegate:
                         break;
                     case TypeClass::Widget:
@@ -533,6 +574,8 @@ namespace Alchemy::Compilation {
 
             }
 
+            file->phaseNanoseconds[(int32) FilePhase::ResolveMembers] = stopwatch.ElapsedNanoseconds();
+
         }
 
     };
@@ -1,42 +1,218 @@
 #pragma once
 
-#include "../../JobSystem/JobSystem.h"
+#include "../../PrimitiveTypes.h"
+#include "../../Collections/Sort.h"
+#include "../../Parsing3/SyntaxNodes.h"
+#include "../SourceFileInfo.h"
+#include "../TypeInfo.h"
+#include "../MemberInfo.h"
+#include "../../Util/Hash.h"
 
 namespace Alchemy::Compilation {
 
-    struct ScheduleIntrospectScopesJob : Jobs::IJob {
+    // one method body to introspect. cost is the body's token count, it follows the statement count (nested ones
+    // included) and is there without walking the tree. order is where it was found, it keeps sorting deterministic
+    struct IntrospectionTarget {
+        TypeInfo* typeInfo;
+        MethodInfo* methodInfo;
+        int32 cost;
+        int32 order;
+    };
 
-        CheckedArray<TypeInfo*> typeInfos;
-        TypeResolutionMap* typeResolutionMap;
+    // the least work worth a job of its own, in tokens. below that the job overhead starts to show
+    constexpr int32 kMinIntrospectionBatchCost = 512;
 
-        ScheduleIntrospectScopesJob(CheckedArray<TypeInfo*> typeInfos, TypeResolutionMap* typeResolutionMap)
-            : typeInfos(typeInfos)
-            , typeResolutionMap(typeResolutionMap) {}
+    inline int32 GetMethodBodyCost(MethodDeclarationSyntax* syntaxNode) {
+        SyntaxBase* body = syntaxNode->body != nullptr ? (SyntaxBase*) syntaxNode->body : (SyntaxBase*) syntaxNode->expressionBody;
+        if (body == nullptr) {
+            return 0;
+        }
+        return body->GetEndTokenId() - body->GetStartTokenId() + 1;
+    }
 
-        void Execute(int32 start, int32 end) override {
+    // 0 when there is nothing to introspect
+    inline int32 GetIntrospectionCost(MethodInfo* methodInfo) {
+        // default parameter overloads forward to the full method and share its body
+        if (methodInfo->syntaxNode == nullptr || methodInfo->isDefaultParameterOverload) {
+            return 0;
+        }
+        return GetMethodBodyCost(methodInfo->syntaxNode);
+    }
 
-            for (int32 i = start; i < end; i++) {
+    // A body reached last time, from the same entry points, in a file nobody changed comes out the same, so it is only
+    // scanned for what it reaches and its diagnostics stay where they are. Instances aren't kept, they depend on their
+    // type arguments' files too.
+    inline bool IsKeptBody(MethodInfo* methodInfo) {
+        TypeInfo* typeInfo = methodInfo->declaringType;
+        return methodInfo->wasReached && !typeInfo->IsGenericInstance() && typeInfo->declaringFile->keepsBodyDiagnostics;
+    }
 
-                TypeInfo* typeInfo = typeInfos[i];
+    // every method with a body declared by `files`, which must all have their syntax trees
+    inline CheckedArray<IntrospectionTarget> GatherIntrospectionTargets(CheckedArray<SourceFileInfo*> files, TempAllocator* allocator) {
 
-                if((typeInfo->flags & TypeInfoFlags::InstantiatedGeneric) != 0) {
-                    // we only want to directly process types that are concrete or generic templates
-                    // for actual generic methods we'll process them as we encounter them
-                    // we do this so we:
-                    // a. don't process a bunch of unused generic methods
-                    // b. allocate concrete methods ephemerally
-                    // c. don't duplicate a ton of diagnostic errors
-                    continue;
-                }
+        int32 count = 0;
+        for (int32 f = 0; f < files.size; f++) {
+            for (int32 t = 0; t < files[f]->declaredTypes.size; t++) {
+                count += files[f]->declaredTypes[t]->methodCount;
+            }
+        }
+
+        IntrospectionTarget* targets = allocator->AllocateUncleared<IntrospectionTarget>(count);
+        int32 write = 0;
+
+        for (int32 f = 0; f < files.size; f++) {
+
+            SourceFileInfo* file = files[f];
+
+            // types restored from a snapshot have no method bodies until their file changes
+            if (file->syntaxTree == nullptr) {
+                continue;
+            }
+
+            for (int32 t = 0; t < file->declaredTypes.size; t++) {
+
+                TypeInfo* typeInfo = file->declaredTypes[t];
 
                 for (int32 m = 0; m < typeInfo->methodCount; m++) {
-                    Schedule(Jobs::Parallel::Foreach(5), IntrospectScopesJob(typeInfo, &typeInfo->methods[m], typeResolutionMap));
+
+                    MethodInfo* methodInfo = &typeInfo->methods[m];
+                    int32 cost = GetIntrospectionCost(methodInfo);
+
+                    if (cost == 0) {
+                        continue;
+                    }
+
+                    targets[write] = IntrospectionTarget { typeInfo, methodInfo, cost, write };
+                    write++;
+
                 }
 
             }
 
         }
 
+        return CheckedArray<IntrospectionTarget>(targets, write);
+
+    }
+
+    // the ones of `methods` that have a body, generic instances share theirs with the declaration they came from
+    inline CheckedArray<IntrospectionTarget> MakeIntrospectionTargets(CheckedArray<MethodInfo*> methods, TempAllocator* allocator) {
+
+        IntrospectionTarget* targets = allocator->AllocateUncleared<IntrospectionTarget>(methods.size);
+        int32 write = 0;
+
+        for (int32 i = 0; i < methods.size; i++) {
+
+            MethodInfo* methodInfo = methods[i];
+            int32 cost = GetIntrospectionCost(methodInfo);
+
+            if (cost == 0) {
+                continue;
+            }
+
+            targets[write] = IntrospectionTarget { methodInfo->declaringType, methodInfo, cost, write };
+            write++;
+
+        }
+
+        return CheckedArray<IntrospectionTarget>(targets, write);
+
+    }
+
+    // Sorts the most expensive bodies to the front and cuts the list into batches worth about the same, so the big
+    // methods start first and the tail is made of small batches other workers can steal. A method bigger than the
+    // budget is a batch of its own. batchStarts needs targets.size + 1 entries, returns the number of batches.
+    inline int32 BatchIntrospectionTargets(CheckedArray<IntrospectionTarget> targets, int32 workerCount, int32* batchStarts) {
+
+        IntrospectionSort(targets.array, targets.size, [](const IntrospectionTarget& a, const IntrospectionTarget& b) {
+            if (a.cost != b.cost) {
+                return a.cost > b.cost ? -1 : 1;
+            }
+            return a.order < b.order ? -1 : (a.order > b.order ? 1 : 0);
+        });
+
+        int64 totalCost = 0;
+        for (int32 i = 0; i < targets.size; i++) {
+            totalCost += targets[i].cost;
+        }
+
+        // a few batches per worker to steal from once the big ones are handed out
+        int64 budget = totalCost / ((int64) (workerCount < 1 ? 1 : workerCount) * 8);
+        budget = budget < kMinIntrospectionBatchCost ? kMinIntrospectionBatchCost : budget;
+
+        int32 batchCount = 0;
+        int64 batchCost = budget;
+
+        for (int32 i = 0; i < targets.size; i++) {
+            if (batchCost >= budget) {
+                batchStarts[batchCount++] = i;
+                batchCost = 0;
+            }
+            batchCost += targets[i].cost;
+        }
+
+        batchStarts[batchCount] = targets.size;
+
+        return batchCount;
+
+    }
+
+    struct MethodNameEntry {
+        int32 nameHash;
+        MethodInfo* methodInfo;
     };
 
-}
\ No newline at end of file
+    // Every method of the concrete types (generic instances included) sorted by the hash of its name, so all the
+    // methods that could answer to a name sit next to each other. Built before the introspection jobs start and
+    // only read by them.
+    struct MethodNameIndex {
+
+        CheckedArray<MethodNameEntry> entries;
+
+        // the first entry with this hash or entries.size, hashes collide so callers still compare the names
+        int32 FindFirst(int32 nameHash) {
+            int32 low = 0;
+            int32 high = entries.size;
+            while (low < high) {
+                int32 mid = low + ((high - low) >> 1);
+                if (entries.array[mid].nameHash < nameHash) {
+                    low = mid + 1;
+                }
+                else {
+                    high = mid;
+                }
+            }
+            return low;
+        }
+
+    };
+
+    inline MethodNameIndex BuildMethodNameIndex(CheckedArray<TypeInfo*> concreteTypes, TempAllocator* allocator) {
+
+        int32 count = 0;
+        for (int32 t = 0; t < concreteTypes.size; t++) {
+            count += concreteTypes[t]->methodCount;
+        }
+
+        MethodNameEntry* entries = allocator->AllocateUncleared<MethodNameEntry>(count);
+        int32 write = 0;
+
+        for (int32 t = 0; t < concreteTypes.size; t++) {
+            TypeInfo* typeInfo = concreteTypes[t];
+            for (int32 m = 0; m < typeInfo->methodCount; m++) {
+                MethodInfo* methodInfo = &typeInfo->methods[m];
+                entries[write++] = MethodNameEntry { MsiHash::FNV1a(methodInfo->name), methodInfo };
+            }
+        }
+
+        IntrospectionSort(entries, write, [](const MethodNameEntry& a, const MethodNameEntry& b) {
+            return a.nameHash < b.nameHash ? -1 : (a.nameHash > b.nameHash ? 1 : 0);
+        });
+
+        MethodNameIndex retn;
+        retn.entries = CheckedArray<MethodNameEntry>(entries, write);
+        return retn;
+
+    }
+
+}
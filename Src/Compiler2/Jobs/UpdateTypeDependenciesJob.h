@@ -0,0 +1,34 @@
+#pragma once
+
+#include "../../JobSystem/Job.h"
+#include "../SourceFileInfo.h"
+#include "../TypeResolutionMap.h"
+
+namespace Alchemy::Compilation {
+
+    struct UpdateTypeDependenciesJob : Jobs::IJob {
+
+        CheckedArray<SourceFileInfo*> files;
+        TypeResolutionMap* resolutionMap;
+
+        UpdateTypeDependenciesJob(CheckedArray<SourceFileInfo*> files, TypeResolutionMap* resolutionMap)
+            : files(files)
+            , resolutionMap(resolutionMap) {}
+
+        void Execute(int32 idx) override {
+
+            SourceFileInfo* file = files[idx];
+
+            // a relinked file only needs more work later on if something it saw actually changed shape,
+            // a body-only edit in a dependency leaves every signature the same
+            if (file->needsRelink) {
+                file->dependencySignatureChanged = file->TypeDependencySignaturesChanged(resolutionMap);
+            }
+
+            file->FinalizeTypeDependencies();
+
+        }
+
+    };
+
+}
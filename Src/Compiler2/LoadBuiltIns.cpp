@@ -1,4 +1,5 @@
 #include "./LoadBuiltIns.h"
+#include "./Snapshot.h"
 
 namespace Alchemy::Compilation {
 
@@ -19,4 +20,30 @@ namespace Alchemy::Compilation {
         return file;
     }
 
-}
\ No newline at end of file
+    bool LoadBuiltIns(PodList<SourceFileInfo*>* files, PoolAllocator<SourceFileInfo>* fileAllocator, Snapshot* image) {
+
+        CheckedArray<uint8> bytes = GetBuiltInImage();
+
+        // an image written by an older compiler fails validation, the sources are always there to fall back on
+        if (bytes.size == 0 || !image->Load(bytes.array, bytes.size)) {
+            LoadBuiltInSources(files, fileAllocator);
+            return false;
+        }
+
+        CheckedArray<SnapshotFile> records = image->GetSection<SnapshotFile>(SnapshotSectionName::Files);
+
+        for (int32 i = 0; i < records.size; i++) {
+            SourceFileInfo* file = new(fileAllocator->Allocate()) SourceFileInfo();
+            file->wasTouched = true;
+            file->isBuiltIn = true;
+            file->path = image->GetString(records[i].path);
+            file->assemblyName = image->GetString(records[i].assemblyName);
+            file->snapshotIndex = i;
+            files->Add(file);
+        }
+
+        return true;
+
+    }
+
+}
@@ -5,8 +5,19 @@
 
 namespace Alchemy::Compilation {
 
+    struct Snapshot;
+
     SourceFileInfo* MakeBuiltInFile(PoolAllocator<SourceFileInfo>* fileAllocator, const char* fileName, const char* source);
 
-    void LoadBuiltIns(PodList<SourceFileInfo*>* files, PoolAllocator<SourceFileInfo>* fileAllocator);
+    // System/*.wyx as source text, generated by include_builtin_sources
+    void LoadBuiltInSources(PodList<SourceFileInfo*>* files, PoolAllocator<SourceFileInfo>* fileAllocator);
+
+    // the built ins already compiled into a snapshot at build time, generated by Tools/BuiltInImage.cpp. empty
+    // for the tool itself since it has to compile them from source
+    CheckedArray<uint8> GetBuiltInImage();
+
+    // returns true if the files came from the image, they have no source and the caller has to materialize their
+    // types from it. otherwise the files hold their source and are parsed like any other
+    bool LoadBuiltIns(PodList<SourceFileInfo*>* files, PoolAllocator<SourceFileInfo>* fileAllocator, Snapshot* image);
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,143 @@
+#include "./LocalSymbolTable.h"
+#include "../Util/Hash.h"
+#include "../Util/MathUtil.h"
+
+namespace Alchemy::Compilation {
+
+    void LocalSymbolTable::Initialize(TempAllocator* tempAllocator, int32 expectedLocals) {
+        int32 capacity = MathUtil::CeilPow2(expectedLocals * 2);
+        capacity = capacity < 16 ? 16 : capacity;
+
+        allocator = tempAllocator;
+        entries = allocator->Allocate<Entry>(capacity);
+        exponent = MathUtil::LogPow2((uint32) capacity);
+        count = 0;
+
+        undoCapacity = capacity;
+        undoSize = 0;
+        undoLog = allocator->AllocateUncleared<UndoRecord>(undoCapacity);
+
+        scopeCapacity = 16;
+        scopeDepth = 0;
+        scopeStarts = allocator->AllocateUncleared<int32>(scopeCapacity);
+    }
+
+    void LocalSymbolTable::PushScope() {
+        if (scopeDepth == scopeCapacity) {
+            int32* newStarts = allocator->AllocateUncleared<int32>(scopeCapacity * 2);
+            memcpy(newStarts, scopeStarts, sizeof(int32) * scopeCapacity);
+            scopeStarts = newStarts;
+            scopeCapacity *= 2;
+        }
+        scopeStarts[scopeDepth++] = undoSize;
+    }
+
+    void LocalSymbolTable::PopScope() {
+        assert(scopeDepth > 0);
+        int32 start = scopeStarts[--scopeDepth];
+
+        // replay newest first so a name declared twice in one scope ends up with its pre-scope value
+        while (undoSize > start) {
+            UndoRecord* record = &undoLog[--undoSize];
+            Entry* entry = FindEntry(record->name, record->nameHash);
+            assert(entry != nullptr);
+            entry->value = record->previous;
+        }
+    }
+
+    LocalSymbolTable::Entry* LocalSymbolTable::FindEntry(FixedCharSpan name, int32 h) {
+
+        for (int32 idx = h;;) {
+            idx = MsiHash::Lookup32(h, exponent, idx);
+            Entry* entry = &entries[idx];
+
+            if (entry->name.ptr == nullptr) {
+                return nullptr;
+            }
+
+            if (entry->nameHash == h && entry->name == name) {
+                return entry;
+            }
+
+        }
+
+    }
+
+    LocalValue* LocalSymbolTable::Find(FixedCharSpan name) {
+        Entry* entry = FindEntry(name, MsiHash::FNV1a(name));
+        return entry != nullptr ? entry->value : nullptr;
+    }
+
+    void LocalSymbolTable::Grow() {
+
+        Entry* oldEntries = entries;
+        int32 oldCapacity = 1 << exponent;
+
+        exponent++;
+        entries = allocator->Allocate<Entry>(1 << exponent);
+        count = 0;
+
+        for (int32 i = 0; i < oldCapacity; i++) {
+            Entry* old = &oldEntries[i];
+
+            // names that are out of scope aren't referenced by the undo log, they can be dropped
+            if (old->name.ptr == nullptr || old->value == nullptr) {
+                continue;
+            }
+
+            for (int32 idx = old->nameHash;;) {
+                idx = MsiHash::Lookup32(old->nameHash, exponent, idx);
+                if (entries[idx].name.ptr == nullptr) {
+                    entries[idx] = *old;
+                    count++;
+                    break;
+                }
+            }
+        }
+
+    }
+
+    LocalValue* LocalSymbolTable::Declare(FixedCharSpan name, LocalValue* value) {
+
+        // keep the load under 50%
+        if ((count + 1) * 2 > (1 << exponent)) {
+            Grow();
+        }
+
+        if (undoSize == undoCapacity) {
+            UndoRecord* newLog = allocator->AllocateUncleared<UndoRecord>(undoCapacity * 2);
+            memcpy(newLog, undoLog, sizeof(UndoRecord) * undoCapacity);
+            undoLog = newLog;
+            undoCapacity *= 2;
+        }
+
+        int32 h = MsiHash::FNV1a(name);
+        LocalValue* previous = nullptr;
+
+        for (int32 idx = h;;) {
+            idx = MsiHash::Lookup32(h, exponent, idx);
+            Entry* entry = &entries[idx];
+
+            if (entry->name.ptr == nullptr) {
+                entry->name = name;
+                entry->nameHash = h;
+                entry->value = value;
+                count++;
+                break;
+            }
+
+            if (entry->nameHash == h && entry->name == name) {
+                previous = entry->value;
+                entry->value = value;
+                break;
+            }
+
+        }
+
+        undoLog[undoSize++] = UndoRecord { name, previous, h };
+
+        return previous;
+
+    }
+
+}
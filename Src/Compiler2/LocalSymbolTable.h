@@ -0,0 +1,63 @@
+#pragma once
+
+#include "../PrimitiveTypes.h"
+#include "../Util/FixedCharSpan.h"
+#include "../Allocation/LinearAllocator.h"
+
+namespace Alchemy::Compilation {
+
+    struct LocalValue;
+
+    // Name -> local lookup for the method currently being introspected. There is one entry per distinct name,
+    // holding whichever declaration is visible right now. Declaring pushes the previous value onto an undo log and
+    // popping a scope replays the log back to where the scope started, so lookup, shadow checks and scope exit
+    // are all proportional to the work done rather than to the number of locals in the method.
+    // Everything lives in the worker's temp allocator and is thrown away with it.
+    struct LocalSymbolTable {
+
+        struct Entry {
+            FixedCharSpan name;
+            LocalValue* value; // nullptr when the name is known but not in scope
+            int32 nameHash;
+        };
+
+        struct UndoRecord {
+            FixedCharSpan name;
+            LocalValue* previous;
+            int32 nameHash;
+        };
+
+        TempAllocator* allocator {};
+        Entry* entries {};
+        int32 exponent {};
+        int32 count {};
+
+        UndoRecord* undoLog {};
+        int32 undoSize {};
+        int32 undoCapacity {};
+
+        int32* scopeStarts {};
+        int32 scopeDepth {};
+        int32 scopeCapacity {};
+
+        void Initialize(TempAllocator* tempAllocator, int32 expectedLocals);
+
+        void PushScope();
+
+        void PopScope();
+
+        LocalValue* Find(FixedCharSpan name);
+
+        // makes value visible under name until the current scope is popped. returns the value it hides if
+        // the name was already visible from this or an enclosing scope, nullptr otherwise
+        LocalValue* Declare(FixedCharSpan name, LocalValue* value);
+
+    private:
+
+        Entry* FindEntry(FixedCharSpan name, int32 h);
+
+        void Grow();
+
+    };
+
+}
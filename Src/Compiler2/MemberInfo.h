@@ -3,6 +3,7 @@
 #include "./ResolvedType.h"
 #include "../Util/FixedCharSpan.h"
 #include "./TypeInfo.h"
+#include "./ConstantValue.h"
 #include <atomic>
 
 namespace Alchemy::Compilation {
@@ -26,25 +27,30 @@ namespace Alchemy::Compilation {
         Export
     };
 
+    enum class ConstantState : uint8 {
+        Unevaluated,
+        Evaluating,
+        Evaluated,
+        Failed
+    };
+
     struct FieldInfo {
 
         ResolvedType type;
         FixedCharSpan identifier;
         TypeInfo* declaringType {};
-        VariableDeclaratorSyntax* syntaxNode {};
+        VariableDeclaratorSyntax* syntaxNode {}; // null for enum members, see GetEnumMemberSyntax
         FieldModifiers modifiers {};
         MemberVisibility visibility {};
 
-    };
+        // const fields & enum members only. the state is only good for the run in constantRunId, anything older is
+        // Unevaluated, so nothing has to be reset between compiles
+        ConstantState constantState {};
+        uint32 constantRunId {};
+        ConstantValue constantValue;
 
-    struct PropertyInfo {
-        TypeInfo* declaringType {};
-        ResolvedType type;
-        FixedCharSpan name;
     };
 
-    struct IndexerInfo {};
-
     size_t FieldModifiersToString(FieldModifiers modifiers, char * buffer);
 
     DEFINE_ENUM_FLAGS(MethodModifiers, uint8, {
@@ -58,6 +64,17 @@ namespace Alchemy::Compilation {
 
     size_t MethodModifiersToString(MethodModifiers modifiers, char * buffer);
 
+    // properties take the method modifiers, `static` is the only one member lookup cares about for now
+    struct PropertyInfo {
+        TypeInfo* declaringType {};
+        ResolvedType type;
+        FixedCharSpan name;
+        MethodModifiers modifiers {};
+        MemberVisibility visibility {};
+    };
+
+    struct IndexerInfo {};
+
     DEFINE_ENUM_FLAGS(ParameterModifiers, uint8, {
         None = 0,
         Ref = 1 << 0,
@@ -74,12 +91,30 @@ namespace Alchemy::Compilation {
         FixedCharSpan name;
         ParameterModifiers modifiers {};
         ParameterSyntax * syntaxNode;
+        ConstantValue defaultValue; // None without one, or when it didn't fold
 
     };
 
     const char * MemberVisibilityToString(MemberVisibility visibility);
 
-    struct MethodIntrospection {};
+    struct Scope;
+    struct IntrospectionDiagnostic;
+    struct MethodInfo;
+
+    // what introspecting a method body left behind, it lives in the arena of the worker that did it. set
+    // ts_LocalExpressionBase to base before following the offsets inside, only good until the next Compile
+    struct MethodIntrospection {
+        uint8* base;
+        Scope* rootScope;
+        IntrospectionDiagnostic* firstDiagnostic;
+        // the methods this body was the first to make reachable, only set when compiling from entry points
+        MethodInfo** claimedMethods;
+        int32 scopeCount;
+        int32 localCount;
+        int32 expressionCount;
+        int32 diagnosticCount;
+        int32 claimedMethodCount;
+    };
 
     struct MethodInfo {
         TypeInfo* declaringType {};
@@ -92,6 +127,7 @@ namespace Alchemy::Compilation {
         int32 parameterCount {};
         bool isDefaultParameterOverload {};
         std::atomic<bool> isEnqueued;
+        bool wasReached {}; // by the entry points of the last run, see IsKeptBody
         MemberVisibility visibility;
         MethodModifiers modifiers;
     };
@@ -0,0 +1,126 @@
+#include "./MemberLookupTable.h"
+#include "./TypeInfo.h"
+#include "./MemberInfo.h"
+#include "../Util/Hash.h"
+#include "../Util/MathUtil.h"
+
+namespace Alchemy::Compilation {
+
+    MemberLookupEntry* MemberLookupTable::Find(FixedCharSpan name) {
+
+        int32 h = MsiHash::FNV1a(name);
+
+        for (int32 idx = h;;) {
+            idx = MsiHash::Lookup32(h, exponent, idx);
+            MemberLookupEntry* entry = &entries[idx];
+
+            if (entry->kind == MemberKind::None) {
+                return nullptr;
+            }
+
+            if (entry->nameHash == h && entry->name == name) {
+                return entry;
+            }
+
+        }
+
+    }
+
+    int32 MemberLookupTable::GetCapacity(int32 memberCount) {
+        int32 capacity = MathUtil::CeilPow2(memberCount * 2); // 50% load
+        return capacity < 8 ? 8 : capacity;
+    }
+
+    static void Insert(MemberLookupTable* table, FixedCharSpan name, int32 h, MemberKind kind, void* member, uint16 depth) {
+
+        for (int32 idx = h;;) {
+            idx = MsiHash::Lookup32(h, table->exponent, idx);
+            MemberLookupEntry* entry = &table->entries[idx];
+
+            if (entry->kind == MemberKind::None) {
+                entry->name = name;
+                entry->member = member;
+                entry->nameHash = h;
+                entry->kind = kind;
+                entry->depth = depth;
+                table->count++;
+                return;
+            }
+
+            // first one in wins, that is the most derived declaration. overloads are found from the first method
+            if (entry->nameHash == h && entry->name == name) {
+                return;
+            }
+
+        }
+
+    }
+
+    MemberLookupTable* MemberLookupTable::Build(TypeInfo* typeInfo, TypeInfo* baseClass, MemberLookupTable* existing, Allocator allocator) {
+
+        MemberLookupTable* baseTable = baseClass != nullptr ? baseClass->memberTable : nullptr;
+
+        int32 memberCount = typeInfo->fieldCount + typeInfo->propertyCount + typeInfo->methodCount;
+
+        if (baseTable != nullptr) {
+            memberCount += baseTable->count;
+        }
+
+        int32 capacity = GetCapacity(memberCount);
+
+        MemberLookupTable* table = existing;
+
+        if (table == nullptr || (1 << table->exponent) < capacity) {
+
+            // generic instances give the old block back to the arena, the sweep only knows about the current one.
+            // file arenas can't free single blocks, the old table stays until the file is parsed again and its
+            // arena is reset. that only happens to types of unchanged files whose base class gained members and as
+            // capacities double the blocks a type leaves behind add up to less than its current table
+            if (existing != nullptr && allocator.CanFree()) {
+                allocator.Free((uint8*) existing, sizeof(MemberLookupTable) + sizeof(MemberLookupEntry) * (1 << existing->exponent));
+            }
+
+            // one block so the generic instance arena can free it in one go
+            uint8* block = allocator.AllocateUncleared<uint8>(sizeof(MemberLookupTable) + sizeof(MemberLookupEntry) * capacity);
+            table = (MemberLookupTable*) block;
+            table->entries = (MemberLookupEntry*) (block + sizeof(MemberLookupTable));
+            table->exponent = MathUtil::LogPow2(capacity);
+        }
+
+        int32 entryCount = 1 << table->exponent;
+        for (int32 i = 0; i < entryCount; i++) {
+            new(&table->entries[i]) MemberLookupEntry();
+        }
+
+        table->count = 0;
+
+        for (int32 i = 0; i < typeInfo->fieldCount; i++) {
+            FieldInfo* fieldInfo = &typeInfo->fields[i];
+            Insert(table, fieldInfo->identifier, MsiHash::FNV1a(fieldInfo->identifier), MemberKind::Field, fieldInfo, 0);
+        }
+
+        for (int32 i = 0; i < typeInfo->propertyCount; i++) {
+            PropertyInfo* propertyInfo = &typeInfo->properties[i];
+            Insert(table, propertyInfo->name, MsiHash::FNV1a(propertyInfo->name), MemberKind::Property, propertyInfo, 0);
+        }
+
+        for (int32 i = 0; i < typeInfo->methodCount; i++) {
+            MethodInfo* methodInfo = &typeInfo->methods[i];
+            Insert(table, methodInfo->name, MsiHash::FNV1a(methodInfo->name), MemberKind::Method, methodInfo, 0);
+        }
+
+        if (baseTable != nullptr) {
+            int32 baseCapacity = 1 << baseTable->exponent;
+            for (int32 i = 0; i < baseCapacity; i++) {
+                MemberLookupEntry* entry = &baseTable->entries[i];
+                if (entry->kind != MemberKind::None) {
+                    Insert(table, entry->name, entry->nameHash, entry->kind, entry->member, entry->depth + 1);
+                }
+            }
+        }
+
+        return table;
+
+    }
+
+}
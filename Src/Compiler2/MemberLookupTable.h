@@ -0,0 +1,61 @@
+#pragma once
+
+#include "../PrimitiveTypes.h"
+#include "../Util/FixedCharSpan.h"
+#include "../Allocation/LinearAllocator.h"
+
+namespace Alchemy::Compilation {
+
+    struct TypeInfo;
+    struct FieldInfo;
+    struct PropertyInfo;
+    struct MethodInfo;
+
+    enum class MemberKind : uint8 {
+        None,
+        Field,
+        Property,
+        Method
+    };
+
+    struct MemberLookupEntry {
+        FixedCharSpan name;
+        void* member; // FieldInfo*, PropertyInfo* or the first MethodInfo* with this name
+        int32 nameHash;
+        MemberKind kind;
+        uint16 depth; // 0 for members declared on the type itself, 1 for the base class, etc
+
+        inline FieldInfo* GetField() {
+            return kind == MemberKind::Field ? (FieldInfo*) member : nullptr;
+        }
+
+        inline PropertyInfo* GetProperty() {
+            return kind == MemberKind::Property ? (PropertyInfo*) member : nullptr;
+        }
+
+        inline MethodInfo* GetMethod() {
+            return kind == MemberKind::Method ? (MethodInfo*) member : nullptr;
+        }
+
+    };
+
+    // Every member visible on a type by name, including the ones it inherits. Derived members are inserted
+    // first so a base member with the same name is shadowed. Built after base types are resolved, bases first.
+    struct MemberLookupTable {
+
+        MemberLookupEntry* entries;
+        int32 exponent;
+        int32 count;
+
+        MemberLookupEntry* Find(FixedCharSpan name);
+
+        static int32 GetCapacity(int32 memberCount);
+
+        // re-uses `existing` when it is big enough, otherwise allocates a new table and frees `existing` if the
+        // allocator can. baseClass is passed in rather than read from the type so callers can leave it out for
+        // cyclic hierarchies
+        static MemberLookupTable* Build(TypeInfo* typeInfo, TypeInfo* baseClass, MemberLookupTable* existing, Allocator allocator);
+
+    };
+
+}
@@ -3,6 +3,7 @@
 #include "../PrimitiveTypes.h"
 #include "./BuiltInTypeName.h"
 #include "./TypeInfo.h"
+#include "./TypeTable.h"
 
 namespace Alchemy::Compilation {
 
@@ -21,43 +22,60 @@ namespace Alchemy::Compilation {
         IsUnresolved = 1 << 10,
     })
 
+    // a TypeId plus flags, 8 bytes instead of a pointer padded out to 16. ids come from the process wide TypeTable
     struct ResolvedType {
 
-        TypeInfo* typeInfo;
+        TypeId typeId;
         ResolvedTypeFlags resolvedTypeFlags;
+        uint16 reserved; // keeps the padding zeroed, ToBits compares all 8 bytes
 
         ResolvedType()
-            : typeInfo(nullptr)
-            , resolvedTypeFlags(ResolvedTypeFlags::IsUnresolved) {}
+            : typeId(kInvalidTypeId)
+            , resolvedTypeFlags(ResolvedTypeFlags::IsUnresolved)
+            , reserved(0) {}
 
         explicit ResolvedType(TypeInfo* typeInfo, ResolvedTypeFlags flags = ResolvedTypeFlags::None)
-            : typeInfo(typeInfo)
-            , resolvedTypeFlags(flags) {}
+            : typeId(typeInfo != nullptr ? typeInfo->typeId : kInvalidTypeId)
+            , resolvedTypeFlags(flags)
+            , reserved(0) {
+            // only registered types can be referenced
+            assert(typeInfo == nullptr || typeInfo->typeId != kInvalidTypeId);
+        }
+
+        inline TypeInfo* GetTypeInfo() {
+            return typeId != kInvalidTypeId ? GetTypeTable()->GetTypeInfo(typeId) : nullptr;
+        }
+
+        inline uint64 ToBits() {
+            uint64 bits;
+            memcpy(&bits, this, sizeof(uint64));
+            return bits;
+        }
 
         inline bool IsVoid() {
             return ((resolvedTypeFlags & ResolvedTypeFlags::IsVoid) != 0);
         }
 
         inline bool IsUnresolved() {
-            return ((resolvedTypeFlags & ResolvedTypeFlags::IsUnresolved) != 0) || (typeInfo != nullptr && typeInfo->IsUnresolved());
+            return ((resolvedTypeFlags & ResolvedTypeFlags::IsUnresolved) != 0) || (typeId != kInvalidTypeId && GetTypeTable()->GetTypeClass(typeId) == TypeClass::Unresolved);
         }
 
         inline bool IsUnresolvedGeneric() {
-            return typeInfo != nullptr && typeInfo->IsGenericTypeDefinition();
+            return typeId != kInvalidTypeId && (GetTypeTable()->GetFlags(typeId) & TypeInfoFlags::IsGenericTypeDefinition) != 0;
         }
 
         bool operator ==(ResolvedType other) {
-            return other.typeInfo == typeInfo && other.resolvedTypeFlags == resolvedTypeFlags;
+            return other.ToBits() == ToBits();
         }
 
         bool operator !=(ResolvedType other) {
-            return other.typeInfo != typeInfo || other.resolvedTypeFlags != resolvedTypeFlags;
+            return other.ToBits() != ToBits();
         }
 
         inline bool IsClass() {
 
-            if (typeInfo != nullptr) {
-                return typeInfo->typeClass == TypeClass::Class;
+            if (typeId != kInvalidTypeId) {
+                return GetTypeTable()->GetTypeClass(typeId) == TypeClass::Class;
             }
 
             return false;
@@ -70,8 +88,8 @@ namespace Alchemy::Compilation {
                 return false;
             }
 
-            if (typeInfo != nullptr) {
-                return (typeInfo->flags & TypeInfoFlags::Sealed) != 0;
+            if (typeId != kInvalidTypeId) {
+                return (GetTypeTable()->GetFlags(typeId) & TypeInfoFlags::Sealed) != 0;
             }
 
             return false;
@@ -79,7 +97,7 @@ namespace Alchemy::Compilation {
         }
 
         inline bool IsInterface() {
-            return typeInfo != nullptr && typeInfo->typeClass == TypeClass::Interface;
+            return typeId != kInvalidTypeId && GetTypeTable()->GetTypeClass(typeId) == TypeClass::Interface;
         }
 
         inline bool IsNullable() {
@@ -95,4 +113,6 @@ namespace Alchemy::Compilation {
         }
     };
 
+    static_assert(sizeof(ResolvedType) == 8);
+
 }
\ No newline at end of file
@@ -0,0 +1,879 @@
+#include "./Snapshot.h"
+#include "./Compiler.h"
+#include "./SourceFileInfo.h"
+#include "./TypeResolutionMap.h"
+#include "../Allocation/ThreadLocalTemp.h"
+#include "../Collections/Sort.h"
+#include "../Util/Hash.h"
+#include "../Util/MathUtil.h"
+
+#if defined(_WIN32)
+
+#define WIN32_LEAN_AND_MEAN
+
+#include <windows.h>
+
+#else
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#endif
+
+namespace Alchemy::Compilation {
+
+    static constexpr size_t kSectionElementSizes[(int32) SnapshotSectionName::Count] = {
+        sizeof(SnapshotFile),
+        sizeof(SnapshotType),
+        sizeof(SnapshotInstance),
+        sizeof(SnapshotString),
+        sizeof(SnapshotTypeRef),
+        sizeof(SnapshotField),
+        sizeof(SnapshotProperty),
+        sizeof(SnapshotMethod),
+        sizeof(SnapshotParameter),
+        sizeof(uint32),
+        sizeof(SnapshotDiagnostic),
+        sizeof(uint32),
+        sizeof(char),
+    };
+
+    Snapshot::Snapshot()
+        : base(nullptr)
+        , size(0)
+        , isMapped(false) {}
+
+    Snapshot::~Snapshot() {
+        Close();
+    }
+
+    bool Snapshot::Open(const char* path) {
+
+        Close();
+
+#if defined(_WIN32)
+        HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart < (LONGLONG) sizeof(SnapshotHeader)) {
+            CloseHandle(file);
+            return false;
+        }
+
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+
+        if (mapping == nullptr) {
+            return false;
+        }
+
+        // the view keeps the mapping alive
+        uint8* bytes = (uint8*) MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+
+        if (bytes == nullptr) {
+            return false;
+        }
+
+        size_t byteCount = (size_t) fileSize.QuadPart;
+#else
+        int fd = open(path, O_RDONLY);
+        if (fd == -1) {
+            return false;
+        }
+
+        struct stat fileStat;
+        if (fstat(fd, &fileStat) != 0 || fileStat.st_size < (off_t) sizeof(SnapshotHeader)) {
+            close(fd);
+            return false;
+        }
+
+        size_t byteCount = (size_t) fileStat.st_size;
+        uint8* bytes = (uint8*) mmap(nullptr, byteCount, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+
+        if (bytes == (uint8*) MAP_FAILED) {
+            return false;
+        }
+#endif
+
+        base = bytes;
+        size = byteCount;
+        isMapped = true;
+
+        if (!Validate()) {
+            Close();
+            return false;
+        }
+
+        return true;
+
+    }
+
+    bool Snapshot::Load(uint8* bytes, size_t byteCount) {
+
+        Close();
+
+        if (bytes == nullptr || byteCount < sizeof(SnapshotHeader) || ((size_t) bytes & 7) != 0) {
+            return false;
+        }
+
+        base = bytes;
+        size = byteCount;
+        isMapped = false;
+
+        if (!Validate()) {
+            Close();
+            return false;
+        }
+
+        return true;
+
+    }
+
+    void Snapshot::Close() {
+
+        if (isMapped && base != nullptr) {
+#if defined(_WIN32)
+            UnmapViewOfFile(base);
+#else
+            munmap(base, size);
+#endif
+        }
+
+        base = nullptr;
+        size = 0;
+        isMapped = false;
+
+    }
+
+    bool Snapshot::Validate() {
+
+        // only the layout is checked, the records are the compiler's own output and are trusted from here on
+        SnapshotHeader* header = GetHeader();
+
+        if (header->magic != kSnapshotMagic || header->version != kSnapshotVersion || header->totalSize != size) {
+            return false;
+        }
+
+        for (int32 i = 0; i < (int32) SnapshotSectionName::Count; i++) {
+            SnapshotSection section = header->sections[i];
+            if ((section.offset & 7) != 0 || section.offset < sizeof(SnapshotHeader)) {
+                return false;
+            }
+            if ((uint64) section.offset + (uint64) section.count * kSectionElementSizes[i] > size) {
+                return false;
+            }
+        }
+
+        SnapshotSection nameTable = header->sections[(int32) SnapshotSectionName::NameTable];
+        return header->nameTableExponent < 32 && nameTable.count == (1u << header->nameTableExponent);
+
+    }
+
+    int32 Snapshot::FindType(FixedCharSpan fullyQualifiedName) {
+
+        CheckedArray<uint32> slots = GetSection<uint32>(SnapshotSectionName::NameTable);
+        CheckedArray<SnapshotType> types = GetSection<SnapshotType>(SnapshotSectionName::Types);
+
+        int32 h = MsiHash::FNV1a(fullyQualifiedName);
+        int32 exponent = (int32) GetHeader()->nameTableExponent;
+
+        for (int32 idx = h;;) {
+            idx = MsiHash::Lookup32(h, exponent, idx);
+            uint32 slot = slots[idx];
+
+            if (slot == 0) {
+                return -1;
+            }
+
+            if (GetString(types[slot - 1].fullyQualifiedName) == fullyQualifiedName) {
+                return (int32) slot - 1;
+            }
+        }
+
+    }
+
+    struct SnapshotWriter {
+
+        TypeResolutionMap* resolveMap;
+        TypeTable* table;
+
+        // per TypeId, kind None until the type was first referenced (declared types are filled in up front)
+        SnapshotTypeRef* refs;
+
+        PodList<SnapshotFile> files;
+        PodList<SnapshotType> types;
+        PodList<SnapshotInstance> instances;
+        PodList<SnapshotString> externals;
+        PodList<SnapshotTypeRef> typeRefs;
+        PodList<SnapshotField> fields;
+        PodList<SnapshotProperty> properties;
+        PodList<SnapshotMethod> methods;
+        PodList<SnapshotParameter> parameters;
+        PodList<uint32> dependencies;
+        PodList<SnapshotDiagnostic> diagnostics;
+        PodList<uint32> nameTable;
+        PodList<char> strings;
+
+        template<typename T>
+        static T* AddRecord(PodList<T>* list) {
+            // padding is zeroed too, the same compiler state always gives the same bytes
+            T* record = list->Reserve();
+            memset(record, 0, sizeof(T));
+            return record;
+        }
+
+        SnapshotString WriteString(FixedCharSpan span) {
+            SnapshotString string { (uint32) strings.size, (uint32) span.size };
+            // AddRange grows to the exact size, Reserve doubles
+            memcpy(strings.Reserve((int32) span.size), span.ptr, span.size);
+            return string;
+        }
+
+        uint32 WriteInstance(TypeInfo* instance) {
+
+            TempAllocator::ScopedMarker m(GetThreadLocalAllocator());
+
+            // arguments go first so a reader can create instances front to back
+            SnapshotTypeRef definition = WriteRef(ResolvedType(instance->genericDefinition));
+
+            SnapshotTypeRef* arguments = GetThreadLocalAllocator()->AllocateUncleared<SnapshotTypeRef>(instance->genericArgumentCount);
+            for (int32 i = 0; i < instance->genericArgumentCount; i++) {
+                arguments[i] = WriteRef(instance->genericArguments[i]);
+            }
+
+            uint32 argumentStart = typeRefs.size;
+            memcpy(typeRefs.Reserve(instance->genericArgumentCount), arguments, sizeof(SnapshotTypeRef) * instance->genericArgumentCount);
+
+            SnapshotInstance* record = AddRecord(&instances);
+            record->definition = definition;
+            record->argumentStart = argumentStart;
+            record->argumentCount = instance->genericArgumentCount;
+
+            return instances.size - 1;
+
+        }
+
+        SnapshotTypeRef WriteRef(ResolvedType resolvedType) {
+
+            SnapshotTypeRef ref {};
+
+            if (resolvedType.typeId != kInvalidTypeId) {
+
+                ref = refs[resolvedType.typeId];
+
+                if (ref.kind == SnapshotTypeRefKind::None) {
+
+                    TypeInfo* typeInfo = resolvedType.GetTypeInfo();
+
+                    if (typeInfo == resolveMap->voidType) {
+                        ref.kind = SnapshotTypeRefKind::Void;
+                    }
+                    else if (typeInfo == resolveMap->unresolvedType) {
+                        ref.kind = SnapshotTypeRefKind::Unresolved;
+                    }
+                    else if (typeInfo->IsGenericInstance() && typeInfo->genericDefinition != nullptr) {
+                        ref.index = WriteInstance(typeInfo);
+                        ref.kind = SnapshotTypeRefKind::Instance;
+                    }
+                    else {
+                        externals.Add(WriteString(typeInfo->GetFullyQualifiedTypeName()));
+                        ref.index = externals.size - 1;
+                        ref.kind = SnapshotTypeRefKind::External;
+                    }
+
+                    refs[resolvedType.typeId] = ref;
+
+                }
+
+            }
+
+            ref.flags = resolvedType.resolvedTypeFlags;
+            return ref;
+
+        }
+
+        uint32 WriteRefs(ResolvedType* resolvedTypes, int32 count) {
+
+            TempAllocator::ScopedMarker m(GetThreadLocalAllocator());
+
+            // instances referenced from here write their own arguments, keep ours contiguous
+            SnapshotTypeRef* buffer = GetThreadLocalAllocator()->AllocateUncleared<SnapshotTypeRef>(count);
+            for (int32 i = 0; i < count; i++) {
+                buffer[i] = WriteRef(resolvedTypes[i]);
+            }
+
+            uint32 start = typeRefs.size;
+            memcpy(typeRefs.Reserve(count), buffer, sizeof(SnapshotTypeRef) * count);
+            return start;
+
+        }
+
+        void WriteType(TypeInfo* typeInfo, uint32 fileIndex) {
+
+            uint32 baseTypeStart = WriteRefs(typeInfo->baseTypes, typeInfo->baseTypeCount);
+            uint32 genericArgumentStart = WriteRefs(typeInfo->genericArguments, typeInfo->genericArgumentCount);
+
+            uint32 fieldStart = fields.size;
+            for (int32 i = 0; i < typeInfo->fieldCount; i++) {
+                FieldInfo* fieldInfo = &typeInfo->fields[i];
+                SnapshotTypeRef type = WriteRef(fieldInfo->type);
+                SnapshotField* record = AddRecord(&fields);
+                record->type = type;
+                record->identifier = WriteString(fieldInfo->identifier);
+                record->modifiers = fieldInfo->modifiers;
+                record->visibility = fieldInfo->visibility;
+            }
+
+            uint32 propertyStart = properties.size;
+            for (int32 i = 0; i < typeInfo->propertyCount; i++) {
+                PropertyInfo* propertyInfo = &typeInfo->properties[i];
+                SnapshotTypeRef type = WriteRef(propertyInfo->type);
+                SnapshotProperty* record = AddRecord(&properties);
+                record->type = type;
+                record->name = WriteString(propertyInfo->name);
+                record->modifiers = propertyInfo->modifiers;
+                record->visibility = propertyInfo->visibility;
+            }
+
+            uint32 methodStart = methods.size;
+            for (int32 i = 0; i < typeInfo->methodCount; i++) {
+                MethodInfo* methodInfo = &typeInfo->methods[i];
+
+                uint32 parameterStart = parameters.size;
+                for (int32 p = 0; p < methodInfo->parameterCount; p++) {
+                    ParameterInfo* parameterInfo = &methodInfo->parameters[p];
+                    SnapshotTypeRef type = WriteRef(parameterInfo->type);
+                    SnapshotParameter* record = AddRecord(&parameters);
+                    record->type = type;
+                    record->name = WriteString(parameterInfo->name);
+                    record->modifiers = parameterInfo->modifiers;
+                }
+
+                SnapshotTypeRef returnType = WriteRef(methodInfo->returnType);
+                SnapshotMethod* record = AddRecord(&methods);
+                record->returnType = returnType;
+                record->name = WriteString(methodInfo->name);
+                record->parameterStart = parameterStart;
+                record->parameterCount = methodInfo->parameterCount;
+                record->visibility = methodInfo->visibility;
+                record->modifiers = methodInfo->modifiers;
+                record->isDefaultParameterOverload = methodInfo->isDefaultParameterOverload;
+            }
+
+            SnapshotType* record = AddRecord(&types);
+            record->signatureHash = typeInfo->signatureHash;
+            record->fullyQualifiedName = WriteString(typeInfo->GetFullyQualifiedTypeName());
+
+            // the short name is usually the tail of the qualified one
+            FixedCharSpan typeName = typeInfo->GetTypeName();
+            FixedCharSpan fullyQualifiedName = typeInfo->GetFullyQualifiedTypeName();
+            if (typeName.ptr >= fullyQualifiedName.ptr && typeName.ptr + typeName.size <= fullyQualifiedName.ptr + fullyQualifiedName.size) {
+                record->typeName = SnapshotString { record->fullyQualifiedName.offset + (uint32) (typeName.ptr - fullyQualifiedName.ptr), (uint32) typeName.size };
+            }
+            else {
+                record->typeName = WriteString(typeName);
+            }
+
+            record->fileIndex = fileIndex;
+            record->baseTypeStart = baseTypeStart;
+            record->genericArgumentStart = genericArgumentStart;
+            record->fieldStart = fieldStart;
+            record->propertyStart = propertyStart;
+            record->methodStart = methodStart;
+            record->fieldCount = typeInfo->fieldCount;
+            record->methodCount = typeInfo->methodCount;
+            record->propertyCount = typeInfo->propertyCount;
+            record->baseTypeCount = typeInfo->baseTypeCount;
+            record->genericArgumentCount = typeInfo->genericArgumentCount;
+            record->indexerCount = typeInfo->indexerCount;
+            record->constructorCount = typeInfo->constructorCount;
+            record->constraintCount = typeInfo->constraintCount;
+            record->flags = typeInfo->flags;
+            record->typeClass = typeInfo->typeClass;
+            record->visibility = typeInfo->visibility;
+
+        }
+
+        void BuildNameTable(int32* exponent) {
+
+            int32 pow2Size = MathUtil::CeilPow2(types.size * 2);
+            if (pow2Size < 16) pow2Size = 16;
+            *exponent = MathUtil::LogPow2(pow2Size);
+
+            nameTable.EnsureCapacity(pow2Size);
+            nameTable.size = pow2Size;
+            memset(nameTable.array, 0, sizeof(uint32) * pow2Size);
+
+            for (int32 i = 0; i < types.size; i++) {
+                FixedCharSpan name(strings.array + types[i].fullyQualifiedName.offset, types[i].fullyQualifiedName.length);
+                int32 h = MsiHash::FNV1a(name);
+
+                for (int32 idx = h;;) {
+                    idx = MsiHash::Lookup32(h, *exponent, idx);
+                    uint32 slot = nameTable[idx];
+
+                    if (slot == 0) {
+                        nameTable[idx] = (uint32) i + 1;
+                        break;
+                    }
+
+                    // duplicate declarations, the first one wins like it does in the resolution map
+                    SnapshotString other = types[slot - 1].fullyQualifiedName;
+                    if (FixedCharSpan(strings.array + other.offset, other.length) == name) {
+                        break;
+                    }
+                }
+            }
+
+        }
+
+        template<typename T>
+        static void AppendSection(PodList<uint8>* output, SnapshotSection* section, PodList<T>* list) {
+            int32 start = output->size;
+            int32 aligned = (start + 7) & ~7;
+            int32 byteCount = (int32) sizeof(T) * list->size;
+            output->Reserve(aligned - start + byteCount);
+            memset(output->array + start, 0, aligned - start);
+            if (byteCount != 0) {
+                memcpy(output->array + aligned, list->array, byteCount);
+            }
+            section->offset = (uint32) aligned;
+            section->count = (uint32) list->size;
+        }
+
+    };
+
+    struct SnapshotFileEntry {
+        SourceFileInfo* file;
+        uint32 index;
+    };
+
+    void WriteSnapshot(Compiler* compiler, PodList<uint8>* output, bool builtIns) {
+
+        TempAllocator* tempAllocator = GetThreadLocalAllocator();
+        TempAllocator::ScopedMarker marker(tempAllocator);
+
+        SnapshotWriter writer;
+        writer.resolveMap = &compiler->resolveMap;
+        writer.table = GetTypeTable();
+        writer.refs = tempAllocator->Allocate<SnapshotTypeRef>(writer.table->GetIdLimit());
+
+        // path order keeps the output independent of the order files were discovered in
+        int32 fileCount = 0;
+        SourceFileInfo** files = tempAllocator->AllocateUncleared<SourceFileInfo*>(compiler->fileInfos.size);
+        for (int32 i = 0; i < compiler->fileInfos.size; i++) {
+            if (compiler->fileInfos[i]->isBuiltIn == builtIns) {
+                files[fileCount++] = compiler->fileInfos[i];
+            }
+        }
+
+        IntrospectionSort(files, fileCount, [](SourceFileInfo* a, SourceFileInfo* b) {
+            size_t length = a->path.size < b->path.size ? a->path.size : b->path.size;
+            int32 cmp = memcmp(a->path.ptr, b->path.ptr, length);
+            if (cmp != 0) {
+                return cmp;
+            }
+            return a->path.size == b->path.size ? 0 : (a->path.size < b->path.size ? -1 : 1);
+        });
+
+        // dependencies are stored as file indices, looked up by pointer
+        SnapshotFileEntry* byPointer = tempAllocator->AllocateUncleared<SnapshotFileEntry>(fileCount);
+        for (int32 i = 0; i < fileCount; i++) {
+            byPointer[i] = SnapshotFileEntry { files[i], (uint32) i };
+        }
+
+        IntrospectionSort(byPointer, fileCount, [](const SnapshotFileEntry& a, const SnapshotFileEntry& b) {
+            if (a.file == b.file) return 0;
+            return a.file < b.file ? -1 : 1;
+        });
+
+        // declared types get their index before anything can reference them
+        uint32 typeIndex = 0;
+        for (int32 i = 0; i < fileCount; i++) {
+            CheckedArray<TypeInfo*> declaredTypes = files[i]->declaredTypes;
+            for (int32 t = 0; t < declaredTypes.size; t++) {
+                TypeInfo* typeInfo = declaredTypes[t];
+                if (typeInfo->typeId != kInvalidTypeId && writer.table->GetTypeInfo(typeInfo->typeId) == typeInfo) {
+                    writer.refs[typeInfo->typeId] = SnapshotTypeRef { typeIndex, ResolvedTypeFlags::None, SnapshotTypeRefKind::Declared, 0 };
+                }
+                typeIndex++;
+            }
+        }
+
+        for (int32 i = 0; i < fileCount; i++) {
+
+            SourceFileInfo* file = files[i];
+
+            uint32 typeStart = writer.types.size;
+            for (int32 t = 0; t < file->declaredTypes.size; t++) {
+                writer.WriteType(file->declaredTypes[t], (uint32) i);
+            }
+
+            uint32 dependencyStart = writer.dependencies.size;
+            for (int32 d = 0; d < file->dependencies.size; d++) {
+                SourceFileInfo* dependency = file->dependencies[d];
+
+                int32 lo = 0;
+                int32 hi = fileCount - 1;
+                while (lo <= hi) {
+                    int32 mid = (lo + hi) >> 1;
+                    if (byPointer[mid].file == dependency) {
+                        writer.dependencies.Add(byPointer[mid].index);
+                        break;
+                    }
+                    if (byPointer[mid].file < dependency) {
+                        lo = mid + 1;
+                    }
+                    else {
+                        hi = mid - 1;
+                    }
+                }
+            }
+
+            uint32 diagnosticStart = writer.diagnostics.size;
+            if (file->diagnostics.size != 0) {
+                TempAllocator::ScopedMarker m(tempAllocator);
+                DiagnosticEntry* entries = tempAllocator->AllocateUncleared<DiagnosticEntry>(file->diagnostics.size);
+                file->diagnostics.CopyTo(entries);
+                for (int32 d = 0; d < file->diagnostics.size; d++) {
+                    SnapshotDiagnostic* record = SnapshotWriter::AddRecord(&writer.diagnostics);
+                    record->start = entries[d].start;
+                    record->end = entries[d].end;
+                    record->errorCode = entries[d].errorCode;
+                    record->message = writer.WriteString(entries[d].GetMessage());
+                }
+            }
+
+            SnapshotFile* record = SnapshotWriter::AddRecord(&writer.files);
+            record->lastEditTime = file->lastEditTime;
+            record->path = writer.WriteString(file->path);
+            record->assemblyName = writer.WriteString(file->assemblyName);
+            record->typeStart = typeStart;
+            record->typeCount = writer.types.size - typeStart;
+            record->dependencyStart = dependencyStart;
+            record->dependencyCount = writer.dependencies.size - dependencyStart;
+            record->diagnosticStart = diagnosticStart;
+            record->diagnosticCount = writer.diagnostics.size - diagnosticStart;
+
+        }
+
+        int32 nameTableExponent = 0;
+        writer.BuildNameTable(&nameTableExponent);
+
+        output->size = 0;
+
+        SnapshotHeader header {};
+        output->AddRange((uint8*) &header, sizeof(SnapshotHeader));
+
+        SnapshotSection sections[(int32) SnapshotSectionName::Count];
+        SnapshotWriter::AppendSection(output, &sections[(int32) SnapshotSectionName::Files], &writer.files);
+        SnapshotWriter::AppendSection(output, &sections[(int32) SnapshotSectionName::Types], &writer.types);
+        SnapshotWriter::AppendSection(output, &sections[(int32) SnapshotSectionName::Instances], &writer.instances);
+        SnapshotWriter::AppendSection(output, &sections[(int32) SnapshotSectionName::Externals], &writer.externals);
+        SnapshotWriter::AppendSection(output, &sections[(int32) SnapshotSectionName::TypeRefs], &writer.typeRefs);
+        SnapshotWriter::AppendSection(output, &sections[(int32) SnapshotSectionName::Fields], &writer.fields);
+        SnapshotWriter::AppendSection(output, &sections[(int32) SnapshotSectionName::Properties], &writer.properties);
+        SnapshotWriter::AppendSection(output, &sections[(int32) SnapshotSectionName::Methods], &writer.methods);
+        SnapshotWriter::AppendSection(output, &sections[(int32) SnapshotSectionName::Parameters], &writer.parameters);
+        SnapshotWriter::AppendSection(output, &sections[(int32) SnapshotSectionName::Dependencies], &writer.dependencies);
+        SnapshotWriter::AppendSection(output, &sections[(int32) SnapshotSectionName::Diagnostics], &writer.diagnostics);
+        SnapshotWriter::AppendSection(output, &sections[(int32) SnapshotSectionName::NameTable], &writer.nameTable);
+        SnapshotWriter::AppendSection(output, &sections[(int32) SnapshotSectionName::Strings], &writer.strings);
+
+        // the blob size stays a multiple of 8 so anything appended after it is aligned too
+        int32 padding = ((output->size + 7) & ~7) - output->size;
+        memset(output->Reserve(padding), 0, padding);
+
+        header.magic = kSnapshotMagic;
+        header.version = kSnapshotVersion;
+        header.totalSize = (uint32) output->size;
+        header.nameTableExponent = (uint32) nameTableExponent;
+        memcpy(header.sections, sections, sizeof(sections));
+        memcpy(output->array, &header, sizeof(SnapshotHeader));
+
+    }
+
+    bool SaveSnapshot(Compiler* compiler, const char* path) {
+
+        PodList<uint8> bytes;
+        WriteSnapshot(compiler, &bytes);
+
+        FILE* file = fopen(path, "wb");
+        if (file == nullptr) {
+            return false;
+        }
+
+        bool written = fwrite(bytes.array, 1, bytes.size, file) == (size_t) bytes.size;
+        return fclose(file) == 0 && written;
+
+    }
+
+    struct SnapshotMaterializer {
+
+        Snapshot* snapshot;
+        TypeResolutionMap* resolveMap;
+
+        CheckedArray<SnapshotType> types;
+        CheckedArray<SnapshotInstance> instances;
+        CheckedArray<SnapshotString> externals;
+        CheckedArray<SnapshotTypeRef> typeRefs;
+        CheckedArray<SnapshotField> fields;
+        CheckedArray<SnapshotProperty> properties;
+        CheckedArray<SnapshotMethod> methods;
+        CheckedArray<SnapshotParameter> parameters;
+
+        TypeInfo** declaredTypes; // per snapshot type, null if its file isn't being materialized
+        ResolvedType* instanceTypes;
+        bool* instanceDone;
+
+        ResolvedType ResolveByName(FixedCharSpan name, ResolvedTypeFlags flags) {
+            TypeInfo* typeInfo = nullptr;
+            if (!resolveMap->TryResolve(name, &typeInfo)) {
+                typeInfo = resolveMap->unresolvedType;
+            }
+            return ResolvedType(typeInfo, flags);
+        }
+
+        ResolvedType Resolve(SnapshotTypeRef ref) {
+
+            switch (ref.kind) {
+
+                case SnapshotTypeRefKind::None: {
+                    ResolvedType resolvedType;
+                    resolvedType.resolvedTypeFlags = ref.flags;
+                    return resolvedType;
+                }
+
+                case SnapshotTypeRefKind::Declared: {
+                    TypeInfo* typeInfo = declaredTypes[ref.index];
+                    if (typeInfo != nullptr && typeInfo->typeId != kInvalidTypeId) {
+                        return ResolvedType(typeInfo, ref.flags);
+                    }
+                    // declared in a file that was re-parsed instead, whatever has the name now replaces it
+                    return ResolveByName(snapshot->GetString(types[ref.index].fullyQualifiedName), ref.flags);
+                }
+
+                case SnapshotTypeRefKind::Instance: {
+                    ResolvedType resolvedType = GetInstance(ref.index);
+                    resolvedType.resolvedTypeFlags = ref.flags;
+                    return resolvedType;
+                }
+
+                case SnapshotTypeRefKind::External: {
+                    return ResolveByName(snapshot->GetString(externals[ref.index]), ref.flags);
+                }
+
+                case SnapshotTypeRefKind::Void: {
+                    return ResolvedType(resolveMap->voidType, ref.flags);
+                }
+
+                case SnapshotTypeRefKind::Unresolved: {
+                    return ResolvedType(resolveMap->unresolvedType, ref.flags);
+                }
+
+            }
+
+            UNREACHABLE("SnapshotMaterializer::Resolve");
+
+        }
+
+        ResolvedType GetInstance(uint32 index) {
+
+            if (instanceDone[index]) {
+                return instanceTypes[index];
+            }
+
+            SnapshotInstance* instance = instances.GetPointer(index);
+            TypeInfo* definition = Resolve(instance->definition).GetTypeInfo();
+
+            TempAllocator::ScopedMarker m(GetThreadLocalAllocator());
+
+            ResolvedType* arguments = GetThreadLocalAllocator()->AllocateUncleared<ResolvedType>(instance->argumentCount);
+            for (uint32 i = 0; i < instance->argumentCount; i++) {
+                arguments[i] = Resolve(typeRefs[instance->argumentStart + i]);
+            }
+
+            ResolvedType resolvedType(resolveMap->unresolvedType);
+
+            // the definition might have been re-declared with a different shape since the snapshot was taken
+            if (definition != nullptr && definition->IsGenericTypeDefinition() && definition->genericArgumentCount == instance->argumentCount) {
+                resolvedType = resolveMap->MakeGenericType(definition, CheckedArray<ResolvedType>(arguments, (int32) instance->argumentCount));
+            }
+
+            instanceTypes[index] = resolvedType;
+            instanceDone[index] = true;
+            return resolvedType;
+
+        }
+
+        void CreateType(SourceFileInfo* file, uint32 index) {
+
+            SnapshotType* record = types.GetPointer(index);
+            LinearAllocator* allocator = &file->allocator;
+
+            TypeInfo* typeInfo = allocator->Allocate<TypeInfo>(1);
+
+            // names are used in place, the snapshot outlives the compiler
+            FixedCharSpan fullyQualifiedName = snapshot->GetString(record->fullyQualifiedName);
+            FixedCharSpan typeName = snapshot->GetString(record->typeName);
+
+            typeInfo->declaringFile = file;
+            typeInfo->fullyQualifiedName = fullyQualifiedName.ptr;
+            typeInfo->fullyQualifiedNameLength = (uint16) fullyQualifiedName.size;
+            typeInfo->typeName = typeName.ptr;
+            typeInfo->typeNameLength = (uint16) typeName.size;
+            typeInfo->signatureHash = record->signatureHash;
+            typeInfo->typeClass = record->typeClass;
+            typeInfo->flags = record->flags;
+            typeInfo->visibility = record->visibility;
+
+            // counts & arrays are set before the type is registered, the table copies them
+            typeInfo->baseTypes = allocator->Allocate<ResolvedType>(record->baseTypeCount);
+            typeInfo->baseTypeCount = record->baseTypeCount;
+            typeInfo->genericArguments = allocator->Allocate<ResolvedType>(record->genericArgumentCount);
+            typeInfo->genericArgumentCount = record->genericArgumentCount;
+            typeInfo->fields = allocator->Allocate<FieldInfo>(record->fieldCount);
+            typeInfo->fieldCount = record->fieldCount;
+            typeInfo->properties = allocator->Allocate<PropertyInfo>(record->propertyCount);
+            typeInfo->propertyCount = record->propertyCount;
+            typeInfo->methods = allocator->Allocate<MethodInfo>(record->methodCount);
+            typeInfo->methodCount = record->methodCount;
+            typeInfo->indexers = allocator->Allocate<IndexerInfo>(record->indexerCount);
+            typeInfo->indexerCount = record->indexerCount;
+            typeInfo->constructors = allocator->Allocate<ConstructorInfo>(record->constructorCount);
+            typeInfo->constructorCount = record->constructorCount;
+            typeInfo->constraints = allocator->Allocate<GenericConstraint>(record->constraintCount);
+            typeInfo->constraintCount = record->constraintCount;
+
+            declaredTypes[index] = typeInfo;
+
+        }
+
+        void FillType(SourceFileInfo* file, uint32 index) {
+
+            SnapshotType* record = types.GetPointer(index);
+            TypeInfo* typeInfo = declaredTypes[index];
+
+            for (int32 i = 0; i < record->baseTypeCount; i++) {
+                typeInfo->baseTypes[i] = Resolve(typeRefs[record->baseTypeStart + i]);
+            }
+
+            for (int32 i = 0; i < record->genericArgumentCount; i++) {
+                typeInfo->genericArguments[i] = Resolve(typeRefs[record->genericArgumentStart + i]);
+            }
+
+            for (int32 i = 0; i < record->fieldCount; i++) {
+                SnapshotField* fieldRecord = fields.GetPointer(record->fieldStart + i);
+                FieldInfo* fieldInfo = &typeInfo->fields[i];
+                fieldInfo->type = Resolve(fieldRecord->type);
+                fieldInfo->identifier = snapshot->GetString(fieldRecord->identifier);
+                fieldInfo->declaringType = typeInfo;
+                fieldInfo->modifiers = fieldRecord->modifiers;
+                fieldInfo->visibility = fieldRecord->visibility;
+            }
+
+            for (int32 i = 0; i < record->propertyCount; i++) {
+                SnapshotProperty* propertyRecord = properties.GetPointer(record->propertyStart + i);
+                PropertyInfo* propertyInfo = &typeInfo->properties[i];
+                propertyInfo->declaringType = typeInfo;
+                propertyInfo->type = Resolve(propertyRecord->type);
+                propertyInfo->name = snapshot->GetString(propertyRecord->name);
+                propertyInfo->modifiers = propertyRecord->modifiers;
+                propertyInfo->visibility = propertyRecord->visibility;
+            }
+
+            for (int32 i = 0; i < record->methodCount; i++) {
+                SnapshotMethod* methodRecord = methods.GetPointer(record->methodStart + i);
+                MethodInfo* methodInfo = &typeInfo->methods[i];
+
+                ParameterInfo* parameterInfos = file->allocator.Allocate<ParameterInfo>(methodRecord->parameterCount);
+                for (int32 p = 0; p < methodRecord->parameterCount; p++) {
+                    SnapshotParameter* parameterRecord = parameters.GetPointer(methodRecord->parameterStart + p);
+                    parameterInfos[p].type = Resolve(parameterRecord->type);
+                    parameterInfos[p].name = snapshot->GetString(parameterRecord->name);
+                    parameterInfos[p].modifiers = parameterRecord->modifiers;
+                }
+
+                methodInfo->declaringType = typeInfo;
+                methodInfo->parameters = parameterInfos;
+                methodInfo->parameterCount = methodRecord->parameterCount;
+                methodInfo->returnType = Resolve(methodRecord->returnType);
+                methodInfo->name = snapshot->GetString(methodRecord->name);
+                methodInfo->isDefaultParameterOverload = methodRecord->isDefaultParameterOverload;
+                methodInfo->visibility = methodRecord->visibility;
+                methodInfo->modifiers = methodRecord->modifiers;
+            }
+
+        }
+
+    };
+
+    void MaterializeSnapshotFiles(Snapshot* snapshot, CheckedArray<SourceFileInfo*> files, TypeResolutionMap* resolveMap, Diagnostics* diagnostics) {
+
+        TempAllocator* tempAllocator = GetThreadLocalAllocator();
+        TempAllocator::ScopedMarker marker(tempAllocator);
+
+        CheckedArray<SnapshotFile> fileRecords = snapshot->GetSection<SnapshotFile>(SnapshotSectionName::Files);
+
+        SnapshotMaterializer materializer;
+        materializer.snapshot = snapshot;
+        materializer.resolveMap = resolveMap;
+        materializer.types = snapshot->GetSection<SnapshotType>(SnapshotSectionName::Types);
+        materializer.instances = snapshot->GetSection<SnapshotInstance>(SnapshotSectionName::Instances);
+        materializer.externals = snapshot->GetSection<SnapshotString>(SnapshotSectionName::Externals);
+        materializer.typeRefs = snapshot->GetSection<SnapshotTypeRef>(SnapshotSectionName::TypeRefs);
+        materializer.fields = snapshot->GetSection<SnapshotField>(SnapshotSectionName::Fields);
+        materializer.properties = snapshot->GetSection<SnapshotProperty>(SnapshotSectionName::Properties);
+        materializer.methods = snapshot->GetSection<SnapshotMethod>(SnapshotSectionName::Methods);
+        materializer.parameters = snapshot->GetSection<SnapshotParameter>(SnapshotSectionName::Parameters);
+        materializer.declaredTypes = tempAllocator->Allocate<TypeInfo*>(materializer.types.size);
+        materializer.instanceTypes = tempAllocator->AllocateUncleared<ResolvedType>(materializer.instances.size);
+        materializer.instanceDone = tempAllocator->Allocate<bool>(materializer.instances.size);
+
+        // every type exists & is registered before any reference between them is resolved
+        for (int32 i = 0; i < files.size; i++) {
+
+            SourceFileInfo* file = files[i];
+            SnapshotFile* record = fileRecords.GetPointer(file->snapshotIndex);
+
+            file->declaredTypes = CheckedArray<TypeInfo*>(file->allocator.Allocate<TypeInfo*>(record->typeCount), (int32) record->typeCount);
+
+            for (uint32 t = 0; t < record->typeCount; t++) {
+                materializer.CreateType(file, record->typeStart + t);
+                file->declaredTypes[(int32) t] = materializer.declaredTypes[record->typeStart + t];
+            }
+
+            for (int32 t = 0; t < file->declaredTypes.size; t++) {
+
+                TypeInfo* typeInfo = file->declaredTypes[t];
+
+                // generic arguments are referenced even if their name collides, same as when they are gathered
+                if (typeInfo->IsGenericArgumentDefinition()) {
+                    GetTypeTable()->Add(typeInfo);
+                }
+
+                if (!resolveMap->AddUnlocked(typeInfo)) {
+                    diagnostics->AddError(Diagnostic(ErrorCode::ERR_DuplicateDeclaration, FixedCharSpan(), typeInfo->GetFullyQualifiedTypeName()));
+                }
+
+            }
+
+        }
+
+        for (int32 i = 0; i < files.size; i++) {
+            SnapshotFile* record = fileRecords.GetPointer(files[i]->snapshotIndex);
+            for (uint32 t = 0; t < record->typeCount; t++) {
+                materializer.FillType(files[i], record->typeStart + t);
+            }
+        }
+
+    }
+
+}
@@ -0,0 +1,212 @@
+#pragma once
+
+#include "../PrimitiveTypes.h"
+#include "../Collections/PodList.h"
+#include "../Collections/CheckedArray.h"
+#include "../Util/FixedCharSpan.h"
+#include "../Parsing3/Diagnostics.h"
+#include "./TypeInfo.h"
+#include "./MemberInfo.h"
+
+namespace Alchemy::Compilation {
+
+    struct Compiler;
+    struct SourceFileInfo;
+    struct TypeResolutionMap;
+
+    // The resolved symbol tables of a compiler in one blob that has no pointers in it. Records only refer to each
+    // other by index into a section and to text by offset into the string section, so the blob can be written
+    // once, mapped read-only at any address and read in place. A fresh Compiler loads it before its first run,
+    // files that didn't change since get their types rebuilt from the records instead of being parsed and
+    // resolved, their names point straight into the mapping. Built ins aren't part of it, they come
+    // from their own image that is written the same way at build time (see LoadBuiltIns).
+
+    constexpr uint32 kSnapshotMagic = 0x50534c41; // "ALSP"
+    constexpr uint32 kSnapshotVersion = 2;
+
+    enum class SnapshotSectionName : uint32 {
+        Files,
+        Types,
+        Instances,
+        Externals,
+        TypeRefs,
+        Fields,
+        Properties,
+        Methods,
+        Parameters,
+        Dependencies,
+        Diagnostics,
+        NameTable,
+        Strings,
+
+        Count
+    };
+
+    struct SnapshotSection {
+        uint32 offset; // bytes from the start of the blob
+        uint32 count;
+    };
+
+    struct SnapshotHeader {
+        uint32 magic;
+        uint32 version;
+        uint32 totalSize;
+        uint32 nameTableExponent;
+        SnapshotSection sections[(int32) SnapshotSectionName::Count];
+    };
+
+    struct SnapshotString {
+        uint32 offset; // into the string section
+        uint32 length;
+    };
+
+    enum class SnapshotTypeRefKind : uint8 {
+        None, // ResolvedType without a type, only the flags mean something
+        Declared, // index into Types
+        Instance, // index into Instances
+        External, // index into Externals, a type this snapshot doesn't declare (built ins), found again by name
+        Void,
+        Unresolved,
+    };
+
+    struct SnapshotTypeRef {
+        uint32 index;
+        ResolvedTypeFlags flags;
+        SnapshotTypeRefKind kind;
+        uint8 reserved;
+    };
+
+    struct SnapshotType {
+        uint64 signatureHash;
+        SnapshotString fullyQualifiedName;
+        SnapshotString typeName;
+        uint32 fileIndex;
+        uint32 baseTypeStart; // into TypeRefs
+        uint32 genericArgumentStart; // into TypeRefs
+        uint32 fieldStart;
+        uint32 propertyStart;
+        uint32 methodStart;
+        uint16 fieldCount;
+        uint16 methodCount;
+        uint16 propertyCount;
+        uint16 baseTypeCount;
+        uint16 genericArgumentCount;
+        uint16 indexerCount;
+        uint16 constructorCount;
+        uint16 constraintCount;
+        TypeInfoFlags flags;
+        TypeClass typeClass;
+        TypeVisibility visibility;
+    };
+
+    // arguments always come before the instances that use them
+    struct SnapshotInstance {
+        SnapshotTypeRef definition;
+        uint32 argumentStart; // into TypeRefs
+        uint32 argumentCount;
+    };
+
+    struct SnapshotField {
+        SnapshotTypeRef type;
+        SnapshotString identifier;
+        FieldModifiers modifiers;
+        MemberVisibility visibility;
+    };
+
+    struct SnapshotProperty {
+        SnapshotTypeRef type;
+        SnapshotString name;
+        MethodModifiers modifiers;
+        MemberVisibility visibility;
+    };
+
+    struct SnapshotMethod {
+        SnapshotTypeRef returnType;
+        SnapshotString name;
+        uint32 parameterStart;
+        int32 parameterCount;
+        MemberVisibility visibility;
+        MethodModifiers modifiers;
+        bool isDefaultParameterOverload;
+    };
+
+    struct SnapshotParameter {
+        SnapshotTypeRef type;
+        SnapshotString name;
+        ParameterModifiers modifiers;
+    };
+
+    struct SnapshotDiagnostic {
+        uint32 start;
+        uint32 end;
+        ErrorCode errorCode;
+        SnapshotString message;
+    };
+
+    struct SnapshotFile {
+        uint64 lastEditTime;
+        SnapshotString path;
+        SnapshotString assemblyName;
+        uint32 typeStart; // a file's types are contiguous
+        uint32 typeCount;
+        uint32 dependencyStart; // into Dependencies, which holds file indices
+        uint32 dependencyCount;
+        uint32 diagnosticStart;
+        uint32 diagnosticCount;
+    };
+
+    struct Snapshot {
+
+        uint8* base;
+        size_t size;
+        bool isMapped;
+
+        Snapshot();
+
+        ~Snapshot();
+
+        Snapshot(const Snapshot&) = delete;
+        Snapshot& operator=(const Snapshot&) = delete;
+
+        // maps the file read-only, returns false if it is missing or isn't a valid snapshot
+        bool Open(const char* path);
+
+        // reads a blob the caller keeps alive, it only needs 8 byte alignment
+        bool Load(uint8* bytes, size_t byteCount);
+
+        void Close();
+
+        inline SnapshotHeader* GetHeader() {
+            return (SnapshotHeader*) base;
+        }
+
+        template<typename T>
+        inline CheckedArray<T> GetSection(SnapshotSectionName name) {
+            SnapshotSection section = GetHeader()->sections[(int32) name];
+            return CheckedArray<T>((T*) (base + section.offset), (int32) section.count);
+        }
+
+        inline FixedCharSpan GetString(SnapshotString string) {
+            SnapshotSection section = GetHeader()->sections[(int32) SnapshotSectionName::Strings];
+            return FixedCharSpan((char*) base + section.offset + string.offset, string.length);
+        }
+
+        // index into Types or -1, doesn't need anything to be materialized
+        int32 FindType(FixedCharSpan fullyQualifiedName);
+
+    private:
+
+        bool Validate();
+
+    };
+
+    // everything but the built in files, or only them for the image that ships with the compiler. only valid after Compile
+    void WriteSnapshot(Compiler* compiler, PodList<uint8>* output, bool builtIns = false);
+
+    bool SaveSnapshot(Compiler* compiler, const char* path);
+
+    // builds TypeInfos for unchanged files that came from the snapshot and adds them to the map. references to
+    // types the snapshot doesn't declare are looked up by name, so whatever they resolve against must be added first
+    void MaterializeSnapshotFiles(Snapshot* snapshot, CheckedArray<SourceFileInfo*> files, TypeResolutionMap* resolveMap, Diagnostics* diagnostics);
+
+}
@@ -1,23 +1,65 @@
 #include "./SourceFileInfo.h"
 #include "../Parsing3/SyntaxBase.h"
+#include "../Collections/Sort.h"
+#include "./TypeInfo.h"
+#include "./TypeResolutionMap.h"
 
 namespace Alchemy::Compilation {
 
+    void SourceFileInfo::ReleaseTypeIds() {
+        // duplicate declarations and generic arguments have ids too, even if the resolution map never took them
+        TypeTable* table = GetTypeTable();
+        for (int32 i = 0; i < declaredTypes.size; i++) {
+            table->RemoveIfRegistered(declaredTypes[i]);
+        }
+    }
+
     void SourceFileInfo::Invalidate() {
-        allocator.Clear();
-        diagnostics.size = 0;
+
+        retiredTypes.size = 0;
+        retiredTypeNames.size = 0;
+
+        if (keepsTypeIds) {
+            // the names are copied, they live in the slab released below
+            TypeTable* table = GetTypeTable();
+            for (int32 i = 0; i < declaredTypes.size; i++) {
+                TypeInfo* typeInfo = declaredTypes[i];
+                TypeId typeId = typeInfo->typeId;
+                if (table->Retire(typeInfo)) {
+                    retiredTypes.Add(RetiredType { typeId, retiredTypeNames.size, (int32) typeInfo->fullyQualifiedNameLength });
+                    retiredTypeNames.AddRange(typeInfo->fullyQualifiedName, (int32) typeInfo->fullyQualifiedNameLength);
+                }
+            }
+        }
+        else {
+            ReleaseTypeIds();
+        }
+
+        // give the slab back, re-parsing borrows a warm one
+        allocator.Release();
+        // the old list lived in the released slab
+        diagnostics = Diagnostics(allocator.MakeAllocator());
+        bodyDiagnostics = DiagnosticsCheckpoint();
         wasChanged = true;
         wasTouched = true;
         dependantsVisited = true;
-        dependants.size = 0;
+        if (!keepsTypeIds) {
+            dependants.size = 0;
+        }
         dependencies.size = 0;
+        typeDependencies.size = 0;
+        typeDependencyNames.size = 0;
+        bodyTypeDependencies.size = 0;
+        bodyTypeDependencyNames.size = 0;
+        needsRelink = false;
         syntaxTree = nullptr;
         namespaceName = FixedCharSpan();
         declaredTypes = CheckedArray<TypeInfo*>();
         usingDirectives = CheckedArray<FixedCharSpan>();
         tokenizerResult = TokenizerResult();
-        genericInstances.size = 0;
         contents = FixedCharSpan();
+        snapshotIndex = -1;
+        nodeCount = 0;
     }
 
     uint8* SourceFileInfo::AllocateLocked(void* cookie, size_t size, size_t alignment) {
@@ -38,6 +80,180 @@ namespace Alchemy::Compilation {
         return token.GetText(tokenizerResult.texts);
     }
 
-}
+    void SourceFileInfo::AddTypeDependency(TypeInfo* typeInfo) {
+
+        SourceFileInfo* declaringFile = typeInfo->declaringFile;
+
+        // built ins never change and instances are covered by their open type + arguments
+        if (declaringFile == this || declaringFile == nullptr || declaringFile->isBuiltIn || typeInfo->IsGenericInstance()) {
+            return;
+        }
+
+        typeDependencies.Add(TypeDependency { typeInfo, 0, 0, 0, 0 });
+
+    }
+
+    void SourceFileInfo::AddBodyTypeDependency(TypeInfo* typeInfo) {
+
+        SourceFileInfo* declaringFile = typeInfo->declaringFile;
+
+        if (declaringFile == this || declaringFile == nullptr || declaringFile->isBuiltIn || typeInfo->IsGenericInstance()) {
+            return;
+        }
+
+        FixedCharSpan name = typeInfo->GetFullyQualifiedTypeName();
+
+        std::unique_lock lock(mutex);
+
+        // the same few types get named over and over, and the pointers of older runs can't be compared
+        for (int32 i = 0; i < bodyTypeDependencies.size; i++) {
+            TypeDependency dependency = bodyTypeDependencies[i];
+            if (name == FixedCharSpan(bodyTypeDependencyNames.array + dependency.nameStart, dependency.nameLength)) {
+                return;
+            }
+        }
+
+        bodyTypeDependencies.Add(TypeDependency { typeInfo, typeInfo->signatureHash, typeInfo->typeId, bodyTypeDependencyNames.size, (int32) name.size });
+        bodyTypeDependencyNames.AddRange(name.ptr, (int32) name.size);
+
+        for (int32 d = 0; d < dependencies.size; d++) {
+            if (dependencies[d] == declaringFile) {
+                return;
+            }
+        }
+
+        dependencies.Add(declaringFile);
+
+    }
+
+    void SourceFileInfo::ReuseTypeIds(PodList<uint32>* unused) {
+
+        TypeTable* table = GetTypeTable();
+
+        for (int32 i = 0; i < declaredTypes.size; i++) {
+            TypeInfo* typeInfo = declaredTypes[i];
+            FixedCharSpan name = typeInfo->GetFullyQualifiedTypeName();
+
+            for (int32 r = 0; r < retiredTypes.size; r++) {
+                RetiredType retired = retiredTypes[r];
+                if (name == FixedCharSpan(retiredTypeNames.array + retired.nameStart, retired.nameLength)) {
+                    table->Reuse(retired.typeId, typeInfo);
+                    retiredTypes.SwapRemoveAt(r);
+                    break;
+                }
+            }
+        }
+
+        for (int32 r = 0; r < retiredTypes.size; r++) {
+            unused->Add(retiredTypes[r].typeId);
+        }
+
+        retiredTypes.size = 0;
+        retiredTypeNames.size = 0;
+
+    }
+
+    void SourceFileInfo::FinalizeTypeDependencies() {
 
+        IntrospectionSort(typeDependencies.array, typeDependencies.size, [](const TypeDependency& a, const TypeDependency& b) {
+            if (a.typeInfo == b.typeInfo) return 0;
+            return a.typeInfo < b.typeInfo ? -1 : 1;
+        });
 
+        int32 write = 0;
+        for (int32 i = 0; i < typeDependencies.size; i++) {
+            if (write != 0 && typeDependencies[write - 1].typeInfo == typeDependencies[i].typeInfo) {
+                continue;
+            }
+            typeDependencies[write++] = typeDependencies[i];
+        }
+
+        typeDependencies.size = write;
+        typeDependencyNames.size = 0;
+        dependencies.size = 0;
+
+        // the bodies are about to be introspected again, they add theirs back
+        bodyTypeDependencies.size = 0;
+        bodyTypeDependencyNames.size = 0;
+
+        for (int32 i = 0; i < typeDependencies.size; i++) {
+            TypeDependency* dependency = typeDependencies.GetPointer(i);
+            TypeInfo* typeInfo = dependency->typeInfo;
+
+            dependency->signatureHash = typeInfo->signatureHash;
+            dependency->typeId = typeInfo->typeId;
+            dependency->nameStart = typeDependencyNames.size;
+            dependency->nameLength = typeInfo->fullyQualifiedNameLength;
+            typeDependencyNames.AddRange(typeInfo->fullyQualifiedName, typeInfo->fullyQualifiedNameLength);
+
+            bool found = false;
+            for (int32 d = 0; d < dependencies.size; d++) {
+                if (dependencies[d] == typeInfo->declaringFile) {
+                    found = true;
+                    break;
+                }
+            }
+
+            if (!found) {
+                dependencies.Add(typeInfo->declaringFile);
+            }
+
+        }
+
+    }
+
+    static bool SignaturesChanged(PodList<TypeDependency>* dependencies, PodList<char>* names, TypeResolutionMap* resolutionMap, bool compareIds) {
+
+        for (int32 i = 0; i < dependencies->size; i++) {
+            TypeDependency dependency = dependencies->Get(i);
+            FixedCharSpan name(names->array + dependency.nameStart, dependency.nameLength);
+
+            TypeInfo* typeInfo = nullptr;
+            if (!resolutionMap->TryResolve(name, &typeInfo) || typeInfo->signatureHash != dependency.signatureHash) {
+                return true;
+            }
+
+            if (compareIds && typeInfo->typeId != dependency.typeId) {
+                return true;
+            }
+
+        }
+
+        return false;
+
+    }
+
+    bool SourceFileInfo::TypeDependencySignaturesChanged(TypeResolutionMap* resolutionMap) {
+        return SignaturesChanged(&previousTypeDependencies, &previousTypeDependencyNames, resolutionMap, false)
+            || SignaturesChanged(&bodyTypeDependencies, &bodyTypeDependencyNames, resolutionMap, false);
+    }
+
+    bool SourceFileInfo::RecordedSignaturesChanged(TypeResolutionMap* resolutionMap) {
+        return SignaturesChanged(&typeDependencies, &typeDependencyNames, resolutionMap, true)
+            || SignaturesChanged(&bodyTypeDependencies, &bodyTypeDependencyNames, resolutionMap, true);
+    }
+
+    void SourceFileInfo::SaveResolveCheckpoint() {
+        resolveCheckpoint.allocatorOffset = allocator.offset;
+        resolveCheckpoint.diagnostics = diagnostics.Checkpoint();
+    }
+
+    void SourceFileInfo::RestoreResolveCheckpoint() {
+        // everything resolution allocated (parameter lists, diagnostics) lives past the checkpoint,
+        // rewinding means a relink produces the same output as a fresh resolve without leaking
+        allocator.offset = resolveCheckpoint.allocatorOffset;
+        diagnostics.Rollback(resolveCheckpoint.diagnostics);
+
+        // member tables were allocated past the checkpoint
+        for (int32 i = 0; i < declaredTypes.size; i++) {
+            declaredTypes[i]->memberTable = nullptr;
+        }
+
+        previousTypeDependencies.size = 0;
+        previousTypeDependencies.AddRange(typeDependencies.array, typeDependencies.size);
+        previousTypeDependencyNames.size = 0;
+        previousTypeDependencyNames.AddRange(typeDependencyNames.array, typeDependencyNames.size);
+        typeDependencies.size = 0;
+    }
+
+}
@@ -5,12 +5,47 @@
 #include "../Parsing3/Diagnostics.h"
 #include "../Parsing3/Tokenizer.h"
 #include "../Parsing3/SyntaxBase.h"
+#include "../Allocation/ArenaPool.h"
 #include <mutex>
 
 namespace Alchemy::Compilation {
 
     struct CompilationUnitSyntax;
     struct TypeInfo;
+    struct TypeResolutionMap;
+
+    // a type declared in another file that this file resolved against. typeInfo is only safe to touch
+    // while that file is alive and unchanged, after that the name is used to find the replacement
+    struct TypeDependency {
+        TypeInfo* typeInfo;
+        uint64 signatureHash;
+        uint32 typeId; // the id we hold, a type with the same name and shape but another id is still a change
+        int32 nameStart;
+        int32 nameLength;
+    };
+
+    // a type the file declared before it was re-parsed, the new type with the same name takes over its id
+    struct RetiredType {
+        uint32 typeId;
+        int32 nameStart;
+        int32 nameLength;
+    };
+
+    // the stages of a compile that run one job per file, each file records how long its own took
+    enum class FilePhase : uint8 {
+        Parse,
+        Gather,
+        ResolveMembers,
+        ResolveBases,
+
+        Count
+    };
+
+    // state to rewind to when an unchanged file needs its member & base types resolved again
+    struct ResolveCheckpoint {
+        size_t allocatorOffset;
+        DiagnosticsCheckpoint diagnostics;
+    };
 
     struct SourceFileInfo {
 
@@ -19,7 +54,18 @@ namespace Alchemy::Compilation {
         uint64 lastEditTime {};
         PodList<SourceFileInfo*> dependencies;
         PodList<SourceFileInfo*> dependants;
-        PodList<TypeInfo*> genericInstances;
+        PodList<TypeDependency> typeDependencies;
+        PodList<TypeDependency> previousTypeDependencies;
+        PodList<char> typeDependencyNames;
+        PodList<char> previousTypeDependencyNames;
+        // what constant initializers & method bodies resolved, they don't go through resolution
+        PodList<TypeDependency> bodyTypeDependencies;
+        PodList<char> bodyTypeDependencyNames;
+        PodList<RetiredType> retiredTypes;
+        PodList<char> retiredTypeNames;
+        ResolveCheckpoint resolveCheckpoint {};
+        // where the diagnostics of the method bodies start, they come after everything resolution reported
+        DiagnosticsCheckpoint bodyDiagnostics {};
         CheckedArray<TypeInfo*> declaredTypes;
         CheckedArray<FixedCharSpan> usingDirectives;
         LinearAllocator allocator;
@@ -31,19 +77,63 @@ namespace Alchemy::Compilation {
 
         FixedCharSpan contents;
 
+        // record in the compiler's snapshot this file was restored from, -1 once its types exist
+        int32 snapshotIndex { -1 };
+
+        // syntax nodes in the tree, only counted when the file is parsed
+        int32 nodeCount {};
+
+        // only meaningful for the phases the file went through in the last run
+        uint64 phaseNanoseconds[(int32) FilePhase::Count] {};
+
         bool wasTouched {};
         bool wasChanged {};
         bool dependantsVisited {};
         bool isBuiltIn {};
+        bool needsRelink {}; // unchanged, but something it resolved against was changed or removed
+        bool dependencySignatureChanged {}; // a type we depend on changed shape, bodies need to be checked again
+        // changed, but its dependants only relink once the new signatures are known, see Compiler::RelinkDependants
+        bool keepsTypeIds {};
+        // unchanged and reached the same way as in the last run from the same entry points, see IsKeptBody
+        bool keepsBodyDiagnostics {};
+        bool reachedInstanceBodies {}; // a generic instance of ours reported into our diagnostics in the last run
 
         std::mutex mutex;
 
         SourceFileInfo()
-            : allocator(MEGABYTES(128), KILOBYTES(32))
-            , diagnostics(allocator.MakeAllocator()) {}
+            : allocator(GetSourceFileArenaPool())
+            , diagnostics(allocator.MakeAllocator()) {
+            allocator.SetStatsName("SourceFile");
+        }
 
         void Invalidate();
 
+        // frees the TypeTable rows of the declared types, their TypeInfos are about to be released
+        void ReleaseTypeIds();
+
+        // called from resolution jobs, the declaring file is not touched
+        void AddTypeDependency(TypeInfo* typeInfo);
+
+        // from any thread, bodies of the same file are introspected in parallel
+        void AddBodyTypeDependency(TypeInfo* typeInfo);
+
+        // new declared types take over the ids of the retired ones with the same name, the ids nobody took are
+        // appended to `unused`
+        void ReuseTypeIds(PodList<uint32>* unused);
+
+        // de-duplicates the dependencies gathered during resolution, captures signatures & names and rebuilds `dependencies`
+        void FinalizeTypeDependencies();
+
+        // compares the dependencies from before the last relink against whatever those names resolve to now
+        bool TypeDependencySignaturesChanged(TypeResolutionMap* resolutionMap);
+
+        // same for the dependencies as they are, before a relink. also true when a name now belongs to another id
+        bool RecordedSignaturesChanged(TypeResolutionMap* resolutionMap);
+
+        void SaveResolveCheckpoint();
+
+        void RestoreResolveCheckpoint();
+
         static uint8* AllocateLocked(void * cookie, size_t size, size_t alignment);
 
         Allocator GetLockedAllocator();
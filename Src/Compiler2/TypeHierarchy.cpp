@@ -0,0 +1,277 @@
+#include "./TypeHierarchy.h"
+#include "./TypeInfo.h"
+#include "./ResolvedType.h"
+#include "../Util/Hash.h"
+#include "../Util/MathUtil.h"
+
+namespace Alchemy::Compilation {
+
+    static int32 HashPointer(TypeInfo* typeInfo) {
+        uint64 v = (uint64) (size_t) typeInfo;
+        v ^= v >> 33;
+        v *= 0xff51afd7ed558ccdull;
+        v ^= v >> 33;
+        return (int32) v;
+    }
+
+    static TypeInfo* GetEdge(TypeInfo* typeInfo, int32 edge) {
+        ResolvedType* baseType = &typeInfo->baseTypes[edge];
+        if (baseType->typeId == kInvalidTypeId || baseType->IsUnresolved()) {
+            return nullptr;
+        }
+        return baseType->GetTypeInfo();
+    }
+
+    int32 TypeHierarchy::IndexOf(TypeInfo* typeInfo) {
+
+        int32 h = HashPointer(typeInfo);
+
+        for (int32 idx = h;;) {
+            idx = MsiHash::Lookup32(h, exponent, idx);
+
+            if (keys[idx] == nullptr) {
+                return -1;
+            }
+
+            if (keys[idx] == typeInfo) {
+                return keyIndices[idx];
+            }
+        }
+
+    }
+
+    void TypeHierarchy::Build(CheckedArray<TypeInfo*> typeInfos, TempAllocator* tempAllocator) {
+
+        int32 n = typeInfos.size;
+        int32 capacity = MathUtil::CeilPow2(n * 2);
+        capacity = capacity < 16 ? 16 : capacity;
+
+        typeCount = n;
+        types = typeInfos.array;
+        exponent = MathUtil::LogPow2((uint32) capacity);
+        keys = tempAllocator->Allocate<TypeInfo*>(capacity);
+        keyIndices = tempAllocator->AllocateUncleared<int32>(capacity);
+
+        for (int32 i = 0; i < n; i++) {
+            int32 h = HashPointer(typeInfos[i]);
+            for (int32 idx = h;;) {
+                idx = MsiHash::Lookup32(h, exponent, idx);
+                if (keys[idx] == nullptr) {
+                    keys[idx] = typeInfos[i];
+                    keyIndices[idx] = i;
+                    break;
+                }
+            }
+        }
+
+        struct Frame {
+            int32 node;
+            int32 edge;
+        };
+
+        int32* indices = tempAllocator->AllocateUncleared<int32>(n);
+        int32* lowLinks = tempAllocator->AllocateUncleared<int32>(n);
+        int32* levels = tempAllocator->Allocate<int32>(n);
+        int32* stack = tempAllocator->AllocateUncleared<int32>(n);
+        Frame* frames = tempAllocator->AllocateUncleared<Frame>(n);
+        uint8* onStack = tempAllocator->Allocate<uint8>(n);
+
+        components = tempAllocator->AllocateUncleared<int32>(n);
+        cyclic = tempAllocator->Allocate<uint8>(n);
+        cycleTypes = tempAllocator->AllocateUncleared<TypeInfo*>(n);
+        cycleStarts = tempAllocator->AllocateUncleared<int32>(n + 1);
+        cycleCount = 0;
+        cycleTypeCount = 0;
+        levelCount = 0;
+
+        for (int32 i = 0; i < n; i++) {
+            indices[i] = -1;
+        }
+
+        int32 nextIndex = 0;
+        int32 stackSize = 0;
+        int32 componentId = 0;
+
+        // iterative so a 10k deep hierarchy doesn't blow the native stack
+        for (int32 root = 0; root < n; root++) {
+
+            if (indices[root] != -1) {
+                continue;
+            }
+
+            int32 frameCount = 0;
+            frames[frameCount++] = Frame { root, 0 };
+            indices[root] = lowLinks[root] = nextIndex++;
+            stack[stackSize++] = root;
+            onStack[root] = 1;
+
+            while (frameCount != 0) {
+
+                Frame* frame = &frames[frameCount - 1];
+                int32 v = frame->node;
+                TypeInfo* typeInfo = types[v];
+
+                if (frame->edge < typeInfo->baseTypeCount) {
+
+                    TypeInfo* target = GetEdge(typeInfo, frame->edge++);
+                    int32 w = target == nullptr ? -1 : IndexOf(target);
+
+                    if (w == -1) {
+                        continue;
+                    }
+
+                    if (indices[w] == -1) {
+                        indices[w] = lowLinks[w] = nextIndex++;
+                        stack[stackSize++] = w;
+                        onStack[w] = 1;
+                        frames[frameCount++] = Frame { w, 0 };
+                    }
+                    else if (onStack[w] && indices[w] < lowLinks[v]) {
+                        lowLinks[v] = indices[w];
+                    }
+
+                    continue;
+                }
+
+                frameCount--;
+
+                if (frameCount != 0) {
+                    int32 parent = frames[frameCount - 1].node;
+                    if (lowLinks[v] < lowLinks[parent]) {
+                        lowLinks[parent] = lowLinks[v];
+                    }
+                }
+
+                if (lowLinks[v] != indices[v]) {
+                    continue;
+                }
+
+                // v is the root of a component. components come out with everything they point at already
+                // emitted, so the level is one past the highest base outside of the component
+                int32 start = stackSize;
+                do {
+                    start--;
+                    onStack[stack[start]] = 0;
+                    components[stack[start]] = componentId;
+                } while (stack[start] != v);
+
+                int32 level = 0;
+                bool isCycle = stackSize - start > 1;
+
+                for (int32 s = start; s < stackSize; s++) {
+                    TypeInfo* member = types[stack[s]];
+                    for (int32 e = 0; e < member->baseTypeCount; e++) {
+                        TypeInfo* target = GetEdge(member, e);
+                        int32 w = target == nullptr ? -1 : IndexOf(target);
+                        if (w == -1) {
+                            continue;
+                        }
+                        if (components[w] == componentId) {
+                            isCycle = true; // includes inheriting from yourself
+                        }
+                        else if (levels[w] + 1 > level) {
+                            level = levels[w] + 1;
+                        }
+                    }
+                }
+
+                if (isCycle) {
+                    cycleStarts[cycleCount++] = cycleTypeCount;
+                }
+
+                for (int32 s = start; s < stackSize; s++) {
+                    levels[stack[s]] = level;
+                    cyclic[stack[s]] = isCycle;
+                    if (isCycle) {
+                        cycleTypes[cycleTypeCount++] = types[stack[s]];
+                    }
+                }
+
+                if (level + 1 > levelCount) {
+                    levelCount = level + 1;
+                }
+
+                stackSize = start;
+                componentId++;
+
+            }
+
+        }
+
+        cycleStarts[cycleCount] = cycleTypeCount;
+
+        levelStarts = tempAllocator->Allocate<int32>(levelCount + 1);
+
+        for (int32 i = 0; i < n; i++) {
+            levelStarts[levels[i] + 1]++;
+        }
+
+        for (int32 l = 0; l < levelCount; l++) {
+            levelStarts[l + 1] += levelStarts[l];
+        }
+
+        int32* writes = tempAllocator->AllocateUncleared<int32>(levelCount);
+        memcpy(writes, levelStarts, sizeof(int32) * levelCount);
+
+        ordered = tempAllocator->AllocateUncleared<TypeInfo*>(n);
+        for (int32 i = 0; i < n; i++) {
+            ordered[writes[levels[i]]++] = types[i];
+        }
+
+    }
+
+    CheckedArray<TypeInfo*> TypeHierarchy::GetLevel(int32 level) {
+        return CheckedArray<TypeInfo*>(ordered + levelStarts[level], levelStarts[level + 1] - levelStarts[level]);
+    }
+
+    bool TypeHierarchy::IsCyclic(TypeInfo* typeInfo) {
+        int32 idx = IndexOf(typeInfo);
+        return idx != -1 && cyclic[idx] != 0;
+    }
+
+    CheckedArray<TypeInfo*> TypeHierarchy::GetCycles(CheckedArray<int32>* starts) {
+        *starts = CheckedArray<int32>(cycleStarts, cycleCount);
+        return CheckedArray<TypeInfo*>(cycleTypes, cycleTypeCount);
+    }
+
+    void TypeHierarchy::GetCyclePath(TypeInfo* typeInfo, FixedPodList<FixedCharSpan>* path) {
+
+        int32 start = IndexOf(typeInfo);
+
+        assert(start != -1 && cyclic[start]);
+
+        int32 componentId = components[start];
+        TypeInfo* ptr = typeInfo;
+
+        path->Add(typeInfo->GetFullyQualifiedTypeName());
+
+        // every type in a cycle has a base in the same component, prefer the class base so the
+        // path reads the way the user wrote the hierarchy
+        while (path->size < path->capacity) {
+
+            TypeInfo* next = nullptr;
+
+            for (int32 e = 0; e < ptr->baseTypeCount; e++) {
+                TypeInfo* target = GetEdge(ptr, e);
+                int32 w = target == nullptr ? -1 : IndexOf(target);
+                if (w != -1 && components[w] == componentId) {
+                    next = target;
+                    break;
+                }
+            }
+
+            assert(next != nullptr);
+
+            path->Add(next->GetFullyQualifiedTypeName());
+
+            if (next == typeInfo) {
+                break;
+            }
+
+            ptr = next;
+
+        }
+
+    }
+
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "../PrimitiveTypes.h"
+#include "../Collections/CheckedArray.h"
+#include "../Collections/FixedPodList.h"
+#include "../Allocation/LinearAllocator.h"
+#include "../Util/FixedCharSpan.h"
+
+namespace Alchemy::Compilation {
+
+    struct TypeInfo;
+
+    // The graph of types -> base types. Built once per run after base types are resolved, it finds every cycle in
+    // one pass (Tarjan's strongly connected components) and orders the types into levels where everything a type
+    // inherits from sits in a lower level, so work that needs a finished base can run level by level in parallel.
+    // All storage comes from the temp allocator handed to Build.
+    struct TypeHierarchy {
+
+        // types sorted by level, bases before derived types
+        TypeInfo** ordered {};
+        int32* levelStarts {}; // levelCount + 1 entries
+        int32 levelCount {};
+        int32 typeCount {};
+
+        void Build(CheckedArray<TypeInfo*> typeInfos, TempAllocator* tempAllocator);
+
+        CheckedArray<TypeInfo*> GetLevel(int32 level);
+
+        // true if the type is part of an inheritance cycle (including inheriting from itself)
+        bool IsCyclic(TypeInfo* typeInfo);
+
+        // the types of every cycle, each cycle is contiguous in the returned array and starts at cycleStarts[i]
+        CheckedArray<TypeInfo*> GetCycles(CheckedArray<int32>* cycleStarts);
+
+        // writes the names along the cycle starting and ending at typeInfo, eg A -> B -> A
+        void GetCyclePath(TypeInfo* typeInfo, FixedPodList<FixedCharSpan>* path);
+
+    private:
+
+        TypeInfo** keys {};
+        int32* keyIndices {};
+        int32 exponent {};
+
+        TypeInfo** types {}; // in input order
+        int32* components {};
+        uint8* cyclic {};
+
+        TypeInfo** cycleTypes {};
+        int32* cycleStarts {};
+        int32 cycleCount {};
+        int32 cycleTypeCount {};
+
+        int32 IndexOf(TypeInfo* typeInfo);
+
+    };
+
+}
@@ -2,6 +2,9 @@
 #include "./ResolvedType.h"
 #include "./MemberInfo.h"
 #include "./SourceFileInfo.h"
+#include "./ConstantEvaluator.h"
+#include "../Parsing3/SyntaxNodes.h"
+#include "../Util/Hash.h"
 
 namespace Alchemy::Compilation {
 
@@ -29,41 +32,6 @@ namespace Alchemy::Compilation {
         return declaringFile->path;
     }
 
-    bool TypeInfo::DetectClassCycle(TypeInfo* type, CheckedArray<TypeInfo*> visited, int32 depth, FixedPodList<FixedCharSpan>* path) {
-        for (int32 i = 0; i < depth; i++) {
-            if (visited[i] == type) {
-                if (path != nullptr) {
-                    path->Push(type->GetFullyQualifiedTypeName());
-                }
-                return true;
-            }
-        }
-
-        // If the type has no baseType, there's no cycle from this node
-        if (type->baseTypeCount == 0 || !type->baseTypes[0].IsClass()) {
-            return false;
-        }
-
-        visited[depth] = type;
-        if (path != nullptr) {
-            path->Push(type->GetFullyQualifiedTypeName());
-        }
-
-        if (DetectClassCycle(type->baseTypes[0].typeInfo, visited, depth + 1, path)) {
-            return true;
-        }
-
-        if (path != nullptr) {
-            path->Pop();
-        }
-
-        return false;
-    }
-
-    bool TypeInfo::DetectClassCycle(CheckedArray<TypeInfo*> visited, FixedPodList<FixedCharSpan>* path) {
-        return DetectClassCycle(this, visited, 0, path);
-    }
-
     FixedCharSpan TypeInfo::GetNamespaceName() {
         return declaringFile->namespaceName.size == 0
             ? FixedCharSpan("global")
@@ -74,7 +42,7 @@ namespace Alchemy::Compilation {
         return typeClass != TypeClass::Class || baseTypeCount == 0
             ? nullptr
             : baseTypes[0].IsClass()
-                ? baseTypes[0].typeInfo
+                ? baseTypes[0].GetTypeInfo()
                 : nullptr;
     }
 
@@ -174,4 +142,104 @@ namespace Alchemy::Compilation {
                 return FixedCharSpan("invalid");
         }
     }
-}
\ No newline at end of file
+    static uint64 HashSpan(uint64 hash, FixedCharSpan span) {
+        hash = MsiHash::FNV1a64(hash, span.ptr, span.size);
+        // length keeps adjacent names from running into each other
+        return MsiHash::FNV1a64(hash, &span.size, sizeof(span.size));
+    }
+
+    static uint64 HashResolvedType(uint64 hash, ResolvedType resolvedType) {
+        if (resolvedType.typeId != kInvalidTypeId) {
+            hash = HashSpan(hash, resolvedType.GetTypeInfo()->GetFullyQualifiedTypeName());
+        }
+        return MsiHash::FNV1a64(hash, &resolvedType.resolvedTypeFlags, sizeof(resolvedType.resolvedTypeFlags));
+    }
+
+    static SyntaxList<TypeParameterConstraintClauseSyntax>* GetConstraintClauses(SyntaxBase* syntaxNode) {
+        switch (syntaxNode->GetKind()) {
+            case SyntaxKind::ClassDeclaration:
+                return ((ClassDeclarationSyntax*) syntaxNode)->constraintClauses;
+            case SyntaxKind::StructDeclaration:
+                return ((StructDeclarationSyntax*) syntaxNode)->constraintClauses;
+            case SyntaxKind::InterfaceDeclaration:
+                return ((InterfaceDeclarationSyntax*) syntaxNode)->constraintClauses;
+            case SyntaxKind::DelegateDeclaration:
+                return ((DelegateDeclarationSyntax*) syntaxNode)->constraintClauses;
+            default:
+                return nullptr;
+        }
+    }
+
+    uint64 TypeInfo::ComputeSignatureHash() {
+
+        uint64 hash = MsiHash::kFNV1a64OffsetBasis;
+
+        hash = HashSpan(hash, GetFullyQualifiedTypeName());
+        hash = MsiHash::FNV1a64(hash, &typeClass, sizeof(typeClass));
+        hash = MsiHash::FNV1a64(hash, &flags, sizeof(flags));
+        hash = MsiHash::FNV1a64(hash, &visibility, sizeof(visibility));
+
+        for (int32 i = 0; i < genericArgumentCount; i++) {
+            hash = HashResolvedType(hash, genericArguments[i]);
+        }
+
+        // constraints aren't gathered yet, their text stands in
+        SyntaxList<TypeParameterConstraintClauseSyntax>* constraintClauses = syntaxNode != nullptr ? GetConstraintClauses(syntaxNode) : nullptr;
+        if (constraintClauses != nullptr) {
+            for (int32 i = 0; i < constraintClauses->size; i++) {
+                hash = HashSpan(hash, declaringFile->GetText(constraintClauses->array[i]));
+            }
+        }
+
+        for (int32 i = 0; i < baseTypeCount; i++) {
+            hash = HashResolvedType(hash, baseTypes[i]);
+        }
+
+        for (int32 i = 0; i < fieldCount; i++) {
+            FieldInfo* fieldInfo = &fields[i];
+            hash = HashResolvedType(hash, fieldInfo->type);
+            hash = HashSpan(hash, fieldInfo->identifier);
+            hash = MsiHash::FNV1a64(hash, &fieldInfo->modifiers, sizeof(fieldInfo->modifiers));
+            hash = MsiHash::FNV1a64(hash, &fieldInfo->visibility, sizeof(fieldInfo->visibility));
+
+            // constants are folded into whoever reads them, they aren't evaluated yet so the initializer stands in
+            EqualsValueClauseSyntax* value = nullptr;
+            if (typeClass == TypeClass::Enum) {
+                value = syntaxNode != nullptr ? GetEnumMemberSyntax(fieldInfo)->equalsValue : nullptr;
+            }
+            else if ((fieldInfo->modifiers & FieldModifiers::Const) != 0 && fieldInfo->syntaxNode != nullptr) {
+                value = fieldInfo->syntaxNode->initializer;
+            }
+
+            if (value != nullptr) {
+                hash = HashSpan(hash, declaringFile->GetText(value));
+            }
+        }
+
+        for (int32 i = 0; i < propertyCount; i++) {
+            hash = HashResolvedType(hash, properties[i].type);
+            hash = HashSpan(hash, properties[i].name);
+            hash = MsiHash::FNV1a64(hash, &properties[i].modifiers, sizeof(properties[i].modifiers));
+            hash = MsiHash::FNV1a64(hash, &properties[i].visibility, sizeof(properties[i].visibility));
+        }
+
+        for (int32 i = 0; i < methodCount; i++) {
+            MethodInfo* methodInfo = &methods[i];
+            hash = HashSpan(hash, methodInfo->name);
+            hash = HashResolvedType(hash, methodInfo->returnType);
+            hash = MsiHash::FNV1a64(hash, &methodInfo->visibility, sizeof(methodInfo->visibility));
+            hash = MsiHash::FNV1a64(hash, &methodInfo->modifiers, sizeof(methodInfo->modifiers));
+            hash = MsiHash::FNV1a64(hash, &methodInfo->isDefaultParameterOverload, sizeof(methodInfo->isDefaultParameterOverload));
+            hash = MsiHash::FNV1a64(hash, &methodInfo->parameterCount, sizeof(methodInfo->parameterCount));
+            for (int32 p = 0; p < methodInfo->parameterCount; p++) {
+                hash = HashResolvedType(hash, methodInfo->parameters[p].type);
+                hash = HashSpan(hash, methodInfo->parameters[p].name);
+                hash = MsiHash::FNV1a64(hash, &methodInfo->parameters[p].modifiers, sizeof(methodInfo->parameters[p].modifiers));
+            }
+        }
+
+        return hash;
+
+    }
+
+}
@@ -21,6 +21,7 @@ namespace Alchemy::Compilation {
     struct ConstructorInfo;
     struct ResolvedType;
     struct SyntaxBase;
+    struct MemberLookupTable;
 
     enum class TypeClass : uint8 {
         Class,
@@ -46,6 +47,7 @@ namespace Alchemy::Compilation {
         InstantiatedGeneric = 1 << 5,
         IsPrimitive = 1 << 6,
         Abstract = 1 << 7,
+        IsGenericInstance = 1 << 8, // allocated by MakeGenericType, lives in the generic instance arena
     })
 
     inline size_t TypeInfoFlagsToString(TypeInfoFlags flags, char* buffer) {
@@ -61,6 +63,7 @@ namespace Alchemy::Compilation {
         PrintFlag(TypeInfoFlags, InstantiatedGeneric)
         PrintFlag(TypeInfoFlags, IsPrimitive)
         PrintFlag(TypeInfoFlags, Abstract)
+        PrintFlag(TypeInfoFlags, IsGenericInstance)
 
         return PrintFlagLength;
 
@@ -89,6 +92,18 @@ namespace Alchemy::Compilation {
         ConstructorInfo* constructors {};
         ResolvedType* genericArguments {};
         GenericConstraint* constraints {};
+        // for generic instances, the declaration they were instantiated from
+        TypeInfo* genericDefinition {};
+
+        // hash of everything other files can observe without looking at method bodies, see ComputeSignatureHash
+        uint64 signatureHash {};
+
+        // flattened members incl. inherited ones, built after base types resolve
+        MemberLookupTable* memberTable {};
+        uint32 memberTableRunId {};
+
+        // index into the resolution map's TypeTable, 0 until the type is registered
+        uint32 typeId {};
 
         TypeClass typeClass {};
         TypeInfoFlags flags {};
@@ -141,9 +156,9 @@ namespace Alchemy::Compilation {
             return (flags & TypeInfoFlags::IsGenericTypeDefinition) != 0;
         }
 
-        bool DetectClassCycle(CheckedArray<TypeInfo*> visited, FixedPodList<FixedCharSpan>* path = nullptr);
-
-        bool DetectClassCycle(TypeInfo* type, CheckedArray<TypeInfo*> visited, int32 depth, FixedPodList<FixedCharSpan>* path = nullptr);
+        inline bool IsGenericInstance() {
+            return (flags & TypeInfoFlags::IsGenericInstance) != 0;
+        }
 
         CheckedArray<ResolvedType> GetGenericArguments();
 
@@ -163,6 +178,9 @@ namespace Alchemy::Compilation {
 
         bool IsBuiltIn();
 
+        // only valid once member and base types are resolved
+        uint64 ComputeSignatureHash();
+
         FixedCharSpan GetSimpleTypeName();
     };
 
@@ -16,9 +16,29 @@ namespace Alchemy::Compilation {
         , unresolvedType(nullptr)
         , voidType(nullptr)
         , longestEntrySize(0)
+        , genericInstances(GIGABYTES(4))
+        , table(GetTypeTable())
+        , tableOwner(0)
+        , deferGenericInstances(false)
+        , pendingInstances(32)
         , exponent(MathUtil::LogPow2(16)) {
 
-        values = CheckedArray<TypeInfo*>(allocator.Allocate<TypeInfo*>(1 << exponent), 1 << exponent);
+        values = CheckedArray<TypeId>(allocator.Allocate<TypeId>(1 << exponent), 1 << exponent);
+        tableOwner = table->AcquireOwner();
+
+    }
+
+    TypeResolutionMap::~TypeResolutionMap() {
+
+        table->ReleaseOwner(tableOwner);
+
+        if (unresolvedType != nullptr) {
+            table->RemoveIfRegistered(unresolvedType);
+        }
+
+        if (voidType != nullptr) {
+            table->RemoveIfRegistered(voidType);
+        }
 
     }
 
@@ -26,19 +46,20 @@ namespace Alchemy::Compilation {
         // otherwise we need to re-hash the table
         int32 newExponent = exponent + 1;
 
-        TypeInfo** newList = allocator.Allocate<TypeInfo*>(1 << newExponent);
+        TypeId* newList = allocator.Allocate<TypeId>(1 << newExponent);
         int32 previousTotalSize = 1 << exponent;
         for (int32 i = 0; i < previousTotalSize; i++) {
-            TypeInfo* pInfo = values[i];
-            if (pInfo == nullptr) {
+            TypeId typeId = values[i];
+            if (typeId == kInvalidTypeId) {
                 continue;
             }
-            int32 h = MsiHash::FNV1a(pInfo->fullyQualifiedName, pInfo->fullyQualifiedNameLength);
+            // the hash is kept in the table, no need to touch the names again
+            int32 h = (int32) table->GetNameHash(typeId);
             int32 idx = h;
             while (true) {
                 idx = MsiHash::Lookup32(h, newExponent, idx);
-                if (newList[idx] == nullptr) {
-                    newList[idx] = pInfo;
+                if (newList[idx] == kInvalidTypeId) {
+                    newList[idx] = typeId;
                     break;
                 }
             }
@@ -57,11 +78,18 @@ namespace Alchemy::Compilation {
 
         for (int32 idx = h;;) {
             idx = MsiHash::Lookup32(h, exponent, idx);
-            TypeInfo* value = values.Get(idx);
+            TypeId value = values.Get(idx);
 
-            if (value == nullptr) {
+            if (value == kInvalidTypeId) {
 
-                values[idx] = typeInfo;
+                // generic arguments already got their id when they were gathered
+                TypeId typeId = typeInfo->typeId;
+                if (typeId == kInvalidTypeId || table->GetTypeInfo(typeId) != typeInfo) {
+                    typeId = table->Add(typeInfo);
+                }
+
+                table->SetOwner(typeId, tableOwner);
+                values[idx] = typeId;
                 size++;
 
                 int32 threshold = (1 << exponent) >> 1;
@@ -76,16 +104,12 @@ namespace Alchemy::Compilation {
 
                 return true;
             }
-            else if (typeInfo == value) {
+            else if (table->GetTypeInfo(value) == typeInfo) {
                 // already in the table, nothing to do
                 return true;
             }
-            else if (typeInfo->fullyQualifiedNameLength == value->fullyQualifiedNameLength) {
-
-                if (memcmp(typeInfo->fullyQualifiedName, value->fullyQualifiedName, typeInfo->fullyQualifiedNameLength) == 0) {
-                    return false; // collision but not identical instances
-                }
-
+            else if (table->GetNameHash(value) == (uint32) h && table->GetFullyQualifiedName(value) == qualifiedName) {
+                return false; // collision but not identical instances
             }
 
         }
@@ -104,52 +128,67 @@ namespace Alchemy::Compilation {
     }
 
     CheckedArray<TypeInfo*> TypeResolutionMap::GetConcreteTypes(Allocator alloc) {
-        int32 total = 1 << exponent;
-        int32 write = 0;
-        int32 cnt = 0;
+
         constexpr TypeInfoFlags exclusions = TypeInfoFlags::IsGenericArgumentDefinition | TypeInfoFlags::IsGenericTypeDefinition;
-        for (int32 i = 0; i < total; i++) {
 
-            TypeInfo* typeInfo = values[i];
-            if (typeInfo == nullptr) {
-                continue;
-            }
+        TypeInfo** retn = alloc.AllocateUncleared<TypeInfo*>(size);
+        int32 write = 0;
 
-            if ((typeInfo->flags & exclusions) != 0) {
-                continue;
+        // filter on the owner & flag columns, only the pointers of types we keep are read
+        TypeId limit = table->GetIdLimit();
+        int32 blockCount = table->GetBlockCount();
+        for (int32 b = 0; b < blockCount; b++) {
+            TypeTableBlock* block = table->GetBlock(b);
+            int32 start = b == 0 ? 1 : 0;
+            int32 end = limit - ((TypeId) b << TypeTable::kBlockShift);
+            end = end > TypeTableBlock::kSize ? TypeTableBlock::kSize : end;
+
+            for (int32 i = start; i < end; i++) {
+                if (block->owners[i] == tableOwner && (block->flags[i] & exclusions) == 0) {
+                    retn[write++] = block->typeInfos[i];
+                }
             }
-
-            cnt++;
         }
 
-        TypeInfo** retn = alloc.AllocateUncleared<TypeInfo*>(cnt);
+        return CheckedArray<TypeInfo*>(retn, write);
+    }
 
-        for (int32 i = 0; i < total; i++) {
+    CheckedArray<TypeId> TypeResolutionMap::GetConcreteTypeIds(Allocator alloc) {
 
-            TypeInfo* typeInfo = values[i];
-            if (typeInfo == nullptr) {
-                continue;
-            }
+        constexpr TypeInfoFlags exclusions = TypeInfoFlags::IsGenericArgumentDefinition | TypeInfoFlags::IsGenericTypeDefinition;
 
-            if ((typeInfo->flags & exclusions) != 0) {
-                continue;
-            }
+        TypeId* retn = alloc.AllocateUncleared<TypeId>(size);
+        int32 write = 0;
 
-            retn[write++] = typeInfo;
+        TypeId limit = table->GetIdLimit();
+        int32 blockCount = table->GetBlockCount();
+        for (int32 b = 0; b < blockCount; b++) {
+            TypeTableBlock* block = table->GetBlock(b);
+            TypeId baseId = (TypeId) b << TypeTable::kBlockShift;
+            int32 start = b == 0 ? 1 : 0;
+            int32 end = limit - baseId;
+            end = end > TypeTableBlock::kSize ? TypeTableBlock::kSize : end;
+
+            for (int32 i = start; i < end; i++) {
+                if (block->owners[i] == tableOwner && (block->flags[i] & exclusions) == 0) {
+                    retn[write++] = baseId + i;
+                }
+            }
         }
 
-        return CheckedArray<TypeInfo*>(retn, write);
+        return CheckedArray<TypeId>(retn, write);
     }
 
     CheckedArray<TypeInfo*> TypeResolutionMap::GetValues(Allocator alloc) {
         TypeInfo** retn = alloc.AllocateUncleared<TypeInfo*>(size);
-        int32 total = 1 << exponent;
         int32 write = 0;
-        for (int32 i = 0; i < total; i++) {
-            if (values[i] != nullptr) {
-                retn[write++] = values[i];
+        TypeId limit = table->GetIdLimit();
+        for (TypeId typeId = 1; typeId < limit; typeId++) {
+            if (table->GetOwner(typeId) == tableOwner) {
+                retn[write++] = table->GetTypeInfo(typeId);
             }
         }
+        assert(write == size);
         return CheckedArray<TypeInfo*>(retn, size);
     }
 
@@ -159,7 +198,15 @@ namespace Alchemy::Compilation {
 
         assert(array.size <= maxItemCount / 2);
 
-        memset(values.array, 0, sizeof(TypeInfo*) * maxItemCount);
+        // dropped types keep their row (and id) until whoever owns their memory frees them, they just stop
+        // belonging to this map. surviving types keep their id
+        for (int32 i = 0; i < maxItemCount; i++) {
+            if (values[i] != kInvalidTypeId) {
+                table->SetOwner(values[i], kNoTypeOwner);
+            }
+        }
+
+        memset(values.array, 0, sizeof(TypeId) * maxItemCount);
 
         size = array.size;
         longestEntrySize = 0;
@@ -167,11 +214,19 @@ namespace Alchemy::Compilation {
         for (int32 i = 0; i < size; i++) {
             TypeInfo* info = array[i];
             int32 h = MsiHash::FNV1a(info->fullyQualifiedName, info->fullyQualifiedNameLength);
+
+            TypeId typeId = info->typeId;
+            if (typeId == kInvalidTypeId || table->GetTypeInfo(typeId) != info) {
+                typeId = table->Add(info);
+            }
+
+            table->SetOwner(typeId, tableOwner);
+
             int32 idx = h;
             while (true) {
                 idx = MsiHash::Lookup32(h, exponent, idx);
-                if (values[idx] == nullptr) {
-                    values[idx] = info;
+                if (values[idx] == kInvalidTypeId) {
+                    values[idx] = typeId;
 
                     if (info->fullyQualifiedNameLength > longestEntrySize) {
                         longestEntrySize = info->fullyQualifiedNameLength;
@@ -184,6 +239,7 @@ namespace Alchemy::Compilation {
 
     }
 
+
     int32 TypeResolutionMap::GetLongestEntrySize() {
         return longestEntrySize;
     }
@@ -195,36 +251,39 @@ namespace Alchemy::Compilation {
         while (true) {
             idx = MsiHash::Lookup32(h, exponent, idx);
 
-            TypeInfo* test = values[idx];
+            TypeId test = values[idx];
 
-            if (test == nullptr) {
+            if (test == kInvalidTypeId) {
                 // don't set the out value if not found
                 return false;
             }
 
-            if (test->GetFullyQualifiedTypeName() == span) {
-                *pInfo = test;
+            // the hash column rules out nearly every collision without reading the name
+            if (table->GetNameHash(test) == (uint32) h && table->GetFullyQualifiedName(test) == span) {
+                *pInfo = table->GetTypeInfo(test);
                 return true;
             }
         }
 
     }
 
-    ResolvedType TypeResolutionMap::RecursiveResolveGenerics(ResolvedType input, CheckedArray<GenericReplacement> replacements, Allocator& alloc) {
+    ResolvedType TypeResolutionMap::RecursiveResolveGenerics(ResolvedType input, CheckedArray<GenericReplacement> replacements) {
 
         // simple type name reference, no work to do
-        if (input.typeInfo == nullptr) {
+        if (input.typeId == kInvalidTypeId) {
             return input;
         }
 
         // check for `List<T> values`
-//        if ((input.typeInfo->flags & TypeInfoFlags::IsGenericTypeDefinition) != 0) {
+//        if ((inputType->flags & TypeInfoFlags::IsGenericTypeDefinition) != 0) {
 //            puts("yep");
 //        }
 
+        TypeInfo* inputType = input.GetTypeInfo();
+
         // handles the `TValue item` case
-        if ((input.typeInfo->flags & TypeInfoFlags::IsGenericArgumentDefinition) != 0) {
-            FixedCharSpan typeName = input.typeInfo->GetTypeName();
+        if ((inputType->flags & TypeInfoFlags::IsGenericArgumentDefinition) != 0) {
+            FixedCharSpan typeName = inputType->GetTypeName();
             for (int32 i = 0; i < replacements.size; i++) {
                 if (replacements[i].genericName == typeName) {
                     return replacements[i].resolvedGeneric;
@@ -233,18 +292,18 @@ namespace Alchemy::Compilation {
             UNREACHABLE("RecursiveResolveGenerics");
         }
 
-        if ((input.typeInfo->flags & TypeInfoFlags::IsGenericTypeDefinition) != 0) {
+        if ((inputType->flags & TypeInfoFlags::IsGenericTypeDefinition) != 0) {
 
-            int32 cnt = input.typeInfo->genericArgumentCount;
+            int32 cnt = inputType->genericArgumentCount;
 
             CheckedArray<ResolvedType> replacedArgs(GetThreadLocalAllocator()->AllocateUncleared<ResolvedType>(cnt), cnt);
 
             for (int32 i = 0; i < cnt; i++) {
                 // for each generic type argument, return a replacement of it
-                replacedArgs[i] = RecursiveResolveGenerics(input.typeInfo->genericArguments[i], replacements, alloc);
+                replacedArgs[i] = RecursiveResolveGenerics(inputType->genericArguments[i], replacements);
             }
 
-            ResolvedType retn = MakeGenericType(input.typeInfo, replacedArgs, alloc);
+            ResolvedType retn = MakeGenericType(inputType, replacedArgs);
             retn.resolvedTypeFlags |= input.resolvedTypeFlags;
 
             return retn;
@@ -255,7 +314,104 @@ namespace Alchemy::Compilation {
 
     }
 
-    ResolvedType TypeResolutionMap::MakeGenericType(TypeInfo* openType, CheckedArray<ResolvedType> typeArguments, Allocator typeAllocator) {
+    template<typename T>
+    static size_t BlockOffset(size_t* blockSize, size_t offset, size_t count) {
+        offset = (offset + alignof(T) - 1) & ~(alignof(T) - 1);
+        *blockSize = offset + sizeof(T) * count;
+        return offset;
+    }
+
+    // everything an instance owns goes in one arena block with the TypeInfo at the front, the arena
+    // finds its block header from the TypeInfo pointer when marking & sweeping
+    struct GenericInstanceLayout {
+        size_t baseTypeOffset;
+        size_t fieldOffset;
+        size_t propertyOffset;
+        size_t methodOffset;
+        size_t parameterOffset;
+        size_t genericArgumentOffset;
+        size_t indexerOffset;
+        size_t constructorOffset;
+        size_t constraintOffset;
+        size_t nameOffset;
+        size_t totalSize;
+
+        GenericInstanceLayout(TypeInfo* openType, size_t nameSize) : totalSize(0) {
+
+            int32 parameterCount = 0;
+            for (int32 i = 0; i < openType->methodCount; i++) {
+                parameterCount += openType->methods[i].parameterCount;
+            }
+
+            baseTypeOffset = BlockOffset<ResolvedType>(&totalSize, sizeof(TypeInfo), openType->baseTypeCount);
+            fieldOffset = BlockOffset<FieldInfo>(&totalSize, totalSize, openType->fieldCount);
+            propertyOffset = BlockOffset<PropertyInfo>(&totalSize, totalSize, openType->propertyCount);
+            methodOffset = BlockOffset<MethodInfo>(&totalSize, totalSize, openType->methodCount);
+            parameterOffset = BlockOffset<ParameterInfo>(&totalSize, totalSize, parameterCount);
+            genericArgumentOffset = BlockOffset<ResolvedType>(&totalSize, totalSize, openType->genericArgumentCount);
+            indexerOffset = BlockOffset<IndexerInfo>(&totalSize, totalSize, openType->indexerCount);
+            constructorOffset = BlockOffset<ConstructorInfo>(&totalSize, totalSize, openType->constructorCount);
+            constraintOffset = BlockOffset<GenericConstraint>(&totalSize, totalSize, openType->constraintCount);
+            nameOffset = BlockOffset<char>(&totalSize, totalSize, nameSize + 1);
+        }
+
+    };
+
+    // the instance's block with everything but its members, those are copied by FillGenericInstance
+    TypeInfo* TypeResolutionMap::CreateGenericInstance(TypeInfo* openType, CheckedArray<ResolvedType> typeArguments, FixedCharSpan name) {
+
+        GenericInstanceLayout layout(openType, name.size);
+
+        uint8* memoryBlock = genericInstances.Allocate(layout.totalSize);
+
+        TypeInfo* newType = (TypeInfo*) memoryBlock;
+
+        *newType = *openType;
+
+        newType->baseTypes = (ResolvedType*) (memoryBlock + layout.baseTypeOffset);
+        newType->fields = (FieldInfo*) (memoryBlock + layout.fieldOffset);
+        newType->properties = (PropertyInfo*) (memoryBlock + layout.propertyOffset);
+        newType->methods = (MethodInfo*) (memoryBlock + layout.methodOffset);
+        newType->genericArguments = (ResolvedType*) (memoryBlock + layout.genericArgumentOffset);
+        newType->indexers = (IndexerInfo*) (memoryBlock + layout.indexerOffset);
+        newType->constructors = (ConstructorInfo*) (memoryBlock + layout.constructorOffset);
+        newType->constraints = (GenericConstraint*) (memoryBlock + layout.constraintOffset);
+        newType->fullyQualifiedName = (char*) (memoryBlock + layout.nameOffset);
+        newType->fullyQualifiedNameLength = name.size;
+        newType->genericDefinition = openType;
+        newType->flags |= TypeInfoFlags::IsGenericInstance;
+        newType->memberTable = nullptr;
+        newType->memberTableRunId = 0;
+        newType->typeId = kInvalidTypeId;
+
+        memcpy(newType->fullyQualifiedName, name.ptr, name.size);
+        newType->fullyQualifiedName[name.size] = '\0';
+        newType->typeName = newType->fullyQualifiedName + openType->GetNamespaceName().size + 2;
+        newType->typeNameLength = newType->fullyQualifiedNameLength - openType->GetNamespaceName().size - 2;
+
+        for (int32 i = 0; i < newType->genericArgumentCount; i++) {
+            newType->genericArguments[i] = typeArguments[i];
+        }
+
+        // todo -- not sure this is true, we may need to check that all of our type args are actually concrete now
+        bool isFullyConcrete = true;
+        for (int32 i = 0; i < newType->genericArgumentCount; i++) {
+            if ((newType->genericArguments[i].GetTypeInfo()->flags & TypeInfoFlags::IsGenericArgumentDefinition) != 0) {
+                isFullyConcrete = false;
+                break;
+            }
+        }
+
+        if (isFullyConcrete) {
+            newType->flags &= ~TypeInfoFlags::IsGenericTypeDefinition;
+            newType->flags |= TypeInfoFlags::InstantiatedGeneric;
+        }
+
+        return newType;
+
+    }
+
+    ResolvedType TypeResolutionMap::MakeGenericType(TypeInfo* openType, CheckedArray<ResolvedType> typeArguments) {
 
         // todo -- fast path for when we instantiate a Something<T> : Base<T> we dont' need to copy methods etc when creating Base<T>
 
@@ -263,6 +419,12 @@ namespace Alchemy::Compilation {
         assert(openType->IsGenericTypeDefinition());
         assert(openType->genericArgumentCount == typeArguments.size);
 
+        // a partially closed instance (the List<T> inside of a Thing<T>) is instantiated from the declaration it
+        // came from, that way instances never depend on other instances being filled in first
+        if (openType->genericDefinition != nullptr) {
+            openType = openType->genericDefinition;
+        }
+
         TempAllocator* tempAllocator = GetThreadLocalAllocator();
         TempAllocator::ScopedMarker scopedMarker(tempAllocator);
 
@@ -285,7 +447,7 @@ namespace Alchemy::Compilation {
 
         size_t nameSize = nameIdx + 2;  // 2 for < >
         for (int32 i = 0; i < typeArguments.size; i++) {
-            nameSize += typeArguments[i].typeInfo->fullyQualifiedNameLength;
+            nameSize += typeArguments[i].GetTypeInfo()->fullyQualifiedNameLength;
             if (i != typeArguments.size - 1) {
                 nameSize += 1; // ,
             }
@@ -300,11 +462,11 @@ namespace Alchemy::Compilation {
         p += nameIdx;
         *p++ = '<';
         for (int32 i = 0; i < typeArguments.size; i++) {
-            TypeInfo* arg = typeArguments[i].typeInfo;
+            TypeInfo* arg = typeArguments[i].GetTypeInfo();
             memcpy(p, arg->fullyQualifiedName, arg->fullyQualifiedNameLength);
             p += arg->fullyQualifiedNameLength;
             if (i != typeArguments.size - 1) {
-                *p = ',';
+                *p++ = ',';
             }
         }
         *p++ = '>';
@@ -322,100 +484,346 @@ namespace Alchemy::Compilation {
             }
         }
 
-        size_t totalSize = sizeof(TypeInfo) +
-            openType->baseTypeCount * sizeof(TypeInfo*) +
-            openType->fieldCount * sizeof(FieldInfo) +
-            openType->propertyCount * sizeof(PropertyInfo) +
-            openType->methodCount * sizeof(MethodInfo) +
-            openType->indexerCount * sizeof(IndexerInfo) +
-            openType->constructorCount * sizeof(ConstructorInfo) +
-            openType->constraintCount * sizeof(GenericConstraint) +
-            openType->genericArgumentCount * sizeof(ResolvedType) +
-            (nameSize + 1) * sizeof(char);
+        TypeInfo* newType = CreateGenericInstance(openType, typeArguments, lookup);
 
-        uint8* memoryBlock = typeAllocator.Allocate<uint8>(totalSize);
+        // while types are still being resolved the open type's members & bases may be half written,
+        // the instance is filled in by FillGenericInstance once they are done
+        bool deferred = deferGenericInstances;
 
-        TypeInfo* newType = (TypeInfo*) (memoryBlock + nameSize + 1);
+        if (!deferred) {
+            FillGenericInstance(newType);
+        }
 
-        *newType = *openType;
+        {
+            std::unique_lock lock(mutex);
+            TypeInfo* retn = nullptr;
+            // in the time we took to create the type data, its possible another thread already created the type and registered it
+            if (TryResolve(lookup, &retn)) {
+                genericInstances.Free(newType);
+                return ResolvedType(retn);
+            }
 
-        newType->fullyQualifiedName = (char*) memoryBlock;
-        newType->fullyQualifiedNameLength = nameSize;
+            AddUnlocked(newType);
+            genericInstances.TrackUnlocked(newType);
 
-        memcpy(newType->fullyQualifiedName, tempNameLookup, nameSize + 1); // + 1 copies terminator
-        newType->typeName = newType->fullyQualifiedName + openType->GetNamespaceName().size + 2;
-        newType->typeNameLength = newType->fullyQualifiedNameLength - openType->GetNamespaceName().size - 2;
+            if (deferred) {
+                pendingInstances.Add(newType);
+            }
 
-        CheckedArray<ResolvedType> openGenerics = openType->GetGenericArguments();
-        CheckedArray<GenericReplacement> replacements(tempAllocator->AllocateUncleared<GenericReplacement>(typeArguments.size), typeArguments.size);
+            return ResolvedType(newType);
 
-        for (int32 i = 0; i < typeArguments.size; i++) {
-            replacements[i].genericName = openGenerics[i].typeInfo->GetTypeName();
-            replacements[i].resolvedGeneric = typeArguments[i];
         }
 
-        for (int32 i = 0; i < newType->genericArgumentCount; i++) {
-            newType->genericArguments[i] = typeArguments[i];
+    }
+
+    void TypeResolutionMap::FillGenericInstance(TypeInfo* newType) {
+
+        TypeInfo* openType = newType->genericDefinition;
+
+        assert(openType != nullptr);
+
+        TempAllocator* tempAllocator = GetThreadLocalAllocator();
+        TempAllocator::ScopedMarker scopedMarker(tempAllocator);
+
+        GenericInstanceLayout layout(openType, newType->fullyQualifiedNameLength);
+
+        CheckedArray<ResolvedType> openGenerics = openType->GetGenericArguments();
+        CheckedArray<GenericReplacement> replacements(tempAllocator->AllocateUncleared<GenericReplacement>(openGenerics.size), openGenerics.size);
+
+        for (int32 i = 0; i < openGenerics.size; i++) {
+            replacements[i].genericName = openGenerics[i].GetTypeInfo()->GetTypeName();
+            replacements[i].resolvedGeneric = newType->genericArguments[i];
         }
 
         for (int32 i = 0; i < openType->baseTypeCount; i++) {
-            newType->baseTypes[i] = RecursiveResolveGenerics(ResolvedType(openType->baseTypes[i]), replacements, typeAllocator);
+            newType->baseTypes[i] = RecursiveResolveGenerics(ResolvedType(openType->baseTypes[i]), replacements);
         }
 
         for (int32 i = 0; i < openType->fieldCount; i++) {
             newType->fields[i] = openType->fields[i];
             newType->fields[i].declaringType = newType;
-            newType->fields[i].type = RecursiveResolveGenerics(newType->fields[i].type, replacements, typeAllocator);
+            newType->fields[i].type = RecursiveResolveGenerics(newType->fields[i].type, replacements);
         }
 
         for (int32 i = 0; i < openType->propertyCount; i++) {
             newType->properties[i] = openType->properties[i];
             newType->properties[i].declaringType = newType;
-            newType->properties[i].type = RecursiveResolveGenerics(newType->properties[i].type, replacements, typeAllocator);
+            newType->properties[i].type = RecursiveResolveGenerics(newType->properties[i].type, replacements);
         }
 
+        ParameterInfo* parameters = (ParameterInfo*) (((uint8*) newType) + layout.parameterOffset);
+
         for (int32 i = 0; i < openType->methodCount; i++) {
-            newType->methods[i] = openType->methods[i];
+            // MethodInfo isn't copy assignable (isEnqueued is atomic), the block is zeroed so isEnqueued starts false
             MethodInfo* methodInfo = &newType->methods[i];
+            MethodInfo* openMethod = &openType->methods[i];
             methodInfo->declaringType = newType;
-            methodInfo->returnType = RecursiveResolveGenerics(openType->methods[i].returnType, replacements, typeAllocator);
+            methodInfo->syntaxNode = openMethod->syntaxNode;
+            methodInfo->name = openMethod->name;
+            methodInfo->parameterCount = openMethod->parameterCount;
+            methodInfo->isDefaultParameterOverload = openMethod->isDefaultParameterOverload;
+            methodInfo->visibility = openMethod->visibility;
+            methodInfo->modifiers = openMethod->modifiers;
+            methodInfo->returnType = RecursiveResolveGenerics(openMethod->returnType, replacements);
+            methodInfo->parameters = parameters;
+            parameters += openMethod->parameterCount;
 
             for (int32 paramIndex = 0; paramIndex < methodInfo->parameterCount; paramIndex++) {
-                methodInfo->parameters[paramIndex] = openType->methods[i].parameters[paramIndex];
-                methodInfo->parameters[paramIndex].type = RecursiveResolveGenerics(methodInfo->parameters[paramIndex].type, replacements, typeAllocator);
+                methodInfo->parameters[paramIndex] = openMethod->parameters[paramIndex];
+                methodInfo->parameters[paramIndex].type = RecursiveResolveGenerics(methodInfo->parameters[paramIndex].type, replacements);
             }
 
         }
 
-        // todo -- not sure this is true, we may need to check that all of our type args are actually concrete now
-        bool isFullyConcrete = true;
-        for (int32 i = 0; i < newType->genericArgumentCount; i++) {
-            if ((newType->genericArguments[i].typeInfo->flags & TypeInfoFlags::IsGenericArgumentDefinition) != 0) {
-                isFullyConcrete = false;
-                break;
+    }
+
+    CheckedArray<TypeInfo*> TypeResolutionMap::TakePendingInstances(Allocator allocator) {
+        std::unique_lock lock(mutex);
+        CheckedArray<TypeInfo*> retn(allocator.AllocateUncleared<TypeInfo*>(pendingInstances.size), pendingInstances.size);
+        memcpy(retn.array, pendingInstances.array, sizeof(TypeInfo*) * pendingInstances.size);
+        pendingInstances.size = 0;
+        return retn;
+    }
+
+    int32 TypeResolutionMap::RebuildKeptInstances() {
+
+        CheckedArray<TypeInfo*> instances = genericInstances.GetInstancesUnlocked();
+
+        int32 lostCount = 0;
+
+        for (int32 i = 0; i < instances.size; i++) {
+
+            TypeInfo* instance = instances[i];
+            SourceFileInfo* declaringFile = instance->declaringFile;
+
+            if (declaringFile == nullptr || !declaringFile->wasChanged || !declaringFile->keepsTypeIds) {
+                continue;
+            }
+
+            // the old declaration lived in the released slab, the new one goes by the same name
+            FixedCharSpan name = instance->GetFullyQualifiedTypeName();
+            FixedCharSpan definitionName = name;
+            for (size_t c = 0; c < name.size; c++) {
+                if (name.ptr[c] == '<') {
+                    definitionName = FixedCharSpan(name.ptr, c);
+                    break;
+                }
+            }
+
+            TypeInfo* openType = nullptr;
+            for (int32 d = 0; d < declaringFile->declaredTypes.size; d++) {
+                TypeInfo* declaredType = declaringFile->declaredTypes[d];
+                if (declaredType->IsGenericTypeDefinition() && declaredType->GetFullyQualifiedTypeName() == definitionName) {
+                    openType = declaredType;
+                    break;
+                }
+            }
+
+            // an argument declared in the same file can go away with it
+            bool argumentsLive = openType != nullptr;
+            for (int32 a = 0; argumentsLive && a < instance->genericArgumentCount; a++) {
+                argumentsLive = instance->genericArguments[a].GetTypeInfo() != nullptr;
             }
+
+            if (!argumentsLive) {
+                // swept by the next RemoveDeadTypes, whoever used it can't resolve its declaration anymore and relinks
+                instance->genericDefinition = nullptr;
+                lostCount++;
+                continue;
+            }
+
+            TypeInfo* replacement = CreateGenericInstance(openType, instance->GetGenericArguments(), name);
+
+            TypeId typeId = instance->typeId;
+            table->Retire(instance);
+            table->Reuse(typeId, replacement);
+            table->SetOwner(typeId, tableOwner);
+
+            if (instance->memberTable != nullptr) {
+                genericInstances.Free(instance->memberTable);
+            }
+
+            genericInstances.Free(instance);
+            instances[i] = replacement;
+
+            // the new declaration isn't resolved yet
+            pendingInstances.Add(replacement);
+
         }
 
-        if (isFullyConcrete) {
-            newType->flags &= ~TypeInfoFlags::IsGenericTypeDefinition;
-            newType->flags |= TypeInfoFlags::InstantiatedGeneric;
+        return lostCount;
+
+    }
+
+    void TypeResolutionMap::RefillInstancesOfRelinkedFiles() {
+
+        CheckedArray<TypeInfo*> instances = genericInstances.GetInstancesUnlocked();
+
+        int32 pendingCount = pendingInstances.size;
+
+        for (int32 i = 0; i < instances.size; i++) {
+
+            TypeInfo* instance = instances[i];
+
+            if (instance->declaringFile == nullptr || !instance->declaringFile->needsRelink) {
+                continue;
+            }
+
+            bool isPending = false;
+            for (int32 p = 0; p < pendingCount; p++) {
+                if (pendingInstances[p] == instance) {
+                    isPending = true;
+                    break;
+                }
+            }
+
+            if (!isPending) {
+                pendingInstances.Add(instance);
+            }
+
         }
 
-        {
-            std::unique_lock lock(mutex);
-            TypeInfo* retn = nullptr;
-            // in the time we took to create the type data, its possible another thread already created the type and registered it
-            if (TryResolve(lookup, &retn)) {
-                typeAllocator.Free(newType);
-                return ResolvedType(retn);
+    }
+
+    static bool IsDeadFile(SourceFileInfo* fileInfo) {
+        // synthesized types (void, unresolved) have no declaring file and never die
+        return fileInfo != nullptr && (fileInfo->wasChanged || !fileInfo->wasTouched);
+    }
+
+    bool TypeResolutionMap::IsLiveGenericInstance(TypeInfo* instance) {
+
+        SourceFileInfo* declaringFile = instance->declaringFile;
+
+        // its declaration went away when the file was re-parsed, see RebuildKeptInstances
+        if (instance->genericDefinition == nullptr) {
+            return false;
+        }
+
+        // an instance copied its members from the open type, if that type is about to be re-resolved the copies are
+        // stale. a re-parsed file that keeps its ids builds its instances again under the same ids instead
+        if ((IsDeadFile(declaringFile) && !declaringFile->keepsTypeIds) || (declaringFile != nullptr && declaringFile->needsRelink)) {
+            return false;
+        }
+
+        for (int32 i = 0; i < instance->genericArgumentCount; i++) {
+            TypeInfo* argument = instance->genericArguments[i].GetTypeInfo();
+
+            // a retired id, the type went away when its file was re-parsed
+            if (argument == nullptr) {
+                if (instance->genericArguments[i].typeId != kInvalidTypeId) {
+                    return false;
+                }
+                continue;
             }
 
-            AddUnlocked(newType);
-            openType->declaringFile->genericInstances.Add(newType);
-            return ResolvedType(newType);
+            if (argument->IsGenericInstance()) {
+                if (!IsLiveGenericInstance(argument)) {
+                    return false;
+                }
+                continue;
+            }
+
+            // a re-parsed file that keeps its ids hands them to the new types, the arguments still mean the same
+            if (IsDeadFile(argument->declaringFile) && !argument->declaringFile->keepsTypeIds) {
+                return false;
+            }
+
+        }
+
+        return true;
+
+    }
+
+    void TypeResolutionMap::MarkGenericInstance(ResolvedType resolvedType) {
+
+        TypeInfo* typeInfo = resolvedType.GetTypeInfo();
+
+        if (typeInfo == nullptr || !typeInfo->IsGenericInstance()) {
+            return;
+        }
+
+        // an instance built over a dead type is unreachable by definition, whoever referenced it is being rebuilt
+        if (!IsLiveGenericInstance(typeInfo) || !genericInstances.Mark(typeInfo)) {
+            return;
+        }
+
+        MarkGenericReferences(typeInfo);
+
+    }
+
+    void TypeResolutionMap::MarkGenericReferences(TypeInfo* typeInfo) {
+
+        for (int32 i = 0; i < typeInfo->genericArgumentCount; i++) {
+            MarkGenericInstance(typeInfo->genericArguments[i]);
+        }
+
+        for (int32 i = 0; i < typeInfo->baseTypeCount; i++) {
+            MarkGenericInstance(typeInfo->baseTypes[i]);
+        }
 
+        for (int32 i = 0; i < typeInfo->fieldCount; i++) {
+            MarkGenericInstance(typeInfo->fields[i].type);
         }
 
+        for (int32 i = 0; i < typeInfo->propertyCount; i++) {
+            MarkGenericInstance(typeInfo->properties[i].type);
+        }
+
+        for (int32 i = 0; i < typeInfo->methodCount; i++) {
+            MethodInfo* methodInfo = &typeInfo->methods[i];
+            MarkGenericInstance(methodInfo->returnType);
+            for (int32 p = 0; p < methodInfo->parameterCount; p++) {
+                MarkGenericInstance(methodInfo->parameters[p].type);
+            }
+        }
+
+    }
+
+    int32 TypeResolutionMap::RemoveDeadTypes() {
+
+        TempAllocator* tempAllocator = GetThreadLocalAllocator();
+        TempAllocator::ScopedMarker scopedMarker(tempAllocator);
+
+        CheckedArray<TypeInfo*> typeInfos = GetValues(tempAllocator->MakeAllocator());
+        FixedPodList<TypeInfo*> list(tempAllocator->AllocateUncleared<TypeInfo*>(typeInfos.size), typeInfos.size);
+
+        // instances are pulled out too, they only go back in if a surviving type still references them
+        for (int32 i = 0; i < typeInfos.size; i++) {
+            TypeInfo* typeInfo = typeInfos[i];
+
+            if (!typeInfo->IsGenericInstance() && !IsDeadFile(typeInfo->declaringFile)) {
+                list.Add(typeInfo);
+            }
+
+        }
+
+        genericInstances.BeginMark();
+
+        int32 rootCount = list.size;
+        for (int32 i = 0; i < rootCount; i++) {
+            MarkGenericReferences(list[i]);
+        }
+
+        for (int32 i = 0; i < typeInfos.size; i++) {
+            TypeInfo* typeInfo = typeInfos[i];
+            if (typeInfo->IsGenericInstance() && genericInstances.IsMarked(typeInfo)) {
+                list.Add(typeInfo);
+            }
+        }
+
+        ReplaceValues(list.ToCheckedArray());
+
+        // instances waiting to be filled are swept like any other
+        int32 pendingWrite = 0;
+        for (int32 i = 0; i < pendingInstances.size; i++) {
+            if (genericInstances.IsMarked(pendingInstances[i])) {
+                pendingInstances[pendingWrite++] = pendingInstances[i];
+            }
+        }
+        pendingInstances.size = pendingWrite;
+
+        return genericInstances.Sweep();
+
     }
 
     struct TypeInfoPrinter {
@@ -476,8 +884,8 @@ namespace Alchemy::Compilation {
                 else if (resolvedType.IsVoid()) {
                     PrintInline("void");
                 }
-                else if (resolvedType.typeInfo != nullptr) {
-                    FixedCharSpan fqn = resolvedType.typeInfo->GetFullyQualifiedTypeName();
+                else if (resolvedType.typeId != kInvalidTypeId) {
+                    FixedCharSpan fqn = resolvedType.GetTypeInfo()->GetFullyQualifiedTypeName();
                     PrintInline(fqn);
                 }
                 else {
@@ -499,12 +907,12 @@ namespace Alchemy::Compilation {
             else if (resolvedType.IsVoid()) {
                 PrintInline("void");
             }
-            else if (resolvedType.typeInfo != nullptr) {
-                if (resolvedType.typeInfo->IsBuiltIn()) {
-                    PrintInline(resolvedType.typeInfo->GetSimpleTypeName());
+            else if (resolvedType.typeId != kInvalidTypeId) {
+                if (resolvedType.GetTypeInfo()->IsBuiltIn()) {
+                    PrintInline(resolvedType.GetTypeInfo()->GetSimpleTypeName());
                 }
                 else {
-                    PrintInline(resolvedType.typeInfo->GetFullyQualifiedTypeName());
+                    PrintInline(resolvedType.GetTypeInfo()->GetFullyQualifiedTypeName());
                 }
             }
             else {
@@ -516,7 +924,7 @@ namespace Alchemy::Compilation {
         void RecurseBaseTypeFields(TypeInfo* pInfo) {
 
             if (pInfo->baseTypeCount > 0 && pInfo->baseTypes[0].IsClass()) {
-                TypeInfo* base = pInfo->baseTypes[0].typeInfo;
+                TypeInfo* base = pInfo->baseTypes[0].GetTypeInfo();
                 for (int32 i = 0; i < base->fieldCount; i++) {
                     FieldInfo* fieldInfo = &base->fields[i];
                     PrintTypes(1, &fieldInfo->type, [](TypeInfoPrinter* printer, void* cookie) {
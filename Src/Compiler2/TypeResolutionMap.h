@@ -4,6 +4,8 @@
 #include "./TypeInfo.h"
 #include "../Util/Hash.h"
 #include "./ResolvedType.h"
+#include "./GenericInstanceArena.h"
+#include "./TypeTable.h"
 #include <mutex>
 
 namespace Alchemy::Compilation {
@@ -17,6 +19,8 @@ namespace Alchemy::Compilation {
 
         explicit TypeResolutionMap(Allocator allocator);
 
+        ~TypeResolutionMap();
+
         bool AddUnlocked(TypeInfo * typeInfo);
         bool AddLocked(TypeInfo * typeInfo);
 
@@ -28,33 +32,74 @@ namespace Alchemy::Compilation {
 
         bool TryResolve(FixedCharSpan span, TypeInfo** pInfo);
 
-        ResolvedType MakeGenericType(TypeInfo* openType, CheckedArray <ResolvedType> typeArguments, Allocator typeAllocator);
+        ResolvedType MakeGenericType(TypeInfo* openType, CheckedArray <ResolvedType> typeArguments);
+
+        // copies the open type's bases & members into an instance, substituting the type arguments
+        void FillGenericInstance(TypeInfo* instance);
+
+        // instances created while deferGenericInstances was set, they still need FillGenericInstance. clears the list
+        CheckedArray<TypeInfo*> TakePendingInstances(Allocator allocator);
+
+        // drops types declared in changed or removed files and sweeps generic instances that are no longer
+        // reachable from a surviving type. must run before the dead files are invalidated. returns the swept instance count
+        int32 RemoveDeadTypes();
+
+        // instances of generic types declared in a re-parsed file that kept its ids are built again from the new
+        // declaration under the same id and filled with the pending ones. the ones whose declaration went away are
+        // left for RemoveDeadTypes, returns how many of those there were
+        int32 RebuildKeptInstances();
+
+        // instances of files relinked after the fact copied members that were just resolved again, they get filled
+        // again in place with the pending ones
+        void RefillInstancesOfRelinkedFiles();
 
         CheckedArray<TypeInfo*> builtInTypeInfos;
 
         TypeInfo * unresolvedType;
         TypeInfo * voidType;
 
+        GenericInstanceArena genericInstances;
+
+        // the process wide table, the hash slots below hold ids into it
+        TypeTable* table;
+
+        // marks the table rows of the types this map resolves
+        uint16 tableOwner;
+
+        // set while member & base types are being resolved in parallel
+        bool deferGenericInstances;
+
         FixedCharSpan DumpTypeTable(Allocator dumpAllocator);
 
 
         CheckedArray<TypeInfo*> GetConcreteTypes(Allocator alloc);
 
+        CheckedArray<TypeId> GetConcreteTypeIds(Allocator alloc);
+
     private:
 
         Allocator allocator;
-        CheckedArray<TypeInfo*> values;
+        CheckedArray<TypeId> values;
         std::mutex mutex;
         int32 exponent;
         int32 size;
         int32 longestEntrySize;
+        PodList<TypeInfo*> pendingInstances;
 
         void ResizeTable();
 
         // returns true if added, existing entries are not overridden
         bool AddInternal(TypeInfo* typeInfo);
 
-        ResolvedType RecursiveResolveGenerics(ResolvedType input, CheckedArray<GenericReplacement> replacements, Allocator & alloc);
+        TypeInfo* CreateGenericInstance(TypeInfo* openType, CheckedArray<ResolvedType> typeArguments, FixedCharSpan name);
+
+        ResolvedType RecursiveResolveGenerics(ResolvedType input, CheckedArray<GenericReplacement> replacements);
+
+        bool IsLiveGenericInstance(TypeInfo* instance);
+
+        void MarkGenericInstance(ResolvedType resolvedType);
+
+        void MarkGenericReferences(TypeInfo* typeInfo);
 
     };
 
@@ -9,6 +9,7 @@ namespace Alchemy::Compilation {
         : file(file)
         , resolutionMap(resolutionMap)
         , supressDiagnostics(false)
+        , recordDependencies(false)
         , inputGenericArguments() {}
 
     bool TypeResolver::TryResolveGenericName(GenericNameSyntax* genericNameSyntax, ResolvedType* resolvedType) {
@@ -54,6 +55,10 @@ namespace Alchemy::Compilation {
         }
         else {
 
+            if (recordDependencies) {
+                file->AddTypeDependency(value);
+            }
+
             // found it. lets see if it's arguments are concrete or not
             ResolvedType* generics = tempAllocator->AllocateUncleared<ResolvedType>(genericCount);
 
@@ -71,7 +76,7 @@ namespace Alchemy::Compilation {
                 }
             }
 
-            *resolvedType = resolutionMap->MakeGenericType(value, CheckedArray<ResolvedType>(generics, genericCount), file->GetLockedAllocator());
+            *resolvedType = resolutionMap->MakeGenericType(value, CheckedArray<ResolvedType>(generics, genericCount));
 
             return true;
 
@@ -128,6 +133,9 @@ namespace Alchemy::Compilation {
         }
         else {
 
+            if (recordDependencies) {
+                file->AddTypeDependency(value);
+            }
 
             *resolvedType = ResolvedType(value);
             return true;
@@ -149,7 +157,7 @@ namespace Alchemy::Compilation {
                 RefTypeSyntax* refTypeSyntax = (RefTypeSyntax*) typeSyntax;
                 ResolvedType r;
                 if (TryResolveType(refTypeSyntax->type, &r)) {
-                    *resolvedType = ResolvedType(r.typeInfo, ResolvedTypeFlags::IsRef | r.resolvedTypeFlags);
+                    *resolvedType = ResolvedType(r.GetTypeInfo(), ResolvedTypeFlags::IsRef | r.resolvedTypeFlags);
                     return true;
                 }
                 return false;
@@ -159,7 +167,7 @@ namespace Alchemy::Compilation {
                 NullableTypeSyntax* pNullableTypeSyntax = (NullableTypeSyntax*) typeSyntax;
 
                 if (TryResolveType(pNullableTypeSyntax->elementType, &r)) {
-                    *resolvedType = ResolvedType(r.typeInfo, ResolvedTypeFlags::IsNullable | r.resolvedTypeFlags);
+                    *resolvedType = ResolvedType(r.GetTypeInfo(), ResolvedTypeFlags::IsNullable | r.resolvedTypeFlags);
                     return true;
                 }
 
@@ -16,6 +16,7 @@ namespace Alchemy::Compilation {
         CheckedArray<TypeInfo*> inputGenericArguments;
         TypeResolutionMap* resolutionMap;
         bool supressDiagnostics;
+        bool recordDependencies; // only safe when the resolving job is the only one touching `file`
 
         TypeResolver(SourceFileInfo* file, TypeResolutionMap* resolutionMap);
 
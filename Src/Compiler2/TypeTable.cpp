@@ -0,0 +1,215 @@
+#include "./TypeTable.h"
+#include "../Panic.h"
+#include "../Util/Hash.h"
+
+namespace Alchemy::Compilation {
+
+    TypeTable::TypeTable()
+        : blocks(MallocateTyped(TypeTableBlock*, kMaxBlocks))
+        , liveCount(0)
+        , nextId(1)
+        , freeIds()
+        , freeOwners()
+        , nextOwner(kNoTypeOwner + 1)
+        , mutex() {}
+
+    TypeTable::~TypeTable() {
+        for (int32 i = 0; i < kMaxBlocks && blocks[i] != nullptr; i++) {
+            MfreeTyped(blocks[i], 1);
+        }
+        MfreeTyped(blocks, kMaxBlocks);
+    }
+
+    TypeId TypeTable::Add(TypeInfo* typeInfo) {
+
+        uint32 nameHash = (uint32) MsiHash::FNV1a(typeInfo->GetFullyQualifiedTypeName());
+
+        std::unique_lock lock(mutex);
+
+        TypeId typeId;
+
+        // recycled ids keep the columns dense after generic instances get swept
+        if (freeIds.size != 0) {
+            typeId = freeIds.Pop();
+        }
+        else {
+            typeId = nextId.load(std::memory_order_relaxed);
+
+            if ((typeId & (TypeTableBlock::kSize - 1)) == 0 || typeId == 1) {
+                if ((int32) (typeId >> kBlockShift) == kMaxBlocks) {
+                    Panic(PanicType::NotSupported, nullptr);
+                }
+                blocks[typeId >> kBlockShift] = MallocateTyped(TypeTableBlock, 1);
+            }
+        }
+
+        TypeTableBlock* block = blocks[typeId >> kBlockShift];
+        block->nameHashes[Slot(typeId)] = nameHash;
+        block->owners[Slot(typeId)] = kNoTypeOwner;
+
+        Store(typeId, typeInfo);
+
+        typeInfo->typeId = typeId;
+        liveCount.fetch_add(1, std::memory_order_relaxed);
+
+        // the row is written before readers can see the new limit
+        if (typeId == nextId.load(std::memory_order_relaxed)) {
+            nextId.store(typeId + 1, std::memory_order_release);
+        }
+
+        return typeId;
+
+    }
+
+    void TypeTable::Remove(TypeId typeId) {
+        std::unique_lock lock(mutex);
+        RemoveUnlocked(typeId);
+    }
+
+    void TypeTable::RemoveIfRegistered(TypeInfo* typeInfo) {
+
+        TypeId typeId = typeInfo->typeId;
+
+        if (typeId == kInvalidTypeId) {
+            return;
+        }
+
+        std::unique_lock lock(mutex);
+
+        if (GetTypeInfo(typeId) == typeInfo) {
+            RemoveUnlocked(typeId);
+        }
+
+    }
+
+    bool TypeTable::Retire(TypeInfo* typeInfo) {
+
+        TypeId typeId = typeInfo->typeId;
+
+        if (typeId == kInvalidTypeId) {
+            return false;
+        }
+
+        std::unique_lock lock(mutex);
+
+        if (GetTypeInfo(typeId) != typeInfo) {
+            return false;
+        }
+
+        TypeTableBlock* block = Block(typeId);
+        int32 slot = Slot(typeId);
+
+        block->typeInfos[slot] = nullptr;
+        block->owners[slot] = kNoTypeOwner;
+        block->flags[slot] = TypeInfoFlags::None;
+
+        liveCount.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+
+    }
+
+    void TypeTable::Reuse(TypeId typeId, TypeInfo* typeInfo) {
+
+        uint32 nameHash = (uint32) MsiHash::FNV1a(typeInfo->GetFullyQualifiedTypeName());
+
+        std::unique_lock lock(mutex);
+
+        assert(GetTypeInfo(typeId) == nullptr);
+
+        TypeTableBlock* block = Block(typeId);
+        block->nameHashes[Slot(typeId)] = nameHash;
+        block->owners[Slot(typeId)] = kNoTypeOwner;
+
+        Store(typeId, typeInfo);
+
+        typeInfo->typeId = typeId;
+        liveCount.fetch_add(1, std::memory_order_relaxed);
+
+    }
+
+    void TypeTable::Release(TypeId typeId) {
+        std::unique_lock lock(mutex);
+        assert(GetTypeInfo(typeId) == nullptr);
+        freeIds.Add(typeId);
+    }
+
+    void TypeTable::RemoveUnlocked(TypeId typeId) {
+
+        TypeTableBlock* block = Block(typeId);
+        int32 slot = Slot(typeId);
+
+        assert(block->typeInfos[slot] != nullptr);
+
+        // scans match on the owner column, a free row never has one
+        block->typeInfos[slot] = nullptr;
+        block->owners[slot] = kNoTypeOwner;
+        block->flags[slot] = TypeInfoFlags::None;
+
+        freeIds.Add(typeId);
+        liveCount.fetch_sub(1, std::memory_order_relaxed);
+
+    }
+
+    void TypeTable::SetOwner(TypeId typeId, uint16 owner) {
+        std::unique_lock lock(mutex);
+        assert(GetTypeInfo(typeId) != nullptr);
+        Block(typeId)->owners[Slot(typeId)] = owner;
+    }
+
+    void TypeTable::Refresh(TypeId typeId) {
+        std::unique_lock lock(mutex);
+        Store(typeId, GetTypeInfo(typeId));
+    }
+
+    uint16 TypeTable::AcquireOwner() {
+
+        std::unique_lock lock(mutex);
+
+        if (freeOwners.size != 0) {
+            return freeOwners.Pop();
+        }
+
+        if (nextOwner == 0xffff) {
+            Panic(PanicType::NotSupported, nullptr);
+        }
+
+        return nextOwner++;
+
+    }
+
+    void TypeTable::ReleaseOwner(uint16 owner) {
+
+        std::unique_lock lock(mutex);
+
+        TypeId limit = GetIdLimit();
+
+        for (TypeId typeId = 1; typeId < limit; typeId++) {
+            if (Block(typeId)->owners[Slot(typeId)] == owner) {
+                RemoveUnlocked(typeId);
+            }
+        }
+
+        freeOwners.Add(owner);
+
+    }
+
+    void TypeTable::Store(TypeId typeId, TypeInfo* typeInfo) {
+
+        TypeTableBlock* block = blocks[typeId >> kBlockShift];
+        int32 slot = Slot(typeId);
+
+        block->typeInfos[slot] = typeInfo;
+        block->baseTypes[slot] = typeInfo->baseTypes;
+        block->names[slot] = typeInfo->fullyQualifiedName;
+        block->flags[slot] = typeInfo->flags;
+        block->nameLengths[slot] = typeInfo->fullyQualifiedNameLength;
+        block->baseTypeCounts[slot] = typeInfo->baseTypeCount;
+        block->fieldCounts[slot] = typeInfo->fieldCount;
+        block->methodCounts[slot] = typeInfo->methodCount;
+        block->propertyCounts[slot] = typeInfo->propertyCount;
+        block->genericArgumentCounts[slot] = typeInfo->genericArgumentCount;
+        block->typeClasses[slot] = typeInfo->typeClass;
+
+    }
+
+}
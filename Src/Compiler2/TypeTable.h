@@ -0,0 +1,179 @@
+#pragma once
+
+#include "../PrimitiveTypes.h"
+#include "../Collections/PodList.h"
+#include "../Collections/CheckedArray.h"
+#include "../Util/FixedCharSpan.h"
+#include "./TypeInfo.h"
+#include <mutex>
+#include <atomic>
+
+namespace Alchemy::Compilation {
+
+    // index of a type in the TypeTable, 0 is never handed out so a TypeInfo with typeId 0 isn't registered
+    typedef uint32 TypeId;
+
+    constexpr TypeId kInvalidTypeId = 0;
+
+    // rows that don't belong to any resolution map, registered but not (or no longer) resolvable by name
+    constexpr uint16 kNoTypeOwner = 0;
+
+    struct TypeTableBlock {
+
+        static constexpr int32 kSize = 1024;
+
+        TypeInfo* typeInfos[kSize]; // nullptr for ids that are free
+        ResolvedType* baseTypes[kSize];
+        char* names[kSize];
+        uint32 nameHashes[kSize];
+        TypeInfoFlags flags[kSize];
+        uint16 owners[kSize];
+        uint16 nameLengths[kSize];
+        uint16 baseTypeCounts[kSize];
+        uint16 fieldCounts[kSize];
+        uint16 methodCounts[kSize];
+        uint16 propertyCounts[kSize];
+        uint16 genericArgumentCounts[kSize];
+        TypeClass typeClasses[kSize];
+
+    };
+
+    // Every TypeInfo a ResolvedType can point at gets a TypeId here, this is what lets ResolvedType be a 32 bit
+    // handle instead of a pointer. Next to the TypeInfo pointer the table keeps the fields whole program passes
+    // filter on, column wise, so a scan over every type reads a couple of bytes per type instead of pulling in a
+    // whole TypeInfo. TypeInfo stays the cold view and the source of truth, columns are copied when a type is
+    // added and whoever changes one of those fields on a registered TypeInfo has to call Refresh.
+    // There is one table per process. Each resolution map owns the rows of the types it resolves by name and only
+    // scans those. Whoever frees a TypeInfo removes its row: files for their declared types, the generic instance
+    // arena for instances. Ids live in fixed size blocks that never move, looking up a live id is safe from any
+    // thread while others add or remove rows.
+    struct TypeTable {
+
+        static constexpr int32 kBlockShift = 10;
+        static constexpr int32 kMaxBlocks = 4096; // 4m types
+
+        static_assert((1 << kBlockShift) == TypeTableBlock::kSize);
+
+        TypeTable();
+
+        ~TypeTable();
+
+        TypeTable(const TypeTable&) = delete;
+        TypeTable& operator=(const TypeTable&) = delete;
+
+        // sets typeInfo->typeId, the row starts out without an owner
+        TypeId Add(TypeInfo* typeInfo);
+
+        void Remove(TypeId typeId);
+
+        // removes the row if the id still belongs to this TypeInfo, no-op for types that were never added
+        void RemoveIfRegistered(TypeInfo* typeInfo);
+
+        // like RemoveIfRegistered, but the id doesn't go back on the free list. the row reads as free until the id
+        // is handed to a replacement with Reuse or given up with Release
+        bool Retire(TypeInfo* typeInfo);
+
+        void Reuse(TypeId typeId, TypeInfo* typeInfo);
+
+        void Release(TypeId typeId);
+
+        void SetOwner(TypeId typeId, uint16 owner);
+
+        // re-reads the hot columns from the TypeInfo
+        void Refresh(TypeId typeId);
+
+        uint16 AcquireOwner();
+
+        // removes every row the owner still has
+        void ReleaseOwner(uint16 owner);
+
+        int32 GetCount() {
+            return liveCount.load(std::memory_order_relaxed);
+        }
+
+        // one past the highest id handed out so far, scans walk [1, GetIdLimit())
+        TypeId GetIdLimit() {
+            return nextId.load(std::memory_order_acquire);
+        }
+
+        int32 GetBlockCount() {
+            return (int32) ((GetIdLimit() + TypeTableBlock::kSize - 1) >> kBlockShift);
+        }
+
+        TypeTableBlock* GetBlock(int32 index) {
+            assert(index >= 0 && index < GetBlockCount());
+            return blocks[index];
+        }
+
+        inline TypeInfo* GetTypeInfo(TypeId typeId) {
+            return Block(typeId)->typeInfos[Slot(typeId)];
+        }
+
+        inline TypeInfoFlags GetFlags(TypeId typeId) {
+            return Block(typeId)->flags[Slot(typeId)];
+        }
+
+        inline TypeClass GetTypeClass(TypeId typeId) {
+            return Block(typeId)->typeClasses[Slot(typeId)];
+        }
+
+        inline uint16 GetOwner(TypeId typeId) {
+            return Block(typeId)->owners[Slot(typeId)];
+        }
+
+        inline uint32 GetNameHash(TypeId typeId) {
+            return Block(typeId)->nameHashes[Slot(typeId)];
+        }
+
+        inline FixedCharSpan GetFullyQualifiedName(TypeId typeId) {
+            TypeTableBlock* block = Block(typeId);
+            return FixedCharSpan(block->names[Slot(typeId)], block->nameLengths[Slot(typeId)]);
+        }
+
+        inline ResolvedType* GetBaseTypes(TypeId typeId) {
+            return Block(typeId)->baseTypes[Slot(typeId)];
+        }
+
+        inline int32 GetBaseTypeCount(TypeId typeId) {
+            return Block(typeId)->baseTypeCounts[Slot(typeId)];
+        }
+
+        inline int32 GetMethodCount(TypeId typeId) {
+            return Block(typeId)->methodCounts[Slot(typeId)];
+        }
+
+        inline int32 GetFieldCount(TypeId typeId) {
+            return Block(typeId)->fieldCounts[Slot(typeId)];
+        }
+
+    private:
+
+        TypeTableBlock** blocks;
+        std::atomic<int32> liveCount;
+        std::atomic<TypeId> nextId;
+        PodList<TypeId> freeIds;
+        PodList<uint16> freeOwners;
+        uint16 nextOwner;
+        std::mutex mutex;
+
+        inline TypeTableBlock* Block(TypeId typeId) {
+            assert(typeId != kInvalidTypeId && typeId < GetIdLimit());
+            return blocks[typeId >> kBlockShift];
+        }
+
+        static inline int32 Slot(TypeId typeId) {
+            return (int32) (typeId & (TypeTableBlock::kSize - 1));
+        }
+
+        void Store(TypeId typeId, TypeInfo* typeInfo);
+
+        void RemoveUnlocked(TypeId typeId);
+
+    };
+
+    inline TypeTable* GetTypeTable() {
+        static TypeTable table;
+        return &table;
+    }
+
+}
@@ -1,5 +1,7 @@
 #include "./Job.h"
 #include "./Worker.h"
+#include "../Util/Stopwatch.h"
+#include "../Allocation/ThreadLocalTemp.h"
 
 namespace Alchemy::Jobs {
 
@@ -38,6 +40,31 @@ namespace Alchemy::Jobs {
         assert(scheduledJobs.size == 0);
         jobAllocator.Clear();
         allocator.Clear();
+        allocator.EndRun();
+
+        // the worker is idle between executions, its thread local allocator only holds what outlives a job
+        TempAllocator* threadTemp = threadAllocator.load(std::memory_order_acquire);
+        assert(threadTemp == nullptr || threadTemp == GetThreadLocalAllocator());
+        if (threadTemp != nullptr) {
+            threadTemp->EndRun();
+        }
+    }
+
+    WorkerStats Worker::GetStats() {
+        WorkerStats stats {};
+        stats.workerId = workerId;
+        stats.jobsExecuted = jobsExecuted;
+        stats.busyNanoseconds = busyNanoseconds.load(std::memory_order_acquire);
+#if ALCHEMY_PERF_COUNTERS != 0
+        stats.perfCounters = perfCounterTotals;
+        stats.perfCounterMask = perfCounters.availableMask;
+#endif
+        stats.jobTemp = allocator.GetRunStats();
+        TempAllocator* threadTemp = threadAllocator.load(std::memory_order_acquire);
+        if (threadTemp != nullptr) {
+            stats.threadTemp = threadTemp->GetRunStats();
+        }
+        return stats;
     }
 
     bool Worker::IsPrimary() {
@@ -86,6 +113,8 @@ namespace Alchemy::Jobs {
 
     void Worker::JobLoop() {
 
+        uint64 loopStart = GetTimestampNanoseconds();
+
         for (int32 i = 0; i < 10; i++) {
 
             IJobBase* job;
@@ -98,6 +127,13 @@ namespace Alchemy::Jobs {
 
                 job->worker = this;
                 job->state = IJobBase::State::Running;
+                jobsExecuted++;
+
+                if (jobDepth++ == 0) {
+                    outerJobStart = loopStart;
+                    outerJobIdleStart = idleSpinNanoseconds;
+                    PERF_COUNTERS(perfCounters.Read(&outerJobCounters));
+                }
 
                 TempAllocator::Marker m = allocator.Mark();
 
@@ -147,6 +183,17 @@ namespace Alchemy::Jobs {
 
                 }
 
+                if (--jobDepth == 0) {
+#if ALCHEMY_PERF_COUNTERS != 0
+                    PerfCounterValues outerJobEnd;
+                    perfCounters.Read(&outerJobEnd);
+                    perfCounterTotals.Add(outerJobCounters, outerJobEnd);
+#endif
+                    uint64 elapsed = GetTimestampNanoseconds() - outerJobStart - (idleSpinNanoseconds - outerJobIdleStart);
+                    // before the job completes, whoever awaited it reads this once it sees the state change
+                    busyNanoseconds.store(busyNanoseconds.load(std::memory_order_relaxed) + elapsed, std::memory_order_release);
+                }
+
                 job->state = IJobBase::State::Completed;
 
                 scheduledJobs.size = scheduleThreshold;
@@ -160,8 +207,12 @@ namespace Alchemy::Jobs {
 
         if (!IsPrimary()) {
             // make 10 attempts to get a job, then sleep if we still don't have one, only workers should do this
-            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            // EndRun wakes us early, otherwise every Execute waits out the sleep of whoever ran out of jobs last
+            std::unique_lock lock(waitForWorkMtx);
+            waitForWorkCV.wait_for(lock, std::chrono::milliseconds(1), [&] { return !workInSystem.load(std::memory_order_acquire); });
         }
+
+        idleSpinNanoseconds += GetTimestampNanoseconds() - loopStart;
     }
 
     void Worker::Await(JobHandle handle) {
@@ -209,20 +260,34 @@ namespace Alchemy::Jobs {
 
     void Worker::WorkerLoop() {
 
-        while (!shuttingDown) {
-            // if no active work, block
-            if (!workInSystem) {
+        uint32 lastRun = 0;
+
+        while (true) {
+
+            uint32 run;
+
+            // a run can start and end before we get to look, so wait for one we haven't finished, not for work
+            {
                 std::unique_lock lock(waitForWorkMtx);
-                waitForWorkCV.wait(lock, [&] { return shuttingDown || workInSystem; });
+                waitForWorkCV.wait(lock, [&] { return shuttingDown || runId != lastRun; });
 
                 if (shuttingDown) {
                     return;
                 }
 
+                run = runId;
             }
 
-            JobLoop();
+            while (workInSystem.load(std::memory_order_acquire)) {
+                JobLoop();
+            }
+
+            Reset();
+            lastRun = run;
+            finishedRun.store(run, std::memory_order_release);
+
         }
+
     }
 
     int32 Worker::CalculateBatches(int32 count, int32 batchSize) {
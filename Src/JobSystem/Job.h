@@ -1,4 +1,5 @@
 #pragma once
+#include <atomic>
 #include "../PrimitiveTypes.h"
 
 namespace Alchemy::Jobs {
@@ -66,7 +67,8 @@ namespace Alchemy::Jobs {
         int32 start {};
         int32 end {};
         JobType jobType {};
-        State state {State::Invalid}; // maybe pad this out for false sharing
+        // polled by whoever awaits the job from another thread, completing it publishes what the job wrote
+        std::atomic<State> state {State::Invalid}; // maybe pad this out for false sharing
 
     };
 
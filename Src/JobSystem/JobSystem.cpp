@@ -1,5 +1,6 @@
 #include "./JobSystem.h"
 #include "../Util/StringUtil.h"
+#include "../Allocation/ThreadLocalTemp.h"
 
 #if defined(_WIN32) || defined(_WIN64)
 #define WIN32_LEAN_AND_MEAN
@@ -21,14 +22,21 @@ void SetThreadName(std::thread* thread, const char* name) {
 #endif
 }
 
-Alchemy::Jobs::JobSystem::JobSystem(int32 workerCount) {
+Alchemy::Jobs::JobSystem::JobSystem(int32 workerCount, LinearAllocatorFlags tempFlags, size_t tempPrefaultBytes)
+    : runId(0) {
+
+    // worker threads create their thread local allocators as they start
+    ConfigureThreadLocalAllocators(tempFlags, tempPrefaultBytes);
 
     uint32 threadMax = std::thread::hardware_concurrency();
 
     workerCount++;
 
-    if (workerCount >= threadMax) {
-        workerCount = (int32) (threadMax) - 1;
+    // asking for workers gets at least one thread besides the caller's, even with a single core
+    int32 maxWorkers = threadMax > 3 ? (int32) threadMax - 1 : 2;
+
+    if (workerCount > maxWorkers) {
+        workerCount = maxWorkers;
     }
 
     if (workerCount > 32) {
@@ -39,9 +47,16 @@ Alchemy::Jobs::JobSystem::JobSystem(int32 workerCount) {
     workers.size = workerCount;
 
     for (int32 i = 0; i < workerCount; i++) {
-        workers[i] = new Worker(i, workers.ToCheckedArray(), workMutex, workCV);
+        workers[i] = new Worker(i, workers.ToCheckedArray(), workMutex, workCV, tempFlags, tempPrefaultBytes);
     }
 
+    // the last worker runs on the thread that owns the job system
+    TempAllocator* mainThreadTemp = GetThreadLocalAllocator();
+    mainThreadTemp->SetResetPolicy(kWorkerTempResetPolicy);
+    mainThreadTemp->Prefault(tempPrefaultBytes);
+    workers[workerCount - 1]->threadAllocator.store(mainThreadTemp, std::memory_order_release);
+    PERF_COUNTERS(workers[workerCount - 1]->perfCounters.Open());
+
     char buffer[32];
     char* c = buffer;
     memcpy(c, "Worker[", 7);
@@ -58,12 +73,60 @@ Alchemy::Jobs::JobSystem::JobSystem(int32 workerCount) {
 
 }
 
+void Alchemy::Jobs::JobSystem::BeginRun() {
+
+    {
+        std::lock_guard lock(workMutex);
+        runId++;
+        for (int32 i = 0; i < workers.size; i++) {
+            workers[i]->runId = runId;
+            workers[i]->workInSystem.store(true, std::memory_order_release);
+        }
+    }
+
+    workCV.notify_all();
+
+}
+
+void Alchemy::Jobs::JobSystem::EndRun() {
+
+    {
+        std::lock_guard lock(workMutex);
+        for (int32 i = 0; i < workers.size; i++) {
+            workers[i]->workInSystem.store(false, std::memory_order_release);
+        }
+    }
+
+    // pulls idle workers out of their sleep in JobLoop
+    workCV.notify_all();
+
+    workers[workers.size - 1]->Reset();
+
+    // the others reset themselves, nothing of a worker can be touched from here until it has
+    for (int32 i = 0; i < workers.size - 1; i++) {
+        while (workers[i]->finishedRun.load(std::memory_order_acquire) != runId) {
+            std::this_thread::yield();
+        }
+    }
+
+}
+
 void Alchemy::Jobs::JobSystem::Shutdown() {
-    for (int32 i = 0; i < workers.size; i++) {
-        workers[i]->shuttingDown = true;
+
+    if (workers.size == 0) {
+        return;
+    }
+
+    {
+        std::lock_guard lock(workMutex);
+        for (int32 i = 0; i < workers.size; i++) {
+            workers[i]->shuttingDown = true;
+        }
     }
 
-    for (int i = 0; i < threads.size; i++) {
+    workCV.notify_all();
+
+    for (int32 i = 0; i < threads.size; i++) {
         threads[i]->join();
         delete threads[i];
     }
@@ -72,8 +135,23 @@ void Alchemy::Jobs::JobSystem::Shutdown() {
         delete workers[i];
     }
 
+    threads.size = 0;
+    workers.size = 0;
+
 }
 
 void Alchemy::Jobs::JobSystem::WorkerLoop(Alchemy::Jobs::Worker* worker) {
+    // create (and prefault if configured) the temp allocator before the first job lands
+    TempAllocator* threadTemp = GetThreadLocalAllocator();
+    threadTemp->SetResetPolicy(kWorkerTempResetPolicy);
+    worker->threadAllocator.store(threadTemp, std::memory_order_release);
+    PERF_COUNTERS(worker->perfCounters.Open());
     worker->WorkerLoop();
 }
+
+void Alchemy::Jobs::JobSystem::GetWorkerStats(Alchemy::PodList<WorkerStats>* stats) {
+    stats->size = 0;
+    for (int32 i = 0; i < workers.size; i++) {
+        stats->Add(workers[i]->GetStats());
+    }
+}
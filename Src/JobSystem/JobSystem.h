@@ -12,9 +12,18 @@ namespace Alchemy::Jobs {
         Alchemy::PodList<Worker*> workers;
         std::mutex workMutex;
         std::condition_variable workCV;
+        uint32 runId;
+
+        // wakes the workers, they run jobs until EndRun
+        void BeginRun();
+
+        // once this returns every worker has reset itself and gone back to sleep
+        void EndRun();
 
     public:
-        explicit JobSystem(int32 workerCount);
+        // tempFlags & tempPrefaultBytes go to every worker's job temp and to the thread local allocators of the
+        // threads started here, see ConfigureThreadLocalAllocators. the calling thread already has its own
+        explicit JobSystem(int32 workerCount, LinearAllocatorFlags tempFlags = LinearAllocatorFlags::None, size_t tempPrefaultBytes = 0);
 
         static void WorkerLoop(Worker * worker);
 
@@ -27,16 +36,11 @@ namespace Alchemy::Jobs {
 
             JobHandle handle = mainThreadWorker->Schedule(parallelParams, job);
 
-            for (int32 i = 0; i < workers.size; i++) {
-                workers[i]->workInSystem = true;
-            }
+            BeginRun();
 
             mainThreadWorker->Await(handle);
 
-            for(int32 i = 0; i < workers.size; i++) {
-                workers[i]->Reset();
-                workers[i]->workInSystem = false;
-            }
+            EndRun();
 
         }
 
@@ -49,21 +53,25 @@ namespace Alchemy::Jobs {
 
             JobHandle handle = mainThreadWorker->Schedule(job);
 
-            for (int32 i = 0; i < workers.size; i++) {
-                workers[i]->workInSystem = true;
-            }
+            BeginRun();
 
             mainThreadWorker->Await(handle);
 
-            for(int32 i = 0; i < workers.size; i++) {
-                workers[i]->Reset();
-                workers[i]->workInSystem = false;
-            }
+            EndRun();
 
         }
 
+        // wakes & joins every worker thread, calling it again does nothing
         void Shutdown();
 
+        // the thread that owns the job system counts as one
+        int32 GetWorkerCount() {
+            return workers.size;
+        }
+
+        // only meaningful between Execute calls
+        void GetWorkerStats(PodList<WorkerStats>* stats);
+
     };
 
 }
\ No newline at end of file
@@ -2,23 +2,44 @@
 
 #include <mutex>
 #include <thread>
+#include <atomic>
 
 #include "./Job.h"
 #include "../Allocation/PagedAllocator.h"
 #include "../Collections/PodQueue.h"
 #include "../Allocation/LinearAllocator.h"
+#include "../Util/PerfCounters.h"
 
 namespace Alchemy::Jobs {
 
     using namespace Alchemy;
 
+    // workers keep 4mb warm and only decommit after a run of small executions, so alternating big and small
+    // builds don't thrash but a one-off huge file doesn't pin gigabytes for the life of the process
+    static constexpr TempAllocatorResetPolicy kWorkerTempResetPolicy = { 4 * 1024 * 1024, 8 };
+
+    struct WorkerStats {
+        int32 workerId;
+        int64 jobsExecuted;
+        uint64 busyNanoseconds; // running jobs, not counting the time spent spinning for a job to wait on
+        TempAllocatorStats jobTemp; // the allocator jobs get through TempAllocate
+        TempAllocatorStats threadTemp; // the worker thread's GetThreadLocalAllocator
+        PerfCounterValues perfCounters; // summed over outermost jobs like busy time, zero unless built with ALCHEMY_PERF_COUNTERS
+        uint32 perfCounterMask; // the counters this worker's thread could open
+    };
+
     struct Worker {
 
         PodQueue<IJobBase*> jobQueue;
         Alchemy::PagedAllocator<uint8> jobAllocator;
         int32 workerId;
-        bool shuttingDown;
-        bool workInSystem;
+        bool shuttingDown; // under waitForWorkMtx
+        std::atomic<bool> workInSystem;
+
+        // Execute hands every worker the id of its run under waitForWorkMtx and waits for it to come back in
+        // finishedRun, which a worker only does once it has reset itself on its own thread
+        uint32 runId;
+        std::atomic<uint32> finishedRun;
 
         CheckedArray<Worker*> workerList;
         PodList<IJobBase*> scheduledJobs;
@@ -28,8 +49,26 @@ namespace Alchemy::Jobs {
         std::mutex jobQueueMtx;
 
         TempAllocator allocator;
-
-        Worker(int32 workerId, CheckedArray<Worker*> workerList, std::mutex& workMutex, std::condition_variable& waitForWorkCV)
+        std::atomic<TempAllocator*> threadAllocator; // set by the worker thread once it starts
+        int64 jobsExecuted;
+
+        // busy time is only written by the worker's own thread. jobs nest (awaiting runs other jobs) so only the
+        // outermost one is timed, minus whatever time the nested job loops spent finding nothing to do
+        std::atomic<uint64> busyNanoseconds;
+        uint64 idleSpinNanoseconds;
+        uint64 outerJobStart;
+        uint64 outerJobIdleStart;
+        int32 jobDepth;
+
+#if ALCHEMY_PERF_COUNTERS != 0
+        // opened by the worker's own thread, read & summed around the outermost job next to busy time. nested
+        // idle spinning isn't taken out of these, it shows up as a few extra instructions
+        PerfCounterGroup perfCounters;
+        PerfCounterValues perfCounterTotals {};
+        PerfCounterValues outerJobCounters {};
+#endif
+
+        Worker(int32 workerId, CheckedArray<Worker*> workerList, std::mutex& workMutex, std::condition_variable& waitForWorkCV, LinearAllocatorFlags tempFlags, size_t tempPrefaultBytes)
             : workerId(workerId)
             , workerList(workerList)
             , waitForWorkMtx(workMutex)
@@ -37,11 +76,28 @@ namespace Alchemy::Jobs {
             , jobAllocator(64 * 1024)
             , shuttingDown(false)
             , workInSystem(false)
+            , runId(0)
+            , finishedRun(0)
             , scheduledJobs(128)
-            , allocator(1024ll * 1024ll * 1024ll * 8ll, 32 * 1024) {}
+            , allocator(1024ll * 1024ll * 1024ll * 8ll, 32 * 1024, tempFlags)
+            , threadAllocator(nullptr)
+            , jobsExecuted(0)
+            , busyNanoseconds(0)
+            , idleSpinNanoseconds(0)
+            , outerJobStart(0)
+            , outerJobIdleStart(0)
+            , jobDepth(0) {
+            allocator.SetResetPolicy(kWorkerTempResetPolicy);
+            if (tempPrefaultBytes != 0) {
+                allocator.Prefault(tempPrefaultBytes);
+            }
+        }
 
+        // only on the worker's own thread, it ends the run of its thread local allocator too
         void Reset();
 
+        WorkerStats GetStats();
+
         bool IsPrimary();
 
         bool TryGetJob(IJobBase** retn);
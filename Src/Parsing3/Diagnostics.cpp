@@ -1,5 +1,6 @@
 #include <cstring>
 #include "./Diagnostics.h"
+#include "../Collections/Sort.h"
 
 namespace Alchemy::Compilation {
 
@@ -24,23 +25,76 @@ namespace Alchemy::Compilation {
         , messageLength(message.size)
         , message(message.ptr) {}
 
+    static constexpr int32 kFirstChunkCapacity = 16;
+    static constexpr int32 kMaxChunkCapacity = 4096;
+
     Diagnostics::Diagnostics(Alchemy::Allocator allocator)
         : allocator(allocator)
-        , capacity(16)
+        , source()
         , size(0)
-        , array(allocator.AllocateUncleared<Diagnostic*>(capacity)) {}
+        , tailStart(0)
+        , head(nullptr)
+        , tail(nullptr) {}
+
+    void Diagnostics::SetSource(FixedCharSpan source) {
+        this->source = source;
+    }
+
+    static DiagnosticChunk* AllocateChunk(Allocator allocator, int32 capacity) {
+        // one allocation, entries follow the header
+        uint8* memory = allocator.AllocateUncleared<uint8>(sizeof(DiagnosticChunk) + sizeof(DiagnosticEntry) * capacity);
+        DiagnosticChunk* chunk = (DiagnosticChunk*) memory;
+        chunk->next = nullptr;
+        chunk->capacity = capacity;
+        chunk->entries = (DiagnosticEntry*) (memory + sizeof(DiagnosticChunk));
+        return chunk;
+    }
+
+    DiagnosticEntry* Diagnostics::Push() {
+
+        if (tail == nullptr) {
+            head = tail = AllocateChunk(allocator, kFirstChunkCapacity);
+            tailStart = 0;
+        }
+        else if (size - tailStart == tail->capacity) {
+            // chunks kept by Clear or Truncate get re-used before asking for a new one
+            DiagnosticChunk* chunk = tail->next;
+            if (chunk == nullptr) {
+                int32 capacity = tail->capacity * 2;
+                chunk = AllocateChunk(allocator, capacity > kMaxChunkCapacity ? kMaxChunkCapacity : capacity);
+                tail->next = chunk;
+            }
+            tailStart += tail->capacity;
+            tail = chunk;
+        }
+
+        return &tail->entries[size++ - tailStart];
+
+    }
 
     void Diagnostics::AddError(Diagnostic error) {
-        if (size + 1 > capacity) {
-            Diagnostic** newList = allocator.AllocateUncleared<Diagnostic*>(capacity * 2);
-            memcpy(newList, array, sizeof(Diagnostic*) * size);
-            allocator.Free(array, capacity);
-            array = newList;
-            capacity *= 2;
+
+        DiagnosticEntry* entry = Push();
+
+        char* base = source.ptr;
+
+        if (base != nullptr && error.start >= base && error.end >= error.start && error.end <= base + source.size) {
+            entry->start = (uint32) (error.start - base);
+            entry->end = (uint32) (error.end - base);
         }
-        Diagnostic* ptr = allocator.AllocateUncleared<Diagnostic>(1);
-        memcpy(ptr, &error, sizeof(Diagnostic));
-        array[size++] = ptr;
+        else {
+            entry->start = kNoSourceOffset;
+            entry->end = kNoSourceOffset;
+        }
+
+        entry->errorCode = error.errorCode;
+        entry->messageLength = error.messageLength;
+        entry->message = error.message;
+
+    }
+
+    void Diagnostics::AddEntry(const DiagnosticEntry& entry) {
+        *Push() = entry;
     }
 
     void Diagnostics::AddError(ErrorCode error, FixedCharSpan sourceSpan) {
@@ -51,4 +105,96 @@ namespace Alchemy::Compilation {
         AddError(Diagnostic(error, sourceSpan ,message));
     }
 
-}
\ No newline at end of file
+    DiagnosticEntry& Diagnostics::Get(int32 index) {
+        assert(index >= 0 && index < size);
+        DiagnosticChunk* chunk = head;
+        while (index >= chunk->capacity) {
+            index -= chunk->capacity;
+            chunk = chunk->next;
+        }
+        return chunk->entries[index];
+    }
+
+    void Diagnostics::CopyTo(DiagnosticEntry* output) {
+        int32 remaining = size;
+        for (DiagnosticChunk* chunk = head; remaining > 0; chunk = chunk->next) {
+            int32 count = remaining < chunk->capacity ? remaining : chunk->capacity;
+            memcpy(output, chunk->entries, sizeof(DiagnosticEntry) * count);
+            output += count;
+            remaining -= count;
+        }
+    }
+
+    FixedCharSpan Diagnostics::GetSourceText(const DiagnosticEntry& entry) {
+        if (entry.start == kNoSourceOffset || source.ptr == nullptr) {
+            return FixedCharSpan();
+        }
+        return FixedCharSpan(source.ptr + entry.start, entry.end - entry.start);
+    }
+
+    void Diagnostics::Clear() {
+        // keep the chunks around, they get filled again from the start
+        size = 0;
+        tailStart = 0;
+        tail = head;
+    }
+
+    DiagnosticsCheckpoint Diagnostics::Checkpoint() {
+        return DiagnosticsCheckpoint { tail, tailStart, size };
+    }
+
+    void Diagnostics::Rollback(DiagnosticsCheckpoint checkpoint) {
+        tail = checkpoint.tail;
+        tailStart = checkpoint.tailStart;
+        size = checkpoint.size;
+        if (tail == nullptr) {
+            head = nullptr;
+        }
+        else {
+            // whatever came after was allocated past the checkpoint
+            tail->next = nullptr;
+        }
+    }
+
+    void Diagnostics::Truncate(DiagnosticsCheckpoint checkpoint) {
+        size = checkpoint.size;
+        if (checkpoint.tail == nullptr) {
+            tail = head;
+            tailStart = 0;
+        }
+        else {
+            tail = checkpoint.tail;
+            tailStart = checkpoint.tailStart;
+        }
+    }
+
+    static int32 CompareEntries(const DiagnosticEntry& a, const DiagnosticEntry& b) {
+        if (a.start != b.start) return a.start < b.start ? -1 : 1;
+        if (a.end != b.end) return a.end < b.end ? -1 : 1;
+        if (a.errorCode != b.errorCode) return (int32) a.errorCode < (int32) b.errorCode ? -1 : 1;
+        if (a.messageLength != b.messageLength) return a.messageLength < b.messageLength ? -1 : 1;
+        return a.messageLength == 0 ? 0 : memcmp(a.message, b.message, a.messageLength);
+    }
+
+    int32 SortAndDeduplicate(DiagnosticEntry* entries, int32 count) {
+
+        IntrospectionSort(entries, count, [](const DiagnosticEntry& a, const DiagnosticEntry& b) {
+            return CompareEntries(a, b);
+        });
+
+        if (count == 0) {
+            return 0;
+        }
+
+        int32 write = 1;
+        for (int32 i = 1; i < count; i++) {
+            if (CompareEntries(entries[i], entries[write - 1]) != 0) {
+                entries[write++] = entries[i];
+            }
+        }
+
+        return write;
+
+    }
+
+}
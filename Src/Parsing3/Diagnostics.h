@@ -30,21 +30,94 @@ namespace Alchemy::Compilation {
 
     };
 
+    // what Diagnostics actually stores. spans are byte offsets into the file's source instead of pointers, so an
+    // entry is 24 bytes, can be copied around by value and doesn't care where the text lives
+    struct DiagnosticEntry {
+
+        uint32 start;
+        uint32 end;
+        ErrorCode errorCode;
+        uint32 messageLength;
+        char* message;
+
+        inline FixedCharSpan GetMessage() const {
+            return FixedCharSpan(message, messageLength);
+        }
+
+    };
+
+    // spans that don't point into the source (generated names, compiler level errors) get this for start & end
+    constexpr uint32 kNoSourceOffset = 0xffffffff;
+
+    struct DiagnosticChunk {
+        DiagnosticChunk* next;
+        DiagnosticEntry* entries;
+        int32 capacity;
+    };
+
+    struct DiagnosticsCheckpoint {
+        DiagnosticChunk* tail;
+        int32 tailStart;
+        int32 size;
+    };
+
+    // Entries live by value in a chain of chunks that grow geometrically, nothing is ever copied or re-allocated
+    // as the list grows. Chunks come from the file's linear allocator, so rolling back to a checkpoint along with
+    // that allocator just forgets the chunks that were added after it.
     struct Diagnostics {
 
         Allocator allocator;
+        FixedCharSpan source;
 
         int32 size;
-        int32 capacity;
-        Diagnostic** array;
+        int32 tailStart; // index of the first entry in tail
+        DiagnosticChunk* head;
+        DiagnosticChunk* tail;
 
         explicit Diagnostics(Allocator allocator);
 
+        // spans passed to AddError are stored relative to this
+        void SetSource(FixedCharSpan source);
+
         void AddError(Diagnostic error);
 
         void AddError(ErrorCode error, FixedCharSpan sourceSpan);
         void AddError(ErrorCode error, FixedCharSpan sourceSpan, FixedCharSpan message);
 
+        // for entries that already hold offsets, ie. ones restored from a snapshot
+        void AddEntry(const DiagnosticEntry& entry);
+
+        // walks the chunk list, use CopyTo when visiting everything
+        DiagnosticEntry& Get(int32 index);
+
+        void CopyTo(DiagnosticEntry* output);
+
+        FixedCharSpan GetSourceText(const DiagnosticEntry& entry);
+
+        void Clear();
+
+        DiagnosticsCheckpoint Checkpoint();
+
+        // only valid when memory allocated after the checkpoint is discarded too (or never re-used)
+        void Rollback(DiagnosticsCheckpoint checkpoint);
+
+        // drops the entries added after the checkpoint but keeps their chunks to be filled again, for when the
+        // allocator moved on and can't be rewound with it
+        void Truncate(DiagnosticsCheckpoint checkpoint);
+
+    private:
+
+        DiagnosticEntry* Push();
+
     };
 
+    // one entry of a merged, cross file list. fileIndex is whatever index the caller gave the Diagnostics it came from
+    struct MergedDiagnostic {
+        int32 fileIndex;
+        DiagnosticEntry entry;
+    };
+
+    // sorts entries by (start, end, error code, message) and drops exact duplicates, returns the new count
+    int32 SortAndDeduplicate(DiagnosticEntry* entries, int32 count);
+
 }
@@ -135,6 +135,15 @@ namespace Alchemy::Compilation {
         ERR_ExpectedReturnType,
         ERR_DuplicateIdentifierInScope,
         ERR_InstanceFieldAccessInStaticContext,
+
+        ERR_EntryPointNotFound,
+        ERR_EntryPointMustBeExported,
+
+        ERR_FailedToWriteOutput,
+
+        ERR_CircularConstantDefinition,
+        ERR_ConstantDivideByZero,
+        ERR_ConstantValueCannotBeConverted,
     };
 
 }
\ No newline at end of file
@@ -59,6 +59,27 @@ namespace Alchemy::Compilation {
 
         tokens[token.GetId()].SetFlags(tokens[token.GetId()].GetFlags() & ~SyntaxTokenFlags::Skipped);
 
+        // the parser upgrades the first `>` of a shift in place and eats the rest, those never make it into the tree
+        int32 combined = 0;
+        switch (token.kind) {
+            case TokenKind::GreaterThanGreaterThanToken:
+            case TokenKind::GreaterThanGreaterThanEqualsToken:
+                combined = 1;
+                break;
+            case TokenKind::GreaterThanGreaterThanGreaterThanToken:
+            case TokenKind::GreaterThanGreaterThanGreaterThanEqualsToken:
+                combined = 2;
+                break;
+            default:
+                break;
+        }
+
+        if (combined != 0 && tokens[token.GetId()].kind == TokenKind::GreaterThanToken) {
+            for (int32 i = 1; i <= combined && token.GetId() + i < tokens.size; i++) {
+                tokens[token.GetId() + i].SetFlags(tokens[token.GetId() + i].GetFlags() & ~SyntaxTokenFlags::Skipped);
+            }
+        }
+
     }
 
 }
\ No newline at end of file
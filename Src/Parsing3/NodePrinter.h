@@ -183,10 +183,10 @@ namespace Alchemy::Compilation {
             }
 
             buffer.size += snprintf(buffer.array + buffer.size, 64, "[%d:%d - %d:%d]",
-                lc[min].line,
-                lc[min].column,
-                lc[max].endLine,
-                lc[max].endColumn
+                GetLineColumn(min).line,
+                GetLineColumn(min).column,
+                GetLineColumn(max).endLine,
+                GetLineColumn(max).endColumn
             );
 
             PrintLine();
@@ -244,24 +244,29 @@ namespace Alchemy::Compilation {
             buffer.EnsureAdditionalCapacity(64);
 
             buffer.size += snprintf(buffer.array + buffer.size, 64, " [%d:%d - %d:%d]",
-                lc[token.GetId()].line,
-                lc[token.GetId()].column,
-                lc[token.GetId()].endLine,
-                lc[token.GetId()].endColumn
+                GetLineColumn(token.GetId()).line,
+                GetLineColumn(token.GetId()).column,
+                GetLineColumn(token.GetId()).endLine,
+                GetLineColumn(token.GetId()).endColumn
             );
 
             PrintLine();
 
         }
 
+        // a missing token at the very end of the input has no line of its own, it borrows the last one
+        LineColumn GetLineColumn(int32 tokenId) {
+            return lc[tokenId < lc.size ? tokenId : lc.size - 1];
+        }
+
         void PrintLineRange(int32 start, int32 end) {
             buffer.EnsureAdditionalCapacity(64);
 
             buffer.size += snprintf(buffer.array + buffer.size, 64, " [%d:%d - %d:%d]",
-                lc[start].line,
-                lc[start].column,
-                lc[end].endLine,
-                lc[end].endColumn
+                GetLineColumn(start).line,
+                GetLineColumn(start).column,
+                GetLineColumn(end).endLine,
+                GetLineColumn(end).endColumn
             );
 
         }
@@ -41,6 +41,7 @@ namespace Alchemy::Compilation {
         , tempAllocator(tempAllocator == nullptr ? GetThreadLocalAllocator() : tempAllocator)
         , termState(TerminatorState::EndOfFile)
         , forceConditionalAccessExpression(false)
+        , nodeCount(0)
         , currentToken() {
 
         for (ptr = 0; ptr < tokens.size; ptr++) {
@@ -160,6 +161,7 @@ namespace Alchemy::Compilation {
         missing.SetId(ptr);
         if (reportError) {
             AddError(missing, errorCode);
+            missing.AddFlag(SyntaxTokenFlags::Error);
         }
         return missing;
     }
@@ -202,23 +204,32 @@ namespace Alchemy::Compilation {
         return Diagnostic(code, text.ptr, text.ptr + token.textSize);
     }
 
+    char* Parser::GetTokenText(int32 tokenId) {
+        if (tokenId >= 0 && tokenId < tokenTexts.size) {
+            return tokenTexts[tokenId];
+        }
+        return diagnostics->source.ptr + diagnostics->source.size;
+    }
+
     void Parser::AddError(SyntaxBase* node, ErrorCode errorCode) {
         if (node == nullptr) {
             return;
         }
 
-        SyntaxToken start = tokens[node->GetStartTokenId()];
-        SyntaxToken end = tokens[node->GetEndTokenId()];
+        int32 startId = node->GetStartTokenId();
+        int32 endId = node->GetEndTokenId();
 
-        if (start.GetId() == ptr) {
+        if (startId == ptr) {
             currentToken.AddFlag(SyntaxTokenFlags::Error);
         }
 
-        if (start.GetId() >= 0) {
-            tokens[start.GetId()].AddFlag(SyntaxTokenFlags::Error);
+        if (startId < tokens.size) {
+            tokens[startId].AddFlag(SyntaxTokenFlags::Error);
         }
 
-        diagnostics->AddError(Diagnostic(errorCode, tokenTexts[start.GetId()], tokenTexts[end.GetId()] + end.textSize));
+        char* end = endId < tokens.size ? GetTokenText(endId) + tokens[endId].textSize : GetTokenText(endId);
+
+        diagnostics->AddError(Diagnostic(errorCode, GetTokenText(startId), end));
     }
 
     void Parser::AddError(SyntaxToken token, ErrorCode errorCode) {
@@ -226,11 +237,12 @@ namespace Alchemy::Compilation {
             currentToken.AddFlag(SyntaxTokenFlags::Error);
         }
 
-        if (token.GetId() >= 0) {
+        if (token.GetId() >= 0 && token.GetId() < tokens.size) {
             tokens[token.GetId()].AddFlag(SyntaxTokenFlags::Error);
         }
 
-        diagnostics->AddError(Diagnostic(errorCode, tokenTexts[token.GetId()], tokenTexts[token.GetId()] + token.textSize));
+        char* text = GetTokenText(token.GetId());
+        diagnostics->AddError(Diagnostic(errorCode, text, text + token.textSize));
     }
 
     void Parser::AddError(SyntaxToken token, Diagnostic diagnostic) {
@@ -239,7 +251,7 @@ namespace Alchemy::Compilation {
             currentToken.AddFlag(SyntaxTokenFlags::Error);
         }
 
-        if (token.GetId() >= 0) {
+        if (token.GetId() >= 0 && token.GetId() < tokens.size) {
             tokens[token.GetId()].AddFlag(SyntaxTokenFlags::Error);
         }
 
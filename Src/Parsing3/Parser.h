@@ -24,6 +24,7 @@ namespace Alchemy::Compilation {
         CheckedArray<SyntaxToken> tokens;
         CheckedArray<char*> tokenTexts;
         bool forceConditionalAccessExpression;
+        int32 nodeCount;
 
         Parser() = default;
 
@@ -36,6 +37,9 @@ namespace Alchemy::Compilation {
         SyntaxToken CreateMissingToken(TokenKind expected);
         SyntaxToken CreateMissingToken(TokenKind expected, SyntaxToken actual, bool reportError);
         Diagnostic MakeDiagnostic(ErrorCode code, SyntaxToken token);
+
+        // tokens made up once the input ran out have the id one past the last token, they point at the end of the text
+        char* GetTokenText(int32 tokenId);
         static ErrorCode GetExpectedTokenErrorCode(TokenKind expected, TokenKind actual);
 
         SyntaxToken EatTokenWithPrejudice(TokenKind kind);
@@ -49,10 +53,14 @@ namespace Alchemy::Compilation {
 
         bool HasMoreTokens();
 
-        template <typename T, typename... Args>
-        T* CreateNode(Args && ... args) {
+        // callers build the node in braces, CreateNode(IfStatementSyntax { ... }). most arguments eat tokens, those
+        // have to run in the order they are written and only a braced list guarantees that. in a plain argument
+        // list the order is up to the compiler (gcc goes right to left and the parser recurses forever)
+        template <typename T>
+        T* CreateNode(const T& node) {
             T* retn = (T*) allocator->AllocateUncleared<T>(1);
-            new(retn) T(std::forward<Args>(args)...);
+            new(retn) T(node);
+            nodeCount++;
             SyntaxBase * pBase = (SyntaxBase*)retn;
             SyntaxToken startToken = GetFirstToken(pBase);
             SyntaxToken endToken = GetLastToken(pBase);
@@ -60,6 +68,10 @@ namespace Alchemy::Compilation {
             assert(endToken.IsValid());
             pBase->SetStartTokenId(startToken.GetId());
             pBase->SetEndTokenId(endToken.GetId());
+            // missing tokens take the id of the token after them, if a real one was eaten in between the ids differ
+            if (startToken.IsMissing() && endToken.IsMissing() && startToken.GetId() == endToken.GetId()) {
+                pBase->SetFlags(SyntaxTokenFlags::Missing);
+            }
             return retn;
         }
 
@@ -14,14 +14,14 @@ namespace Alchemy::Compilation {
         size_t tempAllocatorOffset;
         Parser* originalParser;
         Parser copyParser;
-        Diagnostics diagnosticsCopy;
+        DiagnosticsCheckpoint diagnosticsCheckpoint;
 
         explicit ResetPoint(Parser* parser, bool resetOnDispose = true)
             : originalParser(parser)
             , copyParser(*parser)
             , allocatorOffset(parser->allocator->offset)
             , tempAllocatorOffset(parser->tempAllocator->offset)
-            , diagnosticsCopy(*parser->diagnostics)
+            , diagnosticsCheckpoint(parser->diagnostics->Checkpoint())
             , resetOnDispose(resetOnDispose) {}
 
         ~ResetPoint() {
@@ -32,7 +32,7 @@ namespace Alchemy::Compilation {
 
         void Reset() {
             *originalParser = copyParser;
-            *originalParser->diagnostics = diagnosticsCopy;
+            originalParser->diagnostics->Rollback(diagnosticsCheckpoint);
             originalParser->tempAllocator->offset = tempAllocatorOffset;
             originalParser->allocator->offset = allocatorOffset;
         }
@@ -268,6 +268,7 @@ namespace Alchemy::Compilation {
             case TokenKind::PrivateKeyword:
             case TokenKind::ProtectedKeyword:
             case TokenKind::PublicKeyword:
+            case TokenKind::ExportKeyword:
             case TokenKind::ReadOnlyKeyword:
             case TokenKind::StaticKeyword:
             case TokenKind::VirtualKeyword:
@@ -603,7 +604,7 @@ namespace Alchemy::Compilation {
 
             if (parser->currentToken.kind == TokenKind::QuestionToken) {
 
-                if (lastTokenOfType->kind == TokenKind::QuestionToken && lastTokenOfType->kind != TokenKind::AsteriskToken) {
+                if (lastTokenOfType->kind != TokenKind::QuestionToken && lastTokenOfType->kind != TokenKind::AsteriskToken) {
                     // don't allow `Type??`
                     // don't allow `Type*?`
                     *lastTokenOfType = parser->EatToken();
@@ -794,6 +795,7 @@ namespace Alchemy::Compilation {
         Internal,
         Protected,
         Private,
+        Export,
         Sealed,
         Abstract,
 
@@ -815,6 +817,8 @@ namespace Alchemy::Compilation {
                 return DeclarationModifiers::Protected;
             case TokenKind::PrivateKeyword:
                 return DeclarationModifiers::Private;
+            case TokenKind::ExportKeyword:
+                return DeclarationModifiers::Export;
             case TokenKind::SealedKeyword:
                 return DeclarationModifiers::Sealed;
             case TokenKind::AbstractKeyword:
@@ -911,7 +915,7 @@ namespace Alchemy::Compilation {
 
         SyntaxToken semicolon = parser->EatToken(TokenKind::SemicolonToken);
 
-        return parser->CreateNode<DelegateDeclarationSyntax>(
+        return parser->CreateNode(DelegateDeclarationSyntax {
             attributes,
             modifiers->Persist(parser->allocator),
             delegateToken,
@@ -921,7 +925,7 @@ namespace Alchemy::Compilation {
             parameterList,
             constraints.ToSyntaxList(parser->allocator),
             semicolon
-        );
+        });
 
     }
 
@@ -953,10 +957,10 @@ namespace Alchemy::Compilation {
                 : ParseExpression(parser);
 
             // an identifier is a valid expression
-            equalsValue = parser->CreateNode<EqualsValueClauseSyntax>(equalsToken, value);
+            equalsValue = parser->CreateNode(EqualsValueClauseSyntax {equalsToken, value});
         }
 
-        return parser->CreateNode<EnumMemberDeclarationSyntax>(memberAttrs, memberName, equalsValue);
+        return parser->CreateNode(EnumMemberDeclarationSyntax {memberAttrs, memberName, equalsValue});
     }
 
     EnumDeclarationSyntax* ParseEnumDeclaration(Parser* parser, SyntaxList<AttributeListSyntax>* attributes, TokenListBuffer* modifiers) {
@@ -979,8 +983,8 @@ namespace Alchemy::Compilation {
             TempAllocator::ScopedMarker m(parser->tempAllocator);
             SeparatedSyntaxListBuilder<BaseTypeSyntax> tmpList(parser->tempAllocator);
 
-            tmpList.Add(parser->CreateNode<BaseTypeSyntax>(type, nullptr));
-            baseList = parser->CreateNode<BaseListSyntax>(colon, tmpList.ToList(parser->allocator));
+            tmpList.Add(parser->CreateNode(BaseTypeSyntax {type, nullptr}));
+            baseList = parser->CreateNode(BaseListSyntax {colon, tmpList.ToList(parser->allocator)});
         }
 
         SeparatedSyntaxList<EnumMemberDeclarationSyntax>* members = nullptr;
@@ -1018,7 +1022,7 @@ namespace Alchemy::Compilation {
 
         }
 
-        return parser->CreateNode<EnumDeclarationSyntax>(
+        return parser->CreateNode(EnumDeclarationSyntax {
             attributes,
             modifiers->Persist(parser->allocator),
             enumToken,
@@ -1028,7 +1032,7 @@ namespace Alchemy::Compilation {
             members,
             closeBrace,
             semicolon
-        );
+        });
 
     }
 
@@ -1062,7 +1066,7 @@ namespace Alchemy::Compilation {
             ? ParseParenthesizedArgumentList(parser)
             : nullptr;
 
-        list.Add(parser->CreateNode<BaseTypeSyntax>(firstType, argumentList));
+        list.Add(parser->CreateNode(BaseTypeSyntax {firstType, argumentList}));
 
         // any additional types
         while (true) {
@@ -1074,7 +1078,7 @@ namespace Alchemy::Compilation {
             }
             else if (parser->currentToken.kind == TokenKind::CommaToken || IsPossibleType(parser)) {
                 list.AddSeparator(parser->EatToken(TokenKind::CommaToken));
-                list.Add(parser->CreateNode<BaseTypeSyntax>(ParseType(parser), nullptr));
+                list.Add(parser->CreateNode(BaseTypeSyntax {ParseType(parser), nullptr}));
                 continue;
             }
             else if (SkipBadBaseListTokens(parser, TokenKind::CommaToken) == PostSkipAction::Abort) {
@@ -1082,7 +1086,7 @@ namespace Alchemy::Compilation {
             }
         }
 
-        return parser->CreateNode<BaseListSyntax>(colon, list.ToList(parser->allocator));
+        return parser->CreateNode(BaseListSyntax {colon, list.ToList(parser->allocator)});
 
     }
 
@@ -1105,7 +1109,7 @@ namespace Alchemy::Compilation {
                 SyntaxToken newKeyword = parser->EatToken();
                 SyntaxToken openParen = parser->EatToken(TokenKind::OpenParenToken);
                 SyntaxToken closeParen = parser->EatToken(TokenKind::CloseParenToken);
-                return parser->CreateNode<ConstructorConstraintSyntax>(newKeyword, openParen, closeParen);
+                return parser->CreateNode(ConstructorConstraintSyntax {newKeyword, openParen, closeParen});
             }
             case TokenKind::StructKeyword: {
                 SyntaxToken keyword = parser->EatToken();
@@ -1114,7 +1118,7 @@ namespace Alchemy::Compilation {
                     question = parser->EatToken();
                     parser->AddError(question, ErrorCode::ERR_UnexpectedToken);
                 }
-                return parser->CreateNode<ClassOrStructConstraintSyntax>(SyntaxKind::StructConstraint, keyword, question);
+                return parser->CreateNode(ClassOrStructConstraintSyntax {SyntaxKind::StructConstraint, keyword, question});
             }
             case TokenKind::ClassKeyword: {
                 SyntaxToken keyword = parser->EatToken();
@@ -1122,17 +1126,17 @@ namespace Alchemy::Compilation {
                 if (parser->currentToken.kind == TokenKind::QuestionToken) {
                     question = parser->EatToken();
                 }
-                return parser->CreateNode<ClassOrStructConstraintSyntax>(SyntaxKind::ClassConstraint, keyword, question);
+                return parser->CreateNode(ClassOrStructConstraintSyntax {SyntaxKind::ClassConstraint, keyword, question});
             }
             case TokenKind::DelegateKeyword: {
                 IdentifierNameSyntax* missing = CreateMissingIdentifierName(parser);
                 parser->AddError(missing, ErrorCode::ERR_NoDelegateConstraint);
                 parser->EatToken();
-                return parser->CreateNode<TypeConstraintSyntax>(missing);
+                return parser->CreateNode(TypeConstraintSyntax {missing});
             }
                 // todo -- maybe add constraint for enum keyword
             default: {
-                return parser->CreateNode<TypeConstraintSyntax>(ParseType(parser));
+                return parser->CreateNode(TypeConstraintSyntax {ParseType(parser)});
             }
         }
     }
@@ -1166,7 +1170,7 @@ namespace Alchemy::Compilation {
         if (parser->currentToken.kind == TokenKind::OpenBraceToken || IsCurrentTokenWhereOfConstraintClause(parser)) {
             IdentifierNameSyntax* missing = CreateMissingIdentifierName(parser);
             parser->AddError(missing, ErrorCode::ERR_TypeExpected);
-            bounds.Add(parser->CreateNode<TypeConstraintSyntax>(missing));
+            bounds.Add(parser->CreateNode(TypeConstraintSyntax {missing}));
         }
         else {
             bounds.Add(ParseTypeParameterConstraint(parser));
@@ -1182,7 +1186,7 @@ namespace Alchemy::Compilation {
                     if (IsCurrentTokenWhereOfConstraintClause(parser)) {
                         IdentifierNameSyntax* missing = CreateMissingIdentifierName(parser);
                         parser->AddError(missing, ErrorCode::ERR_TypeExpected);
-                        bounds.Add(parser->CreateNode<TypeConstraintSyntax>(missing));
+                        bounds.Add(parser->CreateNode(TypeConstraintSyntax {missing}));
                         break;
                     }
                     else {
@@ -1195,12 +1199,12 @@ namespace Alchemy::Compilation {
             }
         }
 
-        return parser->CreateNode<TypeParameterConstraintClauseSyntax>(
+        return parser->CreateNode(TypeParameterConstraintClauseSyntax {
             where,
             name,
             colon,
             bounds.ToList(parser->allocator)
-        );
+        });
 
     }
 
@@ -1371,7 +1375,7 @@ namespace Alchemy::Compilation {
 
         switch (topLevelKind) {
             case SyntaxKind::ClassDeclaration: {
-                return parser->CreateNode<ClassDeclarationSyntax>(
+                return parser->CreateNode(ClassDeclarationSyntax {
                     attributes,
                     modifiers->Persist(parser->allocator),
                     keyword,
@@ -1384,11 +1388,11 @@ namespace Alchemy::Compilation {
                     members.ToSyntaxList(parser->allocator),
                     closeBrace,
                     semicolon
-                );
+                });
             }
 
             case SyntaxKind::StructDeclaration: {
-                return parser->CreateNode<StructDeclarationSyntax>(
+                return parser->CreateNode(StructDeclarationSyntax {
                     attributes,
                     modifiers->Persist(parser->allocator),
                     keyword,
@@ -1401,11 +1405,11 @@ namespace Alchemy::Compilation {
                     members.ToSyntaxList(parser->allocator),
                     closeBrace,
                     semicolon
-                );
+                });
             }
 
             case SyntaxKind::InterfaceDeclaration: {
-                return parser->CreateNode<InterfaceDeclarationSyntax>(
+                return parser->CreateNode(InterfaceDeclarationSyntax {
                     attributes,
                     modifiers->Persist(parser->allocator),
                     keyword,
@@ -1418,7 +1422,7 @@ namespace Alchemy::Compilation {
                     members.ToSyntaxList(parser->allocator),
                     closeBrace,
                     semicolon
-                );
+                });
             }
             default: {
                 UNREACHABLE("ParseClassOrStructOrInterfaceDeclaration");
@@ -1560,11 +1564,11 @@ namespace Alchemy::Compilation {
                 }
             }
 
-            result = parser->CreateNode<ParenthesizedVariableDesignationSyntax>(
+            result = parser->CreateNode(ParenthesizedVariableDesignationSyntax {
                 openParen,
                 listOfDesignations.ToList(parser->allocator),
                 parser->EatToken(TokenKind::CloseParenToken)
-            );
+            });
         }
         else {
             result = ParseSimpleDesignation(parser);
@@ -1669,10 +1673,10 @@ namespace Alchemy::Compilation {
     }
 
     ExpressionSyntax* ParseThrowExpression(Parser* parser) {
-        return parser->CreateNode<ThrowExpressionSyntax>(
+        return parser->CreateNode(ThrowExpressionSyntax {
             parser->EatToken(TokenKind::ThrowKeyword),
             ParseSubExpression(parser, Precedence::Coalescing)
-        );
+        });
     }
 
     bool ScanDesignator(Parser* parser) {
@@ -1720,36 +1724,36 @@ namespace Alchemy::Compilation {
 
     VariableDesignationSyntax* ParseSimpleDesignation(Parser* parser) {
         return parser->currentToken.contextualKind == TokenKind::UnderscoreToken
-            ? (VariableDesignationSyntax*) parser->CreateNode<DiscardDesignationSyntax>(parser->EatToken())
-            : (VariableDesignationSyntax*) parser->CreateNode<SingleVariableDesignationSyntax>(parser->EatToken(TokenKind::IdentifierToken));
+            ? (VariableDesignationSyntax*) parser->CreateNode(DiscardDesignationSyntax {parser->EatToken()})
+            : (VariableDesignationSyntax*) parser->CreateNode(SingleVariableDesignationSyntax {parser->EatToken(TokenKind::IdentifierToken)});
     }
 
     ExpressionSyntax* ParseDeclarationExpression(Parser* parser, ParseTypeMode mode, bool isScoped) {
         // todo -- this is probably where we add 'temp' and other lifetime keywords
         TypeSyntax* type = ParseType(parser, mode);
-        return parser->CreateNode<DeclarationExpressionSyntax>(type, ParseDesignation(parser, false));
+        return parser->CreateNode(DeclarationExpressionSyntax {type, ParseDesignation(parser, false)});
     }
 
     ExpressionSyntax* ParseTypeOfExpression(Parser* parser) {
-        return parser->CreateNode<TypeOfExpressionSyntax>(
+        return parser->CreateNode(TypeOfExpressionSyntax {
             parser->EatToken(),
             parser->EatToken(TokenKind::OpenParenToken),
             ParseTypeOrVoid(parser),
             parser->EatToken(TokenKind::CloseParenToken)
-        );
+        });
     }
 
     ExpressionSyntax* ParseDefaultExpression(Parser* parser) {
         SyntaxToken keyword = parser->EatToken();
         if (parser->currentToken.kind == TokenKind::OpenParenToken) {
-            return parser->CreateNode<DefaultExpressionSyntax>(
+            return parser->CreateNode(DefaultExpressionSyntax {
                 keyword,
                 parser->EatToken(TokenKind::OpenParenToken),
                 ParseType(parser),
-                parser->EatToken(TokenKind::CloseParenToken));
+                parser->EatToken(TokenKind::CloseParenToken)});
         }
         else {
-            return parser->CreateNode<LiteralExpressionSyntax>(SyntaxKind::DefaultLiteralExpression, keyword);
+            return parser->CreateNode(LiteralExpressionSyntax {SyntaxKind::DefaultLiteralExpression, keyword});
         }
     }
 
@@ -1857,14 +1861,14 @@ namespace Alchemy::Compilation {
             equalsToken = parser->EatToken();
         }
 
-        return parser->CreateNode<ParameterSyntax>(
+        return parser->CreateNode(ParameterSyntax {
             modifiers.Persist(parser->allocator),
             paramType,
             identifier,
             equalsToken.IsValid()
-                ? parser->CreateNode<EqualsValueClauseSyntax>(equalsToken, ParseExpression(parser))
+                ? parser->CreateNode(EqualsValueClauseSyntax {equalsToken, ParseExpression(parser)})
                 : nullptr
-        );
+        });
     }
 
     ParameterListSyntax* ParseLambdaParameterList(Parser* parser) {
@@ -1886,11 +1890,11 @@ namespace Alchemy::Compilation {
 
         parser->termState = saveTerm;
 
-        return parser->CreateNode<ParameterListSyntax>(
+        return parser->CreateNode(ParameterListSyntax {
             openParen,
             nodes,
             parser->EatToken(TokenKind::CloseParenToken)
-        );
+        });
 
     }
 
@@ -1899,7 +1903,7 @@ namespace Alchemy::Compilation {
             // The consumers of embedded statements are expecting to receive a non-null statement
             // yet there are several error conditions that can lead ParseStatement to return
             // null.  When that occurs create an error empty Statement and return it to the caller.
-            return parser->CreateNode<EmptyStatementSyntax>(parser->EatToken(TokenKind::SemicolonToken));
+            return parser->CreateNode(EmptyStatementSyntax {parser->EatToken(TokenKind::SemicolonToken)});
         }
 
         return statement;
@@ -1920,7 +1924,7 @@ namespace Alchemy::Compilation {
         ExpressionSyntax* expression = ParseExpression(parser);
         parser->termState = saveTerm;
 
-        return parser->CreateNode<DoStatementSyntax>(
+        return parser->CreateNode(DoStatementSyntax {
             doToken,
             statement,
             whileToken,
@@ -1928,7 +1932,7 @@ namespace Alchemy::Compilation {
             expression,
             parser->EatToken(TokenKind::CloseParenToken),
             parser->EatToken(TokenKind::SemicolonToken)
-        );
+        });
     }
 
     void ParseLocalDeclaration(Parser* parser, SeparatedSyntaxListBuilder<VariableDeclaratorSyntax>* variables, bool allowLocalFunctions, bool stopOnCloseParen, TokenListBuffer* mods, TypeSyntax** outType, LocalFunctionStatementSyntax** localFunction) {
@@ -1993,7 +1997,7 @@ namespace Alchemy::Compilation {
 
         assert(localFn == nullptr);
 
-        return parser->CreateNode<VariableDeclarationSyntax>(type, variables.ToList(parser->allocator));
+        return parser->CreateNode(VariableDeclarationSyntax {type, variables.ToList(parser->allocator)});
     }
 
     static PostSkipAction SkipBadForStatementExpressionListTokens(Parser* parser, TokenKind expectedKind, TokenKind closeKind) {
@@ -2095,10 +2099,10 @@ namespace Alchemy::Compilation {
                         return nullptr;
                 }
 
-                return parser->CreateNode<ForEachStatementSyntax>(foreach, openParen, decl->type, identifier, inKeyword, expression, closeParen, statement);
+                return parser->CreateNode(ForEachStatementSyntax {foreach, openParen, decl->type, identifier, inKeyword, expression, closeParen, statement});
             }
         }
-        return parser->CreateNode<ForEachVariableStatementSyntax>(foreach, openParen, variable, inKeyword, expression, closeParen, statement);
+        return parser->CreateNode(ForEachVariableStatementSyntax {foreach, openParen, variable, inKeyword, expression, closeParen, statement});
 
 
     }
@@ -2148,7 +2152,7 @@ namespace Alchemy::Compilation {
             incrementors = ParseForStatementExpressionList(parser, &semi2);
         }
 
-        ForStatementSyntax* retn = parser->CreateNode<ForStatementSyntax>(
+        ForStatementSyntax* retn = parser->CreateNode(ForStatementSyntax {
             forToken,
             openParen,
             decl,
@@ -2159,7 +2163,7 @@ namespace Alchemy::Compilation {
             incrementors,
             parser->EatToken(TokenKind::CloseParenToken),
             ParseEmbeddedStatement(parser)
-        );
+        });
 
         parser->termState = saveTerm;
         return retn;
@@ -2221,22 +2225,22 @@ namespace Alchemy::Compilation {
             arg = ParseIdentifierName(parser);
         }
 
-        return parser->CreateNode<GotoStatementSyntax>(kind, gotoToken, caseOrDefault, arg, parser->EatToken(TokenKind::SemicolonToken));
+        return parser->CreateNode(GotoStatementSyntax {kind, gotoToken, caseOrDefault, arg, parser->EatToken(TokenKind::SemicolonToken)});
     }
 
     ElseClauseSyntax* ParseElseClauseOpt(Parser* parser) {
         return parser->currentToken.kind != TokenKind::ElseKeyword
             ? nullptr
-            : parser->CreateNode<ElseClauseSyntax>(
+            : parser->CreateNode(ElseClauseSyntax {
                 parser->EatToken(TokenKind::ElseKeyword),
                 ParseEmbeddedStatement(parser)
-            );
+            });
     }
 
     ExpressionStatementSyntax* ParseExpressionStatement(Parser* parser, ExpressionSyntax* expression) {
         // Do not report an error if the expression is not a statement expression.
         // The error is reported in semantic analysis.
-        return parser->CreateNode<ExpressionStatementSyntax>(expression, parser->EatToken(TokenKind::SemicolonToken));
+        return parser->CreateNode(ExpressionStatementSyntax {expression, parser->EatToken(TokenKind::SemicolonToken)});
     }
 
     ExpressionStatementSyntax* ParseExpressionStatement(Parser* parser) {
@@ -2244,27 +2248,27 @@ namespace Alchemy::Compilation {
     }
 
     IfStatementSyntax* ParseIfStatement(Parser* parser) {
-        return parser->CreateNode<IfStatementSyntax>(
+        return parser->CreateNode(IfStatementSyntax {
             parser->EatToken(TokenKind::IfKeyword),
             parser->EatToken(TokenKind::OpenParenToken),
             ParseExpression(parser),
             parser->EatToken(TokenKind::CloseParenToken),
             ParseEmbeddedStatement(parser),
             ParseElseClauseOpt(parser)
-        );
+        });
     }
 
     IfStatementSyntax* ParseMisplacedElse(Parser* parser) {
         assert(parser->currentToken.kind == TokenKind::ElseKeyword);
 
-        return parser->CreateNode<IfStatementSyntax>(
+        return parser->CreateNode(IfStatementSyntax {
             parser->EatToken(TokenKind::IfKeyword, ErrorCode::ERR_ElseCannotStartStatement),
             parser->EatToken(TokenKind::OpenParenToken),
             ParseExpression(parser),
             parser->EatToken(TokenKind::CloseParenToken),
             ParseExpressionStatement(parser),
             ParseElseClauseOpt(parser)
-        );
+        });
 
     }
 
@@ -2502,7 +2506,12 @@ namespace Alchemy::Compilation {
 
         tk = parser->currentToken.contextualKind;
 
-        bool isPossibleModifier = SyntaxFacts::IsAdditionalLocalFunctionModifier(tk) || ShouldContextualKeywordBeTreatedAsModifier(parser, true);
+        // only contextual modifiers need the look ahead, it asserts on anything else (ie. every `x = y;`)
+        bool isPossibleModifier = SyntaxFacts::IsAdditionalLocalFunctionModifier(tk) || (
+            parser->currentToken.kind == TokenKind::IdentifierToken &&
+            GetModifier(parser->currentToken) != DeclarationModifiers::None &&
+            ShouldContextualKeywordBeTreatedAsModifier(parser, true)
+        );
 
         if (isPossibleModifier) {
             return true;
@@ -2596,12 +2605,12 @@ namespace Alchemy::Compilation {
             }
         }
 
-        return parser->CreateNode<LocalDeclarationStatementSyntax>(
+        return parser->CreateNode(LocalDeclarationStatementSyntax {
             usingKeyword,
             mods.Persist(parser->allocator),
-            parser->CreateNode<VariableDeclarationSyntax>(type, variables.ToList(parser->allocator)),
+            parser->CreateNode(VariableDeclarationSyntax {type, variables.ToList(parser->allocator)}),
             parser->EatToken(TokenKind::SemicolonToken)
-        );
+        });
 
     }
 
@@ -2624,30 +2633,30 @@ namespace Alchemy::Compilation {
 
     WhileStatementSyntax* ParseWhileStatement(Parser* parser) {
         assert(parser->currentToken.kind == TokenKind::WhileKeyword);
-        return parser->CreateNode<WhileStatementSyntax>(
+        return parser->CreateNode(WhileStatementSyntax {
             parser->EatToken(TokenKind::WhileKeyword),
             parser->EatToken(TokenKind::OpenParenToken),
             ParseExpression(parser),
             parser->EatToken(TokenKind::CloseParenToken),
             ParseEmbeddedStatement(parser)
-        );
+        });
     }
 
     ThrowStatementSyntax* ParseThrowStatement(Parser* parser) {
         assert(parser->currentToken.kind == TokenKind::ThrowKeyword);
-        return parser->CreateNode<ThrowStatementSyntax>(
+        return parser->CreateNode(ThrowStatementSyntax {
             parser->EatToken(TokenKind::ThrowKeyword),
             parser->currentToken.kind != TokenKind::SemicolonToken ? ParseExpression(parser) : nullptr,
             parser->EatToken(TokenKind::SemicolonToken)
-        );
+        });
     }
 
     BlockSyntax* MissingBlock(Parser* parser) {
-        return parser->CreateNode<BlockSyntax>(
+        return parser->CreateNode(BlockSyntax {
             MakeMissingToken(TokenKind::OpenBraceToken, parser->ptr),
             nullptr,
             MakeMissingToken(TokenKind::CloseBraceToken, parser->ptr)
-        );
+        });
     }
 
     CatchClauseSyntax* ParseCatchClause(Parser* parser) {
@@ -2671,7 +2680,7 @@ namespace Alchemy::Compilation {
             parser->termState = saveTerm;
 
             SyntaxToken closeParen = parser->EatToken(TokenKind::CloseParenToken);
-            decl = parser->CreateNode<CatchDeclarationSyntax>(openParen, type, name, closeParen);
+            decl = parser->CreateNode(CatchDeclarationSyntax {openParen, type, name, closeParen});
         }
 
         CatchFilterClauseSyntax* filter = nullptr;
@@ -2686,14 +2695,14 @@ namespace Alchemy::Compilation {
 
             parser->termState = saveTerm;
             SyntaxToken closeParen = parser->EatToken(TokenKind::CloseParenToken);
-            filter = parser->CreateNode<CatchFilterClauseSyntax>(whenKeyword, openParen, filterExpression, closeParen);
+            filter = parser->CreateNode(CatchFilterClauseSyntax {whenKeyword, openParen, filterExpression, closeParen});
         }
 
         parser->termState |= TerminatorState::IsEndOfCatchBlock;
         BlockSyntax* block = ParseBlock(parser);
         parser->termState = saveTerm;
 
-        return parser->CreateNode<CatchClauseSyntax>(catchKeyword, decl, filter, block);
+        return parser->CreateNode(CatchClauseSyntax {catchKeyword, decl, filter, block});
     }
 
     TryStatementSyntax* ParseTryStatement(Parser* parser) {
@@ -2728,27 +2737,27 @@ namespace Alchemy::Compilation {
         }
 
         if (parser->currentToken.kind == TokenKind::FinallyKeyword) {
-            finallyClause = parser->CreateNode<FinallyClauseSyntax>(
+            finallyClause = parser->CreateNode(FinallyClauseSyntax {
                 parser->EatToken(),
                 ParseBlock(parser)
-            );
+            });
         }
 
         if (catchClauses.size == 0 && finallyClause == nullptr) {
             parser->AddError(tryBlock, ErrorCode::ERR_ExpectedEndTry);
             // synthesize missing tokens for "finally { }":
-            finallyClause = parser->CreateNode<FinallyClauseSyntax>(
+            finallyClause = parser->CreateNode(FinallyClauseSyntax {
                 MakeMissingToken(TokenKind::FinallyKeyword, parser->ptr),
                 MissingBlock(parser)
-            );
+            });
         }
 
-        return parser->CreateNode<TryStatementSyntax>(
+        return parser->CreateNode(TryStatementSyntax {
             tryKeyword,
             tryBlock,
             catchClauses.ToSyntaxList(parser->allocator),
             finallyClause
-        );
+        });
 
     }
 
@@ -2809,18 +2818,18 @@ namespace Alchemy::Compilation {
                 SyntaxToken caseKeyword = parser->EatToken();
 
                 if (parser->currentToken.kind == TokenKind::ColonToken) {
-                    label = parser->CreateNode<CaseSwitchLabelSyntax>(
+                    label = parser->CreateNode(CaseSwitchLabelSyntax {
                         caseKeyword,
                         ParseIdentifierName(parser, ErrorCode::ERR_ConstantExpected),
                         parser->EatToken(TokenKind::ColonToken)
-                    );
+                    });
                 }
                 else {
                     SyntaxBase* node = ParseExpressionOrPatternForSwitchStatement(parser);
 
                     // if there is a 'when' token, we treat a case expression as a constant pattern.
                     if (parser->currentToken.contextualKind == TokenKind::WhenKeyword && SyntaxFacts::IsExpressionSyntax(node->GetKind())) {
-                        node = parser->CreateNode<ConstantPatternSyntax>((ExpressionSyntax*) node);
+                        node = parser->CreateNode(ConstantPatternSyntax {(ExpressionSyntax*) node});
                     }
 
                     if (node->GetKind() == SyntaxKind::DiscardPattern) {
@@ -2828,28 +2837,28 @@ namespace Alchemy::Compilation {
                     }
 
                     if (SyntaxFacts::IsPatternSyntax(node->GetKind())) {
-                        label = parser->CreateNode<CasePatternSwitchLabelSyntax>(
+                        label = parser->CreateNode(CasePatternSwitchLabelSyntax {
                             caseKeyword,
                             (PatternSyntax*) node,
                             ParseWhenClause(parser, Precedence::Expression),
                             parser->EatToken(TokenKind::ColonToken)
-                        );
+                        });
                     }
                     else {
-                        label = parser->CreateNode<CaseSwitchLabelSyntax>(
+                        label = parser->CreateNode(CaseSwitchLabelSyntax {
                             caseKeyword,
                             (ExpressionSyntax*) node,
                             parser->EatToken(TokenKind::ColonToken)
-                        );
+                        });
                     }
                 }
             }
             else {
                 assert(parser->currentToken.kind == TokenKind::DefaultKeyword);
-                label = parser->CreateNode<DefaultSwitchLabelSyntax>(
+                label = parser->CreateNode(DefaultSwitchLabelSyntax {
                     parser->EatToken(TokenKind::DefaultKeyword),
                     parser->EatToken(TokenKind::ColonToken)
-                );
+                });
             }
 
             labels.Add(label);
@@ -2858,10 +2867,10 @@ namespace Alchemy::Compilation {
         // Next, parse statement list stopping for new sections
         ParseStatements(parser, &statements, true);
 
-        return parser->CreateNode<SwitchSectionSyntax>(
+        return parser->CreateNode(SwitchSectionSyntax {
             labels.ToSyntaxList(parser->allocator),
             statements.ToSyntaxList(parser->allocator)
-        );
+        });
     }
 
     SwitchStatementSyntax* ParseSwitchStatement(Parser* parser) {
@@ -2882,7 +2891,7 @@ namespace Alchemy::Compilation {
             sections.Add(ParseSwitchSection(parser));
         }
 
-        return parser->CreateNode<SwitchStatementSyntax>(
+        return parser->CreateNode(SwitchStatementSyntax {
             switchKeyword,
             openParen,
             expression,
@@ -2890,7 +2899,7 @@ namespace Alchemy::Compilation {
             openBrace,
             sections.ToSyntaxList(parser->allocator),
             parser->EatToken(TokenKind::CloseBraceToken)
-        );
+        });
     }
 
     bool IsUsingStatementVariableDeclaration(Parser* parser, ScanTypeFlags st) {
@@ -2974,14 +2983,14 @@ namespace Alchemy::Compilation {
         ResetPoint resetPoint(parser, false);
         ParseUsingExpression(parser, &declaration, &expression, &resetPoint);
 
-        return parser->CreateNode<UsingStatementSyntax>(
+        return parser->CreateNode(UsingStatementSyntax {
             usingKeyword,
             openParen,
             declaration,
             expression,
             parser->EatToken(TokenKind::CloseParenToken),
             ParseEmbeddedStatement(parser)
-        );
+        });
     }
 
     StatementSyntax* ParseStatementStartingWithUsing(Parser* parser) {
@@ -3001,13 +3010,13 @@ namespace Alchemy::Compilation {
         SyntaxToken colon = parser->EatToken(TokenKind::ColonToken);
         StatementSyntax* statement = ParseStatement(parser);
         if (statement == nullptr) {
-            statement = parser->CreateNode<EmptyStatementSyntax>(parser->EatToken(TokenKind::SemicolonToken));
+            statement = parser->CreateNode(EmptyStatementSyntax {parser->EatToken(TokenKind::SemicolonToken)});
         }
-        return parser->CreateNode<LabeledStatementSyntax>(
+        return parser->CreateNode(LabeledStatementSyntax {
             identifier,
             colon,
             statement
-        );
+        });
     }
 
     StatementSyntax* TryParseStatementStartingWithIdentifier(Parser* parser) {
@@ -3040,9 +3049,9 @@ namespace Alchemy::Compilation {
             default:
                 break;
             case TokenKind::BreakKeyword:
-                return parser->CreateNode<BreakStatementSyntax>(parser->EatToken(TokenKind::BreakKeyword), parser->EatToken(TokenKind::SemicolonToken));
+                return parser->CreateNode(BreakStatementSyntax {parser->EatToken(TokenKind::BreakKeyword), parser->EatToken(TokenKind::SemicolonToken)});
             case TokenKind::ContinueKeyword:
-                return parser->CreateNode<ContinueStatementSyntax>(parser->EatToken(TokenKind::ContinueKeyword), parser->EatToken(TokenKind::SemicolonToken));
+                return parser->CreateNode(ContinueStatementSyntax {parser->EatToken(TokenKind::ContinueKeyword), parser->EatToken(TokenKind::SemicolonToken)});
             case TokenKind::TryKeyword:
             case TokenKind::CatchKeyword:
             case TokenKind::FinallyKeyword:
@@ -3064,7 +3073,7 @@ namespace Alchemy::Compilation {
                 SyntaxToken returnKeyword = parser->EatToken(TokenKind::ReturnKeyword);
                 ExpressionSyntax * expression = parser->currentToken.kind != TokenKind::SemicolonToken ? ParsePossibleRefExpression(parser) : nullptr;
                 SyntaxToken semicolon = parser->EatToken(TokenKind::SemicolonToken);
-                return parser->CreateNode<ReturnStatementSyntax>(returnKeyword, expression, semicolon);
+                return parser->CreateNode(ReturnStatementSyntax {returnKeyword, expression, semicolon});
             }
             case TokenKind::SwitchKeyword:
             case TokenKind::CaseKeyword: // error recovery case.
@@ -3079,7 +3088,7 @@ namespace Alchemy::Compilation {
             case TokenKind::OpenBraceToken:
                 return ParseBlock(parser);
             case TokenKind::SemicolonToken:
-                return parser->CreateNode<EmptyStatementSyntax>(parser->EatToken());
+                return parser->CreateNode(EmptyStatementSyntax {parser->EatToken()});
             case TokenKind::IdentifierToken:
                 result = TryParseStatementStartingWithIdentifier(parser);
                 if (result != nullptr)
@@ -3144,11 +3153,11 @@ namespace Alchemy::Compilation {
 
         ParseStatements(parser, &statements, false);
 
-        return parser->CreateNode<BlockSyntax>(
+        return parser->CreateNode(BlockSyntax {
             openBrace,
             statements.ToSyntaxList(parser->allocator),
             parser->EatToken(TokenKind::CloseBraceToken)
-        );
+        });
     }
 
     void ParseLambdaBody(Parser* parser, BlockSyntax** block, ExpressionSyntax** expression) {
@@ -3193,14 +3202,14 @@ namespace Alchemy::Compilation {
                 expression
             );
 
-            return parser->CreateNode<ParenthesizedLambdaExpressionSyntax>(
+            return parser->CreateNode(ParenthesizedLambdaExpressionSyntax {
                 modifiers,
                 returnType,
                 paramList,
                 arrow,
                 block,
                 expression
-            );
+            });
         }
         else {
             // Unparenthesized lambda case
@@ -3213,17 +3222,17 @@ namespace Alchemy::Compilation {
             // Case x=>, x =>
             SyntaxToken arrow = parser->EatToken(TokenKind::EqualsGreaterThanToken);
 
-            ParameterSyntax* parameter = parser->CreateNode<ParameterSyntax>(nullptr, nullptr, identifier, nullptr);
+            ParameterSyntax* parameter = parser->CreateNode(ParameterSyntax {nullptr, nullptr, identifier, nullptr});
 
             ParseLambdaBody(parser, &block, &expression);
 
-            return parser->CreateNode<SimpleLambdaExpressionSyntax>(
+            return parser->CreateNode(SimpleLambdaExpressionSyntax {
                 modifiers,
                 parameter,
                 arrow,
                 block,
                 expression
-            );
+            });
         }
     }
 
@@ -3271,10 +3280,10 @@ namespace Alchemy::Compilation {
     CollectionElementSyntax* ParseCollectionElement(Parser* parser) {
 
         if (parser->currentToken.kind == TokenKind::DotDotToken) {
-            return parser->CreateNode<SpreadElementSyntax>(parser->EatToken(), ParseExpression(parser));
+            return parser->CreateNode(SpreadElementSyntax {parser->EatToken(), ParseExpression(parser)});
         }
 
-        return parser->CreateNode<ExpressionElementSyntax>(ParseExpression(parser));
+        return parser->CreateNode(ExpressionElementSyntax {ParseExpression(parser)});
     }
 
     CollectionExpressionSyntax* ParseCollectionExpression(Parser* parser) {
@@ -3292,7 +3301,7 @@ namespace Alchemy::Compilation {
             false
         );
 
-        return parser->CreateNode<CollectionExpressionSyntax>(openBracket, list, parser->EatToken(TokenKind::CloseBracketToken));
+        return parser->CreateNode(CollectionExpressionSyntax {openBracket, list, parser->EatToken(TokenKind::CloseBracketToken)});
 
     }
 
@@ -3419,12 +3428,12 @@ namespace Alchemy::Compilation {
 
             ExpressionSyntax* expression = ParseExpressionOrDeclaration(parser, ParseTypeMode::AfterTupleComma, true);
             ArgumentSyntax* argument = expression->GetKind() != SyntaxKind::IdentifierName || parser->currentToken.kind != TokenKind::ColonToken
-                ? parser->CreateNode<ArgumentSyntax>(nullptr, SyntaxToken(), expression)
-                : parser->CreateNode<ArgumentSyntax>(
-                    parser->CreateNode<NameColonSyntax>((IdentifierNameSyntax*) expression, parser->EatToken()),
+                ? parser->CreateNode(ArgumentSyntax {nullptr, SyntaxToken(), expression})
+                : parser->CreateNode(ArgumentSyntax {
+                    parser->CreateNode(NameColonSyntax {(IdentifierNameSyntax*) expression, parser->EatToken()}),
                     SyntaxToken(),
                     ParseExpressionOrDeclaration(parser, ParseTypeMode::AfterTupleComma, true)
-                );
+                });
 
             list.Add(argument);
         }
@@ -3433,12 +3442,12 @@ namespace Alchemy::Compilation {
             ExpressionSyntax* expressionSyntax = CreateMissingIdentifierName(parser);
 
             list.AddSeparator(parser->CreateMissingToken(TokenKind::CommaToken));
-            list.Add(parser->CreateNode<ArgumentSyntax>(nullptr, SyntaxToken(), expressionSyntax));
+            list.Add(parser->CreateNode(ArgumentSyntax {nullptr, SyntaxToken(), expressionSyntax}));
             parser->AddError(expressionSyntax, ErrorCode::ERR_TupleTooFewElements);
 
         }
 
-        return parser->CreateNode<TupleExpressionSyntax>(openToken, list.ToList(parser->allocator), parser->EatToken(TokenKind::CloseParenToken));
+        return parser->CreateNode(TupleExpressionSyntax {openToken, list.ToList(parser->allocator), parser->EatToken(TokenKind::CloseParenToken)});
     }
 
     ExpressionSyntax* ParseCastOrParenExpressionOrTuple(Parser* parser) {
@@ -3452,12 +3461,12 @@ namespace Alchemy::Compilation {
             // Looks like a cast, so parse it as one.
             resetPoint.Reset();
 
-            return parser->CreateNode<CastExpressionSyntax>(
+            return parser->CreateNode(CastExpressionSyntax {
                 parser->EatToken(TokenKind::OpenParenToken),
                 ParseType(parser),
                 parser->EatToken(TokenKind::CloseParenToken),
                 ParseSubExpression(parser, Precedence::Cast)
-            );
+            });
 
         }
         // Doesn't look like a cast, so parse this as a parenthesized expression or tuple.
@@ -3467,16 +3476,16 @@ namespace Alchemy::Compilation {
 
         //  ( <expr>,    must be a tuple
         if (parser->currentToken.kind == TokenKind::CommaToken) {
-            return ParseTupleExpressionTail(parser, openParen, parser->CreateNode<ArgumentSyntax>(nullptr, SyntaxToken(), expression));
+            return ParseTupleExpressionTail(parser, openParen, parser->CreateNode(ArgumentSyntax {nullptr, SyntaxToken(), expression}));
         }
 
         // ( name:
         if (expression->GetKind() == SyntaxKind::IdentifierName && parser->currentToken.kind == TokenKind::ColonToken) {
-            NameColonSyntax* nameColonSyntax = parser->CreateNode<NameColonSyntax>((IdentifierNameSyntax*) expression, parser->EatToken());
-            return ParseTupleExpressionTail(parser, openParen, parser->CreateNode<ArgumentSyntax>(nameColonSyntax, SyntaxToken(), ParseExpressionOrDeclaration(parser, ParseTypeMode::FirstElementOfPossibleTupleLiteral, true)));
+            NameColonSyntax* nameColonSyntax = parser->CreateNode(NameColonSyntax {(IdentifierNameSyntax*) expression, parser->EatToken()});
+            return ParseTupleExpressionTail(parser, openParen, parser->CreateNode(ArgumentSyntax {nameColonSyntax, SyntaxToken(), ParseExpressionOrDeclaration(parser, ParseTypeMode::FirstElementOfPossibleTupleLiteral, true)}));
         }
 
-        return parser->CreateNode<ParenthesizedExpressionSyntax>(openParen, expression, parser->EatToken(TokenKind::CloseParenToken));
+        return parser->CreateNode(ParenthesizedExpressionSyntax {openParen, expression, parser->EatToken(TokenKind::CloseParenToken)});
     }
 
     bool IsAnonymousType(Parser* parser) {
@@ -3488,17 +3497,17 @@ namespace Alchemy::Compilation {
     }
 
     NameEqualsSyntax* ParseNameEquals(Parser* parser) {
-        return parser->CreateNode<NameEqualsSyntax>(
-            parser->CreateNode<IdentifierNameSyntax>(ParseIdentifierToken(parser)),
+        return parser->CreateNode(NameEqualsSyntax {
+            parser->CreateNode(IdentifierNameSyntax {ParseIdentifierToken(parser)}),
             parser->EatToken(TokenKind::EqualsToken)
-        );
+        });
     }
 
     AnonymousObjectMemberDeclaratorSyntax* ParseAnonymousTypeMemberInitializer(Parser* parser) {
-        return parser->CreateNode<AnonymousObjectMemberDeclaratorSyntax>(
+        return parser->CreateNode(AnonymousObjectMemberDeclaratorSyntax {
             IsNamedAssignment(parser) ? ParseNameEquals(parser) : nullptr,
             ParseExpression(parser)
-        );
+        });
     }
 
     PostSkipAction SkipBadInitializerListTokens(Parser* parser, TokenKind expectedKind, TokenKind closeKind) {
@@ -3527,12 +3536,12 @@ namespace Alchemy::Compilation {
             false  // allowSemicolonAsSeparator
         );
 
-        return parser->CreateNode<AnonymousObjectCreationExpressionSyntax>(
+        return parser->CreateNode(AnonymousObjectCreationExpressionSyntax {
             newToken,
             openBrace,
             expressions,
             parser->EatToken(TokenKind::CloseBraceToken)
-        );
+        });
 
     }
 
@@ -3565,13 +3574,13 @@ namespace Alchemy::Compilation {
             break;
         }
 
-        return parser->CreateNode<ImplicitArrayCreationExpressionSyntax>(
+        return parser->CreateNode(ImplicitArrayCreationExpressionSyntax {
             newKeyword,
             openBracket,
             commas.Persist(parser->allocator),
             parser->EatToken(TokenKind::CloseBracketToken),
             ParseArrayInitializer(parser)
-        );
+        });
 
     }
 
@@ -3654,34 +3663,34 @@ namespace Alchemy::Compilation {
             false
         );
 
-        return parser->CreateNode<InitializerExpressionSyntax>(
+        return parser->CreateNode(InitializerExpressionSyntax {
             SyntaxKind::ComplexElementInitializerExpression,
             openBrace,
             initializers,
             parser->EatToken(TokenKind::CloseBraceToken)
-        );
+        });
     }
 
     AssignmentExpressionSyntax* ParseDictionaryInitializer(Parser* parser) {
-        return parser->CreateNode<AssignmentExpressionSyntax>(
+        return parser->CreateNode(AssignmentExpressionSyntax {
             SyntaxKind::SimpleAssignmentExpression,
-            parser->CreateNode<ImplicitElementAccessSyntax>(ParseBracketedArgumentList(parser)),
+            parser->CreateNode(ImplicitElementAccessSyntax {ParseBracketedArgumentList(parser)}),
             parser->EatToken(TokenKind::EqualsToken),
             parser->currentToken.kind == TokenKind::OpenBraceToken
                 ? ParseObjectOrCollectionInitializer(parser)
                 : ParsePossibleRefExpression(parser)
-        );
+        });
     }
 
     AssignmentExpressionSyntax* ParseObjectInitializerNamedAssignment(Parser* parser) {
-        return parser->CreateNode<AssignmentExpressionSyntax>(
+        return parser->CreateNode(AssignmentExpressionSyntax {
             SyntaxKind::SimpleAssignmentExpression,
             ParseIdentifierName(parser),
             parser->EatToken(TokenKind::EqualsToken),
             parser->currentToken.kind == TokenKind::OpenBraceToken
                 ? ParseObjectOrCollectionInitializer(parser)
                 : ParsePossibleRefExpression(parser)
-        );
+        });
     }
 
     ExpressionSyntax* ParseObjectOrCollectionInitializerMember(Parser* parser) {
@@ -3725,12 +3734,12 @@ namespace Alchemy::Compilation {
 
         SyntaxKind kind = IsObjectInitializer(initializers) ? SyntaxKind::ObjectInitializerExpression : SyntaxKind::CollectionInitializerExpression;
 
-        return parser->CreateNode<InitializerExpressionSyntax>(
+        return parser->CreateNode(InitializerExpressionSyntax {
             kind,
             openBrace,
             initializers,
             parser->EatToken(TokenKind::CloseBraceToken)
-        );
+        });
 
     }
 
@@ -3749,7 +3758,7 @@ namespace Alchemy::Compilation {
 //                    initializer = ParseArrayInitializer(parser);
 //                }
 //
-//                return parser->CreateNode<ArrayCreationExpressionSyntax>(newKeyword, (ArrayTypeSyntax*) type, initializer);
+//                return parser->CreateNode(ArrayCreationExpressionSyntax {newKeyword, (ArrayTypeSyntax*) type, initializer});
 //            }
         }
 
@@ -3764,16 +3773,16 @@ namespace Alchemy::Compilation {
         // we need one or the other. todo -- don't bother reporting this if we already complained about the new type.
         if (argumentList == nullptr && initializer == nullptr) {
 
-            argumentList = parser->CreateNode<ArgumentListSyntax>(
+            argumentList = parser->CreateNode(ArgumentListSyntax {
                 parser->EatToken(TokenKind::OpenParenToken, ErrorCode::ERR_BadNewExpr),
                 parser->allocator->New<SeparatedSyntaxList<ArgumentSyntax >>(0, nullptr, 0, nullptr),
                 parser->CreateMissingToken(TokenKind::CloseParenToken)
-            );
+            });
         }
 
         return type == nullptr
-            ? (ExpressionSyntax*) parser->CreateNode<ImplicitObjectCreationExpressionSyntax>(newKeyword, argumentList, initializer)
-            : (ExpressionSyntax*) parser->CreateNode<ObjectCreationExpressionSyntax>(newKeyword, type, argumentList, initializer);
+            ? (ExpressionSyntax*) parser->CreateNode(ImplicitObjectCreationExpressionSyntax {newKeyword, argumentList, initializer})
+            : (ExpressionSyntax*) parser->CreateNode(ObjectCreationExpressionSyntax {newKeyword, type, argumentList, initializer});
 
     }
 
@@ -3797,7 +3806,7 @@ namespace Alchemy::Compilation {
         SyntaxToken start = parser->EatToken();
         ExpressionSyntax* expression = ParseExpression(parser);
         SyntaxToken end = parser->EatToken(TokenKind::InterpolatedExpressionEnd);
-        return parser->CreateNode<InterpolatedStringExpressionSyntax>(start, expression, end);
+        return parser->CreateNode(InterpolatedStringExpressionSyntax {start, expression, end});
     }
 
     ExpressionSyntax* ParseRawStringLiteral(Parser* parser) {
@@ -3809,12 +3818,12 @@ namespace Alchemy::Compilation {
         while (true) {
             switch (parser->currentToken.kind) {
                 case TokenKind::StringLiteralPart: {
-                    builder.Add(parser->CreateNode<StringLiteralPartSyntax>(parser->EatToken()));
+                    builder.Add(parser->CreateNode(StringLiteralPartSyntax {parser->EatToken()}));
                     break;
                 }
                 case TokenKind::InterpolatedIdentifier: {
                     // todo -- do we need to check that the identifier is not reserved?
-                    builder.Add(parser->CreateNode<InterpolatedIdentifierPartSyntax>(parser->EatToken()));
+                    builder.Add(parser->CreateNode(InterpolatedIdentifierPartSyntax {parser->EatToken()}));
                     break;
                 }
                 case TokenKind::InterpolatedExpressionStart: {
@@ -3822,14 +3831,14 @@ namespace Alchemy::Compilation {
                     break;
                 }
                 default: {
-                    break;
+                    goto end;
                 }
             }
         }
-
+        end:
         SyntaxList<StringPartSyntax>* parts = builder.ToSyntaxList(parser->allocator);
         SyntaxToken end = parser->EatToken(TokenKind::RawStringLiteralEnd);
-        return parser->CreateNode<RawStringLiteralExpression>(start, parts, end);
+        return parser->CreateNode(RawStringLiteralExpression {start, parts, end});
     }
 
     ExpressionSyntax* ParseStringLiteral(Parser* parser) {
@@ -3841,12 +3850,12 @@ namespace Alchemy::Compilation {
         while (true) {
             switch (parser->currentToken.kind) {
                 case TokenKind::StringLiteralPart: {
-                    builder.Add(parser->CreateNode<StringLiteralPartSyntax>(parser->EatToken()));
+                    builder.Add(parser->CreateNode(StringLiteralPartSyntax {parser->EatToken()}));
                     break;
                 }
                 case TokenKind::InterpolatedIdentifier: {
                     // todo -- do we need to check that the identifier is not reserved?
-                    builder.Add(parser->CreateNode<InterpolatedIdentifierPartSyntax>(parser->EatToken()));
+                    builder.Add(parser->CreateNode(InterpolatedIdentifierPartSyntax {parser->EatToken()}));
                     break;
                 }
                 case TokenKind::InterpolatedExpressionStart: {
@@ -3861,7 +3870,7 @@ namespace Alchemy::Compilation {
         end:
         SyntaxList<StringPartSyntax>* parts = builder.ToSyntaxList(parser->allocator);
         SyntaxToken end = parser->EatToken(TokenKind::StringLiteralEnd);
-        return parser->CreateNode<StringLiteralExpression>(start, parts, end);
+        return parser->CreateNode(StringLiteralExpression {start, parts, end});
     }
 
     CharacterLiteralExpressionSyntax* ParseCharacterLiteral(Parser* parser) {
@@ -3875,7 +3884,7 @@ namespace Alchemy::Compilation {
             content = parser->EatToken();
         }
         SyntaxToken end = parser->EatToken(TokenKind::CharLiteralEnd);
-        return parser->CreateNode<CharacterLiteralExpressionSyntax>(start, content, end);
+        return parser->CreateNode(CharacterLiteralExpressionSyntax {start, content, end});
     }
 
     ExpressionSyntax* ParseTermWithoutPostfix(Parser* parser, Precedence precedence) {
@@ -3927,10 +3936,10 @@ namespace Alchemy::Compilation {
                     : (ExpressionSyntax*) ParseCollectionExpression(parser);
 
             case TokenKind::ThisKeyword:
-                return parser->CreateNode<ThisExpressionSyntax>(parser->EatToken());
+                return parser->CreateNode(ThisExpressionSyntax {parser->EatToken()});
 
             case TokenKind::BaseKeyword: {
-                return parser->CreateNode<BaseExpressionSyntax>(parser->EatToken());
+                return parser->CreateNode(BaseExpressionSyntax {parser->EatToken()});
             }
 
             case TokenKind::FalseKeyword:
@@ -3938,7 +3947,7 @@ namespace Alchemy::Compilation {
             case TokenKind::NullKeyword:
             case TokenKind::NumericLiteralToken:
             case TokenKind::StringLiteralEmpty:
-                return parser->CreateNode<LiteralExpressionSyntax>(SyntaxFacts::GetLiteralExpression(tk), parser->EatToken());
+                return parser->CreateNode(LiteralExpressionSyntax {SyntaxFacts::GetLiteralExpression(tk), parser->EatToken()});
             case TokenKind::RawStringLiteralStart: {
                 return ParseRawStringLiteral(parser);
             }
@@ -3954,8 +3963,8 @@ namespace Alchemy::Compilation {
                     if (lambda != nullptr) {
                         return lambda;
                     }
-                    return ParseCastOrParenExpressionOrTuple(parser);
                 }
+                return ParseCastOrParenExpressionOrTuple(parser);
             }
             case TokenKind::NewKeyword:
                 return ParseNewExpression(parser);
@@ -3969,7 +3978,7 @@ namespace Alchemy::Compilation {
                 }
                 // ref is not expected to appear in this position.
                 SyntaxToken refKeyword = parser->EatToken();
-                ExpressionSyntax* expression = parser->CreateNode<RefExpressionSyntax>(refKeyword, ParseExpression(parser));
+                ExpressionSyntax* expression = parser->CreateNode(RefExpressionSyntax {refKeyword, ParseExpression(parser)});
                 parser->AddError(expression, ErrorCode::ERR_InvalidExprTerm);
                 return expression;
             }
@@ -3980,7 +3989,7 @@ namespace Alchemy::Compilation {
                     }
 
                     // check for intrinsic type followed by '.'
-                    ExpressionSyntax* expr = parser->CreateNode<PredefinedTypeSyntax>(parser->EatToken());
+                    ExpressionSyntax* expr = parser->CreateNode(PredefinedTypeSyntax {parser->EatToken()});
 
                     if (parser->currentToken.kind != TokenKind::DotToken || tk == TokenKind::VoidKeyword) {
                         parser->AddError(expr, ErrorCode::ERR_InvalidExprTerm);
@@ -4042,10 +4051,10 @@ namespace Alchemy::Compilation {
         assert(parser->currentToken.kind == TokenKind::DotToken || parser->currentToken.kind == TokenKind::OpenBracketToken);
         ExpressionSyntax* expr = nullptr;
         if (parser->currentToken.kind == TokenKind::DotToken) {
-            expr = parser->CreateNode<MemberBindingExpressionSyntax>(parser->EatToken(), ParseSimpleName(parser, NameOptions::InExpression));
+            expr = parser->CreateNode(MemberBindingExpressionSyntax {parser->EatToken(), ParseSimpleName(parser, NameOptions::InExpression)});
         }
         else if (parser->currentToken.kind == TokenKind::OpenBracketToken) {
-            expr = parser->CreateNode<ElementBindingExpressionSyntax>(ParseBracketedArgumentList(parser));
+            expr = parser->CreateNode(ElementBindingExpressionSyntax {ParseBracketedArgumentList(parser)});
         }
         else {
             UNREACHABLE("ParseConsequenceSyntax");
@@ -4055,25 +4064,25 @@ namespace Alchemy::Compilation {
 
             switch (parser->currentToken.kind) {
                 case TokenKind::OpenParenToken:
-                    expr = parser->CreateNode<InvocationExpressionSyntax>(expr, ParseParenthesizedArgumentList(parser));
+                    expr = parser->CreateNode(InvocationExpressionSyntax {expr, ParseParenthesizedArgumentList(parser)});
                     continue;
 
                 case TokenKind::OpenBracketToken:
-                    expr = parser->CreateNode<ElementAccessExpressionSyntax>(expr, ParseBracketedArgumentList(parser));
+                    expr = parser->CreateNode(ElementAccessExpressionSyntax {expr, ParseBracketedArgumentList(parser)});
                     continue;
 
                 case TokenKind::DotToken:
-                    expr = parser->CreateNode<MemberAccessExpressionSyntax>(SyntaxKind::SimpleMemberAccessExpression, expr, parser->EatToken(), ParseSimpleName(parser, NameOptions::InExpression));
+                    expr = parser->CreateNode(MemberAccessExpressionSyntax {SyntaxKind::SimpleMemberAccessExpression, expr, parser->EatToken(), ParseSimpleName(parser, NameOptions::InExpression)});
                     continue;
 
                 case TokenKind::QuestionToken:
                     return !CanStartConsequenceExpression(parser)
                         ? expr
-                        : parser->CreateNode<ConditionalAccessExpressionSyntax>(
+                        : parser->CreateNode(ConditionalAccessExpressionSyntax {
                             expr,
                             parser->EatToken(),
                             ParseConsequenceSyntax(parser)
-                        );
+                        });
 
                 default:
                     return expr;
@@ -4085,16 +4094,16 @@ namespace Alchemy::Compilation {
         while (true) {
             switch (parser->currentToken.kind) {
                 case TokenKind::OpenParenToken:
-                    expr = parser->CreateNode<InvocationExpressionSyntax>(expr, ParseParenthesizedArgumentList(parser));
+                    expr = parser->CreateNode(InvocationExpressionSyntax {expr, ParseParenthesizedArgumentList(parser)});
                     continue;
 
                 case TokenKind::OpenBracketToken:
-                    expr = parser->CreateNode<ElementAccessExpressionSyntax>(expr, ParseBracketedArgumentList(parser));
+                    expr = parser->CreateNode(ElementAccessExpressionSyntax {expr, ParseBracketedArgumentList(parser)});
                     continue;
 
                 case TokenKind::PlusPlusToken:
                 case TokenKind::MinusMinusToken:
-                    expr = parser->CreateNode<PostfixUnaryExpressionSyntax>(SyntaxFacts::GetPostfixUnaryExpression(parser->currentToken.kind), expr, parser->EatToken());
+                    expr = parser->CreateNode(PostfixUnaryExpressionSyntax {SyntaxFacts::GetPostfixUnaryExpression(parser->currentToken.kind), expr, parser->EatToken()});
                     continue;
 
                 case TokenKind::ColonColonToken:
@@ -4104,12 +4113,12 @@ namespace Alchemy::Compilation {
                         parser->AddError(operatorToken, ErrorCode::ERR_UnexpectedDoubleColon);
 
                         // replace :: with missing dot and annotate with skipped text "::" and error
-                        expr = parser->CreateNode<MemberAccessExpressionSyntax>(
+                        expr = parser->CreateNode(MemberAccessExpressionSyntax {
                             SyntaxKind::SimpleMemberAccessExpression,
                             expr,
                             MakeMissingToken(TokenKind::DotToken, parser->currentToken.GetId()),
                             ParseSimpleName(parser, NameOptions::InExpression)
-                        );
+                        });
                     }
                     else {
                         // just some random trailing :: ?
@@ -4119,7 +4128,7 @@ namespace Alchemy::Compilation {
                     continue;
 
                 case TokenKind::MinusGreaterThanToken:
-                    expr = parser->CreateNode<MemberAccessExpressionSyntax>(SyntaxKind::PointerMemberAccessExpression, expr, parser->EatToken(), ParseSimpleName(parser, NameOptions::InExpression));
+                    expr = parser->CreateNode(MemberAccessExpressionSyntax {SyntaxKind::PointerMemberAccessExpression, expr, parser->EatToken(), ParseSimpleName(parser, NameOptions::InExpression)});
                     continue;
 
                 case TokenKind::DotToken:
@@ -4139,31 +4148,31 @@ namespace Alchemy::Compilation {
                         IdentifierNameSyntax* missing = CreateMissingIdentifierName(parser);
                         parser->AddError(missing, ErrorCode::ERR_IdentifierExpected);
 
-                        return parser->CreateNode<MemberAccessExpressionSyntax>(
+                        return parser->CreateNode(MemberAccessExpressionSyntax {
                             SyntaxKind::SimpleMemberAccessExpression,
                             expr,
                             parser->EatToken(),
                             missing
-                        );
+                        });
                     }
 
-                    expr = parser->CreateNode<MemberAccessExpressionSyntax>(SyntaxKind::SimpleMemberAccessExpression, expr, parser->EatToken(), ParseSimpleName(parser, NameOptions::InExpression));
+                    expr = parser->CreateNode(MemberAccessExpressionSyntax {SyntaxKind::SimpleMemberAccessExpression, expr, parser->EatToken(), ParseSimpleName(parser, NameOptions::InExpression)});
                     continue;
 
                 case TokenKind::QuestionToken:
                     if (CanStartConsequenceExpression(parser)) {
-                        expr = parser->CreateNode<ConditionalAccessExpressionSyntax>(
+                        expr = parser->CreateNode(ConditionalAccessExpressionSyntax {
                             expr,
                             parser->EatToken(),
                             ParseConsequenceSyntax(parser)
-                        );
+                        });
                         continue;
                     }
 
                     return expr;
 
                 case TokenKind::ExclamationToken:
-                    expr = parser->CreateNode<PostfixUnaryExpressionSyntax>(SyntaxKind::BangExpression, expr, parser->EatToken());
+                    expr = parser->CreateNode(PostfixUnaryExpressionSyntax {SyntaxKind::BangExpression, expr, parser->EatToken()});
                     continue;
 
                 default:
@@ -4189,12 +4198,12 @@ namespace Alchemy::Compilation {
             false,
             false
         );
-        return parser->CreateNode<ListPatternSyntax>(
+        return parser->CreateNode(ListPatternSyntax {
             openBracket,
             list,
             parser->EatToken(TokenKind::CloseBracketToken),
             TryParseSimpleDesignation(parser, whenIsKeyword)
-        );
+        });
     }
 
     bool LooksLikeTupleArrayType(Parser* parser) {
@@ -4306,7 +4315,7 @@ namespace Alchemy::Compilation {
 //                ExpressionSyntax* leftExpr;
 //                bool leftConverted = ConvertTypeToExpression(parser, left, &leftExpr, true);
 //                auto newLeft = leftConverted ? leftExpr : left;
-//                *expr = parser->CreateNode<MemberAccessExpressionSyntax>(SyntaxKind::SimpleMemberAccessExpression, newLeft, dotToken, right);
+//                *expr = parser->CreateNode(MemberAccessExpressionSyntax {SyntaxKind::SimpleMemberAccessExpression, newLeft, dotToken, right});
 //                return true;
 //            }
 //        }
@@ -4336,7 +4345,7 @@ namespace Alchemy::Compilation {
             SyntaxToken id = dp->underscore;
             id.kind = TokenKind::IdentifierToken;
             id.contextualKind = TokenKind::IdentifierToken;
-            return parser->CreateNode<IdentifierNameSyntax>(id);
+            return parser->CreateNode(IdentifierNameSyntax {id});
         }
 
         return pattern;
@@ -4355,14 +4364,14 @@ namespace Alchemy::Compilation {
                 ExpressionSyntax* expr = (ExpressionSyntax*) baseExpr;
                 SyntaxToken colon = parser->EatToken();
                 exprColon = expr->GetKind() == SyntaxKind::IdentifierName
-                    ? (BaseExpressionColonSyntax*) parser->CreateNode<NameColonSyntax>((IdentifierNameSyntax*) expr, colon)
-                    : (BaseExpressionColonSyntax*) parser->CreateNode<ExpressionColonSyntax>(expr, colon);
+                    ? (BaseExpressionColonSyntax*) parser->CreateNode(NameColonSyntax {(IdentifierNameSyntax*) expr, colon})
+                    : (BaseExpressionColonSyntax*) parser->CreateNode(ExpressionColonSyntax {expr, colon});
                 pattern = ParsePattern(parser, Precedence::Conditional);
 
             }
         }
 
-        return parser->CreateNode<SubpatternSyntax>(exprColon, pattern);
+        return parser->CreateNode(SubpatternSyntax {exprColon, pattern});
 
     }
 
@@ -4454,11 +4463,11 @@ namespace Alchemy::Compilation {
             false
         );
 
-        return parser->CreateNode<PropertyPatternClauseSyntax>(
+        return parser->CreateNode(PropertyPatternClauseSyntax {
             openBraceToken,
             subPatterns,
             parser->EatToken(TokenKind::CloseBraceToken)
-        );
+        });
     }
 
     bool TryParsePropertyPatternClause(Parser* parser, PropertyPatternClauseSyntax** propertyPatternClauseResult) {
@@ -4485,7 +4494,7 @@ namespace Alchemy::Compilation {
                 // we have a "var" pattern; "var" is not permitted to be a stand-in for a type (or a constant) in a pattern.
                 SyntaxToken varToken = ConvertToKeyword(typeIdentifierToken);
                 VariableDesignationSyntax* varDesignation = ParseDesignation(parser, true);
-                return parser->CreateNode<VarPatternSyntax>(varToken, varDesignation);
+                return parser->CreateNode(VarPatternSyntax {varToken, varDesignation});
             }
         }
 
@@ -4521,12 +4530,12 @@ namespace Alchemy::Compilation {
                     PatternSyntax* subpattern = firstSubPattern->pattern;
                     if (subpattern->GetKind() == SyntaxKind::ConstantPattern) {
                         ConstantPatternSyntax* cp = (ConstantPatternSyntax*) subpattern;
-                        ExpressionSyntax* expression = parser->CreateNode<ParenthesizedExpressionSyntax>(openParenToken, cp->expression, closeParenToken);
+                        ExpressionSyntax* expression = parser->CreateNode(ParenthesizedExpressionSyntax {openParenToken, cp->expression, closeParenToken});
                         expression = ParseExpressionContinued(parser, expression, precedence);
-                        return parser->CreateNode<ConstantPatternSyntax>(expression);
+                        return parser->CreateNode(ConstantPatternSyntax {expression});
                     }
                     else {
-                        return parser->CreateNode<ParenthesizedPatternSyntax>(openParenToken, subpattern, closeParenToken);
+                        return parser->CreateNode(ParenthesizedPatternSyntax {openParenToken, subpattern, closeParenToken});
 
                     }
 
@@ -4534,26 +4543,26 @@ namespace Alchemy::Compilation {
 
             }
 
-            PositionalPatternClauseSyntax* positionalPatternClause = parser->CreateNode<PositionalPatternClauseSyntax>(openParenToken, subPatterns, closeParenToken);
-            return parser->CreateNode<RecursivePatternSyntax>(type, positionalPatternClause, propertyPatternClause0, designation0);
+            PositionalPatternClauseSyntax* positionalPatternClause = parser->CreateNode(PositionalPatternClauseSyntax {openParenToken, subPatterns, closeParenToken});
+            return parser->CreateNode(RecursivePatternSyntax {type, positionalPatternClause, propertyPatternClause0, designation0});
         }
 
         PropertyPatternClauseSyntax* propertyPatternClause = nullptr;
         if (TryParsePropertyPatternClause(parser, &propertyPatternClause)) {
-            return parser->CreateNode<RecursivePatternSyntax>(type, nullptr, propertyPatternClause, TryParseSimpleDesignation(parser, whenIsKeyword));
+            return parser->CreateNode(RecursivePatternSyntax {type, nullptr, propertyPatternClause, TryParseSimpleDesignation(parser, whenIsKeyword)});
         }
 
         if (type != nullptr) {
             VariableDesignationSyntax* designation = TryParseSimpleDesignation(parser, whenIsKeyword);
             if (designation != nullptr) {
-                return parser->CreateNode<DeclarationPatternSyntax>(type, designation);
+                return parser->CreateNode(DeclarationPatternSyntax {type, designation});
             }
 
             // We normally prefer an expression rather than a type in a pattern.
             ExpressionSyntax* expression = nullptr;
             return ConvertTypeToExpression(parser, type, &expression)
-                ? (PatternSyntax*) parser->CreateNode<ConstantPatternSyntax>(ParseExpressionContinued(parser, expression, precedence))
-                : (PatternSyntax*) parser->CreateNode<TypePatternSyntax>(type);
+                ? (PatternSyntax*) parser->CreateNode(ConstantPatternSyntax {ParseExpressionContinued(parser, expression, precedence)})
+                : (PatternSyntax*) parser->CreateNode(TypePatternSyntax {type});
         }
 
         // let the caller fall back to parsing an expression
@@ -4570,13 +4579,13 @@ namespace Alchemy::Compilation {
             case TokenKind::CloseParenToken:
             case TokenKind::CloseBracketToken:
             case TokenKind::EqualsGreaterThanToken:
-                return parser->CreateNode<ConstantPatternSyntax>(ParseIdentifierName(parser, ErrorCode::ERR_MissingPattern));
+                return parser->CreateNode(ConstantPatternSyntax {ParseIdentifierName(parser, ErrorCode::ERR_MissingPattern)});
             default:
                 break;
         }
 
         if (parser->currentToken.contextualKind == TokenKind::UnderscoreToken) {
-            return parser->CreateNode<DiscardPatternSyntax>(parser->EatContextualToken(TokenKind::UnderscoreToken));
+            return parser->CreateNode(DiscardPatternSyntax {parser->EatContextualToken(TokenKind::UnderscoreToken)});
         }
 
         switch (parser->currentToken.kind) {
@@ -4585,12 +4594,12 @@ namespace Alchemy::Compilation {
             case TokenKind::OpenBracketToken:
                 return ParseListPattern(parser, whenIsKeyword);
             case TokenKind::DotDotToken:
-                return parser->CreateNode<SlicePatternSyntax>(
+                return parser->CreateNode(SlicePatternSyntax {
                     parser->EatToken(),
                     IsPossibleSubpatternElement(parser)
                         ? ParsePattern(parser, precedence, false, whenIsKeyword)
                         : nullptr
-                );
+                });
             case TokenKind::LessThanToken:
             case TokenKind::LessThanEqualsToken:
             case TokenKind::GreaterThanToken:
@@ -4599,17 +4608,17 @@ namespace Alchemy::Compilation {
             case TokenKind::ExclamationEqualsToken:
                 // this is a relational pattern.
                 assert(precedence < Precedence::Shift);
-                return parser->CreateNode<RelationalPatternSyntax>(
+                return parser->CreateNode(RelationalPatternSyntax {
                     parser->EatToken(),
                     ParseSubExpression(parser, Precedence::Relational)
-                );
+                });
         }
         ResetPoint resetPoint(parser, false);
 
         TypeSyntax* type = nullptr;
         if (LooksLikeTypeOfPattern(parser)) {
             type = ParseType(parser, afterIs ? ParseTypeMode::AfterIs : ParseTypeMode::DefinitePattern);
-            if (type->IsMissing(parser->tokens) || !SyntaxFacts::CanTokenFollowTypeInPattern(parser->currentToken.kind, precedence)) {
+            if (type->IsMissing() || !SyntaxFacts::CanTokenFollowTypeInPattern(parser->currentToken.kind, precedence)) {
                 // either it is not shaped like a type, or it is a constant expression.
                 resetPoint.Reset();
                 type = nullptr;
@@ -4624,16 +4633,16 @@ namespace Alchemy::Compilation {
 
         resetPoint.Reset();
         ExpressionSyntax* value = ParseSubExpression(parser, precedence);
-        return parser->CreateNode<ConstantPatternSyntax>(value);
+        return parser->CreateNode(ConstantPatternSyntax {value});
     }
 
     PatternSyntax* ParseNegatedPattern(Parser* parser, Precedence precedence, bool afterIs, bool whenIsKeyword) {
         if (parser->currentToken.contextualKind == TokenKind::NotKeyword) {
-            return parser->CreateNode<UnaryPatternSyntax>(
+            return parser->CreateNode(UnaryPatternSyntax {
                 SyntaxKind::NotPattern,
                 ConvertToKeyword(parser->EatToken()),
                 ParseNegatedPattern(parser, precedence, afterIs, whenIsKeyword)
-            );
+            });
         }
         else {
             return ParsePrimaryPattern(parser, precedence, afterIs, whenIsKeyword);
@@ -4643,12 +4652,12 @@ namespace Alchemy::Compilation {
     PatternSyntax* ParseConjunctivePattern(Parser* parser, Precedence precedence, bool afterIs, bool whenIsKeyword) {
         PatternSyntax* result = ParseNegatedPattern(parser, precedence, afterIs, whenIsKeyword);
         while (parser->currentToken.contextualKind == TokenKind::AndKeyword) {
-            result = parser->CreateNode<BinaryPatternSyntax>(
+            result = parser->CreateNode(BinaryPatternSyntax {
                 SyntaxKind::AndPattern,
                 result,
                 ConvertToKeyword(parser->EatToken()),
                 ParseNegatedPattern(parser, precedence, afterIs, whenIsKeyword)
-            );
+            });
         }
 
         return result;
@@ -4658,12 +4667,12 @@ namespace Alchemy::Compilation {
         PatternSyntax* result = ParseConjunctivePattern(parser, precedence, afterIs, whenIsKeyword);
         // todo -- just make and & or reserved keywords
         while (parser->currentToken.contextualKind == TokenKind::OrKeyword) {
-            result = parser->CreateNode<BinaryPatternSyntax>(
+            result = parser->CreateNode(BinaryPatternSyntax {
                 SyntaxKind::OrPattern,
                 result,
                 ConvertToKeyword(parser->EatToken()),
                 ParseConjunctivePattern(parser, precedence, afterIs, whenIsKeyword)
-            );
+            });
         }
 
         return result;
@@ -4673,33 +4682,38 @@ namespace Alchemy::Compilation {
         return ParseDisjunctivePattern(parser, precedence, afterIs, whenIsKeyword);
     }
 
-    ExpressionSyntax* ParseTypeOrPatternForIsOperator(Parser* parser) {
+    SyntaxBase* ParseTypeOrPatternForIsOperator(Parser* parser) {
         PatternSyntax* pattern = ParsePattern(parser, SyntaxFacts::GetPrecedence(SyntaxKind::IsPatternExpression), true);
 
-        // return pattern switch
-        // {
-        //     ConstantPatternSyntax cp when ConvertExpressionToType(cp.Expression, out NameSyntax? type) => type,
-        //         TypePatternSyntax tp => tp.Type,
-        //         DiscardPatternSyntax dp => _syntaxFactory.IdentifierName(ConvertToIdentifier(dp.UnderscoreToken)),
-        //         var p => p,
-        // };
-        return nullptr;
+        // `x is Name` comes back as a constant pattern, it is a type test unless the pattern is more than that.
+        // roslyn also turns dotted member accesses into qualified names, those stay constant patterns here
+        switch (pattern->GetKind()) {
+            case SyntaxKind::ConstantPattern: {
+                ExpressionSyntax* expression = ((ConstantPatternSyntax*) pattern)->expression;
+                if (expression->GetKind() == SyntaxKind::IdentifierName || expression->GetKind() == SyntaxKind::GenericName) {
+                    return expression;
+                }
+                return pattern;
+            }
+            case SyntaxKind::TypePattern: {
+                return ((TypePatternSyntax*) pattern)->type;
+            }
+            default: {
+                return pattern;
+            }
+        }
     }
 
     ExpressionSyntax* ParseIsExpression(Parser* parser, ExpressionSyntax* leftOperand, SyntaxToken opToken) {
 
-        ExpressionSyntax* node = ParseTypeOrPatternForIsOperator(parser);
+        SyntaxBase* node = ParseTypeOrPatternForIsOperator(parser);
 
         if (SyntaxFacts::IsPatternSyntax(node->GetKind())) {
-            return parser->CreateNode<IsPatternExpressionSyntax>(leftOperand, opToken, (PatternSyntax*) node);
-        }
-
-        if (SyntaxFacts::IsTypeSyntax(node->GetKind())) {
-            return parser->CreateNode<BinaryExpressionSyntax>(SyntaxKind::IsExpression, leftOperand, opToken, (TypeSyntax*) node);
+            return parser->CreateNode(IsPatternExpressionSyntax {leftOperand, opToken, (PatternSyntax*) node});
         }
 
-        UNREACHABLE("ParseIsExpression");
-        return nullptr;
+        // anything that isn't a pattern is the type of a type test, names and array types included
+        return parser->CreateNode(BinaryExpressionSyntax {SyntaxKind::IsExpression, leftOperand, opToken, (TypeSyntax*) node});
     }
 
     WhenClauseSyntax* ParseWhenClause(Parser* parser, Precedence precedence) {
@@ -4709,7 +4723,7 @@ namespace Alchemy::Compilation {
 
         SyntaxToken whenKeyword = parser->EatContextualToken(TokenKind::WhenKeyword);
         ExpressionSyntax* expression = ParseSubExpression(parser, precedence);
-        return parser->CreateNode<WhenClauseSyntax>(whenKeyword, expression);
+        return parser->CreateNode(WhenClauseSyntax {whenKeyword, expression});
     }
 
     SeparatedSyntaxList<SwitchExpressionArmSyntax>* ParseSwitchExpressionArms(Parser* parser) {
@@ -4746,12 +4760,12 @@ namespace Alchemy::Compilation {
                 : parser->EatToken(TokenKind::EqualsGreaterThanToken);
 
             ExpressionSyntax* expression = ParseExpression(parser);
-            SwitchExpressionArmSyntax* switchExpressionCase = parser->CreateNode<SwitchExpressionArmSyntax>(
+            SwitchExpressionArmSyntax* switchExpressionCase = parser->CreateNode(SwitchExpressionArmSyntax {
                 pattern,
                 whenClause,
                 gteToken,
                 expression
-            );
+            });
 
             // If we're not making progress, abort
             if (!errantCase.IsValid() && ptr == parser->ptr && parser->currentToken.kind != TokenKind::CommaToken) {
@@ -4780,13 +4794,13 @@ namespace Alchemy::Compilation {
         SeparatedSyntaxList<SwitchExpressionArmSyntax>* arms = ParseSwitchExpressionArms(parser);
         SyntaxToken close = parser->EatToken(TokenKind::CloseBraceToken);
 
-        return parser->CreateNode<SwitchExpressionSyntax>(
+        return parser->CreateNode(SwitchExpressionSyntax {
             governingExpression,
             switchKeyword,
             open,
             arms,
             close
-        );
+        });
 
     }
 
@@ -4858,9 +4872,9 @@ namespace Alchemy::Compilation {
             int32 tokensToCombine = 1;
             SyntaxToken peek1 = parser->PeekToken(1);
             SyntaxToken peek2 = parser->PeekToken(2);
-            if (tk == TokenKind::GreaterThanToken && peek1.kind == TokenKind::GreaterThanToken || peek1.kind == TokenKind::GreaterThanEqualsToken && parser->NoTriviaBetween(parser->currentToken, peek1)) {
+            if (tk == TokenKind::GreaterThanToken && (peek1.kind == TokenKind::GreaterThanToken || peek1.kind == TokenKind::GreaterThanEqualsToken) && parser->NoTriviaBetween(parser->currentToken, peek1)) {
                 if (peek1.kind == TokenKind::GreaterThanToken) {
-                    if (peek2.kind == TokenKind::GreaterThanToken || peek2.kind == TokenKind::GreaterThanEqualsToken && parser->NoTriviaBetween(peek1, peek2)) {
+                    if ((peek2.kind == TokenKind::GreaterThanToken || peek2.kind == TokenKind::GreaterThanEqualsToken) && parser->NoTriviaBetween(peek1, peek2)) {
                         if (peek2.kind == TokenKind::GreaterThanToken) {
                             opKind = SyntaxFacts::GetBinaryExpression(TokenKind::GreaterThanGreaterThanGreaterThanToken);
                         }
@@ -4936,7 +4950,7 @@ namespace Alchemy::Compilation {
             }
             if (opKind == SyntaxKind::AsExpression) {
                 TypeSyntax* type = ParseType(parser, ParseTypeMode::AsExpression);
-                leftOperand = parser->CreateNode<BinaryExpressionSyntax>(opKind, leftOperand, opToken, type);
+                leftOperand = parser->CreateNode(BinaryExpressionSyntax {opKind, leftOperand, opToken, type});
             }
             else if (opKind == SyntaxKind::IsExpression) {
                 leftOperand = ParseIsExpression(parser, leftOperand, opToken);
@@ -4946,16 +4960,16 @@ namespace Alchemy::Compilation {
 
                 // check for lambda expression with explicit ref return type: `ref int () => { ... }`
                 if (opKind == SyntaxKind::SimpleAssignmentExpression && parser->currentToken.kind == TokenKind::RefKeyword && !IsPossibleLambdaExpression(parser, newPrecedence)) {
-                    rhs = parser->CreateNode<RefExpressionSyntax>(
+                    rhs = parser->CreateNode(RefExpressionSyntax {
                         parser->EatToken(),
                         ParseExpression(parser)
-                    );
+                    });
                 }
                 else {
                     rhs = ParseSubExpression(parser, newPrecedence);
                 }
 
-                leftOperand = parser->CreateNode<AssignmentExpressionSyntax>(opKind, leftOperand, opToken, rhs);
+                leftOperand = parser->CreateNode(AssignmentExpressionSyntax {opKind, leftOperand, opToken, rhs});
             }
             else if (opKind == SyntaxKind::SwitchExpression) {
                 leftOperand = ParseSwitchExpression(parser, leftOperand, opToken);
@@ -4976,11 +4990,11 @@ namespace Alchemy::Compilation {
                     rightOperand = nullptr;
                 }
 
-                leftOperand = parser->CreateNode<RangeExpressionSyntax>(leftOperand, opToken, rightOperand);
+                leftOperand = parser->CreateNode(RangeExpressionSyntax {leftOperand, opToken, rightOperand});
             }
             else {
                 assert(SyntaxFacts::IsBinaryExpression(tk));
-                leftOperand = parser->CreateNode<BinaryExpressionSyntax>(opKind, leftOperand, opToken, ParseSubExpression(parser, newPrecedence));
+                leftOperand = parser->CreateNode(BinaryExpressionSyntax {opKind, leftOperand, opToken, ParseSubExpression(parser, newPrecedence)});
             }
         }
 
@@ -5045,13 +5059,13 @@ namespace Alchemy::Compilation {
 //            return this.AddError(leftOperand, ErrorCode.ERR_ConditionalInInterpolation);
 //        }
 //        else {
-        return parser->CreateNode<ConditionalExpressionSyntax>(
+        return parser->CreateNode(ConditionalExpressionSyntax {
             leftOperand,
             questionToken,
             whenTrue,
             parser->EatToken(TokenKind::ColonToken),
             ParsePossibleRefExpression(parser)
-        );
+        });
 //        }
     }
 
@@ -5078,7 +5092,7 @@ namespace Alchemy::Compilation {
             newPrecedence = SyntaxFacts::GetPrecedence(opKind);
             SyntaxToken opToken = parser->EatToken();
             ExpressionSyntax* operand = ParseSubExpression(parser, newPrecedence);
-            leftOperand = parser->CreateNode<PrefixUnaryExpressionSyntax>(opKind, opToken, operand);
+            leftOperand = parser->CreateNode(PrefixUnaryExpressionSyntax {opKind, opToken, operand});
         }
         else if (tk == TokenKind::DotDotToken) {
             // Operator ".." here can either be a prefix unary operator or a stand alone empty range:
@@ -5090,7 +5104,7 @@ namespace Alchemy::Compilation {
                 rightOperand = ParseSubExpression(parser, newPrecedence);
             }
 
-            leftOperand = parser->CreateNode<RangeExpressionSyntax>(nullptr, opToken, rightOperand);
+            leftOperand = parser->CreateNode(RangeExpressionSyntax {nullptr, opToken, rightOperand});
         }
         else if (tk == TokenKind::ThrowKeyword) {
             ExpressionSyntax* result = ParseThrowExpression(parser);
@@ -5101,7 +5115,7 @@ namespace Alchemy::Compilation {
 
             return result;
         }
-        if (IsPossibleDeconstructionLeft(parser, precedence)) {
+        else if (IsPossibleDeconstructionLeft(parser, precedence)) {
             leftOperand = ParseDeclarationExpression(parser, ParseTypeMode::Normal, false);
         }
         else {
@@ -5118,10 +5132,10 @@ namespace Alchemy::Compilation {
         if (parser->currentToken.kind == TokenKind::IdentifierToken && parser->PeekToken(1).kind == TokenKind::ColonToken) {
             IdentifierNameSyntax* identifierName = ParseIdentifierName(parser);
             SyntaxToken colonToken = parser->EatToken(TokenKind::ColonToken);
-            nameColon = parser->CreateNode<NameColonSyntax>(
+            nameColon = parser->CreateNode(NameColonSyntax {
                 identifierName,
                 colonToken
-            );
+            });
         }
         else {
             nameColon = nullptr;
@@ -5150,7 +5164,7 @@ namespace Alchemy::Compilation {
                 : ParseSubExpression(parser, Precedence::Expression);
         }
 
-        return parser->CreateNode<ArgumentSyntax>(nameColon, refKindKeyword, expression);
+        return parser->CreateNode(ArgumentSyntax {nameColon, refKindKeyword, expression});
 
     }
 
@@ -5172,7 +5186,7 @@ namespace Alchemy::Compilation {
 
     void ParseArgumentList(Parser* parser, TokenKind openKind, TokenKind closeKind, SyntaxToken* openToken, SeparatedSyntaxList<ArgumentSyntax>** arguments, SyntaxToken* closeToken) {
         assert(openKind == TokenKind::OpenParenToken || openKind == TokenKind::OpenBracketToken);
-        assert(closeKind == TokenKind::CloseParenToken || openKind == TokenKind::CloseBracketToken);
+        assert(closeKind == TokenKind::CloseParenToken || closeKind == TokenKind::CloseBracketToken);
         assert((openKind == TokenKind::OpenParenToken) == (closeKind == TokenKind::CloseParenToken));
 
         // convert `[` into `(` or vice versa for error recovery
@@ -5246,7 +5260,7 @@ namespace Alchemy::Compilation {
 
         ParseArgumentList(parser, TokenKind::OpenParenToken, TokenKind::CloseParenToken, &openToken, &argumentList, &closeToken);
 
-        return parser->CreateNode<ArgumentListSyntax>(openToken, argumentList, closeToken);
+        return parser->CreateNode(ArgumentListSyntax {openToken, argumentList, closeToken});
     }
 
     ConstructorInitializerSyntax* ParseConstructorInitializer(Parser* parser) {
@@ -5287,17 +5301,17 @@ namespace Alchemy::Compilation {
         else {
             SyntaxToken openParen = parser->EatToken(TokenKind::OpenParenToken);
             SyntaxToken closeParen = parser->CreateMissingToken(TokenKind::CloseParenToken);
-            argumentList = parser->CreateNode<ArgumentListSyntax>(openParen, nullptr, closeParen);
+            argumentList = parser->CreateNode(ArgumentListSyntax {openParen, nullptr, closeParen});
         }
 
         if (kind == SyntaxKind::BaseConstructorInitializer) {
-            return parser->CreateNode<BaseConstructorInitializerSyntax>(colon, token, argumentList);
+            return parser->CreateNode(BaseConstructorInitializerSyntax {colon, token, argumentList});
         }
         else if (kind == SyntaxKind::ThisConstructorInitializer) {
-            return parser->CreateNode<ThisConstructorInitializerSyntax>(colon, token, argumentList);
+            return parser->CreateNode(ThisConstructorInitializerSyntax {colon, token, argumentList});
         }
         else {
-            return parser->CreateNode<NamedConstructorInitializerSyntax>(colon, token, argumentList);
+            return parser->CreateNode(NamedConstructorInitializerSyntax {colon, token, argumentList});
         }
 
     }
@@ -5311,14 +5325,14 @@ namespace Alchemy::Compilation {
             parser->AddError(openBrace, ErrorCode::ERR_SemiOrLBraceOrArrowExpected);
         }
         else {
-            parser->EatToken(TokenKind::OpenBraceToken);
+            openBrace = parser->EatToken(TokenKind::OpenBraceToken);
         }
 
         TempAllocator::ScopedMarker m(parser->tempAllocator);
         SyntaxListBuilder<StatementSyntax> statements(parser->tempAllocator);
         ParseStatements(parser, &statements, false);
 
-        return parser->CreateNode<BlockSyntax>(openBrace, statements.ToSyntaxList(parser->allocator), parser->EatToken(TokenKind::CloseBraceToken));
+        return parser->CreateNode(BlockSyntax {openBrace, statements.ToSyntaxList(parser->allocator), parser->EatToken(TokenKind::CloseBraceToken)});
     }
 
     ExpressionSyntax* ParsePossibleRefExpression(Parser* parser) {
@@ -5330,13 +5344,13 @@ namespace Alchemy::Compilation {
         ExpressionSyntax* expression = ParseExpression(parser);
         return !refKeyword.IsValid()
             ? expression
-            : parser->CreateNode<RefExpressionSyntax>(refKeyword, expression);
+            : parser->CreateNode(RefExpressionSyntax {refKeyword, expression});
     }
 
     ArrowExpressionClauseSyntax* ParseArrowExpressionClause(Parser* parser) {
         SyntaxToken gteToken = parser->EatToken(TokenKind::EqualsGreaterThanToken);
         ExpressionSyntax* expression = ParsePossibleRefExpression(parser);
-        return parser->CreateNode<ArrowExpressionClauseSyntax>(gteToken, expression);
+        return parser->CreateNode(ArrowExpressionClauseSyntax {gteToken, expression});
     }
 
     void ParseBlockAndExpressionBodiesWithSemicolon(Parser* parser, BlockSyntax** blockBody, ArrowExpressionClauseSyntax** expressionBody, SyntaxToken* semicolon, bool parseSemicolonAfterBlock = true) {
@@ -5392,7 +5406,7 @@ namespace Alchemy::Compilation {
         ParseBlockAndExpressionBodiesWithSemicolon(parser, &blockBody, &expressionBody, &semicolon);
 
         parser->termState = saveTerm;
-        return parser->CreateNode<ConstructorDeclarationSyntax>(
+        return parser->CreateNode(ConstructorDeclarationSyntax {
             attributes,
             modifiers->Persist(parser->allocator),
             name, paramList,
@@ -5400,7 +5414,7 @@ namespace Alchemy::Compilation {
             blockBody,
             expressionBody,
             semicolon
-        );
+        });
     }
 
     FieldDeclarationSyntax* ParseConstantFieldDeclaration(Parser* parser, TokenListBuffer* modifiers, SyntaxKind parentKind) {
@@ -5408,8 +5422,8 @@ namespace Alchemy::Compilation {
 
         TypeSyntax* type = ParseType(parser, ParseTypeMode::Normal);
         SeparatedSyntaxList<VariableDeclaratorSyntax>* variableDeclarators = ParseFieldDeclarationVariableDeclarators(parser, type, VariableFlags::Const, parentKind);
-        VariableDeclarationSyntax* declaration = parser->CreateNode<VariableDeclarationSyntax>(type, variableDeclarators);
-        return parser->CreateNode<FieldDeclarationSyntax>(modifiers->Persist(parser->allocator), declaration, parser->EatToken(TokenKind::SemicolonToken));
+        VariableDeclarationSyntax* declaration = parser->CreateNode(VariableDeclarationSyntax {type, variableDeclarators});
+        return parser->CreateNode(FieldDeclarationSyntax {modifiers->Persist(parser->allocator), declaration, parser->EatToken(TokenKind::SemicolonToken)});
     }
 
 //    FieldDeclarationSyntax* ParseFixedFieldDeclaration(Parser* parser, TokenListBuffer* modifiers, SyntaxKind parentKind) {
@@ -5418,15 +5432,15 @@ namespace Alchemy::Compilation {
 //        TypeSyntax* type = ParseType(parser, ParseTypeMode::Normal);
 //
 //        SeparatedSyntaxList<VariableDeclaratorSyntax>* variableDeclarators = ParseFieldDeclarationVariableDeclarators(parser, type, VariableFlags::Fixed, parentKind);
-//        VariableDeclarationSyntax* declaration = parser->CreateNode<VariableDeclarationSyntax>(type, variableDeclarators);
+//        VariableDeclarationSyntax* declaration = parser->CreateNode(VariableDeclarationSyntax {type, variableDeclarators});
 //
-//        return parser->CreateNode<FieldDeclarationSyntax>(modifiers->Persist(parser->allocator), declaration, parser->EatToken(TokenKind::SemicolonToken));
+//        return parser->CreateNode(FieldDeclarationSyntax {modifiers->Persist(parser->allocator), declaration, parser->EatToken(TokenKind::SemicolonToken)});
 //
 //    }
 
     TypeSyntax* ParseTypeOrVoid(Parser* parser) {
         if (parser->currentToken.kind == TokenKind::VoidKeyword) {
-            return parser->CreateNode<PredefinedTypeSyntax>(parser->EatToken());
+            return parser->CreateNode(PredefinedTypeSyntax {parser->EatToken()});
         }
 
         return ParseType(parser, ParseTypeMode::Normal);
@@ -5469,7 +5483,7 @@ namespace Alchemy::Compilation {
         if (IsCurrentTokenWhereOfConstraintClause(parser)) {
             SyntaxToken missing = MakeMissingToken(TokenKind::IdentifierToken, parser->ptr);
             parser->AddError(missing, ErrorCode::ERR_IdentifierExpected);
-            return parser->CreateNode<TypeParameterSyntax>(missing);
+            return parser->CreateNode(TypeParameterSyntax {missing});
         }
 
         // SyntaxListBuilder<AttributeListSyntax> attrList(parser->tempAllocator);
@@ -5480,13 +5494,14 @@ namespace Alchemy::Compilation {
         //     parser->_termState = saveTerm;
         // }
 
-        return parser->CreateNode<TypeParameterSyntax>(ParseIdentifierToken(parser));
+        return parser->CreateNode(TypeParameterSyntax {ParseIdentifierToken(parser)});
     }
 
     PostSkipAction SkipBadTypeParameterListTokens(Parser* parser, TokenKind expected, TokenKind closeKind) {
         return SkipBadSeparatedListTokensWithExpectedKind(
             parser,
-            [](Parser* p) { return p->currentToken.kind != TokenKind::CommaToken && !IsPossibleType(p); },
+            // a parameter is only ever an identifier, `float` looks like a type but nothing would consume it
+            [](Parser* p) { return p->currentToken.kind != TokenKind::CommaToken; },
             [](Parser* p, TokenKind closeKind) { return p->currentToken.kind == TokenKind::GreaterThanToken; },
             expected
         );
@@ -5517,7 +5532,7 @@ namespace Alchemy::Compilation {
 
         SyntaxToken close = parser->EatToken(TokenKind::GreaterThanToken);
 
-        return parser->CreateNode<TypeParameterListSyntax>(open, parameters, close);
+        return parser->CreateNode(TypeParameterListSyntax {open, parameters, close});
 
     }
 
@@ -5583,14 +5598,14 @@ namespace Alchemy::Compilation {
             equalsToken = parser->EatToken();
         }
 
-        return parser->CreateNode<ParameterSyntax>(
+        return parser->CreateNode(ParameterSyntax {
             modifiers.Persist(parser->allocator),
             type,
             identifier,
             equalsToken.IsValid()
-                ? parser->CreateNode<EqualsValueClauseSyntax>(equalsToken, ParseExpression(parser))
+                ? parser->CreateNode(EqualsValueClauseSyntax {equalsToken, ParseExpression(parser)})
                 : nullptr
-        );
+        });
 
     }
 
@@ -5623,7 +5638,7 @@ namespace Alchemy::Compilation {
         SyntaxToken open;
         SyntaxToken close;
         SeparatedSyntaxList<ParameterSyntax>* parameters = ParseParameterList(parser, &open, &close, TokenKind::OpenParenToken, TokenKind::CloseParenToken);
-        return parser->CreateNode<ParameterListSyntax>(open, parameters, close);
+        return parser->CreateNode(ParameterListSyntax {open, parameters, close});
     }
 
     LocalFunctionStatementSyntax* TryParseLocalFunctionStatementBody(Parser* parser, TokenListBuffer* modifiers, TypeSyntax* returnType, SyntaxToken name) {
@@ -5645,7 +5660,7 @@ namespace Alchemy::Compilation {
 
         ParseBlockAndExpressionBodiesWithSemicolon(parser, &blockBody, &expressionBody, &semicolon, false);
 
-        return parser->CreateNode<LocalFunctionStatementSyntax>(
+        return parser->CreateNode(LocalFunctionStatementSyntax {
             modifiers->Persist(parser->allocator),
             returnType,
             name,
@@ -5655,7 +5670,7 @@ namespace Alchemy::Compilation {
             blockBody,
             expressionBody,
             semicolon
-        );
+        });
     }
 
     bool IsPossibleVariableInitializer(Parser* parser) {
@@ -5686,12 +5701,12 @@ namespace Alchemy::Compilation {
             false
         );
 
-        return parser->CreateNode<InitializerExpressionSyntax>(
+        return parser->CreateNode(InitializerExpressionSyntax {
             SyntaxKind::ArrayInitializerExpression,
             openBrace,
             list,
             parser->EatToken(TokenKind::CloseBraceToken)
-        );
+        });
 
     }
 
@@ -5705,7 +5720,7 @@ namespace Alchemy::Compilation {
 
         TokenKind k = parser->currentToken.kind;
 
-        if (!paramList->IsMissing(parser->tokens) && (k == TokenKind::OpenBraceToken || k == TokenKind::EqualsGreaterThanToken || parser->currentToken.contextualKind == TokenKind::WhereKeyword)) {
+        if (!paramList->IsMissing() && (k == TokenKind::OpenBraceToken || k == TokenKind::EqualsGreaterThanToken || parser->currentToken.contextualKind == TokenKind::WhereKeyword)) {
             return true;
         }
 
@@ -5726,7 +5741,7 @@ namespace Alchemy::Compilation {
 
         ParseArgumentList(parser, TokenKind::OpenBracketToken, TokenKind::CloseBracketToken, &openToken, &argumentList, &closeToken);
 
-        return parser->CreateNode<BracketedArgumentListSyntax>(openToken, argumentList, closeToken);
+        return parser->CreateNode(BracketedArgumentListSyntax {openToken, argumentList, closeToken});
 
     }
 
@@ -5769,7 +5784,7 @@ namespace Alchemy::Compilation {
             ResetPoint reset(parser);
 
             TokenKind currentTokenKind = parser->currentToken.kind;
-            if (currentTokenKind == TokenKind::IdentifierToken && !parentType->IsMissing(parser->tokens)) {
+            if (currentTokenKind == TokenKind::IdentifierToken && !parentType->IsMissing()) {
 
                 bool isAfterNewLine = parser->IsAfterNewLine(parentType->GetEndTokenId());
 
@@ -5789,7 +5804,7 @@ namespace Alchemy::Compilation {
                             parser->AddError(missingIdentifier, ErrorCode::ERR_IdentifierExpected);
 
                             *localFunction = nullptr;
-                            return parser->CreateNode<VariableDeclaratorSyntax>(missingIdentifier, nullptr);
+                            return parser->CreateNode(VariableDeclaratorSyntax {missingIdentifier, nullptr});
                         }
                     }
                 }
@@ -5825,7 +5840,7 @@ namespace Alchemy::Compilation {
                     ? parser->EatToken()
                     : SyntaxToken();
                 ExpressionSyntax* init = ParseVariableInitializer(parser);
-                initializer = parser->CreateNode<EqualsValueClauseSyntax>(equals, !refKeyword.IsValid() ? init : parser->CreateNode<RefExpressionSyntax>(refKeyword, init));
+                initializer = parser->CreateNode(EqualsValueClauseSyntax {equals, !refKeyword.IsValid() ? init : parser->CreateNode(RefExpressionSyntax {refKeyword, init})});
                 break;
             }
             case TokenKind::LessThanToken: {
@@ -5844,7 +5859,8 @@ namespace Alchemy::Compilation {
                         return nullptr;
                     }
                 }
-                return nullptr;
+                // no c-style constructor recovery, the `(` gets skipped by whoever is parsing the declarators
+                goto default_label;
 //                // Special case for accidental use of C-style constructors
 //                // Fake up something to hold the arguments.
 //                parser->termState |= TerminatorState::IsPossibleEndOfVariableDeclaration;
@@ -5881,12 +5897,12 @@ namespace Alchemy::Compilation {
 //                        parser->AddError(sizes->items[i], ErrorCode::ERR_ArraySizeInDeclaration);
 //                    }
 //
-//                    args[i] = parser->CreateNode<ArgumentSyntax>(nullptr, SyntaxToken(), sizes->items[i]);
+//                    args[i] = parser->CreateNode(ArgumentSyntax {nullptr, SyntaxToken(), sizes->items[i]});
 //                }
 //
 //                SeparatedSyntaxList<ArgumentSyntax>* argList = parser->allocator->New<SeparatedSyntaxList<ArgumentSyntax >>(sizes->itemCount, args, sizes->separatorCount, sizes->separators);
 //
-//                argumentList = parser->CreateNode<BracketedArgumentListSyntax>(open, argList, close);
+//                argumentList = parser->CreateNode(BracketedArgumentListSyntax {open, argList, close});
 //
 //                if (!isFixed) {
 //                    parser->AddError(argumentList, ErrorCode::ERR_CStyleArray);
@@ -5915,20 +5931,23 @@ namespace Alchemy::Compilation {
             }
         }
         *localFunction = nullptr;
-        return parser->CreateNode<VariableDeclaratorSyntax>(name, initializer);
+        return parser->CreateNode(VariableDeclaratorSyntax {name, initializer});
     }
 
     void ParseVariableDeclarators(Parser* parser, TypeSyntax* type, VariableFlags flags, SeparatedSyntaxListBuilder<VariableDeclaratorSyntax>* variables, bool variableDeclarationsExpected, bool allowLocalFunctions, bool stopOnCloseParen, TokenListBuffer* mods, LocalFunctionStatementSyntax** localFunction) {
 
         *localFunction = nullptr;
 
-        variables->Add(ParseVariableDeclarator(parser, type, flags, true, allowLocalFunctions, mods, localFunction));
+        VariableDeclaratorSyntax* first = ParseVariableDeclarator(parser, type, flags, true, allowLocalFunctions, mods, localFunction);
 
         if (*localFunction != nullptr) {
+            // the declarator is null when it turned out to be a local function, it doesn't go in the list
             assert(variables->itemCount == 0);
             return;
         }
 
+        variables->Add(first);
+
         while (true) {
             if (parser->currentToken.kind == TokenKind::SemicolonToken) {
                 break;
@@ -5964,8 +5983,8 @@ namespace Alchemy::Compilation {
 
     MemberDeclarationSyntax* ParseNormalFieldDeclaration(Parser* parser, TokenListBuffer* modifiers, TypeSyntax* type, SyntaxKind parentKind) {
         SeparatedSyntaxList<VariableDeclaratorSyntax>* variables = ParseFieldDeclarationVariableDeclarators(parser, type, VariableFlags::LocalOrField, parentKind);
-        VariableDeclarationSyntax* variableDeclaration = parser->CreateNode<VariableDeclarationSyntax>(type, variables);
-        return parser->CreateNode<FieldDeclarationSyntax>(modifiers->Persist(parser->allocator), variableDeclaration, parser->EatToken(TokenKind::SemicolonToken));
+        VariableDeclarationSyntax* variableDeclaration = parser->CreateNode(VariableDeclarationSyntax {type, variables});
+        return parser->CreateNode(FieldDeclarationSyntax {modifiers->Persist(parser->allocator), variableDeclaration, parser->EatToken(TokenKind::SemicolonToken)});
     }
 
     bool IsFieldDeclaration(Parser* parser) {
@@ -6028,7 +6047,7 @@ namespace Alchemy::Compilation {
     AttributeSyntax* ParseAttribute(Parser* parser) {
         NameSyntax* nameSyntax = ParseQualifiedName(parser, NameOptions::None);
         ArgumentListSyntax* argumentList = ParseParenthesizedArgumentList(parser);
-        return parser->CreateNode<AttributeSyntax>(nameSyntax, argumentList);
+        return parser->CreateNode(AttributeSyntax {nameSyntax, argumentList});
     }
 
     PostSkipAction SkipBadAttributeListTokens(Parser* parser, TokenKind expectedKind, TokenKind closeKind) {
@@ -6063,7 +6082,7 @@ namespace Alchemy::Compilation {
 
         SyntaxToken closeBracket = parser->EatToken(TokenKind::CloseBracketToken);
 
-        return parser->CreateNode<AttributeListSyntax>(openBracket, attributes, closeBracket);
+        return parser->CreateNode(AttributeListSyntax {openBracket, attributes, closeBracket});
 
     }
 
@@ -6110,7 +6129,7 @@ namespace Alchemy::Compilation {
         SyntaxToken open;
         SyntaxToken close;
         SeparatedSyntaxList<ParameterSyntax>* parameters = ParseParameterList(parser, &open, &close, TokenKind::OpenBracketToken, TokenKind::CloseBracketToken);
-        return parser->CreateNode<BracketedParameterListSyntax>(open, parameters, close);
+        return parser->CreateNode(BracketedParameterListSyntax {open, parameters, close});
     }
 
     bool IsPossibleAccessor(Parser* parser) {
@@ -6171,6 +6190,8 @@ namespace Alchemy::Compilation {
             // to report that the identifier is incorrect.
             if (!accessorName.IsMissing()) {
                 parser->AddError(accessorName, ErrorCode::ERR_GetOrSetExpected);
+                // AddError flags the token in the list, our copy needs it too
+                accessorName.AddFlag(SyntaxTokenFlags::Error);
             }
             else {
                 assert(accessorName.ContainsDiagnostics());
@@ -6218,14 +6239,14 @@ namespace Alchemy::Compilation {
             }
         }
 
-        return parser->CreateNode<AccessorDeclarationSyntax>(
-            accessorKind,
+        return parser->CreateNode(AccessorDeclarationSyntax {
+            accessorKind == SyntaxKind::None ? SyntaxKind::UnknownAccessorDeclaration : accessorKind,
             modifiers.Persist(parser->allocator),
             accessorName,
             blockBody,
             expressionBody,
             semicolon
-        );
+        });
     }
 
     AccessorListSyntax* ParseAccessorList(Parser* parser) {
@@ -6251,7 +6272,7 @@ namespace Alchemy::Compilation {
         }
 
         SyntaxToken closeBrace = parser->EatToken(TokenKind::CloseBraceToken);
-        return parser->CreateNode<AccessorListSyntax>(openBrace, accessors.ToSyntaxList(parser->allocator), closeBrace);
+        return parser->CreateNode(AccessorListSyntax {openBrace, accessors.ToSyntaxList(parser->allocator), closeBrace});
     }
 
     PropertyDeclarationSyntax* ParsePropertyDeclaration(Parser* parser, SyntaxList<AttributeListSyntax>* attributes, TokenListBuffer* modifiers, TypeSyntax* type, SyntaxToken identifier, TypeParameterListSyntax* typeParameterList) {
@@ -6283,7 +6304,7 @@ namespace Alchemy::Compilation {
         else if (parser->currentToken.kind == TokenKind::EqualsToken) {
             SyntaxToken equals = parser->EatToken(TokenKind::EqualsToken);
             ExpressionSyntax* value = ParseVariableInitializer(parser);
-            initializer = parser->CreateNode<EqualsValueClauseSyntax>(equals, value);
+            initializer = parser->CreateNode(EqualsValueClauseSyntax {equals, value});
         }
 
         SyntaxToken semicolon;
@@ -6295,7 +6316,7 @@ namespace Alchemy::Compilation {
             parser->AddError(semicolon, ErrorCode::ERR_UnexpectedSemicolon);
         }
 
-        return parser->CreateNode<PropertyDeclarationSyntax>(
+        return parser->CreateNode(PropertyDeclarationSyntax {
             attributes,
             modifiers->Persist(parser->allocator),
             type,
@@ -6304,7 +6325,7 @@ namespace Alchemy::Compilation {
             expressionBody,
             initializer,
             semicolon
-        );
+        });
 
     }
 
@@ -6342,7 +6363,7 @@ namespace Alchemy::Compilation {
             semicolon = parser->EatToken(TokenKind::SemicolonToken);
         }
 
-        return parser->CreateNode<IndexerDeclarationSyntax>(
+        return parser->CreateNode(IndexerDeclarationSyntax {
             attributes,
             modifiers->Persist(parser->allocator),
             type,
@@ -6351,7 +6372,7 @@ namespace Alchemy::Compilation {
             accessorList,
             expressionBody,
             semicolon
-        );
+        });
     }
 
     MethodDeclarationSyntax* ParseMethodDeclaration(Parser* parser, SyntaxList<AttributeListSyntax>* attributes, TokenListBuffer* modifiers, TypeSyntax* type, SyntaxToken identifier, TypeParameterListSyntax* typeParameterList) {
@@ -6386,7 +6407,7 @@ namespace Alchemy::Compilation {
         SyntaxToken semicolon;
         ParseBlockAndExpressionBodiesWithSemicolon(parser, &block, &expressionBody, &semicolon);
 
-        return parser->CreateNode<MethodDeclarationSyntax>(
+        return parser->CreateNode(MethodDeclarationSyntax {
             attributes,
             modifiers->Persist(parser->allocator),
             type,
@@ -6397,7 +6418,7 @@ namespace Alchemy::Compilation {
             block,
             expressionBody,
             semicolon
-        );
+        });
     }
 
     MemberDeclarationSyntax* ParseMemberDeclaration(Parser* parser, SyntaxKind parentKind) {
@@ -6450,11 +6471,13 @@ namespace Alchemy::Compilation {
 
         if (!IsPossibleMemberName(parser)) {
             // we haven't advanced, the caller needs to consume the tokens ahead
-            if (attributes->size == 0 && modifiers.size == 0 && type->IsMissing(parser->tokens) && type->GetKind() != SyntaxKind::RefType) {
+            if (attributes->size == 0 && modifiers.size == 0 && type->IsMissing() && type->GetKind() != SyntaxKind::RefType) {
                 return nullptr;
             }
             // otherwise return an incomplete member
-            return parser->CreateNode<IncompleteMemberSyntax>(attributes, modifiers.Persist(parser->allocator), type);
+            IncompleteMemberSyntax* incompleteMember = parser->CreateNode(IncompleteMemberSyntax {attributes, modifiers.Persist(parser->allocator), type});
+            parser->AddError(incompleteMember, ErrorCode::ERR_InvalidMemberDecl);
+            return incompleteMember;
         }
 
         bool isThisKeyword = parser->currentToken.kind == TokenKind::ThisKeyword;
@@ -6500,7 +6523,8 @@ namespace Alchemy::Compilation {
 
                 while (parser->currentToken.kind != expectedKind) {
 
-                    if (parser->currentToken.kind == TokenKind::SemicolonToken) {
+                    // eating at the end of the input doesn't move us forward
+                    if (parser->currentToken.kind == TokenKind::SemicolonToken || parser->currentToken.kind == TokenKind::EndOfFileToken) {
                         action = PostSkipAction::Abort;
                         break;
                     }
@@ -6535,7 +6559,7 @@ namespace Alchemy::Compilation {
 
         SyntaxToken semicolon = parser->EatToken(TokenKind::SemicolonToken);
 
-        return parser->CreateNode<NamespaceDeclarationSyntax>(keyword, list, semicolon);
+        return parser->CreateNode(NamespaceDeclarationSyntax {keyword, list, semicolon});
     }
 
     MemberDeclarationSyntax* ParseUsingDirective(Parser* parser) {
@@ -6555,7 +6579,7 @@ namespace Alchemy::Compilation {
 
             SyntaxToken semicolon = parser->EatToken(TokenKind::SemicolonToken);
 
-            return parser->CreateNode<UsingNamespaceDeclarationSyntax>(keyword, list, semicolon);
+            return parser->CreateNode(UsingNamespaceDeclarationSyntax {keyword, list, semicolon});
         }
     }
 
@@ -6647,7 +6671,7 @@ namespace Alchemy::Compilation {
         end:
         SyntaxToken eof = parser->EatToken(TokenKind::EndOfFileToken);
 
-        return parser->CreateNode<CompilationUnitSyntax>(members.ToSyntaxList(parser->allocator), eof);
+        return parser->CreateNode(CompilationUnitSyntax {members.ToSyntaxList(parser->allocator), eof});
 
     }
 
@@ -6742,7 +6766,7 @@ namespace Alchemy::Compilation {
             case TokenKind::StringLiteralStart:
             case TokenKind::CharLiteralStart:
             case TokenKind::NewKeyword:
-            case TokenKind::DelegateKeyword:
+            // case TokenKind::DelegateKeyword: // anonymous methods aren't supported, nothing would consume it
             case TokenKind::ThrowKeyword:
             case TokenKind::DotDotToken:
             case TokenKind::RefKeyword:
@@ -7207,7 +7231,7 @@ namespace Alchemy::Compilation {
     }
 
     IdentifierNameSyntax* ParseIdentifierName(Parser* parser, ErrorCode code) {
-        return parser->CreateNode<IdentifierNameSyntax>(parser->EatToken(TokenKind::IdentifierToken));
+        return parser->CreateNode(IdentifierNameSyntax {parser->EatToken(TokenKind::IdentifierToken)});
     }
 
     ScanTypeArgumentListKind ScanTypeArgumentList(Parser* parser, NameOptions options) {
@@ -7417,7 +7441,7 @@ namespace Alchemy::Compilation {
         SyntaxToken current = parser->currentToken;
         SyntaxToken next = parser->PeekToken(1);
 
-        if (result->IsMissing(parser->tokens) && current.kind != TokenKind::CommaToken && current.kind != TokenKind::GreaterThanToken && next.kind == TokenKind::CommaToken || next.kind == TokenKind::GreaterThanToken) {
+        if (result->IsMissing() && current.kind != TokenKind::CommaToken && current.kind != TokenKind::GreaterThanToken && (next.kind == TokenKind::CommaToken || next.kind == TokenKind::GreaterThanToken)) {
             // skip the current token so we can recover
             parser->SkipToken();
         }
@@ -7509,10 +7533,10 @@ namespace Alchemy::Compilation {
                 SyntaxToken close;
                 ParseTypeArgumentList(parser, &open, &builder, &close);
 
-                name = parser->CreateNode<GenericNameSyntax>(
+                name = parser->CreateNode(GenericNameSyntax {
                     id->identifier,
-                    parser->CreateNode<TypeArgumentListSyntax>(open, builder.ToList(parser->allocator), close)
-                );
+                    parser->CreateNode(TypeArgumentListSyntax {open, builder.ToList(parser->allocator), close})
+                });
             }
 
         }
@@ -7528,7 +7552,7 @@ namespace Alchemy::Compilation {
         SyntaxToken leftDot = MakeMissingToken(TokenKind::DotToken, parser->ptr);
         parser->AddError(*separator, Diagnostic(ErrorCode::ERR_IdentifierExpected, separator->GetText(parser->tokenTexts)));
         *separator = MakeMissingToken(TokenKind::DotToken, parser->ptr);
-        return parser->CreateNode<QualifiedNameSyntax>(left, leftDot, missingName);
+        return parser->CreateNode(QualifiedNameSyntax {left, leftDot, missingName});
     }
 
     NameSyntax* ParseQualifiedNameRight(Parser* parser, NameOptions options, NameSyntax* left, SyntaxToken separator) {
@@ -7536,11 +7560,11 @@ namespace Alchemy::Compilation {
 
         switch (separator.kind) {
             case TokenKind::DotToken:
-                return parser->CreateNode<QualifiedNameSyntax>(left, separator, right);
+                return parser->CreateNode(QualifiedNameSyntax {left, separator, right});
 
             case TokenKind::DotDotToken:
                 // Error recovery.  If we have `X..Y` break that into `X.<missing-id>.Y`
-                return parser->CreateNode<QualifiedNameSyntax>(RecoverFromDotDot(parser, left, &separator), separator, right);
+                return parser->CreateNode(QualifiedNameSyntax {RecoverFromDotDot(parser, left, &separator), separator, right});
 
                 // removing :: support for now, doesn't seem super helpful and is maybe just confusing
 
@@ -7593,7 +7617,8 @@ namespace Alchemy::Compilation {
     }
 
     SyntaxToken MakeMissingToken(TokenKind kind, int32 id) {
-        assert(SyntaxFacts::IsToken(kind));
+        // statements that are missing their keyword get a missing keyword, not just punctuation
+        assert(SyntaxFacts::IsToken(kind) || SyntaxFacts::IsReservedKeyword(kind));
         SyntaxToken retn;
         retn.kind = kind;
         retn.SetId(id);
@@ -7602,16 +7627,16 @@ namespace Alchemy::Compilation {
     }
 
     IdentifierNameSyntax* CreateMissingIdentifierName(Parser* parser) {
-        return parser->CreateNode<IdentifierNameSyntax>(MakeMissingToken(TokenKind::IdentifierToken, parser->ptr));
+        return parser->CreateNode(IdentifierNameSyntax {MakeMissingToken(TokenKind::IdentifierToken, parser->ptr)});
     }
 
     TupleElementSyntax* ParseTupleElement(Parser* parser) {
-        return parser->CreateNode<TupleElementSyntax>(
+        return parser->CreateNode(TupleElementSyntax {
             ParseType(parser, ParseTypeMode::Normal),
             IsTrueIdentifier(parser)
                 ? ParseIdentifierToken(parser)
                 : SyntaxToken()
-        );
+        });
     }
 
     TypeSyntax* ParseTupleType(Parser* parser) {
@@ -7632,19 +7657,19 @@ namespace Alchemy::Compilation {
         if (list.itemCount < 2) {
 
             if (list.itemCount == 0) {
-                list.Add(parser->CreateNode<TupleElementSyntax>(CreateMissingIdentifierName(parser), SyntaxToken()));
+                list.Add(parser->CreateNode(TupleElementSyntax {CreateMissingIdentifierName(parser), SyntaxToken()}));
             }
 
             IdentifierNameSyntax* missing = CreateMissingIdentifierName(parser);
 
             list.AddSeparator(MakeMissingToken(TokenKind::CommaToken, parser->ptr));
-            list.Add(parser->CreateNode<TupleElementSyntax>(missing, SyntaxToken()));
+            list.Add(parser->CreateNode(TupleElementSyntax {missing, SyntaxToken()}));
 
             FixedCharSpan span = parser->currentToken.GetText(parser->tokenTexts);
             parser->diagnostics->AddError(Diagnostic(ErrorCode::ERR_TupleTooFewElements, span));
         }
 
-        return parser->CreateNode<TupleTypeSyntax>(open, list.ToList(parser->allocator), parser->EatToken(TokenKind::CloseParenToken));
+        return parser->CreateNode(TupleTypeSyntax {open, list.ToList(parser->allocator), parser->EatToken(TokenKind::CloseParenToken)});
 
     }
 
@@ -7656,7 +7681,7 @@ namespace Alchemy::Compilation {
                 parser->AddError(token, parser->MakeDiagnostic(code, token));
             }
 
-            return parser->CreateNode<PredefinedTypeSyntax>(token);
+            return parser->CreateNode(PredefinedTypeSyntax {token});
         }
 
         if (IsTrueIdentifier(parser)) {
@@ -7806,7 +7831,7 @@ namespace Alchemy::Compilation {
 //
 //            if (parser->currentToken.kind == TokenKind::CommaToken) {
 //                sawOmittedSize = true;
-//                list.Add(parser->CreateNode<OmittedArraySizeExpressionSyntax>(MakeOmittedToken(TokenKind::OmittedArraySizeExpressionToken, parser->ptr)));
+//                list.Add(parser->CreateNode(OmittedArraySizeExpressionSyntax {MakeOmittedToken(TokenKind::OmittedArraySizeExpressionToken, parser->ptr)}));
 //                list.AddSeparator(parser->EatToken());
 //            }
 //            else if (IsPossibleExpression(parser)) {
@@ -7827,7 +7852,7 @@ namespace Alchemy::Compilation {
 //        // If the omitted size would be the only element, then skip it unless sizes were expected.
 //        if (list.separatorCount == list.itemCount + 1) {
 //            sawOmittedSize = true;
-//            list.Add(parser->CreateNode<OmittedArraySizeExpressionSyntax>(MakeOmittedToken(TokenKind::OmittedArraySizeExpressionToken, parser->ptr)));
+//            list.Add(parser->CreateNode(OmittedArraySizeExpressionSyntax {MakeOmittedToken(TokenKind::OmittedArraySizeExpressionToken, parser->ptr)}));
 //        }
 //
 //        // Never mix omitted and non-omitted array sizes.  If there were non-omitted array sizes,
@@ -7838,12 +7863,12 @@ namespace Alchemy::Compilation {
 //                    SyntaxToken separator = list.GetSeparator(i);
 //                    FixedCharSpan text = separator.GetText(); // we need a text range for the error. try to use the next separator. todo -- probably fails on the end
 //                    parser->AddError(separator, Diagnostic(ErrorCode::ERR_ValueExpected, text.ptr, text.ptr + text.size));
-//                    list.items[i] = parser->CreateNode<IdentifierNameSyntax>(parser->CreateMissingToken(TokenKind::IdentifierToken));
+//                    list.items[i] = parser->CreateNode(IdentifierNameSyntax {parser->CreateMissingToken(TokenKind::IdentifierToken)});
 //                }
 //            }
 //        }
 //
-//        return parser->CreateNode<ArrayRankSpecifierSyntax>(open, list.ToList(parser->allocator), parser->EatToken(TokenKind::CloseBracketToken));
+//        return parser->CreateNode(ArrayRankSpecifierSyntax {open, list.ToList(parser->allocator), parser->EatToken(TokenKind::CloseBracketToken)});
 //
 //    }
 
@@ -7885,7 +7910,7 @@ namespace Alchemy::Compilation {
                     if (CanBeNullableType(parser, type, mode)) {
                         SyntaxToken question;
                         if (TryEatNullableQualifierIfApplicable(parser, mode, &question)) {
-                            type = parser->CreateNode<NullableTypeSyntax>(type, question);
+                            type = parser->CreateNode(NullableTypeSyntax {type, question});
                             continue;
                         }
                     }
@@ -7901,7 +7926,7 @@ namespace Alchemy::Compilation {
 //                        ranks.Add(ParseArrayRankSpecifier(parser, &unused));
 //                    } while (parser->currentToken.kind == TokenKind::OpenBracketToken);
 //
-//                    type = parser->CreateNode<ArrayTypeSyntax>(type, ranks.ToSyntaxList(parser->allocator));
+//                    type = parser->CreateNode(ArrayTypeSyntax {type, ranks.ToSyntaxList(parser->allocator)});
 //                    continue;
 //                }
                 default:
@@ -7919,11 +7944,11 @@ namespace Alchemy::Compilation {
             SyntaxToken refKeyword = parser->EatToken();
             SyntaxToken readonlyKeyword = parser->currentToken.kind == TokenKind::ReadOnlyKeyword ? parser->EatToken() : SyntaxToken();
             TypeSyntax* type = ParseTypeCore(parser, ParseTypeMode::AfterRef);
-            return parser->CreateNode<RefTypeSyntax>(
-                parser->EatToken(),
+            return parser->CreateNode(RefTypeSyntax {
+                refKeyword,
                 readonlyKeyword,
                 type
-            );
+            });
 
         }
 
@@ -66,18 +66,9 @@ namespace Alchemy::Compilation {
             startId_kind_combined = (startId_kind_combined & 0xFF000000) | (startId & 0x00FFFFFF);
         }
 
-        inline bool IsMissing(CheckedArray<SyntaxToken> tokens) {
-            int32 endTokenId = GetEndTokenId();
-            for(int32 i = GetStartTokenId(); i < endTokenId; i++) {
-                SyntaxToken * pToken = &tokens[i];
-                if(pToken->kind == TokenKind::Trivia) {
-                    continue;
-                }
-                if(pToken->IsMissing()) {
-                    return true;
-                }
-            }
-            return false;
+        // missing tokens never make it into the token list, the parser flags nodes that are made of nothing else
+        inline bool IsMissing() {
+            return (GetFlags() & SyntaxTokenFlags::Missing) != 0;
         }
 
 //        #if true // shows better debugger output if polymorphic
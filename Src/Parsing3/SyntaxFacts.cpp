@@ -423,6 +423,8 @@ namespace Alchemy::Compilation::SyntaxFacts {
                 return "public";
             case TokenKind::PrivateKeyword:
                 return "private";
+            case TokenKind::ExportKeyword:
+                return "export";
             case TokenKind::InternalKeyword:
                 return "internal";
             case TokenKind::ProtectedKeyword:
@@ -640,6 +642,7 @@ namespace Alchemy::Compilation::SyntaxFacts {
                 return Precedence::Expression;
             case SyntaxKind::AnonymousObjectCreationExpression:
             case SyntaxKind::ArrayCreationExpression:
+            case SyntaxKind::BangExpression:
             case SyntaxKind::BaseExpression:
             case SyntaxKind::CharacterLiteralExpression:
             case SyntaxKind::CollectionExpression:
@@ -648,6 +651,7 @@ namespace Alchemy::Compilation::SyntaxFacts {
             case SyntaxKind::DefaultExpression:
             case SyntaxKind::DefaultLiteralExpression:
             case SyntaxKind::ElementAccessExpression:
+            case SyntaxKind::EmptyStringLiteralExpression:
             case SyntaxKind::FalseLiteralExpression:
             case SyntaxKind::GenericName:
             case SyntaxKind::IdentifierName:
@@ -664,6 +668,7 @@ namespace Alchemy::Compilation::SyntaxFacts {
             case SyntaxKind::PostDecrementExpression:
             case SyntaxKind::PostIncrementExpression:
             case SyntaxKind::PredefinedType:
+            case SyntaxKind::RawStringLiteralExpression:
             case SyntaxKind::RefExpression:
             case SyntaxKind::SimpleMemberAccessExpression:
             case SyntaxKind::StackAllocArrayCreationExpression:
@@ -757,6 +762,7 @@ namespace Alchemy::Compilation::SyntaxFacts {
             case TokenKind::SwitchKeyword:
             case TokenKind::EqualsGreaterThanToken:
             case TokenKind::DotDotToken:
+            case TokenKind::InterpolatedExpressionEnd: // `"${(a)}"` closes the parens, there is nothing to cast
                 return false;
             default:
                 return true;
@@ -858,6 +864,7 @@ namespace Alchemy::Compilation::SyntaxFacts {
             case TokenKind::PrivateKeyword:
             case TokenKind::ProtectedKeyword:
             case TokenKind::PublicKeyword:
+            case TokenKind::ExportKeyword:
             case TokenKind::SealedKeyword:
             case TokenKind::StaticKeyword:
                 return true;
@@ -54,6 +54,7 @@ namespace Alchemy::Compilation {
         GetAccessorDeclaration,
         SetAccessorDeclaration,
         InitAccessorDeclaration,
+        UnknownAccessorDeclaration,
         TypeArgumentList,
         VariableDeclarator,
 
@@ -214,9 +214,8 @@ namespace Alchemy::Compilation {
             : SyntaxBase(SyntaxKind::SwitchSection)
             , labels(labels)
             , statements(statements) {
-            // min size = 1
+            // min size = 1, statements can come back empty when recovering from `case x: }`
             assert(labels->size >= 1);
-            assert(statements->size >= 1);
         }
 
     };
@@ -986,6 +985,7 @@ namespace Alchemy::Compilation {
         VALID_SYNTAX_KINDS = {
             SyntaxKind::PostIncrementExpression,
             SyntaxKind::PostDecrementExpression,
+            SyntaxKind::BangExpression, // `a!`
         };
 
         PostfixUnaryExpressionSyntax(SyntaxKind kind, ExpressionSyntax* expression, SyntaxToken operatorToken)
@@ -2164,7 +2164,7 @@ namespace Alchemy::Compilation {
         SyntaxToken end;
 
         CharacterLiteralExpressionSyntax(SyntaxToken start, SyntaxToken contents, SyntaxToken end)
-            : ExpressionSyntax(SyntaxKind::RawStringLiteralExpression)
+            : ExpressionSyntax(SyntaxKind::CharacterLiteralExpression)
             , start(start)
             , contents(contents)
             , end(end) {}
@@ -2197,7 +2197,8 @@ namespace Alchemy::Compilation {
         VALID_SYNTAX_KINDS = {
             SyntaxKind::GetAccessorDeclaration,
             SyntaxKind::SetAccessorDeclaration,
-            SyntaxKind::InitAccessorDeclaration
+            SyntaxKind::InitAccessorDeclaration,
+            SyntaxKind::UnknownAccessorDeclaration
         };
 
         AccessorDeclarationSyntax(SyntaxKind kind, TokenList* modifiers, SyntaxToken keyword, BlockSyntax* bodyBlock, ArrowExpressionClauseSyntax* expressionBody, SyntaxToken semiColon)
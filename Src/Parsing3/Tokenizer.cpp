@@ -73,6 +73,9 @@ namespace Alchemy::Compilation {
         TempAllocator::ScopedMarker marker(GetThreadLocalAllocator());
         PendingSyntaxTokenList tokens(GetThreadLocalAllocator(), 256);
 
+        // diagnostics store offsets into the text we are about to scan
+        diagnostics->SetSource(FixedCharSpan(textWindow.start, textWindow.end - textWindow.start));
+
         TokenizeInternal(&textWindow, diagnostics, &tokens);
 
         PendingSyntaxTokenList::Page * pagePtr = &tokens.firstPage;
@@ -244,6 +247,8 @@ namespace Alchemy::Compilation {
                         onlyWhitespaceOnLine = false;
                         break;
                     }
+                    // a divide, not trivia. falling through would scan an empty end of line forever
+                    return;
                 }
                 case '\r':
                 case '\n': {
@@ -257,8 +262,9 @@ namespace Alchemy::Compilation {
                     break;
                 }
                 case '#': {
-                    LexDirectiveAndExcludedTrivia(afterFirstToken, isTrailing || !onlyWhitespaceOnLine, buffer);
-                    break;
+                    // there are no directives (yet), a # gets scanned as an unexpected character instead
+                    // LexDirectiveAndExcludedTrivia(afterFirstToken, isTrailing || !onlyWhitespaceOnLine, buffer);
+                    return;
                 }
                 case '|':
                 case '=':
@@ -465,10 +471,10 @@ namespace Alchemy::Compilation {
 
                         // textWindow points at the } now (or '\0' if we ran out of things to tokenize)
                         PendingSyntaxToken interpolationEnd;
-                        interpolationStart.kind = TokenKind::InterpolatedExpressionEnd;
-                        interpolationStart.contextualKind = TokenKind::InterpolatedExpressionEnd;
-                        interpolationStart.text = textWindow->ptr;
-                        interpolationStart.textSize = 1; // }
+                        interpolationEnd.kind = TokenKind::InterpolatedExpressionEnd;
+                        interpolationEnd.contextualKind = TokenKind::InterpolatedExpressionEnd;
+                        interpolationEnd.text = textWindow->ptr;
+                        interpolationEnd.textSize = 1; // }
                         tokens->Add(interpolationEnd);
 
                         stringPart.text = textWindow->ptr + 1; // we'll advance after break but set this here
@@ -513,9 +519,9 @@ namespace Alchemy::Compilation {
                         endToken.kind = TokenKind::RawStringLiteralEnd;
                         endToken.contextualKind = TokenKind::RawStringLiteralEnd;
                         endToken.text = textWindow->ptr;
-                        endToken.textSize = 1; // "
+                        endToken.textSize = cnt; // the closing quotes match the opening ones
                         tokens->Add(endToken);
-                        textWindow->Advance();
+                        textWindow->Advance(cnt);
                         return;
                     }
                     else {
@@ -828,7 +834,7 @@ namespace Alchemy::Compilation {
 
     void ScanSyntaxToken(TextWindow* textWindow, PendingSyntaxToken* info, Diagnostics* diagnostics, int32* badTokenCount) {
 
-        char* start = textWindow->start;
+        char* start = textWindow->ptr;
 
         char character = textWindow->PeekChar();
 
@@ -998,15 +1004,7 @@ namespace Alchemy::Compilation {
                 break;
             }
 
-            case '@': {
-                NOT_IMPLEMENTED("@ token handling");
-                break;
-            }
-
-            case '$': {
-                NOT_IMPLEMENTED("$ token handling");
-                break;
-            }
+            // @ and $ only mean something inside strings, out here they are unexpected characters like any other
 
             default: {
                 char32 c;
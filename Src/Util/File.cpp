@@ -1,10 +1,15 @@
 #include <cstdio>
 #include <cassert>
 #include <cerrno>
+#include <filesystem>
 #include "./File.h"
 
 #ifndef _WIN32
 
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/uio.h>
+
 errno_t fopen_s(FILE** f, const char* name, const char* mode) {
     errno_t ret = 0;
     assert(f);
@@ -82,3 +87,89 @@ char* Alchemy::ReadFileIntoCString(const char* filename, int32* length) {
     *length = (int32) fileSize;
     return buffer;
 }
+
+int64 Alchemy::GetFileSize(const char* path) {
+    std::error_code error;
+    uintmax_t size = std::filesystem::file_size(path, error);
+    return error ? -1 : (int64) size;
+}
+
+bool Alchemy::WriteFileSegments(const char* path, Alchemy::CheckedArray<Alchemy::FixedCharSpan> segments) {
+
+#ifndef _WIN32
+
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        return false;
+    }
+
+    // IOV_MAX is at least 1024 everywhere we care about, a smaller batch keeps it on the stack
+    constexpr int32 kBatchSize = 256;
+    struct iovec iov[kBatchSize];
+
+    int32 next = 0;
+
+    while (next < segments.size) {
+
+        int32 count = 0;
+        while (count < kBatchSize && next + count < segments.size) {
+            iov[count].iov_base = segments.array[next + count].ptr;
+            iov[count].iov_len = segments.array[next + count].size;
+            count++;
+        }
+
+        struct iovec* pending = iov;
+        int32 pendingCount = count;
+
+        // a short write leaves us somewhere in the middle of a segment
+        while (pendingCount != 0) {
+
+            ssize_t written = writev(fd, pending, pendingCount);
+
+            if (written < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                close(fd);
+                return false;
+            }
+
+            while (pendingCount != 0 && (size_t) written >= pending->iov_len) {
+                written -= (ssize_t) pending->iov_len;
+                pending++;
+                pendingCount--;
+            }
+
+            if (pendingCount != 0) {
+                pending->iov_base = (char*) pending->iov_base + written;
+                pending->iov_len -= written;
+            }
+
+        }
+
+        next += count;
+
+    }
+
+    return close(fd) == 0;
+
+#else
+
+    FILE* file;
+    fopen_s(&file, path, "wb");
+    if (file == nullptr) {
+        return false;
+    }
+
+    for (int32 i = 0; i < segments.size; i++) {
+        if (fwrite(segments.array[i].ptr, 1, segments.array[i].size, file) != segments.array[i].size) {
+            fclose(file);
+            return false;
+        }
+    }
+
+    return fclose(file) == 0;
+
+#endif
+
+}
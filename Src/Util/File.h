@@ -2,6 +2,7 @@
 
 #include "FixedCharSpan.h"
 #include "../Allocation/LinearAllocator.h"
+#include "../Collections/CheckedArray.h"
 
 namespace Alchemy {
 
@@ -9,4 +10,10 @@ namespace Alchemy {
 
     char* ReadFileIntoCString(const char* filename, int32* length);
 
+    // -1 when there is no such file
+    int64 GetFileSize(const char* path);
+
+    // replaces the file with the segments back to back, a single writev where there is one. false if it couldn't be written
+    bool WriteFileSegments(const char* path, CheckedArray<FixedCharSpan> segments);
+
 }
\ No newline at end of file
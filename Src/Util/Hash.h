@@ -21,6 +21,21 @@ namespace Alchemy::MsiHash {
         return FNV1a(span.ptr, span.size);
     }
 
+    constexpr uint64 kFNV1a64OffsetBasis = 14695981039346656037ull;
+
+    // incremental 64 bit variant, start with kFNV1a64OffsetBasis and feed the previous result back in
+    inline uint64 FNV1a64(uint64 hash, const void* data, size_t size) {
+        constexpr uint64 FNV_PRIME_64 = 1099511628211ull;
+        const uint8* bytes = (const uint8*) data;
+
+        for (size_t i = 0; i < size; ++i) {
+            hash ^= bytes[i];
+            hash *= FNV_PRIME_64;
+        }
+
+        return hash;
+    }
+
     inline int32 Lookup32(int32 hash, int32 exponent, int32 idx) {
         uint32 mask = ((uint32) 1 << exponent) - 1;
         uint32 step = (hash >> (32 - exponent)) | 1;
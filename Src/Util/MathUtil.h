@@ -1,5 +1,11 @@
 #pragma once
 
+#include "../PrimitiveTypes.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 namespace Alchemy::MathUtil {
 
     inline int32 CeilPow2(int32 x) {
@@ -23,6 +29,18 @@ namespace Alchemy::MathUtil {
         return x + 1;
     }
 
+    // index of the highest set bit, x must not be 0
+    inline int32 FloorLog2(uint64 x) {
+        assert(x != 0);
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanReverse64(&index, x);
+        return (int32) index;
+#else
+        return 63 - __builtin_clzll(x);
+#endif
+    }
+
    inline int32 LogPow2(uint32 powerOfTwo) {
         switch (powerOfTwo) {
             case 1:          return 0;
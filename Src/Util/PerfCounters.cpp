@@ -0,0 +1,170 @@
+#include "./PerfCounters.h"
+#include <cstring>
+
+#if ALCHEMY_PERF_COUNTERS != 0 && defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define ALCHEMY_PERF_EVENT_OPEN 1
+#else
+#define ALCHEMY_PERF_EVENT_OPEN 0
+#endif
+
+namespace Alchemy {
+
+    const char* PerfCounterToString(PerfCounter counter) {
+        switch (counter) {
+            case PerfCounter::Cycles: return "cycles";
+            case PerfCounter::Instructions: return "instructions";
+            case PerfCounter::BranchMisses: return "branchMisses";
+            case PerfCounter::L1DataMisses: return "l1DataMisses";
+            case PerfCounter::LastLevelCacheMisses: return "llcMisses";
+            case PerfCounter::PageFaults: return "pageFaults";
+            default: return "Invalid";
+        }
+    }
+
+#if ALCHEMY_PERF_EVENT_OPEN
+
+    static int32 OpenEvent(PerfCounter counter, int32 groupFd) {
+
+        perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+
+        switch (counter) {
+            case PerfCounter::Cycles:
+                attr.type = PERF_TYPE_HARDWARE;
+                attr.config = PERF_COUNT_HW_CPU_CYCLES;
+                break;
+            case PerfCounter::Instructions:
+                attr.type = PERF_TYPE_HARDWARE;
+                attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+                break;
+            case PerfCounter::BranchMisses:
+                attr.type = PERF_TYPE_HARDWARE;
+                attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+                break;
+            case PerfCounter::L1DataMisses:
+                attr.type = PERF_TYPE_HW_CACHE;
+                attr.config = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+                break;
+            case PerfCounter::LastLevelCacheMisses:
+                attr.type = PERF_TYPE_HARDWARE;
+                attr.config = PERF_COUNT_HW_CACHE_MISSES;
+                break;
+            case PerfCounter::PageFaults:
+                attr.type = PERF_TYPE_SOFTWARE;
+                attr.config = PERF_COUNT_SW_PAGE_FAULTS;
+                break;
+            default:
+                return -1;
+        }
+
+        // perf_event_paranoid 2, the default on most distros, only lets us count user space
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        return (int32) syscall(SYS_perf_event_open, &attr, 0, -1, groupFd, PERF_FLAG_FD_CLOEXEC);
+
+    }
+
+#endif
+
+    PerfCounterGroup::PerfCounterGroup()
+        : leaderFd(-1)
+        , availableMask(0) {
+        for (int32 i = 0; i < kPerfCounterCount; i++) {
+            fds[i] = -1;
+        }
+    }
+
+    PerfCounterGroup::~PerfCounterGroup() {
+        Close();
+    }
+
+    void PerfCounterGroup::Open() {
+
+        Close();
+
+#if ALCHEMY_PERF_EVENT_OPEN
+        // page faults are a software event and lead the group, that way it exists even when there is no PMU to
+        // count the hardware events with
+        leaderFd = OpenEvent(PerfCounter::PageFaults, -1);
+
+        if (leaderFd < 0) {
+            leaderFd = -1;
+            return;
+        }
+
+        fds[(int32) PerfCounter::PageFaults] = leaderFd;
+        availableMask |= 1u << (uint32) PerfCounter::PageFaults;
+
+        for (int32 i = 0; i < kPerfCounterCount; i++) {
+            if (i == (int32) PerfCounter::PageFaults) {
+                continue;
+            }
+            int32 fd = OpenEvent((PerfCounter) i, leaderFd);
+            if (fd >= 0) {
+                fds[i] = fd;
+                availableMask |= 1u << (uint32) i;
+            }
+        }
+#endif
+
+    }
+
+    void PerfCounterGroup::Close() {
+#if ALCHEMY_PERF_EVENT_OPEN
+        for (int32 i = 0; i < kPerfCounterCount; i++) {
+            if (fds[i] >= 0) {
+                close(fds[i]);
+            }
+        }
+#endif
+        for (int32 i = 0; i < kPerfCounterCount; i++) {
+            fds[i] = -1;
+        }
+        leaderFd = -1;
+        availableMask = 0;
+    }
+
+    void PerfCounterGroup::Read(PerfCounterValues* values) {
+
+        memset(values, 0, sizeof(PerfCounterValues));
+
+#if ALCHEMY_PERF_EVENT_OPEN
+        if (leaderFd < 0) {
+            return;
+        }
+
+        // nr, time enabled, time running, then one value per member
+        uint64 data[3 + kPerfCounterCount];
+        ssize_t size = read(leaderFd, data, sizeof(data));
+
+        if (size < (ssize_t) (3 * sizeof(uint64)) || data[2] == 0) {
+            return;
+        }
+
+        uint64 enabled = data[1];
+        uint64 running = data[2];
+        int32 count = (int32) data[0];
+
+        // members come back in the order they joined, the leader first
+        int32 slot = 0;
+        for (int32 pass = 0; pass < 2; pass++) {
+            for (int32 i = 0; i < kPerfCounterCount && slot < count; i++) {
+                bool isLeader = i == (int32) PerfCounter::PageFaults;
+                if (isLeader != (pass == 0) || (availableMask & (1u << (uint32) i)) == 0) {
+                    continue;
+                }
+                uint64 value = data[3 + slot++];
+                values->values[i] = running < enabled ? (uint64) ((double) value * enabled / running) : value;
+            }
+        }
+#endif
+
+    }
+
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "../PrimitiveTypes.h"
+
+// build with ALCHEMY_PERF_COUNTERS=1 to read hardware counters around every job (linux only, perf_event_open).
+// when it is 0 the worker never touches them and every group reports nothing available
+#ifndef ALCHEMY_PERF_COUNTERS
+#define ALCHEMY_PERF_COUNTERS 0
+#endif
+
+#if ALCHEMY_PERF_COUNTERS != 0
+#define PERF_COUNTERS(x) x
+#else
+#define PERF_COUNTERS(x)
+#endif
+
+namespace Alchemy {
+
+    enum class PerfCounter : uint8 {
+        Cycles,
+        Instructions,
+        BranchMisses,
+        L1DataMisses,
+        LastLevelCacheMisses,
+        PageFaults,
+
+        Count
+    };
+
+    constexpr int32 kPerfCounterCount = (int32) PerfCounter::Count;
+
+    const char* PerfCounterToString(PerfCounter counter);
+
+    struct PerfCounterValues {
+
+        uint64 values[kPerfCounterCount];
+
+        // scaled totals can step backwards when the multiplexing ratio moves, those intervals count as 0
+        void Add(const PerfCounterValues& start, const PerfCounterValues& end) {
+            for (int32 i = 0; i < kPerfCounterCount; i++) {
+                values[i] += end.values[i] > start.values[i] ? end.values[i] - start.values[i] : 0;
+            }
+        }
+
+    };
+
+    // The counters of the thread that opened the group, running totals since Open. Anything the kernel or the
+    // machine won't give us (no PMU in a vm, perf_event_paranoid, another OS) is left out of availableMask and
+    // reads as 0, so callers never have to care. When the PMU has to time slice the group the totals are scaled up
+    // from the time it actually ran.
+    struct PerfCounterGroup {
+
+        int32 fds[kPerfCounterCount];
+        int32 leaderFd;
+        uint32 availableMask; // 1 << PerfCounter
+
+        PerfCounterGroup();
+
+        ~PerfCounterGroup();
+
+        PerfCounterGroup(const PerfCounterGroup&) = delete;
+        PerfCounterGroup& operator=(const PerfCounterGroup&) = delete;
+
+        // counts the calling thread only, call it from the thread to be measured
+        void Open();
+
+        void Close();
+
+        void Read(PerfCounterValues* values);
+
+    };
+
+}
@@ -0,0 +1,87 @@
+#include "./ProcessMemory.h"
+
+#if defined(_WIN32) || defined(_WIN64)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <psapi.h>
+#elif defined(__APPLE__)
+#include <mach/mach.h>
+#include <sys/resource.h>
+#else
+#include <sys/resource.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstdio>
+#endif
+
+namespace Alchemy {
+
+    size_t GetProcessResidentBytes() {
+#if defined(_WIN32) || defined(_WIN64)
+        PROCESS_MEMORY_COUNTERS counters;
+        if (!K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+            return 0;
+        }
+        return counters.WorkingSetSize;
+#elif defined(__APPLE__)
+        mach_task_basic_info_data_t info;
+        mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+        if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, (task_info_t) &info, &count) != KERN_SUCCESS) {
+            return 0;
+        }
+        return info.resident_size;
+#else
+        FILE* file = fopen("/proc/self/statm", "r");
+        if (file == nullptr) {
+            return 0;
+        }
+        unsigned long long pages = 0;
+        unsigned long long residentPages = 0;
+        int32 read = fscanf(file, "%llu %llu", &pages, &residentPages);
+        fclose(file);
+        return read == 2 ? (size_t) residentPages * (size_t) sysconf(_SC_PAGESIZE) : 0;
+#endif
+    }
+
+    int32 GetProcessMappingCount() {
+#if defined(_WIN32) || defined(_WIN64) || defined(__APPLE__)
+        return 0;
+#else
+        int32 fd = open("/proc/self/maps", O_RDONLY);
+        if (fd < 0) {
+            return 0;
+        }
+
+        // one line per mapping
+        char buffer[4096];
+        int32 count = 0;
+        ssize_t size;
+        while ((size = ::read(fd, buffer, sizeof(buffer))) > 0) {
+            for (ssize_t i = 0; i < size; i++) {
+                count += buffer[i] == '\n';
+            }
+        }
+
+        close(fd);
+        return count;
+#endif
+    }
+
+    uint64 GetProcessPageFaults() {
+#if defined(_WIN32) || defined(_WIN64)
+        // windows doesn't tell minor from major faults
+        PROCESS_MEMORY_COUNTERS counters;
+        if (!K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+            return 0;
+        }
+        return counters.PageFaultCount;
+#else
+        struct rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) != 0) {
+            return 0;
+        }
+        return (uint64) usage.ru_minflt + (uint64) usage.ru_majflt;
+#endif
+    }
+
+}
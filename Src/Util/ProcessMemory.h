@@ -0,0 +1,16 @@
+#pragma once
+
+#include "../PrimitiveTypes.h"
+
+namespace Alchemy {
+
+    // resident set of the whole process, 0 where we can't tell
+    size_t GetProcessResidentBytes();
+
+    // address ranges the process has mapped, from /proc/self/maps. 0 anywhere but linux
+    int32 GetProcessMappingCount();
+
+    // minor + major page faults the process took so far, 0 where we can't tell
+    uint64 GetProcessPageFaults();
+
+}
@@ -0,0 +1,31 @@
+#include "./Stopwatch.h"
+
+#if defined(_WIN32) || defined(_WIN64)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+namespace Alchemy {
+
+    uint64 GetProcessCpuNanoseconds() {
+#if defined(_WIN32) || defined(_WIN64)
+        FILETIME creation, exit, kernel, user;
+        if (!GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user)) {
+            return 0;
+        }
+        // 100ns ticks
+        uint64 kernelTicks = ((uint64) kernel.dwHighDateTime << 32) | kernel.dwLowDateTime;
+        uint64 userTicks = ((uint64) user.dwHighDateTime << 32) | user.dwLowDateTime;
+        return (kernelTicks + userTicks) * 100;
+#else
+        timespec time;
+        if (clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &time) != 0) {
+            return 0;
+        }
+        return (uint64) time.tv_sec * 1000000000ull + (uint64) time.tv_nsec;
+#endif
+    }
+
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "../PrimitiveTypes.h"
+#include <chrono>
+
+namespace Alchemy {
+
+    // monotonic, only good for differences
+    inline uint64 GetTimestampNanoseconds() {
+        return (uint64) std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // user + system time of every thread in the process
+    uint64 GetProcessCpuNanoseconds();
+
+    struct Stopwatch {
+
+        uint64 start;
+
+        Stopwatch() : start(GetTimestampNanoseconds()) {}
+
+        inline uint64 ElapsedNanoseconds() const {
+            return GetTimestampNanoseconds() - start;
+        }
+
+        // returns the time since the last lap (or construction)
+        inline uint64 Lap() {
+            uint64 now = GetTimestampNanoseconds();
+            uint64 elapsed = now - start;
+            start = now;
+            return elapsed;
+        }
+
+    };
+
+}
@@ -1,13 +1,31 @@
 #include <catch2/catch_all.hpp>
+#include <string>
+#include <thread>
+#include <fstream>
+#include <sstream>
+#include <filesystem>
 #include "../Src/Allocation/ThreadLocalTemp.h"
+#include "../Src/Allocation/SlabAllocator.h"
 #include "../Src/Parsing3/TextWindow.h"
 #include "../Src/Parsing3/Scanning.h"
+#include "../Src/Parsing3/Tokenizer.h"
 #include "./TestUtil.h"
 #include "../Src/Parsing3/Parser.h"
 #include "../Src/Parsing3/Parsing.h"
 #include "../Src/Compiler2/FullyQualifiedName.h"
 #include "../Src/FileSystem/VirtualFileSystem.h"
 #include "../Src/Compiler2/Compiler.h"
+#include "../Src/Compiler2/MemberLookupTable.h"
+#include "../Src/Compiler2/MemberInfo.h"
+#include "../Src/Compiler2/LocalSymbolTable.h"
+#include "../Src/Compiler2/Jobs/IntrospectScopesJob.h"
+#include "../Src/Compiler2/ConstantFolding.h"
+#include "../Src/Compiler2/Snapshot.h"
+#include "../Src/Compiler2/LoadBuiltIns.h"
+#include "../Src/Parsing3/FindSkippedTokens.h"
+#include "../Src/Util/PerfCounters.h"
+#include "../Src/Util/Stopwatch.h"
+#include "../Tools/SyntaxGenerator.h"
 
 using namespace Alchemy::Compilation;
 
@@ -74,6 +92,1982 @@ TEST_CASE("xyz") {
 
 }
 
+TEST_CASE("generic instances are swept between runs") {
+
+    FixedCharSpan package("Package");
+
+    Compiler compiler(0, FileSystemType::Virtual);
+
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/one.wyx")), FixedCharSpan(R"(
+        public class Thing<T> {
+            T value;
+        }
+    )"));
+
+    FixedCharSpan usesFloat(R"(
+        public class User {
+            Thing<float> thing;
+        }
+    )");
+
+    FixedCharSpan usesInt(R"(
+        public class User {
+            Thing<int> thing;
+        }
+    )");
+
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/two.wyx")), usesFloat);
+
+    PackageInfo info;
+    info.absolutePath = FixedCharSpan("path/");
+    info.packageName = package;
+
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+    TypeInfo* typeInfo = nullptr;
+    REQUIRE(compiler.resolveMap.TryResolve(FixedCharSpan("global::Thing$1<BuiltIn::Float>"), &typeInfo));
+
+    int32 instanceCount = compiler.resolveMap.genericInstances.GetInstanceCount();
+    size_t committed = compiler.resolveMap.genericInstances.GetCommittedBytes();
+
+    for (int32 i = 1; i < 100; i++) {
+        compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/two.wyx"), i), (i & 1) ? usesInt : usesFloat);
+        compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+        REQUIRE(compiler.resolveMap.genericInstances.GetInstanceCount() == instanceCount);
+    }
+
+    REQUIRE(compiler.resolveMap.TryResolve(FixedCharSpan("global::Thing$1<BuiltIn::Int32>"), &typeInfo));
+    REQUIRE(!compiler.resolveMap.TryResolve(FixedCharSpan("global::Thing$1<BuiltIn::Float>"), &typeInfo));
+    REQUIRE(compiler.resolveMap.genericInstances.GetCommittedBytes() == committed);
+
+}
+
+static std::string MakeBaseWithFields(int32 fieldCount) {
+    std::string text = "public class Base {";
+    for (int32 i = 0; i < fieldCount; i++) {
+        text += " public int f" + std::to_string(i) + ";";
+    }
+    return text + " }";
+}
+
+TEST_CASE("member tables of generic instances that outgrow their block give it back") {
+
+    FixedCharSpan package("Package");
+
+    PackageInfo info;
+    info.absolutePath = FixedCharSpan("path/");
+    info.packageName = package;
+
+    FixedCharSpan thingFile("public class Thing<T> : Base { T value; }");
+    FixedCharSpan userFile("public class User { Thing<int> thing; }");
+
+    std::string bases[] = { MakeBaseWithFields(1), MakeBaseWithFields(6), MakeBaseWithFields(14), MakeBaseWithFields(30) };
+
+    Compiler compiler(0, FileSystemType::Virtual);
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/one.wyx")), thingFile);
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/two.wyx")), userFile);
+
+    // each edit grows Thing<int>'s table past its block
+    for (int32 i = 0; i < 4; i++) {
+        compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/base.wyx"), i), FixedCharSpan(bases[i].c_str()));
+        compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+    }
+
+    TypeInfo* thing = nullptr;
+    REQUIRE(compiler.resolveMap.TryResolve(FixedCharSpan("global::Thing$1<BuiltIn::Int32>"), &thing));
+    REQUIRE(thing->memberTable->Find(FixedCharSpan("f29")) != nullptr);
+    REQUIRE(thing->memberTable->Find(FixedCharSpan("value")) != nullptr);
+
+    Compiler fresh(0, FileSystemType::Virtual);
+    fresh.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/one.wyx")), thingFile);
+    fresh.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/two.wyx")), userFile);
+    fresh.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/base.wyx")), FixedCharSpan(bases[3].c_str()));
+    fresh.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+    REQUIRE(compiler.resolveMap.genericInstances.GetLiveBytes() == fresh.resolveMap.genericInstances.GetLiveBytes());
+
+    compiler.jobSystem.Shutdown();
+    fresh.jobSystem.Shutdown();
+
+}
+
+TEST_CASE("body only edits don't invalidate dependants") {
+
+    FixedCharSpan package("Package");
+
+    Compiler compiler(0, FileSystemType::Virtual);
+
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/a.wyx")), FixedCharSpan(R"(
+        public class A {
+            int x;
+            public void M() {}
+        }
+    )"));
+
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/b.wyx")), FixedCharSpan(R"(
+        public class B {
+            A a;
+        }
+    )"));
+
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/c.wyx")), FixedCharSpan(R"(
+        public class C {
+            int y;
+        }
+    )"));
+
+    PackageInfo info;
+    info.absolutePath = FixedCharSpan("path/");
+    info.packageName = package;
+
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/a.wyx"), 1), FixedCharSpan(R"(
+        public class A {
+            int x;
+            public void M() {
+                // only the body changed
+            }
+        }
+    )"));
+
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+    // B's signature saw nothing change and the new A took over the old one's id, so B isn't touched
+    REQUIRE(compiler.changedFileCount == 1);
+    REQUIRE(compiler.relinkedFileCount == 0);
+    REQUIRE(compiler.signatureChangedFileCount == 0);
+
+    TypeInfo* a = nullptr;
+    TypeInfo* b = nullptr;
+    REQUIRE(compiler.resolveMap.TryResolve(FixedCharSpan("global::A"), &a));
+    REQUIRE(compiler.resolveMap.TryResolve(FixedCharSpan("global::B"), &b));
+    REQUIRE(b->fields[0].type.GetTypeInfo() == a);
+
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/a.wyx"), 2), FixedCharSpan(R"(
+        public class A {
+            float x;
+            public void M() {}
+        }
+    )"));
+
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+    REQUIRE(compiler.changedFileCount == 1);
+    REQUIRE(compiler.relinkedFileCount == 1);
+    REQUIRE(compiler.signatureChangedFileCount == 1);
+
+}
+
+TEST_CASE("a signature edit re-checks the bodies that use the type") {
+
+    FixedCharSpan package("Package");
+
+    PackageInfo info;
+    info.absolutePath = FixedCharSpan("path/");
+    info.packageName = package;
+
+    Compiler compiler(0, FileSystemType::Virtual);
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/lib.wyx")), FixedCharSpan("public class Lib { public const int Size = 4; public int Get() { return 1; } }"));
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/user.wyx")), FixedCharSpan("public class User { int M() { return Lib.Size; } }"));
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/other.wyx")), FixedCharSpan("public class Other { int x; }"));
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+    TypeInfo* user = nullptr;
+    REQUIRE(compiler.resolveMap.TryResolve(FixedCharSpan("global::User"), &user));
+    // Lib only shows up in a body, resolution never saw it
+    REQUIRE(user->declaringFile->typeDependencies.size == 0);
+    REQUIRE(user->declaringFile->dependencies.size == 1);
+
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/lib.wyx"), 1), FixedCharSpan("public class Lib { public const int Size = 4; public int Get() { return 2; } }"));
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+    REQUIRE(compiler.relinkedFileCount == 0);
+    REQUIRE(compiler.stats.introspectedMethodCount == 1);
+    REQUIRE(user->methods[0].introspection == nullptr);
+
+    // the value is folded into User.M, so it is part of Lib's shape
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/lib.wyx"), 2), FixedCharSpan("public class Lib { public const int Size = 8; public int Get() { return 2; } }"));
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+    REQUIRE(compiler.relinkedFileCount == 1);
+    REQUIRE(compiler.signatureChangedFileCount == 1);
+    REQUIRE(compiler.stats.introspectedMethodCount == 2);
+    REQUIRE(user->methods[0].introspection != nullptr);
+
+    // a type that goes away takes its id with it, whoever held it resolves again
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/lib.wyx"), 3), FixedCharSpan("public class Library { }"));
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+    REQUIRE(compiler.relinkedFileCount == 1);
+    REQUIRE(user->methods[0].introspection != nullptr);
+
+}
+
+TEST_CASE("body only edits to generic types keep their instances") {
+
+    FixedCharSpan package("Package");
+
+    PackageInfo info;
+    info.absolutePath = FixedCharSpan("path/");
+    info.packageName = package;
+
+    Compiler compiler(0, FileSystemType::Virtual);
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/box.wyx")), FixedCharSpan("public class Box<T> { T value; public T Get() { return value; } }"));
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/user.wyx")), FixedCharSpan("public class User { Box<int> box; }"));
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/holder.wyx")), FixedCharSpan("public class Holder<T> { Box<T> inner; }"));
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/other.wyx")), FixedCharSpan("public class Other { Holder<float> holder; }"));
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+    TypeInfo* user = nullptr;
+    TypeInfo* boxOfInt = nullptr;
+    REQUIRE(compiler.resolveMap.TryResolve(FixedCharSpan("global::User"), &user));
+    REQUIRE(compiler.resolveMap.TryResolve(FixedCharSpan("global::Box$1<BuiltIn::Int32>"), &boxOfInt));
+    TypeId boxOfIntId = boxOfInt->typeId;
+    REQUIRE(user->fields[0].type.typeId == boxOfIntId);
+
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/box.wyx"), 1), FixedCharSpan("public class Box<T> { T value; public T Get() { T copy = value; return copy; } }"));
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+    // the instance was built again from the new Box under its old id, nobody holding it resolves again
+    REQUIRE(compiler.changedFileCount == 1);
+    REQUIRE(compiler.relinkedFileCount == 0);
+    REQUIRE(compiler.resolveMap.TryResolve(FixedCharSpan("global::Box$1<BuiltIn::Int32>"), &boxOfInt));
+    REQUIRE(boxOfInt->typeId == boxOfIntId);
+    REQUIRE(user->fields[0].type.GetTypeInfo() == boxOfInt);
+    REQUIRE(boxOfInt->fields[0].type.GetTypeInfo() == compiler.resolveMap.builtInTypeInfos[(int32) BuiltInTypeName::Int32]);
+
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/box.wyx"), 2), FixedCharSpan("public class Box<T> { T value; T other; public T Get() { return value; } }"));
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+    // Holder's own shape didn't change, Other keeps what it had and Holder<float> was filled again in place
+    REQUIRE(compiler.relinkedFileCount == 2);
+    REQUIRE(compiler.resolveMap.TryResolve(FixedCharSpan("global::Box$1<BuiltIn::Int32>"), &boxOfInt));
+    REQUIRE(boxOfInt->typeId == boxOfIntId);
+    REQUIRE(boxOfInt->fieldCount == 2);
+
+    TypeInfo* holderOfFloat = nullptr;
+    REQUIRE(compiler.resolveMap.TryResolve(FixedCharSpan("global::Holder$1<BuiltIn::Float>"), &holderOfFloat));
+    REQUIRE(holderOfFloat->fields[0].type.GetTypeInfo()->fieldCount == 2);
+
+    // constraints are part of the shape
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/box.wyx"), 3), FixedCharSpan("public class Box<T> where T : struct { T value; T other; public T Get() { return value; } }"));
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+    REQUIRE(compiler.relinkedFileCount == 2);
+
+    // Box is gone, so are its instances
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/box.wyx"), 4), FixedCharSpan("public class Crate<T> { T value; }"));
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+    REQUIRE(compiler.relinkedFileCount == 2);
+    REQUIRE(!compiler.resolveMap.TryResolve(FixedCharSpan("global::Box$1<BuiltIn::Int32>"), &boxOfInt));
+    REQUIRE(user->fields[0].type.GetTypeInfo() == compiler.resolveMap.unresolvedType);
+
+}
+
+TEST_CASE("member lookup tables include inherited members") {
+
+    FixedCharSpan package("Package");
+
+    Compiler compiler(0, FileSystemType::Virtual);
+
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/one.wyx")), FixedCharSpan(R"(
+        public class Thing<T> {
+            T value;
+            int count;
+        }
+
+        public class Xyz : Thing<float> {
+            public string count;
+        }
+
+        public class Derived : Xyz {
+            char someChar;
+            public void Abc() {}
+        }
+    )"));
+
+    PackageInfo info;
+    info.absolutePath = FixedCharSpan("path/");
+    info.packageName = package;
+
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+    TypeInfo* derived = nullptr;
+    REQUIRE(compiler.resolveMap.TryResolve(FixedCharSpan("global::Derived"), &derived));
+    REQUIRE(derived->memberTable != nullptr);
+
+    MemberLookupEntry* entry = derived->memberTable->Find(FixedCharSpan("someChar"));
+    REQUIRE(entry != nullptr);
+    REQUIRE(entry->depth == 0);
+
+    entry = derived->memberTable->Find(FixedCharSpan("Abc"));
+    REQUIRE(entry != nullptr);
+    REQUIRE(entry->kind == MemberKind::Method);
+
+    // Xyz::count shadows Thing<float>::count
+    entry = derived->memberTable->Find(FixedCharSpan("count"));
+    REQUIRE(entry != nullptr);
+    REQUIRE(entry->depth == 1);
+
+    entry = derived->memberTable->Find(FixedCharSpan("value"));
+    REQUIRE(entry != nullptr);
+    REQUIRE(entry->depth == 2);
+    REQUIRE(entry->GetField()->type.GetTypeInfo() == compiler.resolveMap.builtInTypeInfos[(int32) BuiltInTypeName::Float]);
+
+    REQUIRE(derived->memberTable->Find(FixedCharSpan("missing")) == nullptr);
+
+}
+
+TEST_CASE("member lookup tables of relinked types drop a base that went away") {
+
+    FixedCharSpan package("Package");
+
+    PackageInfo info;
+    info.absolutePath = FixedCharSpan("path/");
+    info.packageName = package;
+
+    Compiler compiler(0, FileSystemType::Virtual);
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/base.wyx")), FixedCharSpan("public class Base { public int inherited; }"));
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/derived.wyx")), FixedCharSpan("public class Derived : Base { int own; }"));
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+    TypeInfo* derived = nullptr;
+    REQUIRE(compiler.resolveMap.TryResolve(FixedCharSpan("global::Derived"), &derived));
+    REQUIRE(derived->memberTable->Find(FixedCharSpan("inherited")) != nullptr);
+
+    // Derived is only relinked, its base is unresolved now and the old table pointed into the freed Base
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/base.wyx"), 1), FixedCharSpan("public class Other { }"));
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+    REQUIRE(compiler.relinkedFileCount == 1);
+    REQUIRE(derived->memberTable->Find(FixedCharSpan("inherited")) == nullptr);
+    REQUIRE(derived->memberTable->Find(FixedCharSpan("own")) != nullptr);
+
+}
+
+TEST_CASE("identifiers resolve to static properties and method groups") {
+
+    FixedCharSpan package("Package");
+
+    PackageInfo info;
+    info.absolutePath = FixedCharSpan("path/");
+    info.packageName = package;
+
+    Compiler compiler(0, FileSystemType::Virtual);
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/one.wyx")), FixedCharSpan(R"(
+        public class Props {
+            public static int Shared { get; }
+            public int Own { get; }
+            static int A() { return Shared; }
+            static int B() { return Own; }
+            int C() { return Shared + Own; }
+            static int D() { return A(); }
+        }
+    )"));
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+    TypeInfo* props = nullptr;
+    REQUIRE(compiler.resolveMap.TryResolve(FixedCharSpan("global::Props"), &props));
+    REQUIRE(props->propertyCount == 2);
+    REQUIRE(props->properties[0].name == FixedCharSpan("Shared"));
+    REQUIRE((props->properties[0].modifiers & MethodModifiers::Static) != 0);
+    REQUIRE(props->properties[1].type.GetTypeInfo() == compiler.resolveMap.builtInTypeInfos[(int32) BuiltInTypeName::Int32]);
+
+    MemberLookupEntry* entry = props->memberTable->Find(FixedCharSpan("Own"));
+    REQUIRE(entry != nullptr);
+    REQUIRE(entry->kind == MemberKind::Property);
+
+    // only the instance property read from a static method is an error
+    Diagnostics* diagnostics = &props->declaringFile->diagnostics;
+    REQUIRE(diagnostics->size == 1);
+    REQUIRE(diagnostics->Get(0).errorCode == ErrorCode::ERR_InstanceFieldAccessInStaticContext);
+
+    REQUIRE(props->methods[0].introspection->expressionCount == 1);
+    REQUIRE(props->methods[2].introspection->expressionCount == 4); // this, both properties & the add
+    REQUIRE(props->methods[3].introspection->expressionCount == 1); // the method group
+
+}
+
+TEST_CASE("local symbol table scopes") {
+
+    TempAllocator* tempAllocator = GetThreadLocalAllocator();
+    TempAllocator::ScopedMarker marker(tempAllocator);
+
+    LocalValue* a = (LocalValue*) 1;
+    LocalValue* b = (LocalValue*) 2;
+    LocalValue* c = (LocalValue*) 3;
+
+    LocalSymbolTable locals;
+    locals.Initialize(tempAllocator, 4);
+
+    locals.PushScope();
+    REQUIRE(locals.Declare(FixedCharSpan("x"), a) == nullptr);
+
+    locals.PushScope();
+    REQUIRE(locals.Find(FixedCharSpan("x")) == a);
+    REQUIRE(locals.Declare(FixedCharSpan("x"), b) == a); // shadowing is reported
+    REQUIRE(locals.Declare(FixedCharSpan("y"), c) == nullptr);
+    REQUIRE(locals.Find(FixedCharSpan("x")) == b);
+
+    // enough names to force a few rehashes
+    char names[100][8];
+    for (int32 i = 0; i < 100; i++) {
+        snprintf(names[i], 8, "v%d", i);
+        REQUIRE(locals.Declare(FixedCharSpan(names[i], strlen(names[i])), c) == nullptr);
+    }
+
+    locals.PopScope();
+    REQUIRE(locals.Find(FixedCharSpan("x")) == a);
+    REQUIRE(locals.Find(FixedCharSpan("y")) == nullptr);
+    REQUIRE(locals.Find(FixedCharSpan("v50")) == nullptr);
+
+    // sibling scopes may re-use names
+    locals.PushScope();
+    REQUIRE(locals.Declare(FixedCharSpan("y"), b) == nullptr);
+    locals.PopScope();
+
+    locals.PopScope();
+    REQUIRE(locals.Find(FixedCharSpan("x")) == nullptr);
+
+}
+
+TEST_CASE("deep hierarchies resolve bases before derived types") {
+
+    FixedCharSpan package("Package");
+
+    Compiler compiler(0, FileSystemType::Virtual);
+
+    constexpr int32 kDepth = 10000;
+
+    // the chain is declared derived first so file order doesn't line up with the hierarchy
+    std::string source = "public class X : Y {} public class Y : X {}\n";
+    for (int32 i = kDepth - 1; i > 0; i--) {
+        source += "public class C" + std::to_string(i) + " : C" + std::to_string(i - 1) + " {}\n";
+    }
+    source += "public class C0 : Base<float> {}\n";
+    source += "public class Base<T> : Root { T value; }\n";
+    source += "public class Root { int rootField; }\n";
+
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/deep.wyx")), FixedCharSpan(source.c_str(), source.size()));
+
+    PackageInfo info;
+    info.absolutePath = FixedCharSpan("path/");
+    info.packageName = package;
+
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+    TypeInfo* last = nullptr;
+    std::string lastName = "global::C" + std::to_string(kDepth - 1);
+    REQUIRE(compiler.resolveMap.TryResolve(FixedCharSpan(lastName.c_str(), lastName.size()), &last));
+    REQUIRE(last->memberTable != nullptr);
+
+    // Base<float> was created while Base itself was still being resolved, it must have been filled in afterwards
+    MemberLookupEntry* entry = last->memberTable->Find(FixedCharSpan("value"));
+    REQUIRE(entry != nullptr);
+    REQUIRE(entry->depth == kDepth);
+    REQUIRE(entry->GetField()->type.GetTypeInfo() == compiler.resolveMap.builtInTypeInfos[(int32) BuiltInTypeName::Float]);
+
+    entry = last->memberTable->Find(FixedCharSpan("rootField"));
+    REQUIRE(entry != nullptr);
+    REQUIRE(entry->depth == kDepth + 1);
+
+    TypeInfo* x = nullptr;
+    REQUIRE(compiler.resolveMap.TryResolve(FixedCharSpan("global::X"), &x));
+    REQUIRE(x->memberTable != nullptr);
+
+    int32 cycleErrors = 0;
+    for (int32 i = 0; i < x->declaringFile->diagnostics.size; i++) {
+        if (x->declaringFile->diagnostics.Get(i).errorCode == ErrorCode::ERR_CycleDetectedInClassHierarchy) {
+            cycleErrors++;
+        }
+    }
+    REQUIRE(cycleErrors == 2);
+
+}
+
+TEST_CASE("incremental rebuilds recycle file arenas") {
+
+    FixedCharSpan package("Package");
+
+    Compiler compiler(0, FileSystemType::Virtual);
+
+    PackageInfo info;
+    info.absolutePath = FixedCharSpan("path/");
+    info.packageName = package;
+
+    ArenaPool* pool = GetSourceFileArenaPool();
+
+    int32 slabCount = 0;
+    int32 inUse = 0;
+
+    for (int32 i = 0; i < 100; i++) {
+
+        std::string source = "public class A { int x" + std::to_string(i) + "; }";
+        compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/a.wyx"), i), FixedCharSpan(source.c_str(), source.size()));
+        compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/b.wyx")), FixedCharSpan("public class B { A a; }"));
+
+        compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+        if (i == 0) {
+            slabCount = pool->GetSlabCount();
+            inUse = slabCount - pool->GetFreeSlabCount();
+            continue;
+        }
+
+        // re-parsing a.wyx hands its slab back and borrows one again, nothing new gets reserved
+        REQUIRE(pool->GetSlabCount() == slabCount);
+        REQUIRE(pool->GetSlabCount() - pool->GetFreeSlabCount() == inUse);
+
+    }
+
+}
+
+TEST_CASE("linear allocator commit options") {
+
+    LinearAllocatorFlags options[] = {
+        LinearAllocatorFlags::None,
+        LinearAllocatorFlags::HugePages,
+        LinearAllocatorFlags::GeometricCommit,
+        LinearAllocatorFlags::Prefault,
+        LinearAllocatorFlags::HugePages | LinearAllocatorFlags::GeometricCommit | LinearAllocatorFlags::Prefault,
+    };
+
+    for (LinearAllocatorFlags flags : options) {
+
+        LinearAllocator allocator(GIGABYTES(1), KILOBYTES(64), flags);
+        allocator.Prefault(MEGABYTES(1));
+
+        for (int32 i = 0; i < 64; i++) {
+            uint8* bytes = allocator.AllocateUncleared<uint8>(KILOBYTES(300));
+            REQUIRE(bytes != nullptr);
+            memset(bytes, i, KILOBYTES(300));
+        }
+
+        REQUIRE(allocator.GetBase()[0] == 0);
+        REQUIRE(allocator.GetBase()[allocator.offset - 1] == 63);
+
+    }
+
+}
+
+TEST_CASE("allocator stats") {
+
+    PodList<AllocatorStatsSnapshot> snapshots;
+
+#if ALCHEMY_ALLOCATOR_STATS != 0
+
+    {
+        LinearAllocator a(MEGABYTES(16), KILOBYTES(64));
+        LinearAllocator b(MEGABYTES(16), KILOBYTES(64));
+        a.SetStatsName("TestArena");
+        b.SetStatsName("TestArena");
+
+        a.AllocateUncleared<uint8>(8);
+        a.AllocateUncleared<uint8>(KILOBYTES(100));
+        b.AllocateUncleared<uint8>(100);
+
+        SnapshotAllocatorStats(&snapshots);
+
+        AllocatorStatsSnapshot* snapshot = nullptr;
+        for (int32 i = 0; i < snapshots.size; i++) {
+            if (strcmp(snapshots[i].name, "TestArena") == 0) {
+                snapshot = &snapshots.array[i];
+            }
+        }
+
+        REQUIRE(snapshot != nullptr);
+        REQUIRE(snapshot->allocatorCount == 2);
+        REQUIRE(snapshot->allocationCount == 3);
+        REQUIRE(snapshot->usedBytes >= KILOBYTES(100) + 108);
+        REQUIRE(snapshot->committedBytes >= snapshot->usedBytes);
+        REQUIRE(snapshot->sizeClassCounts[0] == 1);
+        REQUIRE(snapshot->sizeClassCounts[3] == 1); // 100 bytes, (64, 128]
+        REQUIRE(snapshot->sizeClassCounts[13] == 1); // 100kb, (64kb, 128kb]
+
+        FixedCharSpan json = AllocatorStatsToJson(snapshots.ToCheckedArray(), Allocator::MakeMallocator());
+        REQUIRE(strstr(json.ptr, "\"name\": \"TestArena\"") != nullptr);
+        Allocator::MakeMallocator().Free(json.ptr, json.size + 1);
+    }
+
+    // destroyed allocators unregister
+    SnapshotAllocatorStats(&snapshots);
+    for (int32 i = 0; i < snapshots.size; i++) {
+        REQUIRE(strcmp(snapshots[i].name, "TestArena") != 0);
+    }
+
+#else
+
+    SnapshotAllocatorStats(&snapshots);
+    REQUIRE(snapshots.size == 0);
+
+#endif
+
+}
+
+TEST_CASE("slab allocator frees across threads") {
+
+    SlabAllocator slab(MEGABYTES(64));
+
+    constexpr int32 kThreadCount = 4;
+    constexpr int32 kBlockCount = 2000;
+
+    // every thread allocates, tags its blocks, then frees the blocks of its neighbour
+    PodList<uint64*> blocks[kThreadCount];
+    std::thread threads[kThreadCount];
+
+    for (int32 t = 0; t < kThreadCount; t++) {
+        threads[t] = std::thread([&, t]() {
+            for (int32 i = 0; i < kBlockCount; i++) {
+                int32 sizeClass = SlabAllocator::kMinSizeClass + (i % 4);
+                uint64* block = (uint64*) slab.Allocate(sizeClass);
+                block[0] = ((uint64) t << 32) | (uint64) i;
+                block[1] = sizeClass;
+                blocks[t].Add(block);
+            }
+        });
+    }
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    for (int32 t = 0; t < kThreadCount; t++) {
+        for (int32 i = 0; i < kBlockCount; i++) {
+            REQUIRE(blocks[t][i][0] == (((uint64) t << 32) | (uint64) i));
+        }
+    }
+
+    size_t committed = slab.GetCommittedBytes();
+
+    for (int32 t = 0; t < kThreadCount; t++) {
+        threads[t] = std::thread([&, t]() {
+            PodList<uint64*>* list = &blocks[(t + 1) % kThreadCount];
+            for (int32 i = 0; i < list->size; i++) {
+                slab.Free(list->Get(i), (int32) list->Get(i)[1]);
+            }
+        });
+    }
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    REQUIRE(slab.GetLiveBytes() == 0);
+
+    // freed blocks are re-used before anything new is carved
+    for (int32 i = 0; i < kBlockCount; i++) {
+        slab.Free(slab.Allocate(SlabAllocator::kMinSizeClass), SlabAllocator::kMinSizeClass);
+    }
+
+    REQUIRE(slab.GetCommittedBytes() == committed);
+
+}
+
+TEST_CASE("temp allocators decommit after a big run") {
+
+    TempAllocator allocator(GIGABYTES(1), KILOBYTES(64));
+    allocator.SetResetPolicy(TempAllocatorResetPolicy { MEGABYTES(1), 4 });
+
+    memset(allocator.AllocateUncleared<uint8>(MEGABYTES(64)), 1, MEGABYTES(64));
+    allocator.Clear();
+    allocator.EndRun();
+
+    REQUIRE(allocator.GetCommittedBytes() >= MEGABYTES(64));
+
+    for (int32 i = 0; i < 4; i++) {
+        REQUIRE(allocator.GetCommittedBytes() >= MEGABYTES(64));
+        memset(allocator.AllocateUncleared<uint8>(KILOBYTES(100)), 1, KILOBYTES(100));
+        allocator.Clear();
+        allocator.EndRun();
+    }
+
+    TempAllocatorStats stats = allocator.GetRunStats();
+    REQUIRE(stats.runCount == 5);
+    REQUIRE(stats.decommitCount == 1);
+    REQUIRE(stats.maxPeakBytes >= MEGABYTES(64));
+    REQUIRE(allocator.GetCommittedBytes() <= MEGABYTES(1));
+
+    // decommitted pages come back on demand
+    uint8* bytes = allocator.AllocateUncleared<uint8>(MEGABYTES(8));
+    memset(bytes, 2, MEGABYTES(8));
+    REQUIRE(bytes[MEGABYTES(8) - 1] == 2);
+
+}
+
+TEST_CASE("type table ids are stable and recycled") {
+
+    FixedCharSpan package("Package");
+
+    Compiler compiler(0, FileSystemType::Virtual);
+
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/one.wyx")), FixedCharSpan(R"(
+        public class Thing<T> {
+            T value;
+            public void Run() {}
+        }
+    )"));
+
+    FixedCharSpan usesFloat(R"(
+        public class User {
+            Thing<float> thing;
+        }
+    )");
+
+    FixedCharSpan usesInt(R"(
+        public class User {
+            Thing<int> thing;
+        }
+    )");
+
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/two.wyx")), usesFloat);
+
+    PackageInfo info;
+    info.absolutePath = FixedCharSpan("path/");
+    info.packageName = package;
+
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+    TypeTable* table = compiler.resolveMap.table;
+
+    TypeInfo* thing = nullptr;
+    TypeInfo* instance = nullptr;
+    REQUIRE(compiler.resolveMap.TryResolve(FixedCharSpan("global::Thing$1"), &thing));
+    REQUIRE(compiler.resolveMap.TryResolve(FixedCharSpan("global::Thing$1<BuiltIn::Float>"), &instance));
+
+    TypeId thingId = thing->typeId;
+    REQUIRE(thingId != kInvalidTypeId);
+    REQUIRE(table->GetTypeInfo(thingId) == thing);
+    REQUIRE(table->GetMethodCount(thingId) == 1);
+    REQUIRE(table->GetFullyQualifiedName(thingId) == FixedCharSpan("global::Thing$1"));
+    REQUIRE((table->GetFlags(instance->typeId) & TypeInfoFlags::InstantiatedGeneric) != 0);
+
+    TypeInfo* intType = nullptr;
+    REQUIRE(compiler.resolveMap.TryResolve(FixedCharSpan("BuiltIn::Int32"), &intType));
+    REQUIRE((table->GetFlags(intType->typeId) & TypeInfoFlags::IsPrimitive) != 0);
+
+    // open generic types are not concrete
+    TempAllocator::ScopedMarker marker(GetThreadLocalAllocator());
+    CheckedArray<TypeId> concrete = compiler.resolveMap.GetConcreteTypeIds(GetThreadLocalAllocator()->MakeAllocator());
+    for (int32 i = 0; i < concrete.size; i++) {
+        REQUIRE(concrete[i] != thingId);
+    }
+
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/two.wyx"), 1), usesInt);
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+    TypeId limit = table->GetIdLimit();
+    int32 count = table->GetCount();
+
+    // the swept instance and the re-parsed User hand their ids back, so edits don't keep growing the table
+    for (int32 i = 2; i < 20; i++) {
+        compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/two.wyx"), i), (i & 1) ? usesInt : usesFloat);
+        compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+        REQUIRE(table->GetCount() == count);
+        REQUIRE(table->GetIdLimit() == limit);
+    }
+
+    REQUIRE(thing->typeId == thingId);
+    REQUIRE(table->GetTypeInfo(thingId) == thing);
+
+}
+
+TEST_CASE("resolved types are type id handles") {
+
+    FixedCharSpan package("Package");
+
+    Compiler compiler(0, FileSystemType::Virtual);
+
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/one.wyx")), FixedCharSpan(R"(
+        public class Thing<T> {
+            T value;
+        }
+        public class User {
+            Thing<float> a;
+            Thing<float> b;
+            Thing<int> c;
+        }
+    )"));
+
+    PackageInfo info;
+    info.absolutePath = FixedCharSpan("path/");
+    info.packageName = package;
+
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+    TypeInfo* user = nullptr;
+    TypeInfo* instance = nullptr;
+    REQUIRE(compiler.resolveMap.TryResolve(FixedCharSpan("global::User"), &user));
+    REQUIRE(compiler.resolveMap.TryResolve(FixedCharSpan("global::Thing$1<BuiltIn::Float>"), &instance));
+
+    REQUIRE(user->fields[0].type == user->fields[1].type);
+    REQUIRE(user->fields[0].type != user->fields[2].type);
+    REQUIRE(user->fields[0].type == ResolvedType(instance));
+    REQUIRE(user->fields[0].type.GetTypeInfo() == instance);
+    REQUIRE(instance->fields[0].type.GetTypeInfo() == compiler.resolveMap.builtInTypeInfos[(int32) BuiltInTypeName::Float]);
+
+}
+
+TEST_CASE("diagnostics are stored by value and merged per file") {
+
+    TempAllocator::ScopedMarker marker(GetThreadLocalAllocator());
+
+    char source[] = "0123456789abcdefghij";
+
+    Diagnostics diagnostics(GetThreadLocalAllocator()->MakeAllocator());
+    diagnostics.SetSource(FixedCharSpan(source, 20));
+
+    // enough to span several chunks, added back to front with every error reported twice
+    for (int32 i = 999; i >= 0; i--) {
+        FixedCharSpan span(source + (i % 20), 1);
+        diagnostics.AddError(ErrorCode::ERR_InvalidNumber, span);
+        diagnostics.AddError(ErrorCode::ERR_InvalidNumber, span);
+    }
+
+    REQUIRE(diagnostics.size == 2000);
+    REQUIRE(diagnostics.Get(0).start == 19);
+    REQUIRE(diagnostics.Get(1999).start == 0);
+    REQUIRE(diagnostics.GetSourceText(diagnostics.Get(1999)) == FixedCharSpan("0"));
+
+    DiagnosticsCheckpoint checkpoint = diagnostics.Checkpoint();
+    diagnostics.AddError(ErrorCode::ERR_IntOverflow, FixedCharSpan("not in the source"));
+    REQUIRE(diagnostics.Get(2000).start == kNoSourceOffset);
+    diagnostics.Rollback(checkpoint);
+    REQUIRE(diagnostics.size == 2000);
+
+    DiagnosticEntry* entries = GetThreadLocalAllocator()->AllocateUncleared<DiagnosticEntry>(diagnostics.size);
+    diagnostics.CopyTo(entries);
+
+    int32 count = SortAndDeduplicate(entries, diagnostics.size);
+    REQUIRE(count == 20);
+    for (int32 i = 0; i < count; i++) {
+        REQUIRE(entries[i].start == (uint32) i);
+    }
+
+    FixedCharSpan package("Package");
+
+    Compiler compiler(0, FileSystemType::Virtual);
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/b.wyx")), FixedCharSpan("public class B { int x = 99999999999999999999999; }"));
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/a.wyx")), FixedCharSpan("public class A { int x = 99999999999999999999999; int y = 99999999999999999999999; }"));
+
+    PackageInfo info;
+    info.absolutePath = FixedCharSpan("path/");
+    info.packageName = package;
+
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+    PodList<MergedDiagnostic> merged;
+    PodList<SourceFileInfo*> files;
+    compiler.CollectDiagnostics(&merged, &files);
+
+    REQUIRE(files.size == 2);
+    REQUIRE(files[0]->path == FixedCharSpan("path/a.wyx"));
+    REQUIRE(merged.size >= 3);
+
+    for (int32 i = 1; i < merged.size; i++) {
+        MergedDiagnostic* prev = &merged.array[i - 1];
+        MergedDiagnostic* curr = &merged.array[i];
+        REQUIRE(prev->fileIndex <= curr->fileIndex);
+        if (prev->fileIndex == curr->fileIndex) {
+            REQUIRE(prev->entry.start <= curr->entry.start);
+        }
+    }
+
+}
+
+TEST_CASE("snapshots restore unchanged files without parsing them") {
+
+    FixedCharSpan package("Package");
+
+    FixedCharSpan thing(R"(
+        public class Thing<T> {
+            T value;
+        }
+    )");
+
+    FixedCharSpan user(R"(
+        public class User : Base {
+            Thing<float> thing;
+            int Add(int a, float b) { return a; }
+        }
+    )");
+
+    FixedCharSpan base(R"(
+        public class Base {
+            int x = 99999999999999999999999;
+        }
+    )");
+
+    PackageInfo info;
+    info.absolutePath = FixedCharSpan("path/");
+    info.packageName = package;
+
+    PodList<uint8> bytes;
+
+    {
+        Compiler compiler(0, FileSystemType::Virtual);
+        compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/thing.wyx")), thing);
+        compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/user.wyx")), user);
+        compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/base.wyx")), base);
+        compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+        WriteSnapshot(&compiler, &bytes);
+    }
+
+    Snapshot snapshot;
+    REQUIRE(snapshot.Load(bytes.array, bytes.size));
+    REQUIRE(snapshot.GetSection<SnapshotFile>(SnapshotSectionName::Files).size == 3);
+    REQUIRE(snapshot.FindType(FixedCharSpan("global::User")) != -1);
+    REQUIRE(snapshot.FindType(FixedCharSpan("global::Missing")) == -1);
+
+    Compiler compiler(0, FileSystemType::Virtual);
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/thing.wyx")), thing);
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/user.wyx")), user);
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/base.wyx")), base);
+    compiler.LoadSnapshot(&snapshot);
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+    SourceFileInfo* userFile = nullptr;
+    SourceFileInfo* baseFile = nullptr;
+    for (int32 i = 0; i < compiler.fileInfos.size; i++) {
+        SourceFileInfo* file = compiler.fileInfos[i];
+        if (!file->isBuiltIn) {
+            REQUIRE(file->syntaxTree == nullptr);
+        }
+        if (file->path == FixedCharSpan("path/user.wyx")) userFile = file;
+        if (file->path == FixedCharSpan("path/base.wyx")) baseFile = file;
+    }
+
+    REQUIRE(baseFile->diagnostics.size == 1);
+
+    TypeInfo* userType = nullptr;
+    TypeInfo* baseType = nullptr;
+    TypeInfo* instance = nullptr;
+    REQUIRE(compiler.resolveMap.TryResolve(FixedCharSpan("global::User"), &userType));
+    REQUIRE(compiler.resolveMap.TryResolve(FixedCharSpan("global::Base"), &baseType));
+    REQUIRE(compiler.resolveMap.TryResolve(FixedCharSpan("global::Thing$1<BuiltIn::Float>"), &instance));
+
+    REQUIRE(userType->GetBaseClass() == baseType);
+    REQUIRE(userType->fields[0].type == ResolvedType(instance));
+    REQUIRE(instance->fields[0].type.GetTypeInfo() == compiler.resolveMap.builtInTypeInfos[(int32) BuiltInTypeName::Float]);
+    REQUIRE(userType->methods[0].parameterCount == 2);
+    REQUIRE(userType->methods[0].parameters[1].name == FixedCharSpan("b"));
+    REQUIRE(userType->memberTable != nullptr);
+
+    // files that resolved against a changed one can't be relinked without syntax, they are parsed again
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/base.wyx"), 1), FixedCharSpan("public class Base { float x; }"));
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+    REQUIRE(userFile->syntaxTree != nullptr);
+    REQUIRE(baseFile->diagnostics.size == 0);
+    REQUIRE(compiler.resolveMap.TryResolve(FixedCharSpan("global::User"), &userType));
+    REQUIRE(compiler.resolveMap.TryResolve(FixedCharSpan("global::Base"), &baseType));
+    REQUIRE(userType->GetBaseClass() == baseType);
+
+}
+
+TEST_CASE("built ins come from the precompiled image") {
+
+    // builds that couldn't generate the image fall back to parsing System/*.wyx
+    if (GetBuiltInImage().size == 0) {
+        return;
+    }
+
+    FixedCharSpan package("Package");
+
+    PackageInfo info;
+    info.absolutePath = FixedCharSpan("path/");
+    info.packageName = package;
+
+    Compiler compiler(0, FileSystemType::Virtual);
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/user.wyx")), FixedCharSpan("public class User { int x; string s; }"));
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+    int32 builtInCount = 0;
+    for (int32 i = 0; i < compiler.fileInfos.size; i++) {
+        if (compiler.fileInfos[i]->isBuiltIn) {
+            REQUIRE(compiler.fileInfos[i]->syntaxTree == nullptr);
+            builtInCount++;
+        }
+    }
+
+    REQUIRE(builtInCount == compiler.builtInImage.GetSection<SnapshotFile>(SnapshotSectionName::Files).size);
+    REQUIRE(compiler.diagnostics.size == 0);
+
+    TypeInfo* int32Type = compiler.resolveMap.builtInTypeInfos[(int32) BuiltInTypeName::Int32];
+    TypeInfo* userType = nullptr;
+    REQUIRE(int32Type != nullptr);
+    REQUIRE(int32Type->GetFullyQualifiedTypeName() == FixedCharSpan("BuiltIn::Int32"));
+    REQUIRE(int32Type->methodCount != 0);
+    REQUIRE(compiler.resolveMap.TryResolve(FixedCharSpan("global::User"), &userType));
+    REQUIRE(userType->fields[0].type.GetTypeInfo() == int32Type);
+    REQUIRE(userType->fields[1].type.GetTypeInfo() == compiler.resolveMap.builtInTypeInfos[(int32) BuiltInTypeName::String]);
+
+    // nothing to parse again on the next run
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+    REQUIRE(compiler.changedFileCount == 0);
+
+}
+
+TEST_CASE("compile stats") {
+
+    FixedCharSpan package("Package");
+
+    PackageInfo info;
+    info.absolutePath = FixedCharSpan("path/");
+    info.packageName = package;
+
+    Compiler compiler(0, FileSystemType::Virtual);
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/a.wyx")), FixedCharSpan("public class Box<T> { T value; }"));
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/b.wyx")), FixedCharSpan("public class B { Box<int> box; int M(int a) { return a; } }"));
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+    CompileStats* stats = &compiler.stats;
+    REQUIRE(stats->changedFileCount == compiler.changedFileCount);
+    REQUIRE(stats->declaredTypeCount == 3); // T is declared by Box
+    REQUIRE(stats->tokenCount > 0);
+    REQUIRE(stats->nodeCount > 0);
+    REQUIRE(stats->instantiationCount >= 1);
+    REQUIRE(stats->diagnosticCount == 0);
+    REQUIRE(stats->workers.size == compiler.jobSystem.GetWorkerCount());
+    REQUIRE(stats->slowFileCounts[(int32) FilePhase::ResolveMembers] == stats->changedFileCount);
+    REQUIRE(stats->GetWallNanoseconds() != 0);
+    REQUIRE(stats->arenaReservationCount >= 1);
+
+#if defined(__linux__)
+    REQUIRE(stats->residentBytes != 0);
+    REQUIRE(stats->mappingCount != 0);
+#endif
+
+    // the busy time of a phase is part of its wall time
+    for (int32 w = 0; w < stats->workers.size; w++) {
+        REQUIRE(stats->workers[w].busyNanoseconds[(int32) CompilePhase::Parse] <= stats->phases[(int32) CompilePhase::Parse].wallNanoseconds);
+    }
+
+    FixedCharSpan json = compiler.GetStatsJson(Allocator::MakeMallocator());
+    REQUIRE(json.StartsWith(FixedCharSpan("{")));
+    REQUIRE(strstr(json.ptr, "\"slowestFiles\"") != nullptr);
+    REQUIRE(strstr(json.ptr, "\"residentBytes\"") != nullptr);
+    REQUIRE(strstr(json.ptr, "\"path/b.wyx\"") != nullptr);
+    Allocator::MakeMallocator().Free(json.ptr, json.size + 1);
+
+    // an unchanged run parses nothing
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+    REQUIRE(stats->changedFileCount == 0);
+    REQUIRE(stats->tokenCount == 0);
+    REQUIRE(stats->slowFileCounts[(int32) FilePhase::Parse] == 0);
+
+    compiler.jobSystem.Shutdown();
+
+}
+
+// every job holds its worker until a second one has shown up, which only happens in time when Execute woke them
+struct WaitForPeersJob : Jobs::IJob {
+
+    std::atomic<uint32>* seenWorkers;
+
+    explicit WaitForPeersJob(std::atomic<uint32>* seenWorkers)
+        : seenWorkers(seenWorkers) {}
+
+    static int32 CountWorkers(uint32 mask) {
+        int32 count = 0;
+        for (; mask != 0; mask &= mask - 1) {
+            count++;
+        }
+        return count;
+    }
+
+    void Execute(int32 index) override {
+        seenWorkers->fetch_or(1u << GetWorkerId());
+        uint64 deadline = GetTimestampNanoseconds() + 5000000000ull;
+        while (CountWorkers(seenWorkers->load()) < 2 && GetTimestampNanoseconds() < deadline) {
+            std::this_thread::yield();
+        }
+    }
+
+};
+
+TEST_CASE("jobs run on more than one worker") {
+
+    Jobs::JobSystem jobSystem(3);
+    REQUIRE(jobSystem.GetWorkerCount() >= 2);
+
+    // the workers go back to sleep after every run and have to be woken again
+    for (int32 run = 0; run < 3; run++) {
+        std::atomic<uint32> seenWorkers(0);
+        jobSystem.Execute(Jobs::Parallel::Foreach(jobSystem.GetWorkerCount() * 4), WaitForPeersJob(&seenWorkers));
+        REQUIRE(WaitForPeersJob::CountWorkers(seenWorkers.load()) >= 2);
+    }
+
+    PodList<Jobs::WorkerStats> stats;
+    jobSystem.GetWorkerStats(&stats);
+    int32 busyWorkers = 0;
+    for (int32 i = 0; i < stats.size; i++) {
+        if (stats[i].jobsExecuted != 0) {
+            busyWorkers++;
+        }
+    }
+    REQUIRE(busyWorkers >= 2);
+    stats.Dispose();
+
+    // joins the threads, whoever shuts down last doesn't have to know
+    jobSystem.Shutdown();
+    jobSystem.Shutdown();
+
+}
+
+TEST_CASE("job systems hand temp allocator options to their workers") {
+
+    Jobs::JobSystem jobSystem(1, LinearAllocatorFlags::GeometricCommit | LinearAllocatorFlags::Prefault, MEGABYTES(2));
+
+    PodList<Jobs::WorkerStats> stats;
+    jobSystem.GetWorkerStats(&stats);
+    REQUIRE(stats.size >= 2);
+    for (int32 i = 0; i < stats.size; i++) {
+        REQUIRE(stats[i].jobTemp.committedBytes >= MEGABYTES(2));
+    }
+    stats.Dispose();
+
+    jobSystem.Shutdown();
+
+}
+
+TEST_CASE("method bodies are introspected in parallel") {
+
+    FixedCharSpan package("Package");
+
+    PackageInfo info;
+    info.absolutePath = FixedCharSpan("path/");
+    info.packageName = package;
+
+    // enough methods for several batches across the workers
+    std::string many = "public class Many { int total;";
+    for (int32 i = 0; i < 200; i++) {
+        many += " int M" + std::to_string(i) + "(int a, int b) { int c = a + b; if (a > b) { int d = c * a; return d; } return c + total; }";
+    }
+    many += " }";
+
+    Compiler compiler(3, FileSystemType::Virtual);
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/many.wyx")), FixedCharSpan(many.c_str()));
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/bad.wyx")), FixedCharSpan(R"(
+        public class Bad {
+            int field;
+            static int S() { return field; }
+            int D(int a) { int b = a; { int b = 2; } return b; }
+            int R() { return; }
+            void V() { return; }
+        }
+    )"));
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+    REQUIRE(compiler.stats.introspectedMethodCount == 204);
+
+    TypeInfo* many_ = nullptr;
+    TypeInfo* bad = nullptr;
+    REQUIRE(compiler.resolveMap.TryResolve(FixedCharSpan("global::Many"), &many_));
+    REQUIRE(compiler.resolveMap.TryResolve(FixedCharSpan("global::Bad"), &bad));
+    REQUIRE(many_->declaringFile->diagnostics.size == 0);
+
+    for (int32 i = 0; i < many_->methodCount; i++) {
+        MethodIntrospection* introspection = many_->methods[i].introspection;
+        REQUIRE(introspection != nullptr);
+        REQUIRE(introspection->scopeCount == 2); // the body and the if's block
+        REQUIRE(introspection->localCount == 4);
+        REQUIRE(introspection->diagnosticCount == 0);
+
+        ts_LocalExpressionBase = introspection->base;
+        Scope* root = introspection->rootScope;
+        REQUIRE(root->GetParent() == nullptr);
+        REQUIRE(root->localCount == 3);
+        LocalValue* c = root->GetFirstLocal()->GetNextLocal()->GetNextLocal();
+        REQUIRE(c->name == FixedCharSpan("c"));
+        REQUIRE(c->GetDeclaringScope() == root);
+        REQUIRE(c->GetNextLocal() == nullptr);
+        REQUIRE(root->GetFirstChild()->GetFirstLocal()->name == FixedCharSpan("d"));
+    }
+
+    Diagnostics* diagnostics = &bad->declaringFile->diagnostics;
+    REQUIRE(diagnostics->size == 3);
+    REQUIRE(diagnostics->Get(0).errorCode == ErrorCode::ERR_InstanceFieldAccessInStaticContext);
+    REQUIRE(diagnostics->Get(1).errorCode == ErrorCode::ERR_DuplicateIdentifierInScope);
+    REQUIRE(diagnostics->Get(2).errorCode == ErrorCode::ERR_ExpectedReturnType);
+
+    // only the edited file is visited again, the other one keeps its diagnostics and loses its results
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/many.wyx"), 1), FixedCharSpan("public class Many { int M() { return 1; } }"));
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+    REQUIRE(compiler.stats.introspectedMethodCount == 1);
+    REQUIRE(bad->declaringFile->diagnostics.size == 3);
+    REQUIRE(bad->methods[0].introspection == nullptr);
+
+}
+
+TEST_CASE("only bodies reachable from the entry points are introspected") {
+
+    FixedCharSpan package("Package");
+
+    PackageInfo info;
+    info.absolutePath = FixedCharSpan("path/");
+    info.packageName = package;
+
+    Compiler compiler(2, FileSystemType::Virtual);
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/lib.wyx")), FixedCharSpan(R"(
+        public class Lib {
+            public int Used(int a) { return Helper(a) + 1; }
+            int Helper(int a) { return a * 2; }
+            public int Unused(int a) { return a; }
+            public static int Bad() { return; }
+        }
+    )"));
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/box.wyx")), FixedCharSpan("public class Box<T> { T value; public T Get() { return value; } public T Other() { return value; } }"));
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/program.wyx")), FixedCharSpan("export class Program { Box<int> box; export int Main(Lib lib) { return lib.Used(1) + box.Get(); } int Other() { return 0; } }"));
+
+    compiler.AddEntryPoint(FixedCharSpan("Program"));
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+    TypeInfo* lib = nullptr;
+    TypeInfo* program = nullptr;
+    REQUIRE(compiler.resolveMap.TryResolve(FixedCharSpan("global::Lib"), &lib));
+    REQUIRE(compiler.resolveMap.TryResolve(FixedCharSpan("global::Program"), &program));
+    TypeInfo* boxOfInt = program->fields[0].type.GetTypeInfo();
+    TypeInfo* box = boxOfInt->genericDefinition;
+    REQUIRE(boxOfInt->IsGenericInstance());
+
+    // Main, Used, Helper and Box<int>.Get
+    REQUIRE(compiler.stats.introspectedMethodCount == 4);
+    REQUIRE(program->methods[0].introspection != nullptr);
+    REQUIRE(program->methods[1].introspection == nullptr);
+    REQUIRE(lib->methods[0].introspection != nullptr);
+    REQUIRE(lib->methods[1].introspection != nullptr);
+    REQUIRE(lib->methods[2].introspection == nullptr);
+    REQUIRE(boxOfInt->methods[0].introspection != nullptr);
+    REQUIRE(boxOfInt->methods[1].introspection == nullptr);
+    REQUIRE(box->methods[0].introspection == nullptr);
+
+    // Bad isn't reachable so its missing return value isn't reported
+    REQUIRE(lib->declaringFile->diagnostics.size == 0);
+    REQUIRE(compiler.diagnostics.size == 0);
+
+    // calling it from an edited file brings the unchanged file's error in, taking the call out drops it again
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/program.wyx"), 1), FixedCharSpan("export class Program { export int Main() { return Lib.Bad(); } }"));
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+    REQUIRE(compiler.stats.introspectedMethodCount == 2);
+    REQUIRE(lib->declaringFile->diagnostics.size == 1);
+    REQUIRE(lib->declaringFile->diagnostics.Get(0).errorCode == ErrorCode::ERR_ExpectedReturnType);
+
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/program.wyx"), 2), FixedCharSpan("export class Program { export int Main() { return 0; } }"));
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+    REQUIRE(compiler.stats.introspectedMethodCount == 1);
+    REQUIRE(lib->declaringFile->diagnostics.size == 0);
+
+    compiler.AddEntryPoint(FixedCharSpan("Lib.Used"));
+    compiler.AddEntryPoint(FixedCharSpan("Nope"));
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+    REQUIRE(compiler.diagnostics.size == 2);
+    REQUIRE(compiler.diagnostics.Get(0).errorCode == ErrorCode::ERR_EntryPointMustBeExported);
+    REQUIRE(compiler.diagnostics.Get(1).errorCode == ErrorCode::ERR_EntryPointNotFound);
+
+    compiler.jobSystem.Shutdown();
+
+}
+
+TEST_CASE("unchanged files reached like last time keep their body diagnostics") {
+
+    FixedCharSpan package("Package");
+
+    PackageInfo info;
+    info.absolutePath = FixedCharSpan("path/");
+    info.packageName = package;
+
+    Compiler compiler(2, FileSystemType::Virtual);
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/lib.wyx")), FixedCharSpan(R"(
+        public class Lib {
+            public int Used(int a) { return Helper(a) + 1; }
+            int Helper(int a) { return; }
+            public int Unused(int a) { return a; }
+        }
+    )"));
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/program.wyx")), FixedCharSpan("export class Program { export int Main(Lib lib) { return lib.Used(1); } }"));
+
+    compiler.AddEntryPoint(FixedCharSpan("Program"));
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+    TypeInfo* lib = nullptr;
+    REQUIRE(compiler.resolveMap.TryResolve(FixedCharSpan("global::Lib"), &lib));
+
+    REQUIRE(compiler.stats.introspectedMethodCount == 3);
+    REQUIRE(compiler.stats.keptMethodCount == 0);
+    REQUIRE(lib->declaringFile->diagnostics.size == 1);
+
+    // Used & Helper are reached again, they are only scanned and Helper's error stays
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/program.wyx"), 1), FixedCharSpan("export class Program { export int Main(Lib lib) { return lib.Used(2) * 2; } }"));
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+    REQUIRE(compiler.stats.introspectedMethodCount == 1);
+    REQUIRE(compiler.stats.keptMethodCount == 2);
+    REQUIRE(lib->methods[0].introspection == nullptr);
+    REQUIRE(lib->declaringFile->diagnostics.size == 1);
+    REQUIRE(lib->declaringFile->diagnostics.Get(0).errorCode == ErrorCode::ERR_ExpectedReturnType);
+
+    // reaching one more body of the file introspects all of its reached bodies again
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/program.wyx"), 2), FixedCharSpan("export class Program { export int Main(Lib lib) { return lib.Used(2) + lib.Unused(3); } }"));
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+    REQUIRE(compiler.stats.introspectedMethodCount == 4);
+    REQUIRE(compiler.stats.keptMethodCount == 0);
+    REQUIRE(lib->declaringFile->diagnostics.size == 1);
+
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/program.wyx"), 3), FixedCharSpan("export class Program { export int Main(Lib lib) { return 0; } }"));
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+    REQUIRE(compiler.stats.introspectedMethodCount == 1);
+    REQUIRE(lib->declaringFile->diagnostics.size == 0);
+
+    compiler.jobSystem.Shutdown();
+
+}
+
+static std::string ReadTextFile(const std::filesystem::path& path) {
+    std::ifstream stream(path, std::ios::binary);
+    std::stringstream buffer;
+    buffer << stream.rdbuf();
+    return buffer.str();
+}
+
+TEST_CASE("code is emitted into translation units that are only written when they change") {
+
+    FixedCharSpan package("Package");
+
+    PackageInfo info;
+    info.absolutePath = FixedCharSpan("path/");
+    info.packageName = package;
+
+    std::filesystem::path outputPath = std::filesystem::temp_directory_path() / "alchemy_codegen_test";
+    std::filesystem::remove_all(outputPath);
+    std::string output = outputPath.string();
+
+    const char* shapes = R"(
+        public struct Point { int x; int y; }
+        public class Shape {
+            Point origin;
+            public int Area(int scale) { int a = scale * 2; { float f; } return a; }
+            public int Area(Point p) { return 0; }
+            public void Move(Point p) { }
+            public static int Count() { return 0; }
+        }
+    )";
+    const char* circle = "public class Circle : Shape { float radius; public float Radius() { return radius; } }";
+
+    // a small target so every couple of methods is a unit of its own
+    Compiler compiler(3, FileSystemType::Virtual);
+    compiler.SetCodeGenOutput(FixedCharSpan(output.c_str()), 200);
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/shapes.wyx")), FixedCharSpan(shapes));
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/circle.wyx")), FixedCharSpan(circle));
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+    int32 unitCount = compiler.stats.translationUnitCount;
+
+    REQUIRE(compiler.diagnostics.size == 0);
+    REQUIRE(compiler.stats.emittedMethodCount == 5);
+    REQUIRE(unitCount > 1);
+    REQUIRE(compiler.stats.writtenTranslationUnitCount == unitCount);
+    REQUIRE(compiler.stats.emittedBytes > 0);
+
+    std::string types = ReadTextFile(outputPath / "alchemy_types.h");
+    REQUIRE(types.find("struct alc_T_global_NPoint {") != std::string::npos);
+    // the base class is embedded, so it has to be defined first
+    REQUIRE(types.find("struct alc_T_global_NShape {") < types.find("struct alc_T_global_NCircle {"));
+
+    // sorted by mangled name, Circle's method comes first and overloads with the same parameter count are numbered
+    std::string first = ReadTextFile(outputPath / "alchemy_0000.c");
+    REQUIRE(first.find("#include \"alchemy_types.h\"") != std::string::npos);
+    REQUIRE(first.find("float alc_M_global_NCircle_MRadius_P0(struct alc_T_global_NCircle* self) {") != std::string::npos);
+
+    std::string all;
+    for (int32 i = 0; i < unitCount; i++) {
+        char name[32];
+        WriteTranslationUnitName(i, name);
+        all += ReadTextFile(outputPath / name);
+    }
+
+    REQUIRE(all.find("int32_t alc_M_global_NShape_MArea_P1(struct alc_T_global_NShape* self, int32_t l_scale) {") != std::string::npos);
+    REQUIRE(all.find("alc_M_global_NShape_MArea_P1_O1(struct alc_T_global_NShape* self, struct alc_T_global_NPoint l_p)") != std::string::npos);
+    REQUIRE(all.find("int32_t alc_M_global_NShape_MCount_P0(void)") != std::string::npos);
+
+    // bodies with statements can't be lowered yet, the unit refuses to compile rather than return zeroes
+    REQUIRE(all.find("#error \"global::Shape.Area: statements aren't lowered to C yet\"") != std::string::npos);
+    REQUIRE(all.find("#error \"global::Shape.Move") == std::string::npos);
+
+    // nothing changed, nothing is written
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+    REQUIRE(compiler.stats.translationUnitCount == unitCount);
+    REQUIRE(compiler.stats.writtenTranslationUnitCount == 0);
+
+    // a unit someone deleted or truncated is written again even though its hash is known
+    std::filesystem::remove(outputPath / "alchemy_0000.c");
+    std::filesystem::resize_file(outputPath / "alchemy_types.h", 1);
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+    REQUIRE(compiler.stats.writtenTranslationUnitCount == 1);
+    REQUIRE(ReadTextFile(outputPath / "alchemy_0000.c") == first);
+    REQUIRE(ReadTextFile(outputPath / "alchemy_types.h") == types);
+
+    // another compiler with a different worker count doesn't know the hashes, it reads the files back and finds
+    // it would write exactly the same thing
+    Compiler other(0, FileSystemType::Virtual);
+    other.SetCodeGenOutput(FixedCharSpan(output.c_str()), 200);
+    other.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/circle.wyx")), FixedCharSpan(circle));
+    other.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/shapes.wyx")), FixedCharSpan(shapes));
+    other.Compile(CheckedArray<PackageInfo>(&info, 1));
+    REQUIRE(other.stats.translationUnitCount == unitCount);
+    REQUIRE(other.stats.writtenTranslationUnitCount == 0);
+    other.jobSystem.Shutdown();
+
+    // Circle's body sorts first, editing it leaves the units after it alone
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/circle.wyx"), 1), FixedCharSpan("public class Circle : Shape { float radius; public float Radius() { float r; return radius; } }"));
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+    REQUIRE(compiler.stats.writtenTranslationUnitCount == 1);
+    REQUIRE(ReadTextFile(outputPath / "alchemy_0000.c").find("    alc_unresolved l_r;") != std::string::npos);
+
+    // units that aren't needed any more are deleted
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/shapes.wyx"), 1), FixedCharSpan("public class Shape { }"));
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+    char last[32];
+    WriteTranslationUnitName(unitCount - 1, last);
+    REQUIRE(compiler.stats.translationUnitCount == 1);
+    REQUIRE(!std::filesystem::exists(outputPath / last));
+
+    compiler.jobSystem.Shutdown();
+    std::filesystem::remove_all(outputPath);
+
+}
+
+TEST_CASE("sharded code only rewrites the shard of the type that changed") {
+
+    FixedCharSpan package("Package");
+
+    PackageInfo info;
+    info.absolutePath = FixedCharSpan("path/");
+    info.packageName = package;
+
+    std::filesystem::path outputPath = std::filesystem::temp_directory_path() / "alchemy_shard_test";
+    std::filesystem::remove_all(outputPath);
+    std::string output = outputPath.string();
+
+    const char* shapes = R"(
+        public struct Point { int x; int y; }
+        public class Shape {
+            public int Area(int scale) { return scale; }
+            public void Move(Point p) { }
+            public static int Count() { return 0; }
+        }
+    )";
+
+    Compiler compiler(3, FileSystemType::Virtual);
+    compiler.SetCodeGenShards(FixedCharSpan(output.c_str()), 4);
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/shapes.wyx")), FixedCharSpan(shapes));
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/circle.wyx")), FixedCharSpan("public class Circle : Shape { public float Radius() { return 1; } }"));
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+    // empty shards are written too, their names never move
+    REQUIRE(compiler.diagnostics.size == 0);
+    REQUIRE(compiler.stats.emittedMethodCount == 4);
+    REQUIRE(compiler.stats.translationUnitCount == 4);
+    REQUIRE(compiler.stats.writtenTranslationUnitCount == 4);
+
+    TypeInfo* shapeType = nullptr;
+    REQUIRE(compiler.resolveMap.TryResolve(FixedCharSpan("global::Shape"), &shapeType));
+
+    char shapeUnit[32];
+    WriteTranslationUnitName(GetShardIndex(shapeType, 4), shapeUnit);
+
+    std::string shapeText = ReadTextFile(outputPath / shapeUnit);
+    REQUIRE(shapeText.find("alc_M_global_NShape_MArea_P1(") != std::string::npos);
+    REQUIRE(shapeText.find("alc_M_global_NShape_MMove_P1(") != std::string::npos);
+    REQUIRE(shapeText.find("alc_M_global_NShape_MCount_P0(") != std::string::npos);
+
+    std::string manifest = ReadTextFile(outputPath / "alchemy_manifest.json");
+    REQUIRE(manifest.find("\"shards\": 4") != std::string::npos);
+    REQUIRE(manifest.find("\"file\": \"alchemy_types.h\"") != std::string::npos);
+    REQUIRE(manifest.find("\"file\": \"alchemy_0003.c\"") != std::string::npos);
+
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+    REQUIRE(compiler.stats.writtenTranslationUnitCount == 0);
+
+    // a new method on Circle grows its shard and leaves the rest alone
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/circle.wyx"), 1), FixedCharSpan("public class Circle : Shape { public float Radius() { return 1; } public float Diameter() { return 2; } }"));
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+    REQUIRE(compiler.stats.translationUnitCount == 4);
+    REQUIRE(compiler.stats.writtenTranslationUnitCount == 1);
+    REQUIRE(ReadTextFile(outputPath / "alchemy_manifest.json") != manifest);
+
+    compiler.jobSystem.Shutdown();
+    std::filesystem::remove_all(outputPath);
+
+}
+
+TEST_CASE("constants are folded at compile time") {
+
+    ConstantValue value;
+
+    REQUIRE(FoldBinary(BinaryExpressionOp::Add, ConstantValue::Signed(ConstantType::Int32, INT32_MAX), ConstantValue::Signed(ConstantType::Int32, 1), &value) == ConstantFold::Folded);
+    REQUIRE(value.type == ConstantType::Int32);
+    REQUIRE(value.intValue == INT32_MIN);
+
+    REQUIRE(FoldBinary(BinaryExpressionOp::Add, ConstantValue::Signed(ConstantType::Int32, 1), ConstantValue::Signed(ConstantType::Int64, 2), &value) == ConstantFold::Folded);
+    REQUIRE(value.type == ConstantType::Int64);
+
+    REQUIRE(FoldBinary(BinaryExpressionOp::Divide, ConstantValue::Signed(ConstantType::Int32, 7), ConstantValue::Signed(ConstantType::Int32, 2), &value) == ConstantFold::Folded);
+    REQUIRE(value.intValue == 3);
+
+    REQUIRE(FoldBinary(BinaryExpressionOp::Divide, ConstantValue::Double(7), ConstantValue::Signed(ConstantType::Int32, 2), &value) == ConstantFold::Folded);
+    REQUIRE(value.type == ConstantType::Double);
+    REQUIRE(value.doubleValue == 3.5);
+
+    REQUIRE(FoldBinary(BinaryExpressionOp::Modulo, ConstantValue::Signed(ConstantType::Int32, 7), ConstantValue::Signed(ConstantType::Int32, 0), &value) == ConstantFold::DivideByZero);
+
+    // the count is masked to the width like it is at runtime
+    REQUIRE(FoldBinary(BinaryExpressionOp::ShiftLeft, ConstantValue::Signed(ConstantType::Int32, 1), ConstantValue::Signed(ConstantType::Int32, 33), &value) == ConstantFold::Folded);
+    REQUIRE(value.intValue == 2);
+
+    REQUIRE(FoldBinary(BinaryExpressionOp::LessThan, ConstantValue::Unsigned(ConstantType::UInt32, 1), ConstantValue::Signed(ConstantType::Int32, -1), &value) == ConstantFold::Folded);
+    REQUIRE(value.type == ConstantType::Bool);
+    REQUIRE(!value.boolValue); // both become long
+
+    REQUIRE(FoldBinary(BinaryExpressionOp::Add, ConstantValue::Unsigned(ConstantType::Char, 'a'), ConstantValue::Signed(ConstantType::Int32, 1), &value) == ConstantFold::Folded);
+    REQUIRE(value.type == ConstantType::Int32);
+    REQUIRE(value.intValue == 'b');
+
+    REQUIRE(ConvertConstant(ConstantValue::Signed(ConstantType::Int32, 300), ConstantType::UInt8, false, &value) == ConstantFold::OutOfRange);
+    REQUIRE(ConvertConstant(ConstantValue::Signed(ConstantType::Int32, 200), ConstantType::UInt8, false, &value) == ConstantFold::Folded);
+
+    FixedCharSpan package("Package");
+
+    PackageInfo info;
+    info.absolutePath = FixedCharSpan("path/");
+    info.packageName = package;
+
+    std::filesystem::path outputPath = std::filesystem::temp_directory_path() / "alchemy_constants_test";
+    std::filesystem::remove_all(outputPath);
+    std::string output = outputPath.string();
+
+    Compiler compiler(3, FileSystemType::Virtual);
+    compiler.SetCodeGenOutput(FixedCharSpan(output.c_str()), 1 << 20);
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/limits.wyx")), FixedCharSpan(R"(
+        public enum Color { Red, Green = 5, Blue }
+        public class Limits {
+            public const int Max = Other.Base * 4 + 1;
+            public const long Big = Max + 10L;
+            public const float Half = 1 / 2.0f;
+            public const bool Flag = Max > 100 && !false;
+            public const byte Small = (byte) (Max - 301);
+            public const string Name = "café";
+            public int Pick(int x, int scale = Max, Color c = Color.Blue, string s = Name) {
+                const int local = Max * 2;
+                switch (x) {
+                    case Max: return 1;
+                    case local: return 2;
+                    case (int) Color.Green: return 3;
+                }
+                return 0;
+            }
+        }
+    )"));
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/other.wyx")), FixedCharSpan("public class Other { public const int Base = 100; }"));
+    compiler.vfs.AddFile(VirtualFileInfo(package, FixedCharSpan("path/bad.wyx")), FixedCharSpan(R"(
+        public class Loop {
+            const int A = B + 1;
+            const int B = A;
+            const byte Wide = (byte) 300;
+            int F(int x, int y) { switch (x) { case y: return 0; } return 1 / 0; }
+        }
+    )"));
+    compiler.Compile(CheckedArray<PackageInfo>(&info, 1));
+
+    TypeInfo* limits = nullptr;
+    TypeInfo* color = nullptr;
+    TypeInfo* loop = nullptr;
+    REQUIRE(compiler.resolveMap.TryResolve(FixedCharSpan("global::Limits"), &limits));
+    REQUIRE(compiler.resolveMap.TryResolve(FixedCharSpan("global::Color"), &color));
+    REQUIRE(compiler.resolveMap.TryResolve(FixedCharSpan("global::Loop"), &loop));
+    REQUIRE(limits->declaringFile->diagnostics.size == 0);
+
+    REQUIRE(color->fieldCount == 3);
+    REQUIRE(color->fields[1].constantValue.intValue == 5);
+    REQUIRE(color->fields[2].constantValue.intValue == 6);
+
+    FieldInfo* max = &limits->fields[0];
+    REQUIRE(max->constantState == ConstantState::Evaluated);
+    REQUIRE(max->constantValue.type == ConstantType::Int32);
+    REQUIRE(max->constantValue.intValue == 401);
+    REQUIRE(limits->fields[1].constantValue.type == ConstantType::Int64);
+    REQUIRE(limits->fields[1].constantValue.intValue == 411);
+    REQUIRE(limits->fields[2].constantValue.floatValue == 0.5f);
+    REQUIRE(limits->fields[3].constantValue.boolValue);
+    REQUIRE(limits->fields[4].constantValue.type == ConstantType::UInt8);
+    REQUIRE(limits->fields[4].constantValue.uintValue == 100);
+
+    // one full method and three forwarders
+    REQUIRE(limits->methodCount == 4);
+    REQUIRE(limits->methods[0].parameters[1].defaultValue.intValue == 401);
+    REQUIRE(limits->methods[0].parameters[2].defaultValue.intValue == 6);
+
+    std::string code = ReadTextFile(outputPath / "alchemy_0000.c");
+    REQUIRE(code.find("return alc_M_global_NLimits_MPick_P4(self, l_x, 401, 6, (alc_string){ u\"caf\\u00E9\", 4 });") != std::string::npos);
+
+    Diagnostics* diagnostics = &loop->declaringFile->diagnostics;
+    // constants are reported before any body is looked at
+    REQUIRE(diagnostics->size == 4);
+    REQUIRE(diagnostics->Get(0).errorCode == ErrorCode::ERR_CircularConstantDefinition);
+    REQUIRE(diagnostics->Get(1).errorCode == ErrorCode::ERR_ConstantValueCannotBeConverted);
+    REQUIRE(diagnostics->Get(2).errorCode == ErrorCode::ERR_ConstantExpected);
+    REQUIRE(diagnostics->Get(3).errorCode == ErrorCode::ERR_ConstantDivideByZero);
+
+    compiler.jobSystem.Shutdown();
+    std::filesystem::remove_all(outputPath);
+
+}
+
+TEST_CASE("perf counters degrade to nothing available") {
+
+    PerfCounterGroup group;
+    group.Open();
+
+    PerfCounterValues values;
+    group.Read(&values);
+
+    // whatever couldn't be opened (or everything, when not built with ALCHEMY_PERF_COUNTERS) reads as 0
+    for (int32 c = 0; c < kPerfCounterCount; c++) {
+        if ((group.availableMask & (1u << (uint32) c)) == 0) {
+            REQUIRE(values.values[c] == 0);
+        }
+    }
+
+#if ALCHEMY_PERF_COUNTERS == 0
+    REQUIRE(group.availableMask == 0);
+#endif
+
+    group.Close();
+    REQUIRE(group.availableMask == 0);
+
+}
+
+TEST_CASE("divide operators aren't trivia", "[parser]") {
+
+    SourceFileInfo file;
+    char text[] = "x = a / b; y = a /c;";
+
+    TokenizerResult result = Tokenize(TextWindow(text, strlen(text)), &file.diagnostics, &file.allocator);
+
+    int32 slashCount = 0;
+    for (int32 i = 0; i < result.tokens.size; i++) {
+        if (result.tokens[i].kind == TokenKind::SlashToken) {
+            slashCount++;
+        }
+    }
+
+    REQUIRE(slashCount == 2);
+
+}
+
+TEST_CASE("generated syntax parses cleanly", "[parser]") {
+
+    SyntaxOptions options;
+
+    for (uint64 seed = 1; seed <= 16; seed++) {
+
+        CorpusRandom random(seed);
+        PodList<char> text;
+        GenerateSyntax(options, &random, &text);
+        text.Add('\0');
+
+        SourceFileInfo file;
+        TokenizerResult result = Tokenize(TextWindow(text.array, text.size - 1), &file.diagnostics, &file.allocator);
+        Parser parser(result, &file.diagnostics, &file.allocator);
+        SyntaxBase* tree = (SyntaxBase*) ParseCompilationUnit(&parser);
+
+        INFO(text.array);
+        REQUIRE(file.diagnostics.size == 0);
+
+        FindSkippedTokens finder(result.tokens, tree);
+        for (int32 i = 0; i < result.tokens.size; i++) {
+            SyntaxToken token = result.tokens[i];
+            REQUIRE((token.kind == TokenKind::Trivia || token.kind == TokenKind::EndOfFileToken || (token.GetFlags() & SyntaxTokenFlags::Skipped) == 0));
+        }
+
+    }
+
+    // inputs the fuzzer found crashing, hanging or skipping tokens silently, each has to come back with a diagnostic
+    const char* broken[] = {
+        "class A { void M() { x = a > > b; } }",
+        "class A { void M() { int a, b(3); } }",
+        "class A { void M() { switch (x) { case } } }",
+        "class A { float float ref value; }",
+        "class A { string s = \"\"\"abc\"\"",
+        "namespace A::",
+    };
+
+    for (const char* source : broken) {
+        SourceFileInfo file;
+        TokenizerResult result = Tokenize(TextWindow((char*) source, (int32) strlen(source)), &file.diagnostics, &file.allocator);
+        Parser parser(result, &file.diagnostics, &file.allocator);
+        ParseCompilationUnit(&parser);
+        INFO(source);
+        REQUIRE(file.diagnostics.size != 0);
+    }
+
+}
+
+TEST_CASE("character literals are their own kind", "[parser]") {
+
+    SourceFileInfo file;
+    char text[] = "'a' == c";
+
+    TokenizerResult result = Tokenize(TextWindow(text, strlen(text)), &file.diagnostics, &file.allocator);
+    Parser parser(result, &file.diagnostics, &file.allocator);
+    ExpressionSyntax* expression = ParseExpression(&parser);
+
+    REQUIRE(file.diagnostics.size == 0);
+    REQUIRE(expression->GetKind() == SyntaxKind::EqualsExpression);
+    REQUIRE(((BinaryExpressionSyntax*) expression)->left->GetKind() == SyntaxKind::CharacterLiteralExpression);
+
+    // walked as a raw string it would read its contents token as a list of parts
+    FindSkippedTokens finder(result.tokens, expression);
+    for (int32 i = 0; i < result.tokens.size; i++) {
+        REQUIRE((result.tokens[i].kind == TokenKind::Trivia || (result.tokens[i].GetFlags() & SyntaxTokenFlags::Skipped) == 0));
+    }
+
+}
+
+TEST_CASE("postfix bang is an operand", "[parser]") {
+
+    SourceFileInfo file;
+    char text[] = "a! + b!";
+
+    TokenizerResult result = Tokenize(TextWindow(text, strlen(text)), &file.diagnostics, &file.allocator);
+    Parser parser(result, &file.diagnostics, &file.allocator);
+    ExpressionSyntax* expression = ParseExpression(&parser);
+
+    REQUIRE(file.diagnostics.size == 0);
+    REQUIRE(expression->GetKind() == SyntaxKind::AddExpression);
+
+    BinaryExpressionSyntax* add = (BinaryExpressionSyntax*) expression;
+    REQUIRE(add->left->GetKind() == SyntaxKind::BangExpression);
+    REQUIRE(add->right->GetKind() == SyntaxKind::BangExpression);
+
+    // both bangs belong to the tree
+    FindSkippedTokens finder(result.tokens, expression);
+    for (int32 i = 0; i < result.tokens.size; i++) {
+        if (result.tokens[i].kind == TokenKind::ExclamationToken) {
+            REQUIRE((result.tokens[i].GetFlags() & SyntaxTokenFlags::Skipped) == 0);
+        }
+    }
+
+}
+
+TEST_CASE("unknown accessors keep a node of their own", "[parser]") {
+
+    SourceFileInfo file;
+    char text[] = "int Value { get; fetch; set; }";
+
+    TokenizerResult result = Tokenize(TextWindow(text, strlen(text)), &file.diagnostics, &file.allocator);
+    Parser parser(result, &file.diagnostics, &file.allocator);
+    MemberDeclarationSyntax* member = ParseMemberDeclaration(&parser, SyntaxKind::ClassDeclaration);
+
+    REQUIRE(member->GetKind() == SyntaxKind::PropertyDeclaration);
+
+    SyntaxList<AccessorDeclarationSyntax>* accessors = ((PropertyDeclarationSyntax*) member)->accessorList->accessors;
+    REQUIRE(accessors->size == 3);
+    REQUIRE(accessors->array[0]->GetKind() == SyntaxKind::GetAccessorDeclaration);
+    REQUIRE(accessors->array[1]->GetKind() == SyntaxKind::UnknownAccessorDeclaration);
+    REQUIRE(accessors->array[2]->GetKind() == SyntaxKind::SetAccessorDeclaration);
+
+    REQUIRE(file.diagnostics.size == 1);
+    REQUIRE(file.diagnostics.Get(0).errorCode == ErrorCode::ERR_GetOrSetExpected);
+
+    // the printer dispatches on the kind, an accessor it doesn't know would be dropped from the tree
+    NodePrinter printer(result);
+    printer.PrintTree(member);
+    printer.buffer.Add('\0');
+    int32 printed = 0;
+    for (char* p = strstr(printer.buffer.array, "AccessorDeclarationSyntax"); p != nullptr; p = strstr(p + 1, "AccessorDeclarationSyntax")) {
+        printed++;
+    }
+    REQUIRE(printed == 3);
+
+}
+
+TEST_CASE("switch sections can be left empty", "[parser]") {
+
+    SourceFileInfo file;
+    char text[] = "switch (x) { case 1: case 2: }";
+
+    TokenizerResult result = Tokenize(TextWindow(text, strlen(text)), &file.diagnostics, &file.allocator);
+    Parser parser(result, &file.diagnostics, &file.allocator);
+    StatementSyntax* statement = ParseStatement(&parser);
+
+    REQUIRE(statement->GetKind() == SyntaxKind::SwitchStatement);
+
+    // both labels end up in one section with nothing after them, what to make of that is up to the checker
+    SyntaxList<SwitchSectionSyntax>* sections = ((SwitchStatementSyntax*) statement)->sections;
+    REQUIRE(sections->size == 1);
+    REQUIRE(sections->array[0]->labels->size == 2);
+    REQUIRE(sections->array[0]->statements->size == 0);
+
+}
+
+TEST_CASE("nodes made only of missing tokens are missing", "[parser]") {
+
+    SourceFileInfo file;
+    char text[] = "; int";
+
+    TokenizerResult result = Tokenize(TextWindow(text, strlen(text)), &file.diagnostics, &file.allocator);
+    Parser parser(result, &file.diagnostics, &file.allocator);
+
+    // nothing is eaten for the `;`, the name is made up in front of it
+    TypeSyntax* missing = ParseType(&parser);
+    REQUIRE(missing->IsMissing());
+
+    parser.EatToken(TokenKind::SemicolonToken);
+
+    TypeSyntax* type = ParseType(&parser);
+    REQUIRE(type->GetKind() == SyntaxKind::PredefinedType);
+    REQUIRE(!type->IsMissing());
+
+    // at the end of the input the missing name has no token to stand in front of
+    TypeSyntax* pastTheEnd = ParseType(&parser);
+    REQUIRE(pastTheEnd->IsMissing());
+
+}
+
+TEST_CASE("is takes either a type or a pattern", "[parser]") {
+
+    struct IsCase {
+        const char* text;
+        SyntaxKind kind;
+    };
+
+    // a bare (possibly qualified or generic) name is a type test, anything more is a pattern
+    IsCase cases[] = {
+        { "x is Foo", SyntaxKind::IsExpression },
+        { "x is List<int>", SyntaxKind::IsExpression },
+        { "x is Foo f", SyntaxKind::IsPatternExpression },
+        { "x is 3", SyntaxKind::IsPatternExpression },
+        { "x is A.B", SyntaxKind::IsExpression },
+    };
+
+    for (IsCase isCase : cases) {
+
+        SourceFileInfo file;
+        size_t length = strlen(isCase.text);
+        char* text = file.allocator.Allocate<char>(length + 1);
+        memcpy(text, isCase.text, length);
+
+        TokenizerResult result = Tokenize(TextWindow(text, length), &file.diagnostics, &file.allocator);
+        Parser parser(result, &file.diagnostics, &file.allocator);
+        ExpressionSyntax* expression = ParseExpression(&parser);
+
+        INFO(isCase.text);
+        REQUIRE(file.diagnostics.size == 0);
+        REQUIRE(expression->GetKind() == isCase.kind);
+
+        if (isCase.kind == SyntaxKind::IsExpression) {
+            SyntaxKind typeKind = ((BinaryExpressionSyntax*) expression)->right->GetKind();
+            REQUIRE((typeKind == SyntaxKind::IdentifierName || typeKind == SyntaxKind::GenericName || typeKind == SyntaxKind::QualifiedName));
+        }
+
+    }
+
+}
+
+TEST_CASE("delegate doesn't start an expression", "[parser]") {
+
+    SourceFileInfo file;
+    char text[] = "var d = delegate { };";
+
+    TokenizerResult result = Tokenize(TextWindow(text, strlen(text)), &file.diagnostics, &file.allocator);
+    Parser parser(result, &file.diagnostics, &file.allocator);
+    StatementSyntax* statement = ParseStatement(&parser);
+
+    // anonymous delegates aren't parsed, taking the keyword as a term tripped the progress assert
+    REQUIRE(statement != nullptr);
+    REQUIRE(file.diagnostics.size != 0);
+    REQUIRE(file.diagnostics.Get(0).errorCode == ErrorCode::ERR_InvalidExprTerm);
+
+}
+
+TEST_CASE("c-style constructor calls in declarators are skipped", "[parser]") {
+
+    SourceFileInfo file;
+    char text[] = "int a, b(3);";
+
+    TokenizerResult result = Tokenize(TextWindow(text, strlen(text)), &file.diagnostics, &file.allocator);
+    Parser parser(result, &file.diagnostics, &file.allocator);
+    StatementSyntax* statement = ParseStatement(&parser);
+
+    REQUIRE(statement->GetKind() == SyntaxKind::LocalDeclarationStatement);
+
+    // `b` is kept as a plain declarator, bailing out on the `(` used to leave a null in the list
+    SeparatedSyntaxList<VariableDeclaratorSyntax>* variables = ((LocalDeclarationStatementSyntax*) statement)->declaration->variables;
+    REQUIRE(variables->itemCount == 2);
+    REQUIRE(variables->items[0] != nullptr);
+    REQUIRE(variables->items[1] != nullptr);
+    REQUIRE(variables->items[1]->initializer == nullptr);
+    REQUIRE(file.diagnostics.size == 1);
+
+    NodePrinter printer(result);
+    printer.PrintTree(statement);
+    printer.buffer.Add('\0');
+    REQUIRE(strstr(printer.buffer.array, "OpenParenToken <skipped>") != nullptr);
+
+}
+
+TEST_CASE("# is an unexpected character", "[parser]") {
+
+    SourceFileInfo file;
+    char text[] = "class C { int x; # }";
+
+    TokenizerResult result = Tokenize(TextWindow(text, strlen(text)), &file.diagnostics, &file.allocator);
+
+    // there are no directives, scanning one as trivia aborted in the unported directive lexer
+    REQUIRE(file.diagnostics.size == 1);
+    REQUIRE(file.diagnostics.Get(0).errorCode == ErrorCode::ERR_UnexpectedCharacter);
+
+    Parser parser(result, &file.diagnostics, &file.allocator);
+    CompilationUnitSyntax* compilationUnit = ParseCompilationUnit(&parser);
+
+    REQUIRE(compilationUnit->members->size == 1);
+    REQUIRE(compilationUnit->members->array[0]->GetKind() == SyntaxKind::ClassDeclaration);
+    ClassDeclarationSyntax* declaration = (ClassDeclarationSyntax*) compilationUnit->members->array[0];
+    REQUIRE(declaration->members->size == 1);
+    REQUIRE(declaration->members->array[0]->GetKind() == SyntaxKind::FieldDeclaration);
+
+}
+
+TEST_CASE("types in a type parameter list are skipped", "[parser]") {
+
+    SourceFileInfo file;
+    char text[] = "class A<T, int, U> { }";
+
+    TokenizerResult result = Tokenize(TextWindow(text, strlen(text)), &file.diagnostics, &file.allocator);
+    Parser parser(result, &file.diagnostics, &file.allocator);
+    CompilationUnitSyntax* compilationUnit = ParseCompilationUnit(&parser);
+
+    REQUIRE(file.diagnostics.size == 1);
+    REQUIRE(file.diagnostics.Get(0).errorCode == ErrorCode::ERR_IdentifierExpected);
+
+    // `int` isn't kept as a parameter, stopping the skip on it left the token for nobody to consume
+    REQUIRE(compilationUnit->members->size == 1);
+    SeparatedSyntaxList<TypeParameterSyntax>* parameters = ((ClassDeclarationSyntax*) compilationUnit->members->array[0])->typeParameterList->parameters;
+    REQUIRE(parameters->itemCount == 3);
+    REQUIRE(!parameters->items[0]->identifier.IsMissing());
+    REQUIRE(parameters->items[1]->identifier.IsMissing());
+    REQUIRE(!parameters->items[2]->identifier.IsMissing());
+
+}
+
 TEST_CASE("compilation unit", "[parser]") {
 
     INITIALIZE_PARSER_TEST
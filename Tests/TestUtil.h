@@ -16,7 +16,7 @@ using namespace Alchemy::Compilation;
 
 
 #define INITIALIZE_PARSER(str) \
-    diagnostics.size = 0; \
+    diagnostics.Clear(); \
     textWindow = MakeTextWindow(str); \
     tokenizerResult = Tokenize(textWindow, &diagnostics, &allocator); \
     parser = Parser(tokenizerResult, &diagnostics, &allocator);     \
@@ -0,0 +1,560 @@
+#include "../Src/Compiler2/Compiler.h"
+#include "../Src/Compiler2/SourceFileInfo.h"
+#include "../Src/Parsing3/Tokenizer.h"
+#include "../Src/Parsing3/Parser.h"
+#include "../Src/Parsing3/Parsing.h"
+#include "../Src/Parsing3/TextWindow.h"
+#include "../Src/Util/Stopwatch.h"
+#include "../Src/Util/PerfCounters.h"
+#include "../Src/Util/ProcessMemory.h"
+#include "./CorpusGenerator.h"
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+using namespace Alchemy;
+using namespace Alchemy::Compilation;
+
+// Compiles a generated corpus and prints how long each phase took at a range of worker counts. Tokenizing and
+// parsing run on their own here so they can be told apart, everything else comes from the compiler's own
+// phase timings. Every number is the best of --runs fresh runs. --stats writes the CompileStats json of the very last
+// compile. Built with ALCHEMY_PERF_COUNTERS it also prints what the hardware counters saw per phase at the highest
+// worker count. --emit runs codegen into the directory as well and prints how fast the C came out, split into
+// --shards translation units when that is given. --incremental keeps one compiler at the highest worker count and
+// recompiles that many times after touching one file each time, printing what every run redid and what the process
+// holds afterwards. With --export-every the first class of every that many files is export, and the incremental runs
+// are made a second time from those as entry points. --calls makes statements call other methods, so there is
+// something to reach. --alloc-flags tokenizes & parses again with each LinearAllocatorFlags option on the workers' temp
+// allocators and prints the throughput and the page faults the process took, prefaulting --prefault-mb per worker.
+//
+//   bench [--files 1000] [--runs 5] [--workers 8] [--seed 1] [--classes 4] [--generics 1] [--generic-depth 2]
+//         [--fields 8] [--methods 4] [--statements 8] [--expression-depth 3] [--comments 20] [--strings 15]
+//         [--write <directory>] [--stats <file>] [--emit <directory>] [--shards 0] [--incremental 0]
+//         [--calls 0] [--export-every 0] [--alloc-flags] [--prefault-mb 16]
+
+struct TokenizeCorpusJob : Jobs::IJob {
+
+    CheckedArray<SourceFileInfo*> files;
+
+    explicit TokenizeCorpusJob(CheckedArray<SourceFileInfo*> files)
+        : files(files) {}
+
+    void Execute(int32 idx) override {
+        SourceFileInfo* file = files[idx];
+        file->tokenizerResult = Tokenize(TextWindow(file->contents.ptr, file->contents.size), &file->diagnostics, &file->allocator);
+    }
+
+};
+
+struct ParseCorpusJob : Jobs::IJob {
+
+    CheckedArray<SourceFileInfo*> files;
+
+    explicit ParseCorpusJob(CheckedArray<SourceFileInfo*> files)
+        : files(files) {}
+
+    void Execute(int32 idx) override {
+        SourceFileInfo* file = files[idx];
+        Parser parser(file->tokenizerResult, &file->diagnostics, &file->allocator);
+        file->syntaxTree = ParseCompilationUnit(&parser);
+    }
+
+};
+
+enum class BenchPhase {
+    Tokenize,
+    Parse,
+    Gather,
+    ResolveMembers,
+    ResolveBases,
+    Introspect,
+    Compile,
+
+    Count
+};
+
+static const char* kBenchPhaseNames[] = { "tokenize", "parse", "gather", "resolve members", "resolve bases", "introspect", "compile" };
+
+static_assert(sizeof(kBenchPhaseNames) / sizeof(kBenchPhaseNames[0]) == (int32) BenchPhase::Count);
+
+static void ResetFiles(CheckedArray<SourceFileInfo*> files, Corpus* corpus) {
+    for (int32 i = 0; i < files.size; i++) {
+        files[i]->Invalidate();
+        files[i]->contents = corpus->files[i].contents;
+    }
+}
+
+// what the job system's counters moved by since `start`, which becomes the new start
+static void TakeCounterDelta(Jobs::JobSystem* jobSystem, PodList<Jobs::WorkerStats>* scratch, PodList<PerfCounterValues>* start, PerfCounterValues* delta, uint32* mask) {
+    jobSystem->GetWorkerStats(scratch);
+    memset(delta, 0, sizeof(PerfCounterValues));
+    *mask = scratch->size == 0 ? 0 : ~0u;
+    for (int32 i = 0; i < scratch->size; i++) {
+        if (start->size <= i) {
+            start->Add(PerfCounterValues {});
+        }
+        delta->Add(start->Get(i), scratch->Get(i).perfCounters);
+        start->Get(i) = scratch->Get(i).perfCounters;
+        *mask &= scratch->Get(i).perfCounterMask;
+    }
+}
+
+static void PrintCounters(const char* phase, const PerfCounterValues& counters, uint32 mask) {
+    const uint64* v = counters.values;
+    double instructions = (double) v[(int32) PerfCounter::Instructions];
+    double perThousand = instructions == 0 ? 0 : 1000.0 / instructions;
+    printf("  %-16s", phase);
+    for (int32 c = 0; c < kPerfCounterCount; c++) {
+        if ((mask & (1u << (uint32) c)) == 0) {
+            printf(" %14s", "-");
+        }
+        else {
+            printf(" %14llu", (unsigned long long) v[c]);
+        }
+    }
+    if ((mask & (1u << (uint32) PerfCounter::Cycles)) != 0 && v[(int32) PerfCounter::Cycles] != 0) {
+        printf("  ipc %.2f", instructions / (double) v[(int32) PerfCounter::Cycles]);
+    }
+    if ((mask & (1u << (uint32) PerfCounter::BranchMisses)) != 0 && instructions != 0) {
+        printf("  branch miss/ki %.2f", v[(int32) PerfCounter::BranchMisses] * perThousand);
+    }
+    if ((mask & (1u << (uint32) PerfCounter::L1DataMisses)) != 0 && instructions != 0) {
+        printf("  l1d miss/ki %.2f", v[(int32) PerfCounter::L1DataMisses] * perThousand);
+    }
+    printf("\n");
+}
+
+static void MinInto(uint64* best, uint64 value) {
+    if (*best == 0 || value < *best) {
+        *best = value;
+    }
+}
+
+static void PrintIncrementalRun(const char* label, Compiler* compiler, uint64 nanoseconds) {
+    printf("  %-10s %10.3f %8d %8d %8d %8d %8d %10.1f %9d %9d\n",
+        label,
+        nanoseconds / 1e6,
+        compiler->stats.changedFileCount,
+        compiler->stats.relinkedFileCount,
+        compiler->stats.signatureChangedFileCount,
+        compiler->stats.introspectedMethodCount,
+        compiler->stats.keptMethodCount,
+        compiler->stats.residentBytes / (1024.0 * 1024.0),
+        compiler->stats.mappingCount,
+        compiler->stats.arenaReservationCount
+    );
+}
+
+// even runs put a comment at the end of a file, odd runs add a class to it. neither touches what other files see
+// of it, so only the edited file should be parsed again. with entry points only what they reach is introspected
+static void RunIncremental(Corpus* corpus, PackageInfo packageInfo, int32 workers, int32 runs, CheckedArray<FixedCharSpan> entryPoints) {
+
+    Compiler compiler(workers - 1, FileSystemType::Virtual);
+
+    for (int32 i = 0; i < corpus->files.size; i++) {
+        compiler.vfs.AddFile(VirtualFileInfo(packageInfo.packageName, corpus->files[i].path), corpus->files[i].contents);
+    }
+
+    for (int32 i = 0; i < entryPoints.size; i++) {
+        compiler.AddEntryPoint(entryPoints[i]);
+    }
+
+    printf("\nincremental, %d worker%s", workers, workers == 1 ? "" : "s");
+    printf(entryPoints.size == 0 ? "\n" : ", from %d entry points\n", entryPoints.size);
+    printf("  %-10s %10s %8s %8s %8s %8s %8s %10s %9s %9s\n", "run", "ms", "changed", "relinked", "sigs", "bodies", "kept", "rss MB", "mappings", "arenas");
+
+    Stopwatch stopwatch;
+    compiler.Compile(CheckedArray<PackageInfo>(&packageInfo, 1));
+    PrintIncrementalRun("cold", &compiler, stopwatch.Lap());
+
+    // the vfs doesn't copy, edited texts have to outlive the compiler
+    PodList<FixedCharSpan> edits;
+    uint64 total = 0;
+
+    for (int32 r = 0; r < runs; r++) {
+
+        int32 index = (int32) (((uint64) r * 7919) % (uint64) corpus->files.size);
+        FixedCharSpan original = corpus->files[index].contents;
+
+        char suffix[96];
+        int32 suffixSize = (r & 1) == 0
+            ? snprintf(suffix, sizeof(suffix), "\n// edit %d\n", r)
+            : snprintf(suffix, sizeof(suffix), "\npublic class BenchEdit%d { int value; }\n", r);
+
+        // the tokenizer reads up to a terminating 0, MallocateTyped clears it
+        char* text = MallocateTyped(char, original.size + suffixSize + 1);
+        memcpy(text, original.ptr, original.size);
+        memcpy(text + original.size, suffix, suffixSize);
+        edits.Add(FixedCharSpan(text, original.size + suffixSize));
+
+        compiler.vfs.AddFile(VirtualFileInfo(packageInfo.packageName, corpus->files[index].path, (uint64) r + 1), edits[edits.size - 1]);
+
+        char label[16];
+        snprintf(label, sizeof(label), "%d", r + 1);
+
+        stopwatch.Lap();
+        compiler.Compile(CheckedArray<PackageInfo>(&packageInfo, 1));
+        uint64 elapsed = stopwatch.Lap();
+        total += elapsed;
+        PrintIncrementalRun(label, &compiler, elapsed);
+
+    }
+
+    printf("  %-10s %10.3f\n", "mean", total / 1e6 / runs);
+
+    compiler.jobSystem.Shutdown();
+
+    for (int32 i = 0; i < edits.size; i++) {
+        MfreeTyped(edits[i].ptr, edits[i].size + 1);
+    }
+
+    edits.Dispose();
+
+}
+
+struct AllocFlagsOption {
+    const char* name;
+    LinearAllocatorFlags flags;
+};
+
+static const AllocFlagsOption kAllocFlagsOptions[] = {
+    { "none", LinearAllocatorFlags::None },
+    { "huge pages", LinearAllocatorFlags::HugePages },
+    { "geometric", LinearAllocatorFlags::GeometricCommit },
+    { "prefault", LinearAllocatorFlags::Prefault },
+    { "all", LinearAllocatorFlags::HugePages | LinearAllocatorFlags::GeometricCommit | LinearAllocatorFlags::Prefault },
+};
+
+// a fresh job system per option so its threads make their temp allocators with the flags. the first run's faults
+// count from before the job system exists, so what prefaulting costs up front is in there too
+static void RunAllocFlags(CheckedArray<SourceFileInfo*> files, Corpus* corpus, int32 workers, int32 runs, size_t prefaultBytes) {
+
+    printf("\nworker temp allocator options, %d worker%s, %.0f MB prefault\n", workers, workers == 1 ? "" : "s", prefaultBytes / (1024.0 * 1024.0));
+    printf("  %-12s %10s %10s %10s %14s %14s\n", "option", "tokenize", "parse", "parse MB/s", "first faults", "last faults");
+
+    for (int32 o = 0; o < (int32) (sizeof(kAllocFlagsOptions) / sizeof(kAllocFlagsOptions[0])); o++) {
+
+        const AllocFlagsOption& option = kAllocFlagsOptions[o];
+        size_t prefault = (option.flags & LinearAllocatorFlags::Prefault) != 0 ? prefaultBytes : 0;
+
+        uint64 bestTokenize = 0;
+        uint64 bestParse = 0;
+        uint64 firstFaults = 0;
+        uint64 lastFaults = 0;
+
+        uint64 faultStart = GetProcessPageFaults();
+
+        Jobs::JobSystem jobSystem(workers - 1, option.flags, prefault);
+
+        for (int32 r = 0; r < runs; r++) {
+
+            ResetFiles(files, corpus);
+
+            if (r != 0) {
+                faultStart = GetProcessPageFaults();
+            }
+
+            Stopwatch stopwatch;
+            jobSystem.Execute(Jobs::Parallel::Foreach(files.size), TokenizeCorpusJob(files));
+            MinInto(&bestTokenize, stopwatch.Lap());
+
+            jobSystem.Execute(Jobs::Parallel::Foreach(files.size), ParseCorpusJob(files));
+            MinInto(&bestParse, stopwatch.Lap());
+
+            uint64 faults = GetProcessPageFaults() - faultStart;
+            firstFaults = r == 0 ? faults : firstFaults;
+            lastFaults = faults;
+
+        }
+
+        jobSystem.Shutdown();
+
+        printf("  %-12s %10.3f %10.3f %10.1f %14llu %14llu\n",
+            option.name,
+            bestTokenize / 1e6,
+            bestParse / 1e6,
+            corpus->totalBytes / (1024.0 * 1024.0) / (bestParse / 1e9),
+            (unsigned long long) firstFaults,
+            (unsigned long long) lastFaults
+        );
+
+    }
+
+}
+
+static bool HasArg(int32 argc, char** argv, const char* name) {
+    for (int32 i = 1; i < argc; i++) {
+        if (strcmp(argv[i], name) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static int32 ParseIntArg(int32 argc, char** argv, const char* name, int32 fallback) {
+    for (int32 i = 1; i < argc - 1; i++) {
+        if (strcmp(argv[i], name) == 0) {
+            return atoi(argv[i + 1]);
+        }
+    }
+    return fallback;
+}
+
+static const char* ParseStringArg(int32 argc, char** argv, const char* name) {
+    for (int32 i = 1; i < argc - 1; i++) {
+        if (strcmp(argv[i], name) == 0) {
+            return argv[i + 1];
+        }
+    }
+    return nullptr;
+}
+
+int32 main(int32 argc, char** argv) {
+
+    CorpusOptions options;
+    options.fileCount = ParseIntArg(argc, argv, "--files", 1000);
+    options.seed = (uint64) ParseIntArg(argc, argv, "--seed", 1);
+    options.classesPerFile = ParseIntArg(argc, argv, "--classes", options.classesPerFile);
+    options.genericClassesPerFile = ParseIntArg(argc, argv, "--generics", options.genericClassesPerFile);
+    options.genericDepth = ParseIntArg(argc, argv, "--generic-depth", options.genericDepth);
+    options.fieldsPerType = ParseIntArg(argc, argv, "--fields", options.fieldsPerType);
+    options.methodsPerType = ParseIntArg(argc, argv, "--methods", options.methodsPerType);
+    options.statementsPerMethod = ParseIntArg(argc, argv, "--statements", options.statementsPerMethod);
+    options.expressionDepth = ParseIntArg(argc, argv, "--expression-depth", options.expressionDepth);
+    options.commentPercent = ParseIntArg(argc, argv, "--comments", options.commentPercent);
+    options.stringPercent = ParseIntArg(argc, argv, "--strings", options.stringPercent);
+    options.callPercent = ParseIntArg(argc, argv, "--calls", options.callPercent);
+    options.exportInterval = ParseIntArg(argc, argv, "--export-every", options.exportInterval);
+
+    int32 runs = ParseIntArg(argc, argv, "--runs", 5);
+    int32 maxWorkers = ParseIntArg(argc, argv, "--workers", (int32) std::thread::hardware_concurrency());
+    maxWorkers = maxWorkers < 1 ? 1 : maxWorkers;
+
+    Corpus corpus;
+    corpus.Generate(options, "corpus");
+
+    const char* writeDirectory = ParseStringArg(argc, argv, "--write");
+    const char* statsPath = ParseStringArg(argc, argv, "--stats");
+    const char* emitDirectory = ParseStringArg(argc, argv, "--emit");
+    int32 shardCount = ParseIntArg(argc, argv, "--shards", 0);
+    int32 incrementalRuns = ParseIntArg(argc, argv, "--incremental", 0);
+
+    if (writeDirectory != nullptr) {
+        if (!corpus.WriteToDisk(writeDirectory)) {
+            fprintf(stderr, "failed to write the corpus to %s\n", writeDirectory);
+            return 1;
+        }
+        printf("wrote %d files (%.2f MB) to %s\n", corpus.files.size, corpus.totalBytes / (1024.0 * 1024.0), writeDirectory);
+        return 0;
+    }
+
+    SourceFileInfo** fileBuffer = MallocateTyped(SourceFileInfo*, corpus.files.size);
+    CheckedArray<SourceFileInfo*> files(fileBuffer, corpus.files.size);
+
+    for (int32 i = 0; i < files.size; i++) {
+        files[i] = new SourceFileInfo();
+        files[i]->path = corpus.files[i].path;
+    }
+
+    FixedCharSpan package("Corpus");
+    PackageInfo packageInfo;
+    packageInfo.packageName = package;
+    packageInfo.absolutePath = FixedCharSpan("corpus/");
+
+    int64 tokenCount = 0;
+    int32 diagnosticCount = 0;
+
+    printf("%d files, %.2f MB, seed %llu, best of %d runs\n", corpus.files.size, corpus.totalBytes / (1024.0 * 1024.0), (unsigned long long) options.seed, runs);
+
+    // 1, 2, 4 ... and always the max itself
+    for (int32 workers = 1; ; workers = workers * 2 > maxWorkers ? maxWorkers : workers * 2) {
+
+        uint64 best[(int32) BenchPhase::Count] = {};
+
+        // of the last run, unlike the timings
+        PerfCounterValues counters[(int32) BenchPhase::Count] = {};
+        uint32 counterMask = 0;
+
+        uint64 bestCodeGen = 0;
+        int64 emittedBytes = 0;
+        int32 translationUnitCount = 0;
+        int32 writtenTranslationUnitCount = 0;
+
+        {
+            // the job system counts the calling thread as one of its workers
+            Jobs::JobSystem jobSystem(workers - 1);
+
+            PodList<Jobs::WorkerStats> workerScratch;
+            PodList<PerfCounterValues> counterStart;
+            PerfCounterValues skipped;
+
+            for (int32 r = 0; r < runs; r++) {
+
+                ResetFiles(files, &corpus);
+                TakeCounterDelta(&jobSystem, &workerScratch, &counterStart, &skipped, &counterMask);
+
+                Stopwatch stopwatch;
+                jobSystem.Execute(Jobs::Parallel::Foreach(files.size), TokenizeCorpusJob(files));
+                MinInto(&best[(int32) BenchPhase::Tokenize], stopwatch.Lap());
+                TakeCounterDelta(&jobSystem, &workerScratch, &counterStart, &counters[(int32) BenchPhase::Tokenize], &counterMask);
+
+                stopwatch.Lap();
+                jobSystem.Execute(Jobs::Parallel::Foreach(files.size), ParseCorpusJob(files));
+                MinInto(&best[(int32) BenchPhase::Parse], stopwatch.Lap());
+                TakeCounterDelta(&jobSystem, &workerScratch, &counterStart, &counters[(int32) BenchPhase::Parse], &counterMask);
+
+            }
+
+            workerScratch.Dispose();
+            counterStart.Dispose();
+
+            tokenCount = 0;
+            diagnosticCount = 0;
+            for (int32 i = 0; i < files.size; i++) {
+                tokenCount += files[i]->tokenizerResult.tokens.size;
+                diagnosticCount += files[i]->diagnostics.size;
+            }
+
+            jobSystem.Shutdown();
+        }
+
+        for (int32 r = 0; r < runs; r++) {
+
+            Compiler compiler(workers - 1, FileSystemType::Virtual);
+
+            for (int32 i = 0; i < corpus.files.size; i++) {
+                compiler.vfs.AddFile(VirtualFileInfo(package, corpus.files[i].path), corpus.files[i].contents);
+            }
+
+            if (emitDirectory != nullptr && shardCount > 0) {
+                compiler.SetCodeGenShards(FixedCharSpan(emitDirectory), shardCount);
+            }
+            else if (emitDirectory != nullptr) {
+                compiler.SetCodeGenOutput(FixedCharSpan(emitDirectory));
+            }
+
+            Stopwatch stopwatch;
+            compiler.Compile(CheckedArray<PackageInfo>(&packageInfo, 1));
+            MinInto(&best[(int32) BenchPhase::Compile], stopwatch.Lap());
+
+            MinInto(&best[(int32) BenchPhase::Gather], compiler.stats.phases[(int32) CompilePhase::Gather].wallNanoseconds);
+            MinInto(&best[(int32) BenchPhase::ResolveMembers], compiler.stats.phases[(int32) CompilePhase::ResolveMembers].wallNanoseconds);
+            MinInto(&best[(int32) BenchPhase::ResolveBases], compiler.stats.phases[(int32) CompilePhase::ResolveBases].wallNanoseconds);
+            MinInto(&best[(int32) BenchPhase::Introspect], compiler.stats.phases[(int32) CompilePhase::Introspect].wallNanoseconds);
+
+            counters[(int32) BenchPhase::Gather] = compiler.stats.phases[(int32) CompilePhase::Gather].perfCounters;
+            counters[(int32) BenchPhase::ResolveMembers] = compiler.stats.phases[(int32) CompilePhase::ResolveMembers].perfCounters;
+            counters[(int32) BenchPhase::ResolveBases] = compiler.stats.phases[(int32) CompilePhase::ResolveBases].perfCounters;
+            counters[(int32) BenchPhase::Introspect] = compiler.stats.phases[(int32) CompilePhase::Introspect].perfCounters;
+            counterMask &= compiler.stats.perfCounterMask;
+
+            MinInto(&bestCodeGen, compiler.stats.phases[(int32) CompilePhase::CodeGen].wallNanoseconds);
+            emittedBytes = compiler.stats.emittedBytes;
+            translationUnitCount = compiler.stats.translationUnitCount;
+            writtenTranslationUnitCount = compiler.stats.writtenTranslationUnitCount;
+
+            if (statsPath != nullptr && workers == maxWorkers && r == runs - 1) {
+                FixedCharSpan json = compiler.GetStatsJson(Allocator::MakeMallocator());
+                FILE* file = fopen(statsPath, "wb");
+                if (file != nullptr) {
+                    fwrite(json.ptr, 1, json.size, file);
+                    fclose(file);
+                }
+                else {
+                    fprintf(stderr, "failed to write stats to %s\n", statsPath);
+                }
+                Allocator::MakeMallocator().Free(json.ptr, json.size + 1);
+            }
+
+            compiler.jobSystem.Shutdown();
+
+        }
+
+        printf("\n%d worker%s\n", workers, workers == 1 ? "" : "s");
+        printf("  %-16s %10s %10s %12s %14s\n", "phase", "ms", "MB/s", "files/s", "tokens/s");
+
+        for (int32 p = 0; p < (int32) BenchPhase::Count; p++) {
+            double seconds = best[p] / 1e9;
+            seconds = seconds == 0 ? 1e-9 : seconds;
+            printf("  %-16s %10.3f %10.1f %12.0f %14.0f\n",
+                kBenchPhaseNames[p],
+                best[p] / 1e6,
+                corpus.totalBytes / (1024.0 * 1024.0) / seconds,
+                files.size / seconds,
+                tokenCount / seconds
+            );
+        }
+
+        // only the first run of all writes anything, every one after it finds the same files on disk
+        if (emitDirectory != nullptr && bestCodeGen != 0) {
+            printf("\n  %-16s %10.3f %10.1f   %.2f MB emitted, %d translation units, %d written last run\n",
+                "codegen",
+                bestCodeGen / 1e6,
+                emittedBytes / (1024.0 * 1024.0) / (bestCodeGen / 1e9),
+                emittedBytes / (1024.0 * 1024.0),
+                translationUnitCount,
+                writtenTranslationUnitCount
+            );
+        }
+
+        if (workers == maxWorkers) {
+            // the compile row would only repeat the phases above it, it has no counters of its own
+            if (counterMask != 0) {
+                printf("\n  %-16s", "counters");
+                for (int32 c = 0; c < kPerfCounterCount; c++) {
+                    printf(" %14s", PerfCounterToString((PerfCounter) c));
+                }
+                printf("\n");
+                for (int32 p = 0; p < (int32) BenchPhase::Compile; p++) {
+                    PrintCounters(kBenchPhaseNames[p], counters[p], counterMask);
+                }
+            }
+            break;
+        }
+
+    }
+
+    if (incrementalRuns > 0) {
+
+        RunIncremental(&corpus, packageInfo, maxWorkers, incrementalRuns, CheckedArray<FixedCharSpan>());
+
+        // the same edits again, from the export classes of the corpus
+        if (options.exportInterval != 0) {
+
+            PodList<FixedCharSpan> entryPoints;
+            for (int32 f = 0; f < options.fileCount; f += options.exportInterval) {
+                char name[32];
+                int32 length = snprintf(name, sizeof(name), "C%d_0", f);
+                char* copy = MallocateTyped(char, length + 1);
+                memcpy(copy, name, length);
+                entryPoints.Add(FixedCharSpan(copy, length));
+            }
+
+            RunIncremental(&corpus, packageInfo, maxWorkers, incrementalRuns, entryPoints.ToCheckedArray());
+
+            for (int32 i = 0; i < entryPoints.size; i++) {
+                MfreeTyped(entryPoints[i].ptr, entryPoints[i].size + 1);
+            }
+
+            entryPoints.Dispose();
+
+        }
+
+    }
+
+    if (HasArg(argc, argv, "--alloc-flags")) {
+        RunAllocFlags(files, &corpus, maxWorkers, runs, (size_t) ParseIntArg(argc, argv, "--prefault-mb", 16) * 1024 * 1024);
+    }
+
+    printf("\n%lld tokens, %d parse diagnostics\n", (long long) tokenCount, diagnosticCount);
+
+    for (int32 i = 0; i < files.size; i++) {
+        files[i]->Invalidate();
+        delete files[i];
+    }
+
+    MfreeTyped(fileBuffer, corpus.files.size);
+
+    return 0;
+
+}
@@ -0,0 +1,67 @@
+#include "../Src/Compiler2/Compiler.h"
+#include "../Src/Compiler2/LoadBuiltIns.h"
+#include "../Src/Compiler2/Snapshot.h"
+#include <cstdio>
+
+using namespace Alchemy;
+using namespace Alchemy::Compilation;
+
+namespace Alchemy::Compilation {
+
+    // the tool is what makes the image, it has to parse the built ins itself
+    CheckedArray<uint8> GetBuiltInImage() {
+        return CheckedArray<uint8>(nullptr, 0);
+    }
+
+}
+
+// compiles System/*.wyx on its own and writes the result as a byte array, cmake puts it in the build directory as BuiltInImage.generated.cpp
+int32 main(int32 argc, char** argv) {
+
+    if (argc != 2) {
+        fprintf(stderr, "usage: BuiltInImage <output.cpp>\n");
+        return 1;
+    }
+
+    Compiler compiler(0, FileSystemType::Virtual);
+    compiler.Compile(CheckedArray<PackageInfo>(nullptr, 0));
+
+    if (compiler.diagnostics.size != 0) {
+        fprintf(stderr, "built ins have %d diagnostics, not writing an image\n", compiler.diagnostics.size);
+        return 1;
+    }
+
+    PodList<uint8> image;
+    WriteSnapshot(&compiler, &image, true);
+
+    FILE* file = fopen(argv[1], "wb");
+
+    if (file == nullptr) {
+        fprintf(stderr, "cannot open %s\n", argv[1]);
+        return 1;
+    }
+
+    fprintf(file, "// generated by Tools/BuiltInImage.cpp from System/*.wyx, do not edit\n");
+    fprintf(file, "#include \"Src/Compiler2/LoadBuiltIns.h\"\n\n");
+    fprintf(file, "namespace Alchemy::Compilation {\n\n");
+    fprintf(file, "alignas(8) static const uint8 kBuiltInImage[%d] = {\n", image.size);
+
+    for (int32 i = 0; i < image.size; i++) {
+        fprintf(file, (i & 15) == 0 ? "    0x%02x," : " 0x%02x,", image.array[i]);
+        if ((i & 15) == 15 || i == image.size - 1) {
+            fprintf(file, "\n");
+        }
+    }
+
+    fprintf(file, "};\n\n");
+    fprintf(file, "CheckedArray<uint8> GetBuiltInImage() {\n");
+    fprintf(file, "    return CheckedArray<uint8>((uint8*) kBuiltInImage, sizeof(kBuiltInImage));\n");
+    fprintf(file, "}\n\n}\n");
+
+    fclose(file);
+
+    image.Dispose();
+
+    return 0;
+
+}
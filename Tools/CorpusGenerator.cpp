@@ -0,0 +1,336 @@
+#include "./CorpusGenerator.h"
+#include <cstdio>
+#include <cstring>
+
+namespace Alchemy::Compilation {
+
+    static const char* kPrimitiveTypes[] = { "int", "float", "double", "bool", "string", "long", "char" };
+
+    static const char* kWords[] = {
+        "alpha", "bravo", "charlie", "delta", "echo", "foxtrot", "golf", "hotel", "india", "juliet", "kilo", "lima",
+        "mike", "november", "oscar", "papa", "quebec", "romeo", "sierra", "tango", "uniform", "victor", "whiskey"
+    };
+
+    static const char* kOperators[] = { " + ", " - ", " * ", " / ", " % ", " & ", " | ", " ^ " };
+
+    struct CorpusWriter {
+
+        PodList<char>* output;
+        CorpusRandom* random;
+        const CorpusOptions* options;
+
+        // names of everything declared so far, earlier files included
+        PodList<int32> classNames; // packed as file << 16 | index
+        PodList<int32> genericNames;
+
+        int32 intFieldCount;
+        int32 localCount;
+        int32 stringCount;
+
+        void Write(const char* text) {
+            size_t length = strlen(text);
+            memcpy(output->Reserve((int32) length), text, length);
+        }
+
+        void Write(const char* format, int32 a, int32 b = 0) {
+            char buffer[128];
+            int32 length = snprintf(buffer, sizeof(buffer), format, a, b);
+            memcpy(output->Reserve(length), buffer, length);
+        }
+
+        void WriteClassName(int32 packed) {
+            Write("C%d_%d", packed >> 16, packed & 0xffff);
+        }
+
+        void WriteGenericName(int32 packed) {
+            Write("Box%d_%d", packed >> 16, packed & 0xffff);
+        }
+
+        void WriteWords(int32 count) {
+            for (int32 i = 0; i < count; i++) {
+                Write(i == 0 ? "" : " ");
+                Write(kWords[random->Range(sizeof(kWords) / sizeof(kWords[0]))]);
+            }
+        }
+
+        void MaybeWriteComment(const char* indent) {
+            if (!random->Percent(options->commentPercent)) {
+                return;
+            }
+            Write(indent);
+            if (random->Percent(50)) {
+                Write("// ");
+                WriteWords(3 + random->Range(8));
+                Write("\n");
+            }
+            else {
+                Write("/* ");
+                WriteWords(4 + random->Range(12));
+                Write(" */\n");
+            }
+        }
+
+        void WriteFieldType(int32 depth) {
+
+            if (depth > 0 && genericNames.size != 0) {
+                WriteGenericName(genericNames[random->Range(genericNames.size)]);
+                Write("<");
+                WriteFieldType(depth - 1);
+                Write(">");
+                return;
+            }
+
+            if (classNames.size != 0 && random->Percent(25)) {
+                WriteClassName(classNames[random->Range(classNames.size)]);
+                return;
+            }
+
+            Write(kPrimitiveTypes[random->Range(sizeof(kPrimitiveTypes) / sizeof(kPrimitiveTypes[0]))]);
+
+        }
+
+        void WriteOperand() {
+            int32 pick = random->Range(localCount == 0 ? 3 : 5);
+            if (pick == 0) {
+                Write("a");
+            }
+            else if (pick == 1 && intFieldCount != 0) {
+                Write("i%d", random->Range(intFieldCount));
+            }
+            else if (pick >= 3) {
+                Write("x%d", random->Range(localCount));
+            }
+            else {
+                Write("%d", random->Range(1000));
+            }
+        }
+
+        void WriteExpression(int32 depth) {
+
+            if (depth == 0) {
+                WriteOperand();
+                return;
+            }
+
+            bool parenthesize = random->Percent(30);
+
+            if (parenthesize) {
+                Write("(");
+            }
+
+            // lopsided trees, the left side is sometimes a level shallower
+            int32 leftDepth = depth - 1 - random->Range(2);
+            WriteExpression(leftDepth < 0 ? 0 : leftDepth);
+            Write(kOperators[random->Range(sizeof(kOperators) / sizeof(kOperators[0]))]);
+            WriteExpression(depth - 1);
+
+            if (parenthesize) {
+                Write(")");
+            }
+
+        }
+
+        void WriteStatement() {
+
+            MaybeWriteComment("        ");
+
+            if (options->stringPercent != 0 && random->Percent(options->stringPercent)) {
+                // strings aren't used in expressions, they are only there to be scanned
+                Write("        string s%d = \"", stringCount++);
+                WriteWords(1 + random->Range(6));
+                Write("\";\n");
+                return;
+            }
+
+            if (localCount != 0 && options->callPercent != 0 && random->Percent(options->callPercent)) {
+                Write("        x%d = ", random->Range(localCount));
+                Write("M%d(a, b);\n", random->Range(options->methodsPerType));
+                return;
+            }
+
+            int32 pick = localCount == 0 ? 0 : random->Range(3);
+
+            if (pick == 0) {
+                Write("        int x%d = ", localCount);
+                WriteExpression(options->expressionDepth);
+                Write(";\n");
+                localCount++;
+            }
+            else if (pick == 1) {
+                Write("        x%d = ", random->Range(localCount));
+                WriteExpression(options->expressionDepth);
+                Write(";\n");
+            }
+            else {
+                Write("        if (");
+                WriteExpression(options->expressionDepth - 1);
+                Write(" < ");
+                WriteExpression(options->expressionDepth - 1);
+                Write(") {\n            x%d = ", random->Range(localCount));
+                WriteExpression(options->expressionDepth);
+                Write(";\n        }\n");
+            }
+
+        }
+
+        void WriteGenericClass(int32 fileIndex, int32 index) {
+            MaybeWriteComment("");
+            Write("public class Box%d_%d<T> {\n", fileIndex, index);
+            Write("    public T value;\n");
+            Write("    public int count;\n");
+            Write("    public T Get() {\n        return value;\n    }\n");
+            Write("}\n\n");
+        }
+
+        void WriteClass(int32 fileIndex, int32 index) {
+
+            MaybeWriteComment("");
+
+            bool exported = options->exportInterval != 0 && index == 0 && fileIndex % options->exportInterval == 0;
+
+            Write(exported ? "export class C%d_%d" : "public class C%d_%d", fileIndex, index);
+
+            if (classNames.size != 0 && random->Percent(60)) {
+                // bases are always declared before, hierarchies can get deep but never cycle
+                Write(" : ");
+                WriteClassName(classNames[classNames.size - 1 - random->Range(classNames.size < 8 ? classNames.size : 8)]);
+            }
+
+            Write(" {\n\n");
+
+            intFieldCount = 0;
+
+            for (int32 i = 0; i < options->fieldsPerType; i++) {
+                MaybeWriteComment("    ");
+                Write(random->Percent(50) ? "    public " : "    ");
+                if (i % 2 == 0) {
+                    Write("int i%d;\n", intFieldCount++);
+                }
+                else {
+                    WriteFieldType(random->Range(options->genericDepth + 1));
+                    Write(" f%d;\n", i);
+                }
+            }
+
+            for (int32 i = 0; i < options->methodsPerType; i++) {
+                Write("\n");
+                MaybeWriteComment("    ");
+                Write(exported && i == 0 ? "    export int M%d(int a, float b) {\n" : "    public int M%d(int a, float b) {\n", i);
+                localCount = 0;
+                stringCount = 0;
+                for (int32 s = 0; s < options->statementsPerMethod; s++) {
+                    WriteStatement();
+                }
+                Write(localCount == 0 ? "        return a;\n" : "        return x0;\n");
+                Write("    }\n");
+            }
+
+            Write("\n}\n\n");
+
+        }
+
+    };
+
+    Corpus::Corpus()
+        : files()
+        , totalBytes(0) {}
+
+    Corpus::~Corpus() {
+        Clear();
+        files.Dispose();
+    }
+
+    void Corpus::Clear() {
+        for (int32 i = 0; i < files.size; i++) {
+            MfreeTyped(files[i].path.ptr, files[i].path.size + 1);
+            MfreeTyped(files[i].contents.ptr, files[i].contents.size + 1);
+        }
+        files.size = 0;
+        totalBytes = 0;
+    }
+
+    static FixedCharSpan CopyToSpan(const char* text, size_t length) {
+        char* copy = MallocateTypedUncleared(char, length + 1);
+        memcpy(copy, text, length);
+        copy[length] = '\0';
+        return FixedCharSpan(copy, length);
+    }
+
+    void Corpus::Generate(const CorpusOptions& options, const char* directory) {
+
+        Clear();
+
+        CorpusRandom random(options.seed);
+        PodList<char> buffer;
+
+        CorpusWriter writer;
+        writer.output = &buffer;
+        writer.random = &random;
+        writer.options = &options;
+        writer.intFieldCount = 0;
+        writer.localCount = 0;
+        writer.stringCount = 0;
+
+        files.EnsureCapacity(options.fileCount);
+
+        for (int32 f = 0; f < options.fileCount; f++) {
+
+            buffer.size = 0;
+
+            writer.MaybeWriteComment("");
+
+            for (int32 g = 0; g < options.genericClassesPerFile; g++) {
+                writer.WriteGenericClass(f, g);
+                writer.genericNames.Add(f << 16 | g);
+            }
+
+            for (int32 c = 0; c < options.classesPerFile; c++) {
+                writer.WriteClass(f, c);
+                writer.classNames.Add(f << 16 | c);
+            }
+
+            char path[256];
+            int32 pathLength = snprintf(path, sizeof(path), "%s/file%d.wyx", directory, f);
+
+            files.Add(CorpusFile { CopyToSpan(path, pathLength), CopyToSpan(buffer.array, buffer.size) });
+            totalBytes += buffer.size;
+
+        }
+
+        buffer.Dispose();
+        writer.classNames.Dispose();
+        writer.genericNames.Dispose();
+
+    }
+
+    bool Corpus::WriteToDisk(const char* directory) {
+
+        for (int32 i = 0; i < files.size; i++) {
+
+            // paths already start with the directory they were generated for, only the file name is kept
+            const char* name = strrchr(files[i].path.ptr, '/');
+            name = name == nullptr ? files[i].path.ptr : name + 1;
+
+            char path[512];
+            snprintf(path, sizeof(path), "%s/%s", directory, name);
+
+            FILE* file = fopen(path, "wb");
+
+            if (file == nullptr) {
+                return false;
+            }
+
+            bool ok = fwrite(files[i].contents.ptr, 1, files[i].contents.size, file) == files[i].contents.size;
+            fclose(file);
+
+            if (!ok) {
+                return false;
+            }
+
+        }
+
+        return true;
+
+    }
+
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "../Src/PrimitiveTypes.h"
+#include "../Src/Collections/PodList.h"
+#include "../Src/Util/FixedCharSpan.h"
+
+namespace Alchemy::Compilation {
+
+    // xorshift64*, the corpus has to come out the same on every platform so no std distributions
+    struct CorpusRandom {
+
+        uint64 state;
+
+        explicit CorpusRandom(uint64 seed) : state(seed == 0 ? 0x9e3779b97f4a7c15ull : seed) {}
+
+        uint32 Next() {
+            state ^= state >> 12;
+            state ^= state << 25;
+            state ^= state >> 27;
+            return (uint32) ((state * 0x2545f4914f6cdd1dull) >> 32);
+        }
+
+        // [0, max)
+        int32 Range(int32 max) {
+            return max <= 1 ? 0 : (int32) (Next() % (uint32) max);
+        }
+
+        bool Percent(int32 percent) {
+            return Range(100) < percent;
+        }
+
+    };
+
+    // the same options and seed always give the same files, byte for byte
+    struct CorpusOptions {
+
+        int32 fileCount { 100 };
+        uint64 seed { 1 };
+
+        int32 classesPerFile { 4 };
+        int32 genericClassesPerFile { 1 };
+        int32 genericDepth { 2 }; // how deep generic arguments nest in field types, Box1<Box0<int>> is 2
+        int32 fieldsPerType { 8 };
+        int32 methodsPerType { 4 };
+        int32 statementsPerMethod { 8 };
+        int32 expressionDepth { 3 }; // of the binary operator trees in method bodies
+
+        // chance out of 100 per member / statement
+        int32 commentPercent { 20 };
+        int32 stringPercent { 15 };
+        int32 callPercent { 0 }; // a statement calls one of its type's methods, which reaches the overloads in the bases too
+
+        // the first class of every that many files is `export`, and so is its M0. 0 exports nothing
+        int32 exportInterval { 0 };
+
+    };
+
+    struct CorpusFile {
+        FixedCharSpan path;
+        FixedCharSpan contents;
+    };
+
+    // files only refer to types declared in themselves or in files before them, base classes form chains
+    // across files and generic fields nest instances of the generic classes of earlier files
+    struct Corpus {
+
+        PodList<CorpusFile> files;
+        size_t totalBytes;
+
+        Corpus();
+
+        ~Corpus();
+
+        Corpus(const Corpus&) = delete;
+        Corpus& operator=(const Corpus&) = delete;
+
+        void Generate(const CorpusOptions& options, const char* directory);
+
+        // writes every file below `directory` (which has to exist), returns false on the first failure
+        bool WriteToDisk(const char* directory);
+
+        void Clear();
+
+    };
+
+}
@@ -0,0 +1,453 @@
+#include "../Src/Compiler2/SourceFileInfo.h"
+#include "../Src/Compiler2/LoadBuiltIns.h"
+#include "../Src/Parsing3/Tokenizer.h"
+#include "../Src/Parsing3/Parser.h"
+#include "../Src/Parsing3/Parsing.h"
+#include "../Src/Parsing3/TextWindow.h"
+#include "../Src/Parsing3/NodePrinter.h"
+#include "../Src/Parsing3/FindSkippedTokens.h"
+#include "../Src/Util/Stopwatch.h"
+#include "./SyntaxGenerator.h"
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
+
+using namespace Alchemy;
+using namespace Alchemy::Compilation;
+
+// Throws generated programs and mutations of them (and of the built in sources) at the tokenizer and parser.
+// Generated programs have to parse without a diagnostic or a skipped token, anything at all has to parse without
+// crashing or hanging, every skipped token has to come with a diagnostic and parsing the same text twice has to
+// print the same tree. Every input is a function of --seed and its iteration, a failure prints the iteration and
+// `--dump <iteration>` writes that input to stdout so it can be replayed in a test.
+//
+//   parserfuzz [--iterations 5000] [--seed 1] [--mutations 4] [--timeout 10] [--dump <iteration>]
+//              [--types 3] [--members 6] [--statements 4] [--statement-depth 3] [--expression-depth 4]
+
+static const char* kFragments[] = {
+    "(", ")", "{", "}", "[", "]", "<", ">", ";", ",", ".", ":", "?", "=", "=>", "++", "!", "&&", "::", "..",
+    "class", "struct", "interface", "enum", "namespace", "using", "if", "else", "for", "foreach", "while", "do",
+    "switch", "case", "default", "return", "new", "this", "base", "var", "ref", "out", "in", "is", "as", "null",
+    "public", "static", "override", "where", "get", "set", "async", "await", "delegate", "operator",
+    "\"", "'", "$\"", "$\"{", "@\"", "\"\"\"", "/*", "//", "#", "@", "\\", "0x", "1e", "1.", "`", "\xc3\xa9"
+};
+
+// every mutation works on whole tokens of the text as it is right then
+enum class MutationKind {
+    Delete,
+    Duplicate,
+    Swap,
+    Insert,
+    Truncate,
+
+    Count
+};
+
+struct TokenSpan {
+    int32 start;
+    int32 end;
+};
+
+enum class InputKind {
+    Generated,
+    Mutated,
+
+    Count
+};
+
+static const char* kInputKindNames[] = { "generated", "mutated" };
+
+struct InputStats {
+    int32 count;
+    int64 bytes;
+    int64 tokens;
+    uint64 tokenizeNanoseconds;
+    uint64 parseNanoseconds;
+    int64 tokenizeAllocatedBytes;
+    int64 parseAllocatedBytes;
+};
+
+static std::atomic<int32> gIteration { -1 };
+static std::atomic<uint64> gIterationStart { 0 };
+static std::atomic<bool> gFinished { false };
+
+static uint64 NowNanoseconds() {
+    return (uint64) std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void WriteRaw(const char* text) {
+#if defined(_WIN32)
+    fputs(text, stderr);
+#else
+    ssize_t ignored = write(2, text, strlen(text));
+    (void) ignored;
+#endif
+}
+
+// only async signal safe calls in here
+static void OnCrash(int32 signal) {
+    char buffer[96];
+    int32 iteration = gIteration.load();
+    int32 length = 0;
+    char digits[16];
+    int32 digitCount = 0;
+    uint32 value = (uint32) (iteration < 0 ? 0 : iteration);
+    do {
+        digits[digitCount++] = (char) ('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+    const char* prefix = "\nparserfuzz: crashed on iteration ";
+    while (*prefix != 0) {
+        buffer[length++] = *prefix++;
+    }
+    while (digitCount != 0) {
+        buffer[length++] = digits[--digitCount];
+    }
+    buffer[length++] = '\n';
+    buffer[length] = 0;
+    WriteRaw(buffer);
+    std::signal(signal, SIG_DFL);
+    std::raise(signal);
+}
+
+static uint64 IterationSeed(uint64 seed, int32 iteration) {
+    // splitmix64 so neighbouring iterations don't start from neighbouring states
+    uint64 z = seed * 0x9e3779b97f4a7c15ull + (uint64) iteration + 1;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+// the scanner can peek one past the end
+static void Terminate(PodList<char>* text) {
+    text->EnsureCapacity(text->size + 1);
+    text->array[text->size] = '\0';
+}
+
+static void CollectTokenSpans(PodList<char>* text, PodList<TokenSpan>* spans) {
+
+    spans->size = 0;
+
+    // every mutation leaves the text unterminated
+    Terminate(text);
+
+    SourceFileInfo scratch;
+    TokenizerResult result = Tokenize(TextWindow(text->array, text->size), &scratch.diagnostics, &scratch.allocator);
+
+    for (int32 i = 0; i < result.tokens.size; i++) {
+        SyntaxToken token = result.tokens[i];
+        if (token.kind == TokenKind::Trivia || token.kind == TokenKind::EndOfFileToken || token.textSize == 0) {
+            continue;
+        }
+        int32 start = (int32) (result.texts[i] - text->array);
+        if (start < 0 || start + token.textSize > text->size) {
+            continue;
+        }
+        spans->Add(TokenSpan { start, start + token.textSize });
+    }
+
+}
+
+static void Splice(PodList<char>* text, int32 start, int32 removeCount, const char* insert, int32 insertCount) {
+    int32 tail = text->size - start - removeCount;
+    text->EnsureCapacity(text->size - removeCount + insertCount + 1);
+    memmove(text->array + start + insertCount, text->array + start + removeCount, tail);
+    memcpy(text->array + start, insert, insertCount);
+    text->size = text->size - removeCount + insertCount;
+}
+
+static void Mutate(PodList<char>* text, CorpusRandom* random, int32 mutationCount) {
+
+    PodList<TokenSpan> spans;
+    PodList<char> scratch;
+
+    for (int32 m = 0; m < mutationCount; m++) {
+
+        CollectTokenSpans(text, &spans);
+
+        if (spans.size == 0) {
+            break;
+        }
+
+        TokenSpan span = spans[random->Range(spans.size)];
+
+        switch ((MutationKind) random->Range((int32) MutationKind::Count)) {
+            case MutationKind::Delete: {
+                Splice(text, span.start, span.end - span.start, "", 0);
+                break;
+            }
+            case MutationKind::Duplicate: {
+                scratch.size = 0;
+                memcpy(scratch.Reserve(span.end - span.start), text->array + span.start, span.end - span.start);
+                scratch.Add(' ');
+                Splice(text, span.start, 0, scratch.array, scratch.size);
+                break;
+            }
+            case MutationKind::Swap: {
+                TokenSpan other = spans[random->Range(spans.size)];
+                if (other.start < span.start) {
+                    TokenSpan t = other;
+                    other = span;
+                    span = t;
+                }
+                if (other.start < span.end) {
+                    break;
+                }
+                // first | between | second becomes second | between | first
+                scratch.size = 0;
+                int32 firstLength = span.end - span.start;
+                int32 secondLength = other.end - other.start;
+                int32 betweenLength = other.start - span.end;
+                memcpy(scratch.Reserve(secondLength), text->array + other.start, secondLength);
+                memcpy(scratch.Reserve(betweenLength), text->array + span.end, betweenLength);
+                memcpy(scratch.Reserve(firstLength), text->array + span.start, firstLength);
+                memcpy(text->array + span.start, scratch.array, scratch.size);
+                break;
+            }
+            case MutationKind::Insert: {
+                const char* fragment = kFragments[random->Range(sizeof(kFragments) / sizeof(kFragments[0]))];
+                scratch.size = 0;
+                scratch.Add(' ');
+                memcpy(scratch.Reserve((int32) strlen(fragment)), fragment, strlen(fragment));
+                scratch.Add(' ');
+                Splice(text, random->Percent(50) ? span.start : span.end, 0, scratch.array, scratch.size);
+                break;
+            }
+            default: {
+                text->size = span.start + random->Range(span.end - span.start + 1);
+                break;
+            }
+        }
+
+    }
+
+    spans.Dispose();
+    scratch.Dispose();
+
+}
+
+// same seed & iteration, same bytes
+static InputKind MakeInput(uint64 seed, int32 iteration, const SyntaxOptions& options, CheckedArray<SourceFileInfo*> builtIns, int32 maxMutations, PodList<char>* text) {
+
+    CorpusRandom random(IterationSeed(seed, iteration));
+
+    text->size = 0;
+
+    InputKind kind = iteration % 4 == 0 ? InputKind::Generated : InputKind::Mutated;
+
+    if (kind == InputKind::Mutated && builtIns.size != 0 && random.Percent(20)) {
+        FixedCharSpan contents = builtIns[random.Range(builtIns.size)]->contents;
+        memcpy(text->Reserve((int32) contents.size), contents.ptr, contents.size);
+    }
+    else {
+        GenerateSyntax(options, &random, text);
+    }
+
+    if (kind == InputKind::Mutated) {
+        Mutate(text, &random, 1 + random.Range(maxMutations));
+    }
+
+    Terminate(text);
+
+    return kind;
+
+}
+
+struct ParseOutput {
+    int32 diagnosticCount;
+    int32 skippedCount;
+    int32 tokenCount;
+    uint64 tokenizeNanoseconds;
+    uint64 parseNanoseconds;
+    int64 tokenizeAllocatedBytes;
+    int64 parseAllocatedBytes;
+};
+
+static SyntaxBase* ParseText(SourceFileInfo* file, PodList<char>* text, ParseOutput* output) {
+
+    Stopwatch stopwatch;
+
+    file->tokenizerResult = Tokenize(TextWindow(text->array, text->size), &file->diagnostics, &file->allocator);
+    output->tokenizeNanoseconds = stopwatch.Lap();
+    output->tokenizeAllocatedBytes = (int64) file->allocator.offset;
+
+    Parser parser(file->tokenizerResult, &file->diagnostics, &file->allocator);
+    file->syntaxTree = ParseCompilationUnit(&parser);
+    output->parseNanoseconds = stopwatch.Lap();
+    output->parseAllocatedBytes = (int64) file->allocator.offset - output->tokenizeAllocatedBytes;
+
+    output->diagnosticCount = file->diagnostics.size;
+    output->tokenCount = file->tokenizerResult.tokens.size;
+
+    return file->syntaxTree;
+
+}
+
+static int32 CountSkippedTokens(TokenizerResult result, SyntaxBase* tree) {
+    FindSkippedTokens finder(result.tokens, tree);
+    int32 count = 0;
+    for (int32 i = 0; i < result.tokens.size; i++) {
+        SyntaxToken token = result.tokens[i];
+        if ((token.GetFlags() & SyntaxTokenFlags::Skipped) != 0 && token.kind != TokenKind::Trivia && token.kind != TokenKind::EndOfFileToken) {
+            count++;
+        }
+    }
+    return count;
+}
+
+static int32 ParseIntArg(int32 argc, char** argv, const char* name, int32 fallback) {
+    for (int32 i = 1; i < argc - 1; i++) {
+        if (strcmp(argv[i], name) == 0) {
+            return atoi(argv[i + 1]);
+        }
+    }
+    return fallback;
+}
+
+int32 main(int32 argc, char** argv) {
+
+    SyntaxOptions options;
+    options.typesPerFile = ParseIntArg(argc, argv, "--types", options.typesPerFile);
+    options.membersPerType = ParseIntArg(argc, argv, "--members", options.membersPerType);
+    options.statementsPerBlock = ParseIntArg(argc, argv, "--statements", options.statementsPerBlock);
+    options.statementDepth = ParseIntArg(argc, argv, "--statement-depth", options.statementDepth);
+    options.expressionDepth = ParseIntArg(argc, argv, "--expression-depth", options.expressionDepth);
+
+    int32 iterations = ParseIntArg(argc, argv, "--iterations", 5000);
+    uint64 seed = (uint64) ParseIntArg(argc, argv, "--seed", 1);
+    int32 maxMutations = ParseIntArg(argc, argv, "--mutations", 4);
+    int32 timeoutSeconds = ParseIntArg(argc, argv, "--timeout", 10);
+    int32 dumpIteration = ParseIntArg(argc, argv, "--dump", -1);
+
+    maxMutations = maxMutations < 1 ? 1 : maxMutations;
+
+    PoolAllocator<SourceFileInfo> builtInAllocator;
+    PodList<SourceFileInfo*> builtIns;
+    LoadBuiltInSources(&builtIns, &builtInAllocator);
+
+    PodList<char> text;
+
+    if (dumpIteration >= 0) {
+        MakeInput(seed, dumpIteration, options, builtIns.ToCheckedArray(), maxMutations, &text);
+        fwrite(text.array, 1, text.size, stdout);
+        return 0;
+    }
+
+    std::signal(SIGSEGV, OnCrash);
+    std::signal(SIGABRT, OnCrash);
+    std::signal(SIGFPE, OnCrash);
+    std::signal(SIGILL, OnCrash);
+
+    // a parser that stops making progress never returns, nothing inside it can notice
+    std::thread watchdog([timeoutSeconds]() {
+        while (!gFinished.load()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            uint64 start = gIterationStart.load();
+            if (start != 0 && NowNanoseconds() - start > (uint64) timeoutSeconds * 1000000000ull) {
+                fprintf(stderr, "\nparserfuzz: iteration %d took longer than %ds\n", gIteration.load(), timeoutSeconds);
+                abort();
+            }
+        }
+    });
+
+    InputStats stats[(int32) InputKind::Count] = {};
+    int32 failureCount = 0;
+
+    for (int32 i = 0; i < iterations; i++) {
+
+        InputKind kind = MakeInput(seed, i, options, builtIns.ToCheckedArray(), maxMutations, &text);
+
+        gIteration.store(i);
+        gIterationStart.store(NowNanoseconds());
+
+        SourceFileInfo first;
+        SourceFileInfo second;
+        ParseOutput output {};
+        ParseOutput secondOutput {};
+
+        SyntaxBase* tree = ParseText(&first, &text, &output);
+        SyntaxBase* secondTree = ParseText(&second, &text, &secondOutput);
+
+        output.skippedCount = CountSkippedTokens(first.tokenizerResult, tree);
+
+        NodePrinter printer(first.tokenizerResult, TreePrintOptions::PrintSkippedTokens);
+        NodePrinter secondPrinter(second.tokenizerResult, TreePrintOptions::PrintSkippedTokens);
+        printer.PrintTree(tree);
+        secondPrinter.PrintTree(secondTree);
+
+        gIterationStart.store(0);
+
+        const char* failure = nullptr;
+
+        if (kind == InputKind::Generated && output.diagnosticCount != 0) {
+            failure = "a generated input has diagnostics";
+        }
+        else if (kind == InputKind::Generated && output.skippedCount != 0) {
+            failure = "a generated input has skipped tokens";
+        }
+        else if (output.skippedCount != 0 && output.diagnosticCount == 0) {
+            failure = "tokens were skipped without a diagnostic";
+        }
+        else if (printer.buffer.size != secondPrinter.buffer.size || memcmp(printer.buffer.array, secondPrinter.buffer.array, printer.buffer.size) != 0) {
+            failure = "parsing the same text twice printed different trees";
+        }
+
+        if (failure != nullptr) {
+            failureCount++;
+            fprintf(stderr, "iteration %d (%s): %s, %d diagnostics, %d skipped tokens\n", i, kInputKindNames[(int32) kind], failure, output.diagnosticCount, output.skippedCount);
+        }
+
+        InputStats* s = &stats[(int32) kind];
+        s->count++;
+        s->bytes += text.size;
+        s->tokens += output.tokenCount;
+        s->tokenizeNanoseconds += output.tokenizeNanoseconds;
+        s->parseNanoseconds += output.parseNanoseconds;
+        s->tokenizeAllocatedBytes += output.tokenizeAllocatedBytes;
+        s->parseAllocatedBytes += output.parseAllocatedBytes;
+
+        first.Invalidate();
+        second.Invalidate();
+
+    }
+
+    gFinished.store(true);
+    watchdog.join();
+
+    printf("%d iterations, seed %llu\n\n", iterations, (unsigned long long) seed);
+    printf("  %-10s %8s %10s %12s %14s %14s %16s %16s\n", "input", "count", "MB", "tokens", "tokenize MB/s", "parse MB/s", "tokenize B/MB", "parse B/MB");
+
+    for (int32 k = 0; k < (int32) InputKind::Count; k++) {
+        InputStats* s = &stats[k];
+        double megabytes = s->bytes / (1024.0 * 1024.0);
+        double tokenizeSeconds = s->tokenizeNanoseconds == 0 ? 1e-9 : s->tokenizeNanoseconds / 1e9;
+        double parseSeconds = s->parseNanoseconds == 0 ? 1e-9 : s->parseNanoseconds / 1e9;
+        double perMegabyte = megabytes == 0 ? 0 : 1 / megabytes;
+        printf("  %-10s %8d %10.2f %12lld %14.1f %14.1f %16.0f %16.0f\n",
+            kInputKindNames[k],
+            s->count,
+            megabytes,
+            (long long) s->tokens,
+            megabytes / tokenizeSeconds,
+            megabytes / parseSeconds,
+            s->tokenizeAllocatedBytes * perMegabyte,
+            s->parseAllocatedBytes * perMegabyte
+        );
+    }
+
+    printf("\n%d failure%s\n", failureCount, failureCount == 1 ? "" : "s");
+
+    text.Dispose();
+    builtIns.Dispose();
+
+    return failureCount == 0 ? 0 : 1;
+
+}
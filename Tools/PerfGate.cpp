@@ -0,0 +1,449 @@
+#include "../Src/Compiler2/Compiler.h"
+#include "../Src/Compiler2/SourceFileInfo.h"
+#include "../Src/Parsing3/Tokenizer.h"
+#include "../Src/Parsing3/Parser.h"
+#include "../Src/Parsing3/Parsing.h"
+#include "../Src/Parsing3/TextWindow.h"
+#include "../Src/Util/StringTable.h"
+#include "../Src/Util/Stopwatch.h"
+#include "./CorpusGenerator.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
+
+using namespace Alchemy;
+using namespace Alchemy::Compilation;
+
+// Times the kernels everything else sits on, one at a time, and checks them against a baseline json. Every number is
+// nanoseconds per op (see kKernelUnits for what an op is) and the best of --runs. Timings from two machines can't be
+// compared, so --compare only fails when the baseline was written on this host with the same thread count; a kernel
+// fails when it got slower than the baseline by more than --threshold percent.
+//
+//   perfgate [--baseline Tests/PerfBaseline.json] [--write] [--compare] [--threshold 15] [--runs 7]
+//            [--files 200] [--seed 1] [--workers <hardware threads>]
+
+enum class Kernel {
+    Tokenize,
+    Parse,
+    Resolve,
+    MakeGenericType,
+    Intern,
+    ExecuteEmptyJob,
+    ForeachEmptyJob,
+
+    Count
+};
+
+static const char* kKernelNames[] = { "tokenize", "parse", "resolve", "makeGenericType", "intern", "executeEmptyJob", "foreachEmptyJob" };
+static const char* kKernelUnits[] = { "KB", "KB", "lookup", "call", "call", "execute", "item" };
+
+static_assert(sizeof(kKernelNames) / sizeof(kKernelNames[0]) == (int32) Kernel::Count);
+static_assert(sizeof(kKernelUnits) / sizeof(kKernelUnits[0]) == (int32) Kernel::Count);
+
+struct EmptyJob : Jobs::IJob {
+
+    void Execute() override {}
+
+    void Execute(int32 idx) override {}
+
+};
+
+struct GenericRequest {
+    TypeInfo* openType;
+    int32 argumentStart;
+};
+
+struct Baseline {
+    char machine[256];
+    int32 threads;
+    int32 files;
+    int32 seed;
+    double nanosecondsPerOp[(int32) Kernel::Count];
+};
+
+static void MinInto(double* best, double value) {
+    if (*best == 0 || value < *best) {
+        *best = value;
+    }
+}
+
+static int32 ParseIntArg(int32 argc, char** argv, const char* name, int32 fallback) {
+    for (int32 i = 1; i < argc - 1; i++) {
+        if (strcmp(argv[i], name) == 0) {
+            return atoi(argv[i + 1]);
+        }
+    }
+    return fallback;
+}
+
+static const char* ParseStringArg(int32 argc, char** argv, const char* name, const char* fallback) {
+    for (int32 i = 1; i < argc - 1; i++) {
+        if (strcmp(argv[i], name) == 0) {
+            return argv[i + 1];
+        }
+    }
+    return fallback;
+}
+
+static bool HasFlag(int32 argc, char** argv, const char* name) {
+    for (int32 i = 1; i < argc; i++) {
+        if (strcmp(argv[i], name) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void GetMachineName(char* buffer, int32 capacity) {
+#if defined(_WIN32)
+    const char* name = getenv("COMPUTERNAME");
+    snprintf(buffer, capacity, "%s", name != nullptr ? name : "unknown");
+#else
+    if (gethostname(buffer, capacity) != 0) {
+        snprintf(buffer, capacity, "unknown");
+    }
+    buffer[capacity - 1] = '\0';
+#endif
+}
+
+static bool WriteBaseline(const char* path, const Baseline& baseline) {
+
+    FILE* file = fopen(path, "wb");
+
+    if (file == nullptr) {
+        return false;
+    }
+
+    fprintf(file, "{\n");
+    fprintf(file, "  \"machine\": \"%s\",\n", baseline.machine);
+    fprintf(file, "  \"threads\": %d,\n", baseline.threads);
+    fprintf(file, "  \"files\": %d,\n", baseline.files);
+    fprintf(file, "  \"seed\": %d,\n", baseline.seed);
+    fprintf(file, "  \"nanosecondsPerOp\": {\n");
+    for (int32 k = 0; k < (int32) Kernel::Count; k++) {
+        fprintf(file, "    \"%s\": %.3f%s\n", kKernelNames[k], baseline.nanosecondsPerOp[k], k == (int32) Kernel::Count - 1 ? "" : ",");
+    }
+    fprintf(file, "  }\n");
+    fprintf(file, "}\n");
+
+    fclose(file);
+    return true;
+
+}
+
+// only reads what WriteBaseline writes, the keys are looked up by name so reordering them by hand is fine
+static const char* FindJsonValue(const char* json, const char* key) {
+    char quoted[64];
+    snprintf(quoted, sizeof(quoted), "\"%s\":", key);
+    const char* p = strstr(json, quoted);
+    return p == nullptr ? nullptr : p + strlen(quoted);
+}
+
+static bool ReadBaseline(const char* path, Baseline* baseline) {
+
+    FILE* file = fopen(path, "rb");
+
+    if (file == nullptr) {
+        return false;
+    }
+
+    char json[4096];
+    size_t size = fread(json, 1, sizeof(json) - 1, file);
+    json[size] = '\0';
+    fclose(file);
+
+    const char* machine = FindJsonValue(json, "machine");
+    const char* threads = FindJsonValue(json, "threads");
+    const char* files = FindJsonValue(json, "files");
+    const char* seed = FindJsonValue(json, "seed");
+    const char* kernels = FindJsonValue(json, "nanosecondsPerOp");
+
+    if (machine == nullptr || threads == nullptr || files == nullptr || seed == nullptr || kernels == nullptr) {
+        return false;
+    }
+
+    machine = strchr(machine, '"');
+    const char* machineEnd = machine == nullptr ? nullptr : strchr(machine + 1, '"');
+
+    if (machineEnd == nullptr || machineEnd - machine - 1 >= (int32) sizeof(baseline->machine)) {
+        return false;
+    }
+
+    memcpy(baseline->machine, machine + 1, machineEnd - machine - 1);
+    baseline->machine[machineEnd - machine - 1] = '\0';
+    baseline->threads = atoi(threads);
+    baseline->files = atoi(files);
+    baseline->seed = atoi(seed);
+
+    for (int32 k = 0; k < (int32) Kernel::Count; k++) {
+        const char* value = FindJsonValue(kernels, kKernelNames[k]);
+        baseline->nanosecondsPerOp[k] = value == nullptr ? 0 : strtod(value, nullptr);
+    }
+
+    return true;
+
+}
+
+int32 main(int32 argc, char** argv) {
+
+    CorpusOptions options;
+    options.fileCount = ParseIntArg(argc, argv, "--files", 200);
+    options.seed = (uint64) ParseIntArg(argc, argv, "--seed", 1);
+
+    int32 runs = ParseIntArg(argc, argv, "--runs", 7);
+    int32 threshold = ParseIntArg(argc, argv, "--threshold", 15);
+    int32 workers = ParseIntArg(argc, argv, "--workers", (int32) std::thread::hardware_concurrency());
+    const char* baselinePath = ParseStringArg(argc, argv, "--baseline", "Tests/PerfBaseline.json");
+    bool write = HasFlag(argc, argv, "--write");
+    bool compare = HasFlag(argc, argv, "--compare");
+
+    runs = runs < 1 ? 1 : runs;
+    workers = workers < 1 ? 1 : workers;
+
+    Baseline current {};
+    GetMachineName(current.machine, sizeof(current.machine));
+    current.threads = (int32) std::thread::hardware_concurrency();
+    current.files = options.fileCount;
+    current.seed = (int32) options.seed;
+
+    Baseline baseline {};
+
+    if (compare) {
+        if (!ReadBaseline(baselinePath, &baseline)) {
+            fprintf(stderr, "failed to read a baseline from %s\n", baselinePath);
+            return 1;
+        }
+        if (baseline.files != current.files || baseline.seed != current.seed) {
+            fprintf(stderr, "the baseline was written with --files %d --seed %d\n", baseline.files, baseline.seed);
+            return 1;
+        }
+    }
+
+    Corpus corpus;
+    corpus.Generate(options, "corpus");
+
+    SourceFileInfo** fileBuffer = MallocateTyped(SourceFileInfo*, corpus.files.size);
+    CheckedArray<SourceFileInfo*> files(fileBuffer, corpus.files.size);
+
+    for (int32 i = 0; i < files.size; i++) {
+        files[i] = new SourceFileInfo();
+        files[i]->path = corpus.files[i].path;
+    }
+
+    double* best = current.nanosecondsPerOp;
+    double kilobytes = corpus.totalBytes / 1024.0;
+
+    for (int32 r = 0; r < runs; r++) {
+
+        for (int32 i = 0; i < files.size; i++) {
+            files[i]->Invalidate();
+            files[i]->contents = corpus.files[i].contents;
+        }
+
+        Stopwatch stopwatch;
+        for (int32 i = 0; i < files.size; i++) {
+            SourceFileInfo* file = files[i];
+            file->tokenizerResult = Tokenize(TextWindow(file->contents.ptr, file->contents.size), &file->diagnostics, &file->allocator);
+        }
+        MinInto(&best[(int32) Kernel::Tokenize], stopwatch.Lap() / kilobytes);
+
+        for (int32 i = 0; i < files.size; i++) {
+            SourceFileInfo* file = files[i];
+            Parser parser(file->tokenizerResult, &file->diagnostics, &file->allocator);
+            file->syntaxTree = ParseCompilationUnit(&parser);
+        }
+        MinInto(&best[(int32) Kernel::Parse], stopwatch.Lap() / kilobytes);
+
+    }
+
+    // the token texts live in the file allocators, which hold on to them until the next Invalidate
+    PodList<FixedCharSpan> identifiers;
+    for (int32 i = 0; i < files.size; i++) {
+        TokenizerResult result = files[i]->tokenizerResult;
+        for (int32 t = 0; t < result.tokens.size; t++) {
+            if (result.tokens[t].kind == TokenKind::IdentifierToken) {
+                identifiers.Add(result.tokens[t].GetText(result.texts));
+            }
+        }
+    }
+
+    // one pass that fills a fresh table and a few that only find what's there, most names a build interns it has seen before
+    constexpr int32 kInternPasses = 16;
+
+    for (int32 r = 0; r < runs; r++) {
+        StringTable stringTable(Allocator::MakeMallocator(), 128);
+        Stopwatch stopwatch;
+        for (int32 pass = 0; pass < kInternPasses; pass++) {
+            for (int32 i = 0; i < identifiers.size; i++) {
+                stringTable.Intern(identifiers[i]);
+            }
+        }
+        MinInto(&best[(int32) Kernel::Intern], (double) stopwatch.Lap() / (identifiers.size == 0 ? 1 : identifiers.size * kInternPasses));
+    }
+
+    {
+        FixedCharSpan package("Corpus");
+        PackageInfo packageInfo;
+        packageInfo.packageName = package;
+        packageInfo.absolutePath = FixedCharSpan("corpus/");
+
+        Compiler compiler(0, FileSystemType::Virtual);
+
+        for (int32 i = 0; i < corpus.files.size; i++) {
+            compiler.vfs.AddFile(VirtualFileInfo(package, corpus.files[i].path), corpus.files[i].contents);
+        }
+
+        compiler.Compile(CheckedArray<PackageInfo>(&packageInfo, 1));
+
+        TypeResolutionMap* resolveMap = &compiler.resolveMap;
+        CheckedArray<TypeInfo*> values = resolveMap->GetValues(Allocator::MakeMallocator());
+
+        PodList<FixedCharSpan> names;
+        PodList<GenericRequest> genericRequests;
+        PodList<ResolvedType> genericArguments;
+        PodList<TypeInfo*> argumentTypes;
+
+        for (int32 i = 0; i < resolveMap->builtInTypeInfos.size; i++) {
+            TypeInfo* typeInfo = resolveMap->builtInTypeInfos[i];
+            if (typeInfo != nullptr && !typeInfo->IsGenericTypeDefinition()) {
+                argumentTypes.Add(typeInfo);
+            }
+        }
+
+        for (int32 i = 0; i < values.size; i++) {
+            TypeInfo* resolved = nullptr;
+            FixedCharSpan name = values[i]->GetFullyQualifiedTypeName();
+            if (resolveMap->TryResolve(name, &resolved)) {
+                names.Add(name);
+            }
+            if (values[i]->IsGenericTypeDefinition() && values[i]->genericDefinition == nullptr && argumentTypes.size != 0) {
+                genericRequests.Add(GenericRequest { values[i], genericArguments.size });
+                for (int32 a = 0; a < values[i]->genericArgumentCount; a++) {
+                    genericArguments.Add(ResolvedType(argumentTypes[(i + a) % argumentTypes.size]));
+                }
+            }
+        }
+
+        // the first call makes each instance, the timed ones find it again, which is what nearly every call in a build does
+        for (int32 i = 0; i < genericRequests.size; i++) {
+            GenericRequest request = genericRequests[i];
+            resolveMap->MakeGenericType(request.openType, CheckedArray<ResolvedType>(genericArguments.array + request.argumentStart, request.openType->genericArgumentCount));
+        }
+
+        int32 resolveRepeats = names.size == 0 ? 0 : 1 + 1000000 / names.size;
+        int32 genericRepeats = genericRequests.size == 0 ? 0 : 1 + 100000 / genericRequests.size;
+
+        for (int32 r = 0; r < runs; r++) {
+
+            Stopwatch stopwatch;
+            int32 found = 0;
+            for (int32 repeat = 0; repeat < resolveRepeats; repeat++) {
+                for (int32 i = 0; i < names.size; i++) {
+                    TypeInfo* resolved = nullptr;
+                    found += resolveMap->TryResolve(names[i], &resolved);
+                }
+            }
+            MinInto(&best[(int32) Kernel::Resolve], (double) stopwatch.Lap() / (found == 0 ? 1 : found));
+
+            for (int32 repeat = 0; repeat < genericRepeats; repeat++) {
+                for (int32 i = 0; i < genericRequests.size; i++) {
+                    GenericRequest request = genericRequests[i];
+                    resolveMap->MakeGenericType(request.openType, CheckedArray<ResolvedType>(genericArguments.array + request.argumentStart, request.openType->genericArgumentCount));
+                }
+            }
+            int32 calls = genericRepeats * genericRequests.size;
+            MinInto(&best[(int32) Kernel::MakeGenericType], (double) stopwatch.Lap() / (calls == 0 ? 1 : calls));
+
+        }
+
+        Allocator::MakeMallocator().Free(values.array, values.size);
+        compiler.jobSystem.Shutdown();
+    }
+
+    {
+        // the job system counts the calling thread as one of its workers
+        Jobs::JobSystem jobSystem(workers - 1);
+
+        constexpr int32 kExecuteCount = 2000;
+        constexpr int32 kForeachCount = 200000;
+
+        for (int32 r = 0; r < runs; r++) {
+
+            Stopwatch stopwatch;
+            for (int32 i = 0; i < kExecuteCount; i++) {
+                jobSystem.Execute(EmptyJob());
+            }
+            MinInto(&best[(int32) Kernel::ExecuteEmptyJob], (double) stopwatch.Lap() / kExecuteCount);
+
+            jobSystem.Execute(Jobs::Parallel::Foreach(kForeachCount), EmptyJob());
+            MinInto(&best[(int32) Kernel::ForeachEmptyJob], (double) stopwatch.Lap() / kForeachCount);
+
+        }
+
+        jobSystem.Shutdown();
+    }
+
+    for (int32 i = 0; i < files.size; i++) {
+        files[i]->Invalidate();
+        delete files[i];
+    }
+
+    MfreeTyped(fileBuffer, corpus.files.size);
+
+    printf("%d files, %.2f MB, seed %llu, best of %d runs, %s\n", corpus.files.size, corpus.totalBytes / (1024.0 * 1024.0), (unsigned long long) options.seed, runs, current.machine);
+
+    bool sameMachine = compare && baseline.threads == current.threads && strcmp(baseline.machine, current.machine) == 0;
+    int32 regressionCount = 0;
+
+    if (compare) {
+        printf("\n  %-18s %12s %12s %9s\n", "kernel", "ns/op", "baseline", "change");
+    }
+    else {
+        printf("\n  %-18s %12s   %s\n", "kernel", "ns/op", "op");
+    }
+
+    for (int32 k = 0; k < (int32) Kernel::Count; k++) {
+
+        if (!compare) {
+            printf("  %-18s %12.3f   %s\n", kKernelNames[k], best[k], kKernelUnits[k]);
+            continue;
+        }
+
+        if (baseline.nanosecondsPerOp[k] == 0) {
+            printf("  %-18s %12.3f %12s\n", kKernelNames[k], best[k], "-");
+            continue;
+        }
+
+        double change = (best[k] - baseline.nanosecondsPerOp[k]) * 100.0 / baseline.nanosecondsPerOp[k];
+        bool regressed = change > threshold;
+        regressionCount += regressed;
+        printf("  %-18s %12.3f %12.3f %+8.1f%%%s\n", kKernelNames[k], best[k], baseline.nanosecondsPerOp[k], change, regressed ? "  REGRESSED" : "");
+
+    }
+
+    if (write) {
+        if (!WriteBaseline(baselinePath, current)) {
+            fprintf(stderr, "failed to write the baseline to %s\n", baselinePath);
+            return 1;
+        }
+        printf("\nwrote %s\n", baselinePath);
+    }
+
+    if (compare && !sameMachine) {
+        printf("\nthe baseline comes from %s (%d threads), nothing fails on another machine\n", baseline.machine, baseline.threads);
+        return 0;
+    }
+
+    if (regressionCount != 0) {
+        printf("\n%d kernel%s regressed by more than %d%%\n", regressionCount, regressionCount == 1 ? "" : "s", threshold);
+        return 1;
+    }
+
+    return 0;
+
+}
@@ -0,0 +1,818 @@
+#include "./SyntaxGenerator.h"
+#include <cstdio>
+#include <cstring>
+
+namespace Alchemy::Compilation {
+
+    static const char* kPredefinedTypes[] = { "int", "float", "double", "bool", "string", "long", "char", "byte", "object", "uint", "short" };
+
+    static const char* kNames[] = {
+        "alpha", "bravo", "charlie", "delta", "echo", "foxtrot", "golf", "hotel", "india", "juliet", "kilo", "lima",
+        "mike", "november", "oscar", "papa", "quebec", "romeo", "sierra", "tango", "uniform", "victor", "whiskey"
+    };
+
+    static const char* kTypeNames[] = { "List", "Map", "Node", "Vector", "Buffer", "Handle", "Entry", "Cursor" };
+
+    static const char* kArithmeticOperators[] = { " + ", " - ", " * ", " / ", " % ", " & ", " | ", " ^ ", " << ", " >> ", " && ", " || ", " == ", " != ", " ?? " };
+
+    // their operands are always parenthesized or leaves, `a < b > (c)` would be read as a generic name
+    static const char* kRelationalOperators[] = { " < ", " > ", " <= ", " >= " };
+
+    static const char* kAssignmentOperators[] = { " = ", " += ", " -= ", " *= ", " /= ", " |= ", " &= ", " ^= ", " <<= ", " ?\?= " };
+
+    static const char* kUnaryOperators[] = { "-", "!", "~", "+" };
+
+    static const char* kModifiers[] = { "public ", "private ", "protected ", "internal ", "" };
+
+    struct SyntaxWriter {
+
+        PodList<char>* output;
+        CorpusRandom* random;
+        const SyntaxOptions* options;
+
+        int32 indent;
+        int32 nameCounter;
+
+        void Write(const char* text) {
+            size_t length = strlen(text);
+            memcpy(output->Reserve((int32) length), text, length);
+        }
+
+        void Write(const char* format, int32 a) {
+            char buffer[128];
+            int32 length = snprintf(buffer, sizeof(buffer), format, a);
+            memcpy(output->Reserve(length), buffer, length);
+        }
+
+        template<int32 N>
+        void WritePick(const char* (&table)[N]) {
+            Write(table[random->Range(N)]);
+        }
+
+        void WriteIndent() {
+            for (int32 i = 0; i < indent; i++) {
+                Write("    ");
+            }
+        }
+
+        void WriteLine(const char* text) {
+            WriteIndent();
+            Write(text);
+            Write("\n");
+        }
+
+        void WriteIdentifier() {
+            WritePick(kNames);
+            if (random->Percent(30)) {
+                Write("%d", random->Range(100));
+            }
+        }
+
+        // a fresh one, for declarations that shouldn't collide
+        void WriteDeclaredIdentifier(const char* prefix) {
+            Write(prefix);
+            Write("%d", nameCounter++);
+        }
+
+        void WriteTypeName() {
+            WritePick(kTypeNames);
+            if (random->Percent(30)) {
+                Write("%d", random->Range(10));
+            }
+        }
+
+        // type : base_type '?'?, array types aren't part of the language, Array<T> is
+        void WriteType(int32 depth, bool allowNullable = true) {
+
+            int32 pick = random->Range(depth <= 0 ? 2 : 4);
+
+            if (pick == 0) {
+                WritePick(kPredefinedTypes);
+            }
+            else if (pick == 1) {
+                WriteTypeName();
+            }
+            else if (pick == 2) {
+                WriteTypeName();
+                WriteTypeArgumentList(depth - 1);
+            }
+            else {
+                WriteTypeName();
+                Write(".");
+                WriteTypeName();
+            }
+
+            if (allowNullable && random->Percent(10)) {
+                Write("?");
+            }
+
+        }
+
+        // type_argument_list : '<' type ( ',' type)* '>'
+        void WriteTypeArgumentList(int32 depth) {
+            Write("<");
+            int32 count = 1 + random->Range(3);
+            for (int32 i = 0; i < count; i++) {
+                Write(i == 0 ? "" : ", ");
+                WriteType(depth, false);
+            }
+            Write(">");
+        }
+
+        void WriteLiteral() {
+            switch (random->Range(10)) {
+                case 0: Write("%d", random->Range(100000)); break;
+                case 1: Write("%d.5f", random->Range(100)); break;
+                case 2: Write("%d.25", random->Range(100)); break;
+                case 3: Write("0x%x", random->Range(0xffff)); break;
+                case 4: Write(random->Percent(50) ? "true" : "false"); break;
+                case 5: Write("null"); break;
+                case 6: Write("'%c'", 'a' + random->Range(26)); break;
+                case 7: {
+                    Write("\"");
+                    WritePick(kNames);
+                    Write(random->Percent(30) ? "\\n\"" : "\"");
+                    break;
+                }
+                case 8: {
+                    // raw strings can hold lone quotes, the closing run has to match the opening one
+                    Write("\"\"\"");
+                    WritePick(kNames);
+                    Write(random->Percent(30) ? " \"quoted\" $" : " ");
+                    WritePick(kNames);
+                    Write("\"\"\"");
+                    break;
+                }
+                default: Write("%dL", random->Range(1000)); break;
+            }
+        }
+
+        // argument_list : argument ( ',' argument)*
+        void WriteArgumentList(int32 depth) {
+            int32 count = random->Range(4);
+            for (int32 i = 0; i < count; i++) {
+                Write(i == 0 ? "" : ", ");
+                if (random->Percent(10)) {
+                    Write(random->Percent(50) ? "ref " : "out ");
+                    WriteIdentifier();
+                }
+                else {
+                    WriteExpression(depth);
+                }
+            }
+        }
+
+        // primary_expression_start followed by any number of member accesses, calls and indexers
+        void WritePrimaryExpression(int32 depth) {
+
+            if (depth <= 0) {
+                if (random->Percent(60)) {
+                    WriteIdentifier();
+                }
+                else {
+                    WriteLiteral();
+                }
+                return;
+            }
+
+            bool parenthesized = false;
+
+            switch (random->Range(9)) {
+                case 0: {
+                    WriteIdentifier();
+                    break;
+                }
+                case 1: {
+                    Write("this");
+                    break;
+                }
+                case 2: {
+                    // object_creation_expression
+                    Write("new ");
+                    WriteTypeName();
+                    if (random->Percent(30)) {
+                        WriteTypeArgumentList(1);
+                    }
+                    Write("(");
+                    WriteArgumentList(depth - 1);
+                    Write(")");
+                    return;
+                }
+                case 3: {
+                    Write("base.");
+                    WriteIdentifier();
+                    break;
+                }
+                case 4: {
+                    Write("typeof(");
+                    WriteType(1);
+                    Write(")");
+                    return;
+                }
+                case 5: {
+                    Write("default(");
+                    WriteType(1);
+                    Write(")");
+                    return;
+                }
+                case 6: {
+                    Write("(");
+                    WriteExpression(depth - 1);
+                    Write(")");
+                    parenthesized = true;
+                    break;
+                }
+                case 7: {
+                    // a predefined type is only an expression when something is accessed on it
+                    WritePick(kPredefinedTypes);
+                    Write(".");
+                    WriteIdentifier();
+                    break;
+                }
+                default: {
+                    WriteLiteral();
+                    return;
+                }
+            }
+
+            int32 postfixCount = random->Range(3);
+
+            for (int32 i = 0; i < postfixCount; i++) {
+                // `(a)(b)` is a cast, not a call
+                switch (parenthesized && i == 0 ? 0 : random->Range(3)) {
+                    case 0: {
+                        Write(".");
+                        WriteIdentifier();
+                        break;
+                    }
+                    case 1: {
+                        Write("(");
+                        WriteArgumentList(depth - 1);
+                        Write(")");
+                        break;
+                    }
+                    default: {
+                        Write("[");
+                        WriteExpression(depth - 1);
+                        Write("]");
+                        break;
+                    }
+                }
+            }
+
+        }
+
+        void WriteParenthesized(int32 depth) {
+            if (depth <= 0) {
+                WritePrimaryExpression(0);
+                return;
+            }
+            Write("(");
+            WriteExpression(depth);
+            Write(")");
+        }
+
+        // everything from conditional_expression down, anything compound is parenthesized where precedence or
+        // the generic name ambiguity could make it read differently
+        void WriteExpression(int32 depth) {
+
+            if (depth <= 0) {
+                WritePrimaryExpression(0);
+                return;
+            }
+
+            switch (random->Range(9)) {
+                case 0:
+                case 1: {
+                    WriteExpression(depth - 1 - random->Range(2));
+                    WritePick(kArithmeticOperators);
+                    WriteExpression(depth - 1);
+                    break;
+                }
+                case 2: {
+                    WriteParenthesized(depth - 1);
+                    WritePick(kRelationalOperators);
+                    WriteParenthesized(depth - 1);
+                    break;
+                }
+                case 3: {
+                    // unary_expression, the space keeps `- -a` from becoming a decrement
+                    WritePick(kUnaryOperators);
+                    Write(" ");
+                    WriteParenthesized(depth - 1);
+                    break;
+                }
+                case 4: {
+                    // cast_expression
+                    Write("(");
+                    WritePick(kPredefinedTypes);
+                    Write(")");
+                    WriteParenthesized(depth - 1);
+                    break;
+                }
+                case 5: {
+                    Write("(");
+                    WriteParenthesized(depth - 1);
+                    Write(" ? ");
+                    WriteExpression(depth - 1);
+                    Write(" : ");
+                    WriteExpression(depth - 1);
+                    Write(")");
+                    break;
+                }
+                case 6: {
+                    Write("(");
+                    WritePrimaryExpression(depth - 1);
+                    Write(random->Percent(50) ? " is " : " as ");
+                    WriteTypeName();
+                    Write(")");
+                    break;
+                }
+                case 7: {
+                    // strings interpolate ${expression} and $identifier, there is no $"" prefix
+                    Write("\"");
+                    WritePick(kNames);
+                    Write(" ${");
+                    WriteExpression(depth - 1);
+                    Write("} $");
+                    WritePick(kNames);
+                    Write("\"");
+                    break;
+                }
+                default: {
+                    WritePrimaryExpression(depth);
+                    break;
+                }
+            }
+
+        }
+
+        // the expressions C# allows as a statement
+        void WriteStatementExpression() {
+            switch (random->Range(4)) {
+                case 0: {
+                    WriteIdentifier();
+                    WritePick(kAssignmentOperators);
+                    WriteExpression(options->expressionDepth);
+                    break;
+                }
+                case 1: {
+                    WriteIdentifier();
+                    Write(".");
+                    WriteIdentifier();
+                    Write("(");
+                    WriteArgumentList(options->expressionDepth - 1);
+                    Write(")");
+                    break;
+                }
+                case 2: {
+                    WriteIdentifier();
+                    Write(random->Percent(50) ? "++" : "--");
+                    break;
+                }
+                default: {
+                    Write(random->Percent(50) ? "++" : "--");
+                    WriteIdentifier();
+                    break;
+                }
+            }
+        }
+
+        void WriteCondition() {
+            WriteParenthesized(options->expressionDepth - 1);
+            WritePick(kRelationalOperators);
+            WriteParenthesized(options->expressionDepth - 1);
+        }
+
+        // block : OPEN_BRACE statement_list? CLOSE_BRACE, the open brace goes on the current line
+        void WriteBlock(int32 depth) {
+            Write("{\n");
+            indent++;
+            int32 count = random->Range(options->statementsPerBlock + 1);
+            for (int32 i = 0; i < count; i++) {
+                WriteStatement(depth);
+            }
+            indent--;
+            WriteIndent();
+            Write("}");
+        }
+
+        void WriteLocalVariableDeclaration() {
+            // var is a keyword but local declarations don't take it yet
+            WriteType(2);
+            Write(" ");
+            WriteDeclaredIdentifier("local");
+            Write(" = ");
+            WriteExpression(options->expressionDepth);
+        }
+
+        void WriteStatement(int32 depth) {
+
+            WriteIndent();
+
+            int32 pick = random->Range(depth <= 0 ? 3 : 14);
+
+            switch (pick) {
+                case 0: {
+                    WriteLocalVariableDeclaration();
+                    Write(";\n");
+                    return;
+                }
+                case 1: {
+                    WriteStatementExpression();
+                    Write(";\n");
+                    return;
+                }
+                case 2: {
+                    Write("return");
+                    if (random->Percent(70)) {
+                        Write(" ");
+                        WriteExpression(options->expressionDepth);
+                    }
+                    Write(";\n");
+                    return;
+                }
+                case 3: {
+                    Write("if (");
+                    WriteCondition();
+                    Write(") ");
+                    WriteBlock(depth - 1);
+                    if (random->Percent(40)) {
+                        Write(" else ");
+                        if (random->Percent(30)) {
+                            Write("if (");
+                            WriteCondition();
+                            Write(") ");
+                        }
+                        WriteBlock(depth - 1);
+                    }
+                    break;
+                }
+                case 4: {
+                    Write("while (");
+                    WriteCondition();
+                    Write(") ");
+                    WriteBlock(depth - 1);
+                    break;
+                }
+                case 5: {
+                    Write("do ");
+                    WriteBlock(depth - 1);
+                    Write(" while (");
+                    WriteCondition();
+                    Write(");");
+                    break;
+                }
+                case 6: {
+                    Write("for (int i%d = 0; ", depth);
+                    Write("i%d < ", depth);
+                    WriteParenthesized(options->expressionDepth - 1);
+                    Write("; i%d++) ", depth);
+                    WriteBlock(depth - 1);
+                    break;
+                }
+                case 7: {
+                    Write("foreach (");
+                    WriteType(1);
+                    Write(" ");
+                    WriteDeclaredIdentifier("item");
+                    Write(" in ");
+                    WritePrimaryExpression(options->expressionDepth - 1);
+                    Write(") ");
+                    WriteBlock(depth - 1);
+                    break;
+                }
+                case 8: {
+                    Write("switch (");
+                    WriteExpression(options->expressionDepth - 1);
+                    Write(") {\n");
+                    int32 sections = 1 + random->Range(3);
+                    for (int32 i = 0; i < sections; i++) {
+                        indent++;
+                        WriteIndent();
+                        if (i == sections - 1 && random->Percent(50)) {
+                            Write("default:\n");
+                        }
+                        else {
+                            Write("case %d:\n", i);
+                        }
+                        indent++;
+                        WriteStatement(depth - 1);
+                        WriteLine("break;");
+                        indent -= 2;
+                    }
+                    WriteIndent();
+                    Write("}");
+                    break;
+                }
+                case 9: {
+                    Write("try ");
+                    WriteBlock(depth - 1);
+                    if (random->Percent(70)) {
+                        Write(" catch (");
+                        WriteTypeName();
+                        Write(" ");
+                        WriteDeclaredIdentifier("e");
+                        Write(") ");
+                        WriteBlock(depth - 1);
+                    }
+                    else {
+                        Write(" finally ");
+                        WriteBlock(depth - 1);
+                    }
+                    break;
+                }
+                case 10: {
+                    Write("throw new ");
+                    WriteTypeName();
+                    Write("(");
+                    WriteArgumentList(options->expressionDepth - 1);
+                    Write(");");
+                    break;
+                }
+                case 11: {
+                    Write(random->Percent(50) ? "break;" : "continue;");
+                    break;
+                }
+                case 12: {
+                    WriteBlock(depth - 1);
+                    break;
+                }
+                default: {
+                    WriteLocalVariableDeclaration();
+                    Write(";");
+                    break;
+                }
+            }
+
+            Write("\n");
+
+        }
+
+        // formal_parameter_list
+        void WriteParameterList() {
+            Write("(");
+            int32 count = random->Range(4);
+            for (int32 i = 0; i < count; i++) {
+                Write(i == 0 ? "" : ", ");
+                if (random->Percent(10)) {
+                    Write(random->Percent(50) ? "ref " : "out ");
+                }
+                WriteType(2);
+                Write(" p%d", i);
+            }
+            Write(")");
+        }
+
+        void WriteTypeParameterList() {
+            Write("<T");
+            if (random->Percent(40)) {
+                Write(", U");
+            }
+            Write(">");
+        }
+
+        void WriteFieldDeclaration() {
+            WriteIndent();
+            WritePick(kModifiers);
+            if (random->Percent(15)) {
+                Write("const int ");
+                WriteDeclaredIdentifier("Constant");
+                Write(" = %d;\n", random->Range(1000));
+                return;
+            }
+            if (random->Percent(20)) {
+                Write(random->Percent(50) ? "static " : "readonly ");
+            }
+            WriteType(3);
+            Write(" ");
+            WriteDeclaredIdentifier("field");
+            if (random->Percent(40)) {
+                Write(" = ");
+                WriteExpression(options->expressionDepth - 1);
+            }
+            Write(";\n");
+        }
+
+        void WriteMethodDeclaration(bool isInterface) {
+
+            WriteIndent();
+
+            if (!isInterface) {
+                WritePick(kModifiers);
+                int32 extra = random->Range(6);
+                if (extra == 0) {
+                    Write("static ");
+                }
+                else if (extra == 1) {
+                    Write("virtual ");
+                }
+                else if (extra == 2) {
+                    Write("override ");
+                }
+            }
+
+            if (random->Percent(30)) {
+                Write("void ");
+            }
+            else {
+                WriteType(2);
+                Write(" ");
+            }
+
+            WriteDeclaredIdentifier("Method");
+
+            bool isGeneric = random->Percent(20);
+
+            if (isGeneric) {
+                WriteTypeParameterList();
+            }
+
+            WriteParameterList();
+
+            if (isGeneric && random->Percent(50)) {
+                Write(" where T : ");
+                Write(random->Percent(50) ? "class" : "struct");
+            }
+
+            if (isInterface) {
+                Write(";\n");
+                return;
+            }
+
+            if (random->Percent(20)) {
+                Write(" => ");
+                WriteExpression(options->expressionDepth);
+                Write(";\n");
+                return;
+            }
+
+            Write(" ");
+            WriteBlock(options->statementDepth);
+            Write("\n");
+
+        }
+
+        void WritePropertyDeclaration(bool isInterface) {
+            WriteIndent();
+            if (!isInterface) {
+                WritePick(kModifiers);
+            }
+            WriteType(2);
+            Write(" ");
+            WriteDeclaredIdentifier("Property");
+            if (!isInterface && random->Percent(40)) {
+                Write(" => ");
+                WriteExpression(options->expressionDepth - 1);
+                Write(";\n");
+                return;
+            }
+            Write(random->Percent(50) ? " { get; set; }\n" : " { get; }\n");
+        }
+
+        void WriteConstructorDeclaration(const char* typeName, int32 typeIndex) {
+            WriteIndent();
+            Write("public ");
+            Write(typeName);
+            Write("%d", typeIndex);
+            WriteParameterList();
+            Write(" ");
+            WriteBlock(options->statementDepth - 1);
+            Write("\n");
+        }
+
+        void WriteEnumDeclaration() {
+            WriteIndent();
+            WritePick(kModifiers);
+            Write("enum ");
+            WriteDeclaredIdentifier("Kind");
+            Write(" {\n");
+            indent++;
+            int32 count = 1 + random->Range(6);
+            for (int32 i = 0; i < count; i++) {
+                WriteIndent();
+                WritePick(kNames);
+                Write("%d", i);
+                if (random->Percent(30)) {
+                    Write(" = %d", i * 4);
+                }
+                Write(i == count - 1 ? "\n" : ",\n");
+            }
+            indent--;
+            WriteLine("}");
+        }
+
+        // class_definition, struct_definition and interface_definition
+        void WriteTypeDeclaration(int32 typeIndex) {
+
+            int32 kind = random->Range(4);
+
+            if (kind == 3) {
+                WriteEnumDeclaration();
+                Write("\n");
+                return;
+            }
+
+            const char* keyword = kind == 0 ? "class" : kind == 1 ? "struct" : "interface";
+            const char* name = kind == 0 ? "Class" : kind == 1 ? "Struct" : "IThing";
+            bool isInterface = kind == 2;
+
+            WriteIndent();
+            WritePick(kModifiers);
+
+            if (kind == 0 && random->Percent(20)) {
+                Write(random->Percent(50) ? "sealed " : "abstract ");
+            }
+
+            Write(keyword);
+            Write(" ");
+            Write(name);
+            Write("%d", typeIndex);
+
+            bool isGeneric = random->Percent(30);
+
+            if (isGeneric) {
+                WriteTypeParameterList();
+            }
+
+            if (random->Percent(40)) {
+                Write(" : ");
+                WriteTypeName();
+                if (random->Percent(30)) {
+                    Write(", IThing%d", random->Range(10));
+                }
+            }
+
+            if (isGeneric && random->Percent(40)) {
+                Write(" where T : ");
+                WriteTypeName();
+            }
+
+            Write(" {\n\n");
+            indent++;
+
+            for (int32 i = 0; i < options->membersPerType; i++) {
+                int32 member = random->Range(isInterface ? 2 : 5);
+                if (isInterface) {
+                    member++;
+                }
+                switch (member) {
+                    case 0: WriteFieldDeclaration(); break;
+                    case 1: WriteMethodDeclaration(isInterface); break;
+                    case 2: WritePropertyDeclaration(isInterface); break;
+                    case 3: WriteConstructorDeclaration(name, typeIndex); break;
+                    default: WriteMethodDeclaration(false); break;
+                }
+                Write("\n");
+            }
+
+            indent--;
+            WriteLine("}");
+            Write("\n");
+
+        }
+
+        // namespaces are file scoped and their parts are separated by `::`
+        void WriteNamespaceName() {
+            int32 partCount = 1 + random->Range(3);
+            for (int32 i = 0; i < partCount; i++) {
+                Write(i == 0 ? "" : "::");
+                WriteTypeName();
+            }
+        }
+
+        // compilation_unit : using_directives? namespace_declaration? type_declarations? EOF
+        void WriteCompilationUnit() {
+
+            int32 usingCount = random->Range(3);
+            for (int32 i = 0; i < usingCount; i++) {
+                Write("using ");
+                WriteNamespaceName();
+                Write(";\n");
+            }
+
+            if (random->Percent(70)) {
+                Write(usingCount == 0 ? "namespace " : "\nnamespace ");
+                WriteNamespaceName();
+                Write(";\n\n");
+            }
+
+            for (int32 i = 0; i < options->typesPerFile; i++) {
+                WriteTypeDeclaration(i);
+            }
+
+        }
+
+    };
+
+    void GenerateSyntax(const SyntaxOptions& options, CorpusRandom* random, PodList<char>* output) {
+        SyntaxWriter writer;
+        writer.output = output;
+        writer.random = random;
+        writer.options = &options;
+        writer.indent = 0;
+        writer.nameCounter = 0;
+        writer.WriteCompilationUnit();
+    }
+
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "../Src/PrimitiveTypes.h"
+#include "../Src/Collections/PodList.h"
+#include "./CorpusGenerator.h"
+
+namespace Alchemy::Compilation {
+
+    // Unlike the corpus, which is about volume, these cover as much of the grammar as the parser is expected to
+    // accept. Names don't have to resolve, only the syntax has to be valid.
+    struct SyntaxOptions {
+
+        int32 typesPerFile { 3 };
+        int32 membersPerType { 6 };
+        int32 statementsPerBlock { 4 };
+        int32 statementDepth { 3 }; // how deep blocks nest
+        int32 expressionDepth { 4 };
+
+    };
+
+    // appends one compilation unit to output, the parser should take it without a single diagnostic or skipped token
+    void GenerateSyntax(const SyntaxOptions& options, CorpusRandom* random, PodList<char>* output);
+
+}
@@ -187,6 +187,10 @@ function generateKeywordMatch(cppEnumContent, start, end) {
         if(grouped.length > 1) {
             functionBody += `            switch(length) {\n`
         }
+        else {
+            // only one length starts with these two chars, anything longer or shorter is an identifier
+            functionBody += `                    if(length != ${grouped[0].length - "Keyword".length}) return false;\n`;
+        }
 
         grouped.forEach((g) => {
             if(grouped.length > 1) {